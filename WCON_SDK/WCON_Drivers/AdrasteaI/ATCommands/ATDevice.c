@@ -79,7 +79,7 @@ bool AdrasteaI_ATDevice_RequestManufacturerIdentity(AdrasteaI_ATDevice_Manufactu
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -113,7 +113,7 @@ bool AdrasteaI_ATDevice_RequestModelIdentity(AdrasteaI_ATDevice_Model_Identity_t
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -147,14 +147,14 @@ bool AdrasteaI_ATDevice_RequestRevisionIdentity(AdrasteaI_ATDevice_Revision_Iden
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
 		return false;
 	}
 
-	if (!ATCommand_GetNextArgumentString(&pResponseCommand, pResponseCommand, '_', sizeof(AT_commandBuffer)))
+	if (!ATCommand_GetNextArgumentString(&pResponseCommand, pResponseCommand, '_', sizeof(AdrasteaI_commandBuffer)))
 	{
 		return false;
 	}
@@ -191,7 +191,7 @@ bool AdrasteaI_ATDevice_RequestIMEI(AdrasteaI_ATDevice_IMEI_t *imeiP)
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -225,7 +225,7 @@ bool AdrasteaI_ATDevice_RequestIMEISV(AdrasteaI_ATDevice_IMEISV_t *imeisvP)
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -259,7 +259,7 @@ bool AdrasteaI_ATDevice_RequestSVN(AdrasteaI_ATDevice_SVN_t *svnP)
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -293,7 +293,7 @@ bool AdrasteaI_ATDevice_RequestSerialNumber(AdrasteaI_ATDevice_Serial_Number_t *
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -327,7 +327,7 @@ bool AdrasteaI_ATDevice_GetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t *ch
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -354,16 +354,17 @@ bool AdrasteaI_ATDevice_GetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t *ch
  */
 bool AdrasteaI_ATDevice_SetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t charset)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CSCS=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT+CSCS=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATDevice_Character_Set_Strings[charset], ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, AdrasteaI_ATDevice_Character_Set_Strings[charset], ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -402,7 +403,7 @@ bool AdrasteaI_ATDevice_GetCapabilitiesList(char *capListP, uint8_t maxBufferSiz
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -438,7 +439,7 @@ bool AdrasteaI_ATDevice_GetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functiona
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -468,27 +469,28 @@ bool AdrasteaI_ATDevice_SetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functiona
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CFUN=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT+CFUN=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, phoneFun, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, phoneFun, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (resetType != AdrasteaI_ATDevice_Phone_Functionality_Reset_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, resetType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, resetType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		AdrasteaI_optionalParamsDelimCount = 0;
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -564,16 +566,17 @@ bool AdrasteaI_ATDevice_FactoryReset()
  */
 bool AdrasteaI_ATDevice_SetResultCodeFormat(AdrasteaI_ATDevice_Result_Code_Format_t format)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "ATV");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "ATV");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
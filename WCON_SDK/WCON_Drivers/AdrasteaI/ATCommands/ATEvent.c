@@ -32,37 +32,37 @@
 #include <global/ATCommands.h>
 
 const static ATCommand_Event_t GNSSSubEvents[] = {
+				EVENTENTRY(" \"ALLOWSTAT\"", AdrasteaI_ATEvent_GNSS_Allowed_Status_Change)
 				EVENTENTRY(" \"NMEA\"", AdrasteaI_ATEvent_GNSS_NMEA)
 				EVENTENTRY(" \"SESSIONSTAT\"", AdrasteaI_ATEvent_GNSS_Session_Status_Change)
-				LASTEVENTENTRY(" \"ALLOWSTAT\"", AdrasteaI_ATEvent_GNSS_Allowed_Status_Change)
 		};
 
 const static ATCommand_Event_t MQTTSubEvents[] = {
 				EVENTENTRY("\"CONCONF\"", AdrasteaI_ATEvent_MQTT_Connection_Confirmation)
+				EVENTENTRY("\"CONFAIL\"", AdrasteaI_ATEvent_MQTT_Connection_Failure)
 				EVENTENTRY("\"DISCONF\"", AdrasteaI_ATEvent_MQTT_Disconnection_Confirmation)
-				EVENTENTRY("\"SUBCONF\"", AdrasteaI_ATEvent_MQTT_Subscription_Confirmation)
-				EVENTENTRY("\"UNSCONF\"", AdrasteaI_ATEvent_MQTT_Unsubscription_Confirmation)
 				EVENTENTRY("\"PUBCONF\"", AdrasteaI_ATEvent_MQTT_Publication_Confirmation)
 				EVENTENTRY("\"PUBRCV\"", AdrasteaI_ATEvent_MQTT_Publication_Received)
-				LASTEVENTENTRY("\"CONFAIL\"", AdrasteaI_ATEvent_MQTT_Connection_Failure)
+				EVENTENTRY("\"SUBCONF\"", AdrasteaI_ATEvent_MQTT_Subscription_Confirmation)
+				EVENTENTRY("\"UNSCONF\"", AdrasteaI_ATEvent_MQTT_Unsubscription_Confirmation)
 		};
 
 const static ATCommand_Event_t MQTT_AWSIOTSubEvents[] = {
 				EVENTENTRY("\"CONCONF\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Connection_Confirmation)
+				EVENTENTRY("\"CONFAIL\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Connection_Failure)
 				EVENTENTRY("\"DISCONF\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Disconnection_Confirmation)
-				EVENTENTRY("\"SUBCONF\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Subscription_Confirmation)
-				EVENTENTRY("\"UNSCONF\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Unsubscription_Confirmation)
 				EVENTENTRY("\"PUBCONF\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Publication_Confirmation)
 				EVENTENTRY("\"PUBRCV\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Publication_Received)
-				LASTEVENTENTRY("\"CONFAIL\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Connection_Failure)
+				EVENTENTRY("\"SUBCONF\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Subscription_Confirmation)
+				EVENTENTRY("\"UNSCONF\"", AdrasteaI_ATEvent_MQTT_AWSIOT_Unsubscription_Confirmation)
 		};
 
 const static ATCommand_Event_t HTTPSubEvents[] = {
-				EVENTENTRY("\"PUTCONF\"", AdrasteaI_ATEvent_HTTP_PUT_Confirmation)
-				EVENTENTRY("\"POSTCONF\"", AdrasteaI_ATEvent_HTTP_POST_Confirmation)
 				EVENTENTRY("\"DELCONF\"", AdrasteaI_ATEvent_HTTP_DELETE_Confirmation)
 				EVENTENTRY("\"GETRCV\"", AdrasteaI_ATEvent_HTTP_GET_Receive)
-				LASTEVENTENTRY("\"SESTERM\"", AdrasteaI_ATEvent_HTTP_Session_Termination)
+				EVENTENTRY("\"POSTCONF\"", AdrasteaI_ATEvent_HTTP_POST_Confirmation)
+				EVENTENTRY("\"PUTCONF\"", AdrasteaI_ATEvent_HTTP_PUT_Confirmation)
+				EVENTENTRY("\"SESTERM\"", AdrasteaI_ATEvent_HTTP_Session_Termination)
 		};
 
 const static ATCommand_Event_t SocketSubEvents[] = {
@@ -70,30 +70,30 @@ const static ATCommand_Event_t SocketSubEvents[] = {
 				EVENTENTRY("2", AdrasteaI_ATEvent_Socket_Deactivated_Idle_Timer)
 				EVENTENTRY("3", AdrasteaI_ATEvent_Socket_Terminated_By_Peer)
 				EVENTENTRY("4", AdrasteaI_ATEvent_Socket_New_Socket_Accepted)
-				LASTEVENTENTRY("SOCKETCMD", AdrasteaI_ATEvent_Socket_Sockets_Read)
+				EVENTENTRY("SOCKETCMD", AdrasteaI_ATEvent_Socket_Sockets_Read)
 		};
 
 const static ATCommand_Event_t moduleMainEvents[] = {
-				EVENTENTRY("+COPN", AdrasteaI_ATEvent_NetService_Operator_Read)
-				EVENTENTRY("%PINGCMD", AdrasteaI_ATEvent_Proprietary_Ping_Result)
+				PARENTEVENTENTRY("%AWSIOTEVU", MQTT_AWSIOTSubEvents, ATCOMMAND_ARGUMENT_DELIM)
 				EVENTENTRY("%DNSRSLV", AdrasteaI_ATEvent_Proprietary_Domain_Name_Resolve)
+				PARENTEVENTENTRY("%HTTPEVU", HTTPSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				EVENTENTRY("%IGNSSCEP", AdrasteaI_ATEvent_GNSS_DataFileSaved)
+				PARENTEVENTENTRY("%IGNSSEVU", GNSSSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				EVENTENTRY("%IGNSSINFO", AdrasteaI_ATEvent_GNSS_Satellite_Query)
+				PARENTEVENTENTRY("%MQTTEVU", MQTTSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				EVENTENTRY("%PINGCMD", AdrasteaI_ATEvent_Proprietary_Ping_Result)
+				EVENTENTRY("%SCMNOTIFYEV", AdrasteaI_ATEvent_Ready)
+				EVENTENTRY("%SOCKETCMD", AdrasteaI_ATEvent_Socket_Sockets_Read)
+				PARENTEVENTENTRY("%SOCKETEV", SocketSubEvents, ATCOMMAND_ARGUMENT_DELIM)
 				EVENTENTRY("+CEREG", AdrasteaI_ATEvent_PacketDomain_Network_Registration_Status)
-				EVENTENTRY("+CGDCONT", AdrasteaI_ATEvent_PacketDomain_PDP_Context)
 				EVENTENTRY("+CGACT", AdrasteaI_ATEvent_PacketDomain_PDP_Context_State)
-				EVENTENTRY("%IGNSSINFO", AdrasteaI_ATEvent_GNSS_Satellite_Query)
-				EVENTENTRY("+CMGR", AdrasteaI_ATEvent_SMS_Read_Message)
+				EVENTENTRY("+CGDCONT", AdrasteaI_ATEvent_PacketDomain_PDP_Context)
 				EVENTENTRY("+CMGL", AdrasteaI_ATEvent_SMS_List_Messages)
-				EVENTENTRY("+CMTI", AdrasteaI_ATEvent_SMS_Message_Received)
+				EVENTENTRY("+CMGR", AdrasteaI_ATEvent_SMS_Read_Message)
 				EVENTENTRY("+CMS ERROR", AdrasteaI_ATEvent_SMS_Error)
-				EVENTENTRY("%SOCKETCMD", AdrasteaI_ATEvent_Socket_Sockets_Read)
+				EVENTENTRY("+CMTI", AdrasteaI_ATEvent_SMS_Message_Received)
 				EVENTENTRY("+CNUM", AdrasteaI_ATEvent_SIM_Subscriber_Number)
-				EVENTENTRY("%SCMNOTIFYEV", AdrasteaI_ATEvent_Ready)
-				EVENTENTRY("%IGNSSCEP", AdrasteaI_ATEvent_GNSS_DataFileSaved)
-				PARENTEVENTENTRY("%IGNSSEVU", GNSSSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				PARENTEVENTENTRY("%MQTTEVU", MQTTSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				PARENTEVENTENTRY("%AWSIOTEVU", MQTT_AWSIOTSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				PARENTEVENTENTRY("%HTTPEVU", HTTPSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				LASTPARENTEVENTENTRY("%SOCKETEV", SocketSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				EVENTENTRY("+COPN", AdrasteaI_ATEvent_NetService_Operator_Read)
 		};
 
 /**
@@ -110,7 +110,7 @@ bool AdrasteaI_ATEvent_ParseEventType(char **pAtCommand, AdrasteaI_ATEvent_t *pE
 			ATCOMMAND_EVENT_DELIM,
 			ATCOMMAND_STRING_TERMINATE };
 
-	if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, delimiters, sizeof(delimiters), (uint16_t*) pEvent))
+	if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, ATCOMMAND_EVENT_COUNT(moduleMainEvents), delimiters, sizeof(delimiters), (uint16_t*) pEvent))
 	{
 		*pEvent = AdrasteaI_ATEvent_Invalid;
 		return false;
@@ -95,22 +95,23 @@ bool AdrasteaI_ATGNSS_StartGNSS(AdrasteaI_ATGNSS_Start_Mode_t startMode)
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%IGNSSACT=1,");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSACT=1,");
 
 	if (startMode != AdrasteaI_ATGNSS_Start_Mode_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, startMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, startMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		AdrasteaI_optionalParamsDelimCount = 0;
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -137,16 +138,17 @@ bool AdrasteaI_ATGNSS_StartGNSS(AdrasteaI_ATGNSS_Start_Mode_t startMode)
  */
 bool AdrasteaI_ATGNSS_StartGNSSWithTolerance(AdrasteaI_ATGNSS_Tolerance_t tolerance)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%IGNSSACT=2,");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSACT=2,");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, tolerance, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, tolerance, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -183,7 +185,7 @@ bool AdrasteaI_ATGNSS_ReadGNSSActiveMode(AdrasteaI_ATGNSS_Active_Mode_t *activeM
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -209,24 +211,25 @@ bool AdrasteaI_ATGNSS_SetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t s
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%IGNSSCFG=\"SET\",\"SAT\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSCFG=\"SET\",\"SAT\",");
 
 	for (uint8_t i = 0; i < AdrasteaI_ATGNSS_Satellite_Systems_Strings_NumberOfValues; i++)
 	{
 		if ((satSystems.satSystemsStates & (AdrasteaI_ATGNSS_Runtime_Mode_State_Set << i)) >> i)
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Satellite_Systems_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, AdrasteaI_ATGNSS_Satellite_Systems_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
 		}
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -263,7 +266,7 @@ bool AdrasteaI_ATGNSS_GetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t *
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -316,24 +319,25 @@ bool AdrasteaI_ATGNSS_SetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t nmeaSen
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%IGNSSCFG=\"SET\",\"NMEA\"");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSCFG=\"SET\",\"NMEA\"");
 
 	for (uint8_t i = 0; i < AdrasteaI_ATGNSS_NMEA_Sentences_Strings_NumberOfValues; i++)
 	{
 		if ((nmeaSentences.nmeaSentencesStates & (AdrasteaI_ATGNSS_Runtime_Mode_State_Set << i)) >> i)
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_NMEA_Sentences_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, AdrasteaI_ATGNSS_NMEA_Sentences_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
 		}
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -370,7 +374,7 @@ bool AdrasteaI_ATGNSS_GetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t *nmeaSe
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -431,7 +435,7 @@ bool AdrasteaI_ATGNSS_QueryGNSSSatellites(AdrasteaI_ATGNSS_Satellite_Count_t *sa
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -515,15 +519,16 @@ bool AdrasteaI_ATGNSS_QueryGNSSFix(AdrasteaI_ATGNSS_Fix_Relavancy_t relevancy, A
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
 	switch (relevancy)
 	{
 	case AdrasteaI_ATGNSS_Fix_Relavancy_Current:
-		strcpy(pRequestCommand, "AT%IGNSSINFO=\"FIX\"\r\n");
+		ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSINFO=\"FIX\"\r\n");
 		break;
 	case AdrasteaI_ATGNSS_Fix_Relavancy_Last:
-		strcpy(pRequestCommand, "AT%IGNSSINFO=\"LASTFIX\"\r\n");
+		ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSINFO=\"LASTFIX\"\r\n");
 		break;
 	default:
 		return false;
@@ -535,7 +540,7 @@ bool AdrasteaI_ATGNSS_QueryGNSSFix(AdrasteaI_ATGNSS_Fix_Relavancy_t relevancy, A
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -668,7 +673,7 @@ bool AdrasteaI_ATGNSS_QueryGNSSTTFF(AdrasteaI_ATGNSS_TTFF_t *ttffP)
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -704,7 +709,7 @@ bool AdrasteaI_ATGNSS_QueryGNSSEphemerisStatus(AdrasteaI_ATGNSS_Ephemeris_Status
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -730,21 +735,22 @@ bool AdrasteaI_ATGNSS_QueryGNSSEphemerisStatus(AdrasteaI_ATGNSS_Ephemeris_Status
  */
 bool AdrasteaI_ATGNSS_SetGNSSUnsolicitedNotificationEvents(AdrasteaI_ATGNSS_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%IGNSSEV=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSEV=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, AdrasteaI_ATGNSS_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -841,16 +847,17 @@ bool AdrasteaI_ATGNSS_ParseNMEAEvent(char *pEventArguments, AdrasteaI_ATGNSS_NME
  */
 bool AdrasteaI_ATGNSS_DeleteData(AdrasteaI_ATGNSS_Deletion_Option_t deleteOption)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%IGNSSMEM=\"ERASE\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSMEM=\"ERASE\",");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Deletion_Option_Strings[deleteOption], ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, AdrasteaI_ATGNSS_Deletion_Option_Strings[deleteOption], ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -877,16 +884,17 @@ bool AdrasteaI_ATGNSS_DeleteData(AdrasteaI_ATGNSS_Deletion_Option_t deleteOption
  */
 bool AdrasteaI_ATGNSS_DownloadCEPFile(AdrasteaI_ATGNSS_CEP_Number_of_Days_t numDays)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%IGNSSCEP=\"DLD\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%IGNSSCEP=\"DLD\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, numDays, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, numDays, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -943,7 +951,7 @@ bool AdrasteaI_ATGNSS_QueryCEPFileStatus(AdrasteaI_ATGNSS_CEP_Status_t *status)
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
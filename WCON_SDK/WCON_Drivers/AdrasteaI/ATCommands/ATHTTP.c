@@ -57,28 +57,29 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPCFG=\"NODES\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPCFG=\"NODES\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (username != NULL && password != NULL)
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, password, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, password, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -87,9 +88,9 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
 
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -120,26 +121,27 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
  */
 bool AdrasteaI_ATHTTP_ConfigureTLS(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_TLS_Auth_Mode_t authMode, AdrasteaI_ATCommon_TLS_Profile_ID_t tlsProfileID)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPCFG=\"TLS\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPCFG=\"TLS\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, tlsProfileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, tlsProfileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -176,18 +178,19 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPCFG=\"IP\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPCFG=\"IP\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (sessionID != AdrasteaI_ATHTTP_IP_Session_ID_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -195,7 +198,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -204,7 +207,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 
 	if (ipFormat != AdrasteaI_ATHTTP_IP_Addr_Format_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -212,7 +215,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -221,7 +224,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 
 	if (destPort != AdrasteaI_ATCommon_Port_Number_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, destPort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, destPort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -229,7 +232,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -238,16 +241,16 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 
 	if (sourcePort != AdrasteaI_ATCommon_Port_Number_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, sourcePort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, sourcePort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		AdrasteaI_optionalParamsDelimCount = 0;
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -278,31 +281,32 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
  */
 bool AdrasteaI_ATHTTP_ConfigureFormat(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, AdrasteaI_ATHTTP_Header_Presence_t requestHeader)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPCFG=\"FORMAT\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPCFG=\"FORMAT\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, requestHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, requestHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -331,21 +335,22 @@ bool AdrasteaI_ATHTTP_ConfigureFormat(AdrasteaI_ATHTTP_Profile_ID_t profileID, A
  */
 bool AdrasteaI_ATHTTP_ConfigureTimeout(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATHTTP_Timeout_t timeout)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPCFG=\"TIMEOUT\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPCFG=\"TIMEOUT\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, timeout, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, timeout, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -374,21 +379,22 @@ bool AdrasteaI_ATHTTP_ConfigureTimeout(AdrasteaI_ATHTTP_Profile_ID_t profileID,
  */
 bool AdrasteaI_ATHTTP_SetHTTPUnsolicitedNotificationEvents(AdrasteaI_ATHTTP_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPEV=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPEV=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATHTTP_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, AdrasteaI_ATHTTP_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -406,28 +412,28 @@ bool AdrasteaI_ATHTTP_SetHTTPUnsolicitedNotificationEvents(AdrasteaI_ATHTTP_Even
 	return true;
 }
 
-static bool GETDELETE_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char *headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
+static bool GETDELETE_Common(ATCommand_Builder_t *pRequestBuilder, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char *headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pRequestBuilder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pRequestBuilder, addr, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pRequestBuilder, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (responseHeader != AdrasteaI_ATHTTP_Header_Presence_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(pRequestBuilder, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -435,7 +441,7 @@ static bool GETDELETE_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pRequestBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -446,13 +452,13 @@ static bool GETDELETE_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
 	{
 		for (int i = 0; i < headersCount - 1; i++)
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[i], ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pRequestBuilder, headers[i], ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
 		}
 
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pRequestBuilder, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -460,14 +466,14 @@ static bool GETDELETE_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
 		AdrasteaI_optionalParamsDelimCount = 0;
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(pRequestBuilder, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(pRequestBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!AdrasteaI_SendRequest(pRequestCommand))
+	if (!AdrasteaI_SendRequest(pRequestBuilder->buffer))
 	{
 		return false;
 	}
@@ -497,11 +503,11 @@ static bool GETDELETE_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
  */
 bool AdrasteaI_ATHTTP_GET(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char *headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPCMD=\"GET\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPCMD=\"GET\",");
 
-	return GETDELETE_Common(pRequestCommand, profileID, addr, responseHeader, headers, headersCount);
+	return GETDELETE_Common(&requestCommand, profileID, addr, responseHeader, headers, headersCount);
 }
 
 /**
@@ -521,14 +527,14 @@ bool AdrasteaI_ATHTTP_GET(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATC
  */
 bool AdrasteaI_ATHTTP_DELETE(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char *headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPCMD=\"DELETE\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPCMD=\"DELETE\",");
 
-	return GETDELETE_Common(pRequestCommand, profileID, addr, responseHeader, headers, headersCount);
+	return GETDELETE_Common(&requestCommand, profileID, addr, responseHeader, headers, headersCount);
 }
 
-static bool POSTPUT_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char *body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char *contentType, char *headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
+static bool POSTPUT_Common(ATCommand_Builder_t *pRequestBuilder, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char *body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char *contentType, char *headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
@@ -536,24 +542,24 @@ static bool POSTPUT_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
 			'\r',
 			ATCOMMAND_STRING_TERMINATE };
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pRequestBuilder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, bodySize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pRequestBuilder, bodySize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pRequestBuilder, addr, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (contentType != NULL)
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, contentType, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pRequestBuilder, contentType, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -561,20 +567,20 @@ static bool POSTPUT_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pRequestBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 		AdrasteaI_optionalParamsDelimCount++;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pRequestBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 	AdrasteaI_optionalParamsDelimCount++;
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pRequestBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -584,13 +590,13 @@ static bool POSTPUT_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
 	{
 		for (int i = 0; i < headersCount - 1; i++)
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[i], ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pRequestBuilder, headers[i], ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
 		}
 
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pRequestBuilder, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -598,19 +604,19 @@ static bool POSTPUT_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
 		AdrasteaI_optionalParamsDelimCount = 0;
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(pRequestBuilder, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, crchar, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(pRequestBuilder, crchar, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, body, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(pRequestBuilder, body, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!AdrasteaI_SendRequest(pRequestCommand))
+	if (!AdrasteaI_SendRequest(pRequestBuilder->buffer))
 	{
 		return false;
 	}
@@ -644,11 +650,11 @@ static bool POSTPUT_Common(char *pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
  */
 bool AdrasteaI_ATHTTP_POST(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char *body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char *contentType, char *headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPSEND=\"POST\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPSEND=\"POST\",");
 
-	return POSTPUT_Common(pRequestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount);
+	return POSTPUT_Common(&requestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount);
 }
 
 /**
@@ -672,11 +678,11 @@ bool AdrasteaI_ATHTTP_POST(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_AT
  */
 bool AdrasteaI_ATHTTP_PUT(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char *body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char *contentType, char *headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPSEND=\"PUT\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPSEND=\"PUT\",");
 
-	return POSTPUT_Common(pRequestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount);
+	return POSTPUT_Common(&requestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount);
 }
 
 /**
@@ -740,21 +746,22 @@ bool AdrasteaI_ATHTTP_ReadResponse(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adra
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%HTTPREAD=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%HTTPREAD=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, maxLength, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, maxLength, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -764,9 +771,9 @@ bool AdrasteaI_ATHTTP_ReadResponse(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adra
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
-	memset(pResponseCommand, 0, sizeof(AT_commandBuffer));
+	memset(pResponseCommand, 0, sizeof(AdrasteaI_commandBuffer));
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
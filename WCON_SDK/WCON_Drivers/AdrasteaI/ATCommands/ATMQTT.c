@@ -61,33 +61,34 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCFG=\"NODES\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCFG=\"NODES\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (username != NULL && password != NULL)
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, password, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, password, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -96,9 +97,9 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
 
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -129,26 +130,27 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
  */
 bool AdrasteaI_ATMQTT_ConfigureTLS(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATCommon_TLS_Auth_Mode_t authMode, AdrasteaI_ATCommon_TLS_Profile_ID_t profileID)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCFG=\"TLS\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCFG=\"TLS\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -183,18 +185,19 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCFG=\"IP\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCFG=\"IP\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (sessionID != AdrasteaI_ATMQTT_IP_Session_ID_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -202,7 +205,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -211,7 +214,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 
 	if (ipFormat != AdrasteaI_ATMQTT_IP_Addr_Format_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -219,7 +222,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -228,16 +231,16 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 
 	if (port != AdrasteaI_ATCommon_Port_Number_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, port, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, port, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		AdrasteaI_optionalParamsDelimCount = 0;
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -274,41 +277,42 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
  */
 bool AdrasteaI_ATMQTT_ConfigureWillMessage(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_WILL_Presence_t presence, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topic, char *message)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCFG=\"WILLMSG\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCFG=\"WILLMSG\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, presence, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, presence, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topic, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, topic, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, message, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, message, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -339,31 +343,32 @@ bool AdrasteaI_ATMQTT_ConfigureWillMessage(AdrasteaI_ATMQTT_Conn_ID_t connID, Ad
  */
 bool AdrasteaI_ATMQTT_ConfigureProtocol(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Keep_Alive_t keepAlive, AdrasteaI_ATMQTT_Clean_Session_t cleanSession)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCFG=\"PROTOCOL\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCFG=\"PROTOCOL\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, cleanSession, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, cleanSession, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -392,21 +397,22 @@ bool AdrasteaI_ATMQTT_ConfigureProtocol(AdrasteaI_ATMQTT_Conn_ID_t connID, Adras
  */
 bool AdrasteaI_ATMQTT_SetMQTTUnsolicitedNotificationEvents(AdrasteaI_ATMQTT_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTEV=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTEV=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -630,16 +636,17 @@ bool AdrasteaI_ATMQTT_ParsePublicationReceivedEvent(char *pEventArguments, Adras
  */
 bool AdrasteaI_ATMQTT_Connect(AdrasteaI_ATMQTT_Conn_ID_t connID)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCMD=\"CONNECT\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCMD=\"CONNECT\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -666,16 +673,17 @@ bool AdrasteaI_ATMQTT_Connect(AdrasteaI_ATMQTT_Conn_ID_t connID)
  */
 bool AdrasteaI_ATMQTT_Disconnect(AdrasteaI_ATMQTT_Conn_ID_t connID)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCMD=\"DISCONNECT\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCMD=\"DISCONNECT\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -706,26 +714,27 @@ bool AdrasteaI_ATMQTT_Disconnect(AdrasteaI_ATMQTT_Conn_ID_t connID)
  */
 bool AdrasteaI_ATMQTT_Subscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t QoS, AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCMD=\"SUBSCRIBE\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCMD=\"SUBSCRIBE\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, QoS, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, QoS, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -754,21 +763,22 @@ bool AdrasteaI_ATMQTT_Subscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATM
  */
 bool AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCMD=\"UNSUBSCRIBE\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCMD=\"UNSUBSCRIBE\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -805,41 +815,42 @@ bool AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
  */
 bool AdrasteaI_ATMQTT_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, char *payload, AdrasteaI_ATMQTT_Payload_Size_t payloadSize)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%MQTTCMD=\"PUBLISH\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%MQTTCMD=\"PUBLISH\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, payloadSize + 1, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, payloadSize + 1, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, payload, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, payload, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -870,26 +881,27 @@ bool AdrasteaI_ATMQTT_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQT
  */
 bool AdrasteaI_ATMQTT_AWSIOTConfigureConnection(AdrasteaI_ATCommon_IP_Addr_t url, AdrasteaI_ATCommon_TLS_Profile_ID_t profileID, AdrasteaI_ATMQTT_Client_ID_t clientID)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%AWSIOTCFG=\"CONN\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%AWSIOTCFG=\"CONN\",");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, url, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, url, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -920,13 +932,14 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
 {
 	AdrasteaI_optionalParamsDelimCount = 1;
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%AWSIOTCFG=\"IP\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%AWSIOTCFG=\"IP\",");
 
 	if (sessionID != AdrasteaI_ATMQTT_IP_Session_ID_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -934,7 +947,7 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -943,16 +956,16 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
 
 	if (ipFormat != AdrasteaI_ATMQTT_IP_Addr_Format_Invalid)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		AdrasteaI_optionalParamsDelimCount = 0;
 	}
 
-	pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -981,21 +994,22 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
  */
 bool AdrasteaI_ATMQTT_AWSIOTConfigureProtocol(AdrasteaI_ATMQTT_Keep_Alive_t keepAlive, AdrasteaI_ATMQTT_AWSIOT_QoS_t qos)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%AWSIOTCFG=\"PROTOCOL\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%AWSIOTCFG=\"PROTOCOL\",");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1024,21 +1038,22 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureProtocol(AdrasteaI_ATMQTT_Keep_Alive_t keep
  */
 bool AdrasteaI_ATMQTT_SetAWSIOTUnsolicitedNotificationEvents(AdrasteaI_ATMQTT_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%AWSIOTEV=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%AWSIOTEV=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1229,16 +1244,17 @@ bool AdrasteaI_ATMQTT_AWSIOTDisconnect()
  */
 bool AdrasteaI_ATMQTT_AWSIOTSubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%AWSIOTCMD=\"SUBSCRIBE\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%AWSIOTCMD=\"SUBSCRIBE\",");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1265,16 +1281,17 @@ bool AdrasteaI_ATMQTT_AWSIOTSubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
  */
 bool AdrasteaI_ATMQTT_AWSIOTUnsubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%AWSIOTCMD=\"UNSUBSCRIBE\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%AWSIOTCMD=\"UNSUBSCRIBE\",");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1303,21 +1320,22 @@ bool AdrasteaI_ATMQTT_AWSIOTUnsubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
  */
 bool AdrasteaI_ATMQTT_AWSIOTPublish(AdrasteaI_ATMQTT_Topic_Name_t topicName, char *payload)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT%AWSIOTCMD=\"PUBLISH\",");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT%AWSIOTCMD=\"PUBLISH\",");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, payload, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, payload, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -96,16 +96,17 @@ bool AdrasteaI_ATNetService_ParseOperatorReadEvent(char *pEventArguments, Adrast
  */
 bool AdrasteaI_ATNetService_SetPLMNReadFormat(AdrasteaI_ATNetService_PLMN_Format_t format)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+COPS=3,");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT+COPS=3,");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -147,11 +148,12 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 	{
 		AdrasteaI_optionalParamsDelimCount = 1;
 
-		char *pRequestCommand = AT_commandBuffer;
+		char *pRequestCommand = AdrasteaI_commandBuffer;
+		ATCommand_Builder_t requestCommand;
 
-		strcpy(pRequestCommand, "AT+COPS=1,");
+		ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT+COPS=1,");
 
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, plmn.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, plmn.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -161,7 +163,7 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 		case AdrasteaI_ATNetService_PLMN_Format_Short_AlphaNumeric:
 		case AdrasteaI_ATNetService_PLMN_Format_Long_AlphaNumeric:
 		{
-			if (!ATCommand_AppendArgumentString(pRequestCommand, plmn.operator.operatorString, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, plmn.operator.operatorString, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -170,7 +172,7 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 		}
 		case AdrasteaI_ATNetService_PLMN_Format_Numeric:
 		{
-			if (!ATCommand_AppendArgumentIntQuotationMarks(pRequestCommand, plmn.operator.operatorNumeric, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentIntQuotationMarks(&requestCommand, plmn.operator.operatorNumeric, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -184,7 +186,7 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 
 		if (plmn.accessTechnology != AdrasteaI_ATCommon_AcT_Invalid)
 		{
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, plmn.accessTechnology, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, plmn.accessTechnology, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -192,9 +194,9 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 
 		}
 
-		pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+		ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -247,7 +249,7 @@ bool AdrasteaI_ATNetService_ReadPLMN(AdrasteaI_ATNetService_PLMN_t *plmnP)
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -343,7 +345,7 @@ bool AdrasteaI_ATNetService_ReadSignalQuality(AdrasteaI_ATNetService_Signal_Qual
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -384,7 +386,7 @@ bool AdrasteaI_ATNetService_ReadExtendedSignalQuality(AdrasteaI_ATNetService_Ext
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -445,7 +447,7 @@ bool AdrasteaI_ATNetService_ReadPowerSavingMode(AdrasteaI_ATNetService_Power_Sav
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -493,15 +495,16 @@ bool AdrasteaI_ATNetService_ReadPowerSavingMode(AdrasteaI_ATNetService_Power_Sav
  */
 bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Saving_Mode_t psm)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CPSMS=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT+CPSMS=");
 
 	switch (psm.state)
 	{
 	case AdrasteaI_ATNetService_Power_Saving_Mode_State_Disable:
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, AdrasteaI_ATNetService_Power_Saving_Mode_State_Disable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, AdrasteaI_ATNetService_Power_Saving_Mode_State_Disable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -510,27 +513,27 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
 	}
 	case AdrasteaI_ATNetService_Power_Saving_Mode_State_Enable:
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, AdrasteaI_ATNetService_Power_Saving_Mode_State_Enable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, AdrasteaI_ATNetService_Power_Saving_Mode_State_Enable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, psm.periodicTAU.periodicTAU, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentBitsQuotationMarks(&requestCommand, psm.periodicTAU.periodicTAU, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, psm.activeTime.activeTime, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentBitsQuotationMarks(&requestCommand, psm.activeTime.activeTime, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -543,7 +546,7 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
 		break;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -572,16 +575,17 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
  */
 bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX_Mode_t mode, AdrasteaI_ATNetService_eDRX_t edrx)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = AdrasteaI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CEDRXS=");
+	ATCommand_BuilderInit(&requestCommand, AdrasteaI_commandBuffer, sizeof(AdrasteaI_commandBuffer), "AT+CEDRXS=");
 
 	switch (mode)
 	{
 	case AdrasteaI_ATNetService_eDRX_Mode_Disable:
 	case AdrasteaI_ATNetService_eDRX_Mode_Disable_Reset:
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -593,14 +597,14 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
 	{
 		AdrasteaI_optionalParamsDelimCount = 1;
 
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
 		if (edrx.AcT > AdrasteaI_ATNetService_eDRX_AcT_NotUsingeDRX)
 		{
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, edrx.AcT, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, edrx.AcT, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -608,7 +612,7 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
 		}
 		else
 		{
-			if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -617,14 +621,14 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
 
 		if (edrx.requestedValue != AdrasteaI_ATNetService_eDRX_Value_Invalid)
 		{
-			if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, edrx.requestedValue, (ATCOMMAND_INTFLAGS_SIZE8 ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentBitsQuotationMarks(&requestCommand, edrx.requestedValue, (ATCOMMAND_INTFLAGS_SIZE8 ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			AdrasteaI_optionalParamsDelimCount = 0;
 		}
 
-		pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+		ATCommand_BuilderRemoveTrailing(&requestCommand, AdrasteaI_optionalParamsDelimCount);
 
 		break;
 
@@ -635,7 +639,7 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
 		break;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -672,7 +676,7 @@ bool AdrasteaI_ATNetService_ReadeDRXDynamicParameters(AdrasteaI_ATNetService_eDR
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -745,7 +749,7 @@ bool AdrasteaI_ATNetService_ReadCoverageEnhancementStatus(AdrasteaI_ATNetService
 		return false;
 	}
 
-	char *pResponseCommand = AT_commandBuffer;
+	char *pResponseCommand = AdrasteaI_commandBuffer;
 
 	if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
 	{
@@ -37,6 +37,9 @@
 
 static void AdrasteaI_HandleRxByte(uint8_t *dataP, size_t size);
 static void AdrasteaI_HandleRxLine(char *rxPacket, uint16_t rxLength);
+static void AdrasteaI_AppendRxByte(uint8_t receivedByte);
+static void AdrasteaI_CompleteRxLine();
+static void AdrasteaI_HandleRxBufferFull();
 static WE_UART_HandleRxByte_t byteRxCallback = AdrasteaI_HandleRxByte;
 
 /**
@@ -70,9 +73,17 @@ static char AdrasteaI_pendingCommandName[64] = {
 		0 };
 
 /**
- * @brief Length of AdrasteaI_pendingCommandName.
+ * @brief Name of the pending command (points to AdrasteaI_pendingCommandName or to a
+ * name supplied to AdrasteaI_SendRequestWithCommandName()).
  */
-static size_t AdrasteaI_pendingCommandNameLength = 0;
+static ATCommand_CommandName_t AdrasteaI_pendingCommand = {
+		NULL,
+		0 };
+
+/**
+ * @brief Buffer used for assembling commands and storing responses.
+ */
+char AdrasteaI_commandBuffer[ADRASTEAI_COMMAND_BUFFER_SIZE];
 
 /**
  * @brief Buffer used for current response text.
@@ -107,6 +118,24 @@ static uint16_t AdrasteaI_rxByteCounter = 0;
  */
 static bool AdrasteaI_eolChar1Found = false;
 
+/**
+ * @brief Is set if the current line didn't fit into the receive buffer and is
+ * passed to AdrasteaI_lineFragmentRxCallback in fragments.
+ */
+static bool AdrasteaI_rxLineFragmented = false;
+
+/**
+ * @brief Is set if the current line didn't fit into the receive buffer and is
+ * discarded (because no line fragment callback has been set).
+ */
+static bool AdrasteaI_rxLineDiscarded = false;
+
+/**
+ * @brief Optional callback function which receives lines that don't fit into the receive buffer.
+ * @see AdrasteaI_SetLineFragmentRxCallback()
+ */
+static AdrasteaI_LineFragmentRxCallback_t AdrasteaI_lineFragmentRxCallback = NULL;
+
 /**
  * @brief First EOL character expected for responses received from Adrastea.
  * @see AdrasteaI_eolChar2, AdrasteaI_twoEolCharacters, AdrasteaI_SetEolCharacters()
@@ -137,14 +166,20 @@ static bool AdrasteaI_responseincoming = false;
 static volatile AdrasteaI_ATMode_t AdrasteaI_ATMode = AdrasteaI_ATMode_Off;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from Adrastea.
+ * @brief Max. time (microseconds) to sleep between checks when waiting for responses from Adrastea.
  *
- * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+ * Waiting ends as soon as a line has been received (see AdrasteaI_lineReceived). If set to 0, the
+ * driver polls for responses without sleeping.
  *
  * @see AdrasteaI_SetTimingParameters
  */
 static uint32_t AdrasteaI_waitTimeStepUsec = 5 * 1000;
 
+/**
+ * @brief Is set when a line has been received from Adrastea (used to wake up AdrasteaI_WaitForConfirm()).
+ */
+static volatile bool AdrasteaI_lineReceived = false;
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to Adrastea
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -379,6 +414,24 @@ bool AdrasteaI_PinWakeUp(void)
  * @return true if successful, false otherwise
  */
 bool AdrasteaI_SendRequest(char *data)
+{
+	return AdrasteaI_SendRequestWithCommandName(data, NULL);
+}
+
+/**
+ * @brief Sends the supplied AT command to the module
+ *
+ * Same as AdrasteaI_SendRequest(), but the name of the command (which is used for
+ * assigning responses to the request) is supplied by the caller instead of being
+ * extracted from the command.
+ *
+ * @param[in] data AT command to send. Note that the command has to end with "\r\n\0".
+ * @param[in] commandName Name of the command (see ATCOMMAND_COMMAND_NAME()). Must stay valid
+ *            until the next request is sent. If NULL, the name is extracted from the command.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_SendRequestWithCommandName(char *data, const ATCommand_CommandName_t *commandName)
 {
 	if (AdrasteaI_executingEventCallback)
 	{
@@ -400,33 +453,41 @@ bool AdrasteaI_SendRequest(char *data)
 
 	size_t dataLength = strlen(data);
 
-	char delimiters[] = {
-			ATCOMMAND_COMMAND_DELIM,
-			'?',
-			'\r' };
-
-	/* Get command name from request string (remove prefix "AT+" and parameters) */
-	AdrasteaI_pendingCommandName[0] = '\0';
-	AdrasteaI_pendingCommandNameLength = 0;
-	if (dataLength > 2 && data[0] == 'A' && data[1] == 'T')
+	if (NULL != commandName)
 	{
-		char *pData;
-		if (dataLength > 3 && (data[2] == '+' || data[2] == '%'))
-		{
-			pData = data + 3;
-		}
-		else
-		{
-			pData = data + 2;
-		}
-		if (ATCommand_GetCmdName(&pData, AdrasteaI_pendingCommandName, sizeof(AdrasteaI_pendingCommandName), delimiters, sizeof(delimiters)))
+		AdrasteaI_pendingCommand = *commandName;
+	}
+	else
+	{
+		char delimiters[] = {
+				ATCOMMAND_COMMAND_DELIM,
+				'?',
+				'\r' };
+
+		/* Get command name from request string (remove prefix "AT+" and parameters) */
+		AdrasteaI_pendingCommandName[0] = '\0';
+		AdrasteaI_pendingCommand.name = AdrasteaI_pendingCommandName;
+		AdrasteaI_pendingCommand.length = 0;
+		if (dataLength > 2 && data[0] == 'A' && data[1] == 'T')
 		{
-			AdrasteaI_pendingCommandNameLength = strlen(AdrasteaI_pendingCommandName);
+			char *pData;
+			if (dataLength > 3 && (data[2] == '+' || data[2] == '%'))
+			{
+				pData = data + 3;
+			}
+			else
+			{
+				pData = data + 2;
+			}
+			if (ATCommand_GetCmdName(&pData, AdrasteaI_pendingCommandName, sizeof(AdrasteaI_pendingCommandName), delimiters, sizeof(delimiters)))
+			{
+				AdrasteaI_pendingCommand.length = (uint8_t) strlen(AdrasteaI_pendingCommandName);
+			}
 		}
 	}
 
 #ifdef WE_DEBUG
-	printf("> %s", data);
+	WE_LOG("> %s", data);
 #endif
 
 	AdrasteaI_Transparent_Transmit(data, dataLength);
@@ -469,6 +530,9 @@ bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expected
 
 	while (1)
 	{
+		/* Reset flag before checking, so that a line received in the meantime is not missed */
+		AdrasteaI_lineReceived = false;
+
 		if (AdrasteaI_CNFStatus_Invalid != AdrasteaI_cmdConfirmStatus)
 		{
 			/* Store current time to enable check for min. time between received confirm and next command. */
@@ -490,8 +554,8 @@ bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expected
 			}
 		}
 
-		uint32_t now = WE_GetTick();
-		if (now - t0 > maxTimeMs)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= maxTimeMs)
 		{
 			/* Timeout */
 			break;
@@ -499,7 +563,9 @@ bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expected
 
 		if (AdrasteaI_waitTimeStepUsec > 0)
 		{
-			WE_DelayMicroseconds(AdrasteaI_waitTimeStepUsec);
+			/* Sleep until the next line has been received (but not longer than one time step) */
+			uint32_t timeStepMs = (AdrasteaI_waitTimeStepUsec + 999) / 1000;
+			WE_WaitForEvent(&AdrasteaI_lineReceived, (maxTimeMs - elapsed < timeStepMs) ? maxTimeMs - elapsed : timeStepMs);
 		}
 	}
 
@@ -563,7 +629,7 @@ void AdrasteaI_CheckResponseComplete()
  *
  * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
  *
- * @param[in] waitTimeStepUsec Time step (microseconds) when waiting for responses from Adrastea.
+ * @param[in] waitTimeStepUsec Max. time (microseconds) to sleep between checks when waiting for responses from Adrastea (0 = poll without sleeping).
  * @param[in] minCommandIntervalUsec Minimum interval (microseconds) between subsequent commands sent to Adrastea.
  *
  * @return true if successful, false otherwise
@@ -611,7 +677,7 @@ static void AdrasteaI_HandleRxByte(uint8_t *dataP, size_t size)
 	for (; size > 0; size--, dataP++)
 	{
 		receivedByte = *dataP;
-		if (receivedByte == AdrasteaI_eolChar1 && AdrasteaI_rxByteCounter == 0)
+		if (receivedByte == AdrasteaI_eolChar1 && AdrasteaI_rxByteCounter == 0 && !AdrasteaI_rxLineFragmented && !AdrasteaI_rxLineDiscarded)
 		{
 			continue;
 		}
@@ -621,13 +687,6 @@ static void AdrasteaI_HandleRxByte(uint8_t *dataP, size_t size)
 			continue;
 		}
 
-		if (AdrasteaI_rxByteCounter >= ADRASTEAI_LINE_MAX_SIZE)
-		{
-			AdrasteaI_rxByteCounter = 0;
-			AdrasteaI_eolChar1Found = false;
-			return;
-		}
-
 		if (receivedByte == AdrasteaI_eolChar1)
 		{
 			AdrasteaI_eolChar1Found = true;
@@ -642,19 +701,14 @@ static void AdrasteaI_HandleRxByte(uint8_t *dataP, size_t size)
 			{
 				if (AdrasteaI_responseSkip.lineskip == 0)
 				{
-					AdrasteaI_rxBuffer[AdrasteaI_rxByteCounter] = '\0';
-					AdrasteaI_rxByteCounter++;
-					AdrasteaI_HandleRxLine(AdrasteaI_rxBuffer, AdrasteaI_rxByteCounter);
-					AdrasteaI_eolChar1Found = false;
-					AdrasteaI_rxByteCounter = 0;
+					AdrasteaI_CompleteRxLine();
 					AdrasteaI_shouldCheckResponseSkip = true;
 				}
 				else
 				{
 					AdrasteaI_responseSkip.lineskip -= 1;
 					AdrasteaI_eolChar1Found = false;
-					AdrasteaI_rxBuffer[AdrasteaI_rxByteCounter] = AdrasteaI_responseSkip.delim;
-					AdrasteaI_rxByteCounter++;
+					AdrasteaI_AppendRxByte(AdrasteaI_responseSkip.delim);
 				}
 			}
 		}
@@ -665,27 +719,88 @@ static void AdrasteaI_HandleRxByte(uint8_t *dataP, size_t size)
 				if (AdrasteaI_responseSkip.lineskip == 0)
 				{
 					/* Interpret it now */
-					AdrasteaI_rxBuffer[AdrasteaI_rxByteCounter] = '\0';
-					AdrasteaI_rxByteCounter++;
-					AdrasteaI_HandleRxLine(AdrasteaI_rxBuffer, AdrasteaI_rxByteCounter);
-					AdrasteaI_eolChar1Found = false;
-					AdrasteaI_rxByteCounter = 0;
+					AdrasteaI_CompleteRxLine();
 					AdrasteaI_shouldCheckResponseSkip = true;
 				}
 				else
 				{
 					AdrasteaI_responseSkip.lineskip -= 1;
 					AdrasteaI_eolChar1Found = false;
-					AdrasteaI_rxBuffer[AdrasteaI_rxByteCounter] = AdrasteaI_responseSkip.delim;
-					AdrasteaI_rxByteCounter++;
+					AdrasteaI_AppendRxByte(AdrasteaI_responseSkip.delim);
 				}
 			}
 		}
 		else
 		{
-			AdrasteaI_rxBuffer[AdrasteaI_rxByteCounter++] = receivedByte;
+			AdrasteaI_AppendRxByte(receivedByte);
+		}
+	}
+}
+
+/**
+ * @brief Appends a byte to the line stored in the receive buffer.
+ *
+ * @param[in] receivedByte Byte to append
+ */
+static void AdrasteaI_AppendRxByte(uint8_t receivedByte)
+{
+	if (AdrasteaI_rxByteCounter >= ADRASTEAI_LINE_MAX_SIZE - 1)
+	{
+		/* Line doesn't fit into the receive buffer (last byte is reserved for termination character) */
+		AdrasteaI_HandleRxBufferFull();
+	}
+	if (!AdrasteaI_rxLineDiscarded)
+	{
+		AdrasteaI_rxBuffer[AdrasteaI_rxByteCounter++] = receivedByte;
+	}
+}
+
+/**
+ * @brief Is called when the end of a line has been received.
+ *
+ * Passes the line to AdrasteaI_HandleRxLine() or, if the line didn't fit into the receive
+ * buffer, passes its last fragment to the line fragment callback. Resets the receive buffer.
+ */
+static void AdrasteaI_CompleteRxLine()
+{
+	if (AdrasteaI_rxLineFragmented)
+	{
+		if (NULL != AdrasteaI_lineFragmentRxCallback)
+		{
+			AdrasteaI_lineFragmentRxCallback(AdrasteaI_rxBuffer, AdrasteaI_rxByteCounter, false, true);
 		}
 	}
+	else if (!AdrasteaI_rxLineDiscarded)
+	{
+		AdrasteaI_rxBuffer[AdrasteaI_rxByteCounter] = '\0';
+		AdrasteaI_rxByteCounter++;
+		AdrasteaI_HandleRxLine(AdrasteaI_rxBuffer, AdrasteaI_rxByteCounter);
+	}
+	AdrasteaI_lineReceived = true;
+	AdrasteaI_eolChar1Found = false;
+	AdrasteaI_rxLineFragmented = false;
+	AdrasteaI_rxLineDiscarded = false;
+	AdrasteaI_rxByteCounter = 0;
+}
+
+/**
+ * @brief Is called when the receive buffer is full before the end of the current line has been received.
+ *
+ * Passes the buffered data to the line fragment callback (if set), otherwise the
+ * rest of the line is discarded.
+ */
+static void AdrasteaI_HandleRxBufferFull()
+{
+	if (NULL != AdrasteaI_lineFragmentRxCallback)
+	{
+		AdrasteaI_lineFragmentRxCallback(AdrasteaI_rxBuffer, AdrasteaI_rxByteCounter, !AdrasteaI_rxLineFragmented, false);
+		AdrasteaI_rxLineFragmented = true;
+	}
+	else
+	{
+		AdrasteaI_rxLineDiscarded = true;
+	}
+	AdrasteaI_rxByteCounter = 0;
 }
 
 /**
@@ -697,7 +812,7 @@ static void AdrasteaI_HandleRxByte(uint8_t *dataP, size_t size)
 static void AdrasteaI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 {
 #ifdef WE_DEBUG
-	printf("< %s\r\n", rxPacket);
+	WE_LOG("< %s\r\n", rxPacket);
 #endif
 
 	if (AdrasteaI_requestPending)
@@ -735,10 +850,10 @@ static void AdrasteaI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 				uint16_t chunkLength = rxLength;
 				bool isevent = false;
 
-				if (AdrasteaI_currentResponseLength == 0 && rxLength > (AdrasteaI_pendingCommandNameLength + 2) && (0 == strncmp(AdrasteaI_pendingCommandName, rxPacket + 1, AdrasteaI_pendingCommandNameLength)))
+				if (AdrasteaI_currentResponseLength == 0 && rxLength > (AdrasteaI_pendingCommand.length + 2) && ATCommand_MatchCommandName(&AdrasteaI_pendingCommand, rxPacket + 1, rxLength - 1, false))
 				{
 					isevent = true;
-					chunkLength -= (AdrasteaI_pendingCommandNameLength + 2);
+					chunkLength -= (AdrasteaI_pendingCommand.length + 2);
 				}
 
 				if (AdrasteaI_currentResponseLength + chunkLength >= ADRASTEAI_MAX_RESPONSE_TEXT_LENGTH)
@@ -750,7 +865,7 @@ static void AdrasteaI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 				{
 					if (isevent)
 					{
-						memcpy(&AdrasteaI_currentResponseText[AdrasteaI_currentResponseLength], AdrasteaI_rxBuffer + AdrasteaI_pendingCommandNameLength + 2, chunkLength);
+						memcpy(&AdrasteaI_currentResponseText[AdrasteaI_currentResponseLength], AdrasteaI_rxBuffer + AdrasteaI_pendingCommand.length + 2, chunkLength);
 					}
 					else
 					{
@@ -763,7 +878,7 @@ static void AdrasteaI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 				}
 				AdrasteaI_currentResponseLength += chunkLength;
 			}
-			else if (rxLength < ADRASTEAI_LINE_MAX_SIZE && rxLength > 2 && AdrasteaI_pendingCommandName[0] != '\0' && 'A' == rxPacket[0] && 'T' == rxPacket[1] && ((('+' == rxPacket[2] || '%' == rxPacket[2]) && (0 == strncmp(AdrasteaI_pendingCommandName, AdrasteaI_rxBuffer + 3, AdrasteaI_pendingCommandNameLength))) || (0 == strncmp(AdrasteaI_pendingCommandName, AdrasteaI_rxBuffer + 2, AdrasteaI_pendingCommandNameLength))))
+			else if (rxLength < ADRASTEAI_LINE_MAX_SIZE && rxLength > 2 && 'A' == rxPacket[0] && 'T' == rxPacket[1] && ((('+' == rxPacket[2] || '%' == rxPacket[2]) && ATCommand_MatchCommandName(&AdrasteaI_pendingCommand, AdrasteaI_rxBuffer + 3, rxLength - 3, false)) || ATCommand_MatchCommandName(&AdrasteaI_pendingCommand, AdrasteaI_rxBuffer + 2, rxLength - 2, false)))
 			{
 				//if true command echo detected store response for lines after
 				AdrasteaI_responseincoming = true;
@@ -813,6 +928,20 @@ void AdrasteaI_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacter
 	AdrasteaI_twoEolCharacters = twoEolCharacters;
 }
 
+/**
+ * @brief Sets an optional callback function which receives lines that don't fit into the receive buffer.
+ *
+ * Lines exceeding ADRASTEAI_LINE_MAX_SIZE (e.g. responses containing large amounts of data) are
+ * passed to this callback in fragments instead of being processed by the driver. The callback
+ * is executed in the context of the rx byte handler. If no callback is set, such lines are discarded.
+ *
+ * @param[in] callback Pointer to line fragment received callback function (may be NULL)
+ */
+void AdrasteaI_SetLineFragmentRxCallback(AdrasteaI_LineFragmentRxCallback_t callback)
+{
+	AdrasteaI_lineFragmentRxCallback = callback;
+}
+
 /**
  * @brief Check if module is in at command mode
  *
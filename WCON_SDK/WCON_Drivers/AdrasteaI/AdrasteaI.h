@@ -36,6 +36,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <global/global_types.h>
+#include <global/ATCommands.h>
 
 /**
  * @brief Max recommended payload size is 1460 bytes.
@@ -53,6 +54,20 @@
  */
 #define ADRASTEAI_MAX_RESPONSE_TEXT_LENGTH ADRASTEAI_LINE_MAX_SIZE
 
+/**
+ * @brief Size of the buffer used for assembling the commands sent to AdrasteaI and for
+ * storing the responses to these commands (see AdrasteaI_commandBuffer).
+ *
+ * May be defined by the application, must not be smaller than ADRASTEAI_MAX_RESPONSE_TEXT_LENGTH.
+ */
+#ifndef ADRASTEAI_COMMAND_BUFFER_SIZE
+#define ADRASTEAI_COMMAND_BUFFER_SIZE ADRASTEAI_LINE_MAX_SIZE
+#endif
+
+#if ADRASTEAI_COMMAND_BUFFER_SIZE < ADRASTEAI_MAX_RESPONSE_TEXT_LENGTH
+#error "ADRASTEAI_COMMAND_BUFFER_SIZE must not be smaller than ADRASTEAI_MAX_RESPONSE_TEXT_LENGTH"
+#endif
+
 #define ADRASTEAI_RESPONSE_OK     "OK"                       /**< String sent by module if AT command was successful */
 #define ADRASTEAI_RESPONSE_ERROR  "ERROR"                    /**< String sent by module if AT command failed */
 #define ADRASTEAI_SMS_ERROR  "+CMS ERROR"                    /**< String sent by module if SMS AT command failed */
@@ -134,8 +149,31 @@ typedef struct AdrasteaI_Response_Complete_t
  */
 typedef void (*AdrasteaI_EventCallback_t)(char*);
 
+/**
+ * @brief AdrasteaI line fragment received callback.
+ *
+ * Receives lines that don't fit into the receive buffer of the driver (ADRASTEAI_LINE_MAX_SIZE),
+ * e.g. responses containing large amounts of data. Such lines are not processed by the
+ * driver, but are passed to this callback in fragments as they are received.
+ *
+ * Arguments: Fragment text (not null-terminated), length of fragment,
+ *            true if first fragment of line, true if last fragment of line
+ *
+ * @see AdrasteaI_SetLineFragmentRxCallback()
+ */
+typedef void (*AdrasteaI_LineFragmentRxCallback_t)(const char*, uint16_t, bool, bool);
+
 extern uint8_t AdrasteaI_optionalParamsDelimCount;
 
+/**
+ * @brief Buffer used by the AdrasteaI driver for assembling commands and storing responses.
+ *
+ * Is owned by the AdrasteaI driver, so commands for other modules can be assembled at the
+ * same time. Commands may also be assembled in a buffer supplied by the caller
+ * (see ATCommand_BuilderInit()) and sent using AdrasteaI_SendRequest().
+ */
+extern char AdrasteaI_commandBuffer[ADRASTEAI_COMMAND_BUFFER_SIZE];
+
 extern bool AdrasteaI_Init(WE_UART_t *uartP, AdrasteaI_Pins_t *pinoutP, AdrasteaI_EventCallback_t eventCallback);
 extern bool AdrasteaI_Deinit(void);
 
@@ -143,6 +181,7 @@ extern bool AdrasteaI_PinReset(void);
 extern bool AdrasteaI_PinWakeUp(void);
 
 extern bool AdrasteaI_SendRequest(char *data);
+extern bool AdrasteaI_SendRequestWithCommandName(char *data, const ATCommand_CommandName_t *commandName);
 extern bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expectedStatus, char *pOutResponse);
 
 extern bool AdrasteaI_SetTimingParameters(uint32_t waitTimeStepMicroseconds, uint32_t minCommandIntervalMicroseconds);
@@ -151,6 +190,7 @@ extern uint32_t AdrasteaI_GetTimeout(AdrasteaI_Timeout_t type);
 
 extern bool AdrasteaI_Transparent_Transmit(const char *data, uint16_t dataLength);
 extern void AdrasteaI_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacters);
+extern void AdrasteaI_SetLineFragmentRxCallback(AdrasteaI_LineFragmentRxCallback_t callback);
 extern AdrasteaI_ATMode_t AdrasteaI_CheckATMode();
 
 #ifdef __cplusplus
@@ -117,8 +117,8 @@ static const char *Calypso_ATDevice_StatusFlagsStrings[Calypso_ATDevice_StatusFl
 
 static bool Calypso_ATDevice_IsInputValidATget(Calypso_ATDevice_GetId_t id, uint8_t option);
 static bool Calypso_ATDevice_IsInputValidATset(Calypso_ATDevice_GetId_t id, uint8_t option);
-static bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t option);
-static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uint8_t option, Calypso_ATDevice_Value_t *pValue);
+static bool Calypso_ATDevice_AddArgumentsATget(ATCommand_Builder_t *pAtCommand, uint8_t id, uint8_t option);
+static bool Calypso_ATDevice_AddArgumentsATset(ATCommand_Builder_t *pAtCommand, uint8_t id, uint8_t option, Calypso_ATDevice_Value_t *pValue);
 static bool Calypso_ATDevice_ParseResponseATget(uint8_t id, uint8_t option, char *pAtCommand, Calypso_ATDevice_Value_t *pValue);
 
 /**
@@ -165,14 +165,17 @@ bool Calypso_ATDevice_Stop(uint32_t timeoutMs)
 		return false;
 	}
 
-	char cmdToSend[32] = "AT+stop=";
+	char cmdToSend[32];
+	ATCommand_Builder_t requestCommand;
 
-	if (!ATCommand_IntToString(&cmdToSend[strlen(cmdToSend)], timeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC )))
+	ATCommand_BuilderInit(&requestCommand, cmdToSend, sizeof(cmdToSend), "AT+stop=");
+
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, timeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(cmdToSend, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -252,14 +255,17 @@ bool Calypso_ATDevice_Sleep(uint32_t timeoutSeconds)
 		return false;
 	}
 
-	char cmdToSend[32] = "AT+sleep=";
+	char cmdToSend[32];
+	ATCommand_Builder_t requestCommand;
+
+	ATCommand_BuilderInit(&requestCommand, cmdToSend, sizeof(cmdToSend), "AT+sleep=");
 
-	if (!ATCommand_IntToString(&cmdToSend[strlen(cmdToSend)], timeoutSeconds, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC )))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, timeoutSeconds, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(cmdToSend, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -302,12 +308,13 @@ bool Calypso_ATDevice_Get(Calypso_ATDevice_GetId_t id, uint8_t option, Calypso_A
 	{
 		return false;
 	}
-	char *pRequestCommand = AT_commandBuffer;
-	char *pResponseCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pResponseCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+get=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+get=");
 
-	if (!Calypso_ATDevice_AddArgumentsATget(&pRequestCommand[strlen(pRequestCommand)], id, option))
+	if (!Calypso_ATDevice_AddArgumentsATget(&requestCommand, id, option))
 	{
 		return false;
 	}
@@ -369,11 +376,12 @@ bool Calypso_ATDevice_Set(Calypso_ATDevice_GetId_t id, uint8_t option, Calypso_A
 	{
 		return false;
 	}
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+set=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+set=");
 
-	if (!Calypso_ATDevice_AddArgumentsATset(&pRequestCommand[strlen(pRequestCommand)], id, option, pValue))
+	if (!Calypso_ATDevice_AddArgumentsATset(&requestCommand, id, option, pValue))
 	{
 		return false;
 	}
@@ -476,9 +484,9 @@ bool Calypso_ATDevice_IsInputValidATget(Calypso_ATDevice_GetId_t id, uint8_t opt
  * @param[in] option The option to add
  * @return true if arguments were added successfully, false otherwise
  */
-bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t option)
+bool Calypso_ATDevice_AddArgumentsATget(ATCommand_Builder_t *pAtCommand, uint8_t id, uint8_t option)
 {
-	if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -487,7 +495,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t op
 	{
 	case Calypso_ATDevice_GetId_Status:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetStatusStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetStatusStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -495,7 +503,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t op
 	}
 	case Calypso_ATDevice_GetId_General:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -503,7 +511,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t op
 	}
 	case Calypso_ATDevice_GetId_IOT:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIotStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIotStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -511,7 +519,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t op
 	}
 	case Calypso_ATDevice_GetId_UART:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetUartStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetUartStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -519,7 +527,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t op
 	}
 	case Calypso_ATDevice_GetId_TransparentMode:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -527,7 +535,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t op
 	}
 	case Calypso_ATDevice_GetId_GPIO:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGPIOStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGPIOStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -539,7 +547,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char *pAtCommand, uint8_t id, uint8_t op
 	}
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -986,11 +994,11 @@ static bool Calypso_ATDevice_IsInputValidATset(Calypso_ATDevice_GetId_t id, uint
  * @param[out] pValues Parsed values
  * @return true if arguments were added successful, false otherwise
  */
-static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uint8_t option, Calypso_ATDevice_Value_t *pValue)
+static bool Calypso_ATDevice_AddArgumentsATset(ATCommand_Builder_t *pAtCommand, uint8_t id, uint8_t option, Calypso_ATDevice_Value_t *pValue)
 {
 
 	/* add id */
-	if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -1000,7 +1008,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 	case Calypso_ATDevice_GetId_General:
 	{
 		/* add option */
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -1014,7 +1022,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, tempString, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -1030,7 +1038,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -1040,7 +1048,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -1050,7 +1058,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -1060,7 +1068,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -1070,7 +1078,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -1080,7 +1088,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, tempString, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -1098,7 +1106,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 
 	case Calypso_ATDevice_GetId_UART:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetUartStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetUartStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -1106,37 +1114,37 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 		switch (option)
 		{
 		case Calypso_ATDevice_GetUart_Baudrate:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->uart.baudrate, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValue->uart.baudrate, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATDevice_GetUart_Parity:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->uart.parity, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValue->uart.parity, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATDevice_GetUart_FlowControl:
-			if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->uart.flowControl, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentBoolean(pAtCommand, pValue->uart.flowControl, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATDevice_GetUart_TransparentTrigger:
-			if (!ATCommand_AppendArgumentBitmask(pAtCommand, Calypso_ATDevice_ATGetTransparentModeUartTriggerStrings, Calypso_ATDevice_TransparentModeUartTrigger_NumberOfValues, pValue->uart.transparentTrigger,
+			if (!ATCommand_BuilderAppendArgumentBitmask(pAtCommand, Calypso_ATDevice_ATGetTransparentModeUartTriggerStrings, Calypso_ATDevice_TransparentModeUartTrigger_NumberOfValues, pValue->uart.transparentTrigger,
 			ATCOMMAND_STRING_TERMINATE,
-			AT_MAX_COMMAND_BUFFER_SIZE))
+			CALYPSO_COMMAND_BUFFER_SIZE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATDevice_GetUart_TransparentTimeout:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->uart.transparentTimeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValue->uart.transparentTimeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -1145,7 +1153,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 		case Calypso_ATDevice_GetUart_TransparentETX:
 		{
 			uint16_t etx = ((uint16_t) pValue->uart.transparentETX[0] << 8) | pValue->uart.transparentETX[1];
-			if (!ATCommand_AppendArgumentInt(pAtCommand, etx, (ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, etx, (ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -1161,7 +1169,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 
 	case Calypso_ATDevice_GetId_TransparentMode:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -1169,14 +1177,14 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 		switch (option)
 		{
 		case Calypso_ATDevice_GetTransparentMode_RemoteAddress:
-			if (!ATCommand_AppendArgumentString(pAtCommand, pValue->transparentMode.remoteAddress, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValue->transparentMode.remoteAddress, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATDevice_GetTransparentMode_RemotePort:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->transparentMode.remotePort,
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValue->transparentMode.remotePort,
 			ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 			ATCOMMAND_STRING_TERMINATE))
 			{
@@ -1185,7 +1193,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 			break;
 
 		case Calypso_ATDevice_GetTransparentMode_LocalPort:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->transparentMode.localPort,
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValue->transparentMode.localPort,
 			ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 			ATCOMMAND_STRING_TERMINATE))
 			{
@@ -1194,7 +1202,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 			break;
 
 		case Calypso_ATDevice_GetTransparentMode_SocketType:
-			if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeSocketTypeStrings[pValue->transparentMode.socketType],
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeSocketTypeStrings[pValue->transparentMode.socketType],
 			ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
@@ -1202,7 +1210,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 			break;
 
 		case Calypso_ATDevice_GetTransparentMode_SecureMethod:
-			if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeSecureMethodStrings[pValue->transparentMode.secureMethod],
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeSecureMethodStrings[pValue->transparentMode.secureMethod],
 			ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
@@ -1210,21 +1218,21 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 			break;
 
 		case Calypso_ATDevice_GetTransparentMode_PowerSave:
-			if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->transparentMode.powerSave, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentBoolean(pAtCommand, pValue->transparentMode.powerSave, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATDevice_GetTransparentMode_SkipDateVerify:
-			if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->transparentMode.skipDateVerify, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentBoolean(pAtCommand, pValue->transparentMode.skipDateVerify, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATDevice_GetTransparentMode_DisableCertificateStore:
-			if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->transparentMode.disableCertificateStore, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentBoolean(pAtCommand, pValue->transparentMode.disableCertificateStore, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -1240,14 +1248,14 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 
 	case Calypso_ATDevice_GetId_GPIO:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGPIOStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGPIOStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 		switch (option)
 		{
 		case Calypso_ATDevice_GetGPIO_RemoteLock:
-			if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->gpio.remoteLock,
+			if (!ATCommand_BuilderAppendArgumentBoolean(pAtCommand, pValue->gpio.remoteLock,
 			ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
@@ -1267,5 +1275,5 @@ static bool Calypso_ATDevice_AddArgumentsATset(char *pAtCommand, uint8_t id, uin
 	}
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
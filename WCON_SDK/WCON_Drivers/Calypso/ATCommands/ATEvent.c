@@ -32,86 +32,86 @@
 #include <Calypso/Calypso.h>
 
 const static ATCommand_Event_t generalSubEvents[] = {
+				EVENTENTRY("error", Calypso_ATEvent_GeneralError)
 				EVENTENTRY("reset_request", Calypso_ATEvent_GeneralResetRequest)
-				LASTEVENTENTRY("error", Calypso_ATEvent_GeneralError)
 		};
 
 const static ATCommand_Event_t wlanSubEvents[] = {
 				EVENTENTRY("connect", Calypso_ATEvent_WlanConnect)
 				EVENTENTRY("disconnect", Calypso_ATEvent_WlanDisconnect)
-				EVENTENTRY("sta_added", Calypso_ATEvent_WlanStaAdded)
-				EVENTENTRY("sta_removed", Calypso_ATEvent_WlanStaRemoved)
-				EVENTENTRY("p2p_connect", Calypso_ATEvent_WlanP2PConnect)
-				EVENTENTRY("p2p_disconnect", Calypso_ATEvent_WlanP2PDisconnect)
 				EVENTENTRY("p2p_client_added", Calypso_ATEvent_WlanP2PClientAdded)
 				EVENTENTRY("p2p_client_removed", Calypso_ATEvent_WlanP2PClientRemoved)
+				EVENTENTRY("p2p_connect", Calypso_ATEvent_WlanP2PConnect)
+				EVENTENTRY("p2p_connectfail", Calypso_ATEvent_WlanP2PConnectFail)
 				EVENTENTRY("p2p_devfound", Calypso_ATEvent_WlanP2PDevFound)
+				EVENTENTRY("p2p_disconnect", Calypso_ATEvent_WlanP2PDisconnect)
 				EVENTENTRY("p2p_request", Calypso_ATEvent_WlanP2PRequest)
-				EVENTENTRY("p2p_connectfail", Calypso_ATEvent_WlanP2PConnectFail)
+				EVENTENTRY("provisioning_profile_added", Calypso_ATEvent_WlanProvisioningProfileAdded)
 				EVENTENTRY("provisioning_status", Calypso_ATEvent_WlanProvisioningStatus)
-				LASTEVENTENTRY("provisioning_profile_added", Calypso_ATEvent_WlanProvisioningProfileAdded)
+				EVENTENTRY("sta_added", Calypso_ATEvent_WlanStaAdded)
+				EVENTENTRY("sta_removed", Calypso_ATEvent_WlanStaRemoved)
 		};
 
 const static ATCommand_Event_t socketSubEvents[] = {
+				EVENTENTRY("async_event", Calypso_ATEvent_SocketAsyncEvent)
 				EVENTENTRY("tx_failed", Calypso_ATEvent_SocketTxFailed)
-				LASTEVENTENTRY("async_event", Calypso_ATEvent_SocketAsyncEvent)
 		};
 
 const static ATCommand_Event_t netAppSubEvents[] = {
-				EVENTENTRY("ipv4_acquired", Calypso_ATEvent_NetappIP4Acquired)
-				EVENTENTRY("ipv6_acquired", Calypso_ATEvent_NetappIP6Acquired)
-				EVENTENTRY("ip_collision", Calypso_ATEvent_NetappIPCollision)
+				EVENTENTRY("dhcp_ipv4_acquire_timeout", Calypso_ATEvent_NetappDHCPIPv4AcquireTimeout)
 				EVENTENTRY("dhcpv4_leased", Calypso_ATEvent_NetappDHCPv4_leased)
 				EVENTENTRY("dhcpv4_released", Calypso_ATEvent_NetappDHCPv4_released)
+				EVENTENTRY("ip_collision", Calypso_ATEvent_NetappIPCollision)
+				EVENTENTRY("ipv4_acquired", Calypso_ATEvent_NetappIP4Acquired)
 				EVENTENTRY("ipv4_lost", Calypso_ATEvent_NetappIPv4Lost)
-				EVENTENTRY("dhcp_ipv4_acquire_timeout", Calypso_ATEvent_NetappDHCPIPv4AcquireTimeout)
-				LASTEVENTENTRY("ipv6_lost", Calypso_ATEvent_NetappIPv6Lost)
+				EVENTENTRY("ipv6_acquired", Calypso_ATEvent_NetappIP6Acquired)
+				EVENTENTRY("ipv6_lost", Calypso_ATEvent_NetappIPv6Lost)
 		};
 
 const static ATCommand_Event_t mqttOperationSubEvents[] = {
 				EVENTENTRY("connack", Calypso_ATEvent_MQTTConnack)
 				EVENTENTRY("puback", Calypso_ATEvent_MQTTPuback)
 				EVENTENTRY("suback", Calypso_ATEvent_MQTTSuback)
-				LASTEVENTENTRY("unsuback", Calypso_ATEvent_MQTTUnsuback)
+				EVENTENTRY("unsuback", Calypso_ATEvent_MQTTUnsuback)
 		};
 
 const static ATCommand_Event_t mqttSubEvents[] = {
+				EVENTENTRY("disconnect", Calypso_ATEvent_MQTTDisconnect)
 				PARENTEVENTENTRY("operation", mqttOperationSubEvents, ATCOMMAND_ARGUMENT_DELIM)
 				EVENTENTRY("recv", Calypso_ATEvent_MQTTRecv)
-				LASTEVENTENTRY("disconnect", Calypso_ATEvent_MQTTDisconnect)
 		};
 
 const static ATCommand_Event_t fatalErrorSubEvents[] = {
+				EVENTENTRY("cmd_timout", Calypso_ATEvent_FatalErrorCmdTimeout)
 				EVENTENTRY("device_abort", Calypso_ATEvent_FatalErrorDeviceAbort)
 				EVENTENTRY("driver_abort", Calypso_ATEvent_FatalErrorDriverAbort)
-				EVENTENTRY("sync_loss", Calypso_ATEvent_FatalErrorSyncLost)
 				EVENTENTRY("no_cmd_ack", Calypso_ATEvent_FatalErrorNoCmdAck)
-				LASTEVENTENTRY("cmd_timout", Calypso_ATEvent_FatalErrorCmdTimeout)
+				EVENTENTRY("sync_loss", Calypso_ATEvent_FatalErrorSyncLost)
 		};
 
 const static ATCommand_Event_t customSubEvents[] = {
 				EVENTENTRY("0", Calypso_ATEvent_CustomGPIO)
-				LASTEVENTENTRY("1", Calypso_ATEvent_CustomHTTPPost)
+				EVENTENTRY("1", Calypso_ATEvent_CustomHTTPPost)
 		};
 
 const static ATCommand_Event_t moduleMainEvents[] = {
+				EVENTENTRY("+accept", Calypso_ATEvent_SocketTCPAccept)
+				EVENTENTRY("+connect", Calypso_ATEvent_SocketTCPConnect)
+				PARENTEVENTENTRY("+eventcustom", customSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				PARENTEVENTENTRY("+eventfatalerror", fatalErrorSubEvents, ATCOMMAND_ARGUMENT_DELIM)
 				PARENTEVENTENTRY("+eventgeneral", generalSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				PARENTEVENTENTRY("+eventwlan", wlanSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				PARENTEVENTENTRY("+eventsock", socketSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				PARENTEVENTENTRY("+eventnetapp", netAppSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				EVENTENTRY("+eventhttpget", Calypso_ATEvent_HTTPGet)
 				PARENTEVENTENTRY("+eventmqtt", mqttSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				PARENTEVENTENTRY("+eventfatalerror", fatalErrorSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				PARENTEVENTENTRY("+eventnetapp", netAppSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				PARENTEVENTENTRY("+eventsock", socketSubEvents, ATCOMMAND_ARGUMENT_DELIM)
 				EVENTENTRY("+eventstartup", Calypso_ATEvent_Startup)
 				EVENTENTRY("+eventwakeup", Calypso_ATEvent_WakeUp)
+				PARENTEVENTENTRY("+eventwlan", wlanSubEvents, ATCOMMAND_ARGUMENT_DELIM)
+				EVENTENTRY("+filegetfilelist", Calypso_ATEvent_FileListEntry)
+				EVENTENTRY("+netappping", Calypso_ATEvent_Ping)
 				EVENTENTRY("+recv", Calypso_ATEvent_SocketRcvd)
 				EVENTENTRY("+recvfrom", Calypso_ATEvent_SocketRcvdFrom)
-				EVENTENTRY("+connect", Calypso_ATEvent_SocketTCPConnect)
-				EVENTENTRY("+accept", Calypso_ATEvent_SocketTCPAccept)
 				EVENTENTRY("+select", Calypso_ATEvent_SocketSelect)
-				EVENTENTRY("+eventhttpget", Calypso_ATEvent_HTTPGet)
-				PARENTEVENTENTRY("+eventcustom", customSubEvents, ATCOMMAND_ARGUMENT_DELIM)
-				EVENTENTRY("+netappping", Calypso_ATEvent_Ping)
-				LASTEVENTENTRY("+filegetfilelist", Calypso_ATEvent_FileListEntry)
 		};
 
 /**
@@ -128,7 +128,7 @@ bool Calypso_ATEvent_ParseEventType(char **pAtCommand, Calypso_ATEvent_t *pEvent
 			ATCOMMAND_EVENT_DELIM,
 			ATCOMMAND_STRING_TERMINATE };
 
-	if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, delimiters, sizeof(delimiters), (uint16_t*) pEvent))
+	if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, ATCOMMAND_EVENT_COUNT(moduleMainEvents), delimiters, sizeof(delimiters), (uint16_t*) pEvent))
 	{
 		*pEvent = Calypso_ATEvent_Invalid;
 		return false;
@@ -309,6 +309,12 @@ bool decodeBase64, Calypso_ATEvent_SocketRcvd_t *rcvdEvent)
 
 	if (decodeBase64)
 	{
+		if (strnlen(*pEventArguments, rcvdEvent->length) < rcvdEvent->length)
+		{
+			/* line is shorter than the announced data length */
+			return false;
+		}
+
 		uint32_t decodedSize;
 		if (!Base64_GetDecBufSize((uint8_t*) *pEventArguments, rcvdEvent->length, &decodedSize))
 		{
@@ -59,11 +59,11 @@ static const char *Calypso_ATFile_FileProperties_Strings[Calypso_ATFile_FileProp
 		"public_write",
 		"public_read" };
 
-static bool Calypso_ATFile_AddArgumentsFileOpen(char *pAtCommand, const char *fileName, uint32_t options, uint16_t fileSize);
-static bool Calypso_ATFile_AddArgumentsFileClose(char *pAtCommand, uint32_t fileID, const char *certName, const char *signature);
-static bool Calypso_ATFile_AddArgumentsFileDel(char *pAtCommand, const char *fileName, uint32_t secureToken);
-static bool Calypso_ATFile_AddArgumentsFileRead(char *pAtCommand, uint32_t fileID, uint16_t offset, Calypso_DataFormat_t format, uint16_t bytesToRead);
-static bool Calypso_ATFile_AddArgumentsFileWrite(char *pAtCommand, uint32_t fileID, uint16_t offset, Calypso_DataFormat_t format, uint16_t bytesToWrite, const char *data);
+static bool Calypso_ATFile_AddArgumentsFileOpen(ATCommand_Builder_t *pAtCommand, const char *fileName, uint32_t options, uint16_t fileSize);
+static bool Calypso_ATFile_AddArgumentsFileClose(ATCommand_Builder_t *pAtCommand, uint32_t fileID, const char *certName, const char *signature);
+static bool Calypso_ATFile_AddArgumentsFileDel(ATCommand_Builder_t *pAtCommand, const char *fileName, uint32_t secureToken);
+static bool Calypso_ATFile_AddArgumentsFileRead(ATCommand_Builder_t *pAtCommand, uint32_t fileID, uint16_t offset, Calypso_DataFormat_t format, uint16_t bytesToRead);
+static bool Calypso_ATFile_AddArgumentsFileWrite(ATCommand_Builder_t *pAtCommand, uint32_t fileID, uint16_t offset, Calypso_DataFormat_t format, uint16_t bytesToWrite, const char *data);
 
 static bool Calypso_ATFile_ParseResponseFileOpen(char **pAtCommand, uint32_t *fileID, uint32_t *secureToken);
 static bool Calypso_ATFile_ParseResponseFileRead(char **pAtCommand, uint16_t bytesToRead,
@@ -84,12 +84,13 @@ static bool Calypso_ATFile_ParseResponseFileWrite(char **pAtCommand, uint16_t *b
 bool Calypso_ATFile_Open(const char *fileName, uint32_t options, uint16_t fileSize, uint32_t *fileID, uint32_t *secureToken)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+fileOpen=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+fileOpen=");
 
-	if (!Calypso_ATFile_AddArgumentsFileOpen(pRequestCommand, fileName, options, fileSize))
+	if (!Calypso_ATFile_AddArgumentsFileOpen(&requestCommand, fileName, options, fileSize))
 	{
 		return false;
 	}
@@ -119,11 +120,12 @@ bool Calypso_ATFile_Open(const char *fileName, uint32_t options, uint16_t fileSi
 bool Calypso_ATFile_Close(uint32_t fileID, char *certFileName, char *signature)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+fileClose=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+fileClose=");
 
-	if (!Calypso_ATFile_AddArgumentsFileClose(pRequestCommand, fileID, certFileName, signature))
+	if (!Calypso_ATFile_AddArgumentsFileClose(&requestCommand, fileID, certFileName, signature))
 	{
 		return false;
 	}
@@ -147,11 +149,12 @@ bool Calypso_ATFile_Close(uint32_t fileID, char *certFileName, char *signature)
  */
 bool Calypso_ATFile_Delete(const char *fileName, uint32_t secureToken)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+fileDel=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+fileDel=");
 
-	if (!Calypso_ATFile_AddArgumentsFileDel(pRequestCommand, fileName, secureToken))
+	if (!Calypso_ATFile_AddArgumentsFileDel(&requestCommand, fileName, secureToken))
 	{
 		return false;
 	}
@@ -196,12 +199,13 @@ bool decodeBase64, uint16_t bytesToRead, char *data, uint16_t *bytesRead)
 			chunkSize = ATFILE_FILE_MAX_CHUNK_SIZE;
 		}
 
-		char *pRequestCommand = AT_commandBuffer;
-		char *pRespondCommand = AT_commandBuffer;
+		char *pRequestCommand = Calypso_commandBuffer;
+		ATCommand_Builder_t requestCommand;
+		char *pRespondCommand = Calypso_commandBuffer;
 
-		strcpy(pRequestCommand, "AT+fileRead=");
+		ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+fileRead=");
 
-		if (!Calypso_ATFile_AddArgumentsFileRead(pRequestCommand, fileID, offset + chunkOffset, format, chunkSize))
+		if (!Calypso_ATFile_AddArgumentsFileRead(&requestCommand, fileID, offset + chunkOffset, format, chunkSize))
 		{
 			return false;
 		}
@@ -304,12 +308,13 @@ bool encodeAsBase64, uint16_t bytesToWrite, const char *data, uint16_t *bytesWri
 			chunkSize = ATFILE_FILE_MAX_CHUNK_SIZE;
 		}
 
-		char *pRequestCommand = AT_commandBuffer;
-		char *pRespondCommand = AT_commandBuffer;
+		char *pRequestCommand = Calypso_commandBuffer;
+		ATCommand_Builder_t requestCommand;
+		char *pRespondCommand = Calypso_commandBuffer;
 
-		strcpy(pRequestCommand, "AT+fileWrite=");
+		ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+fileWrite=");
 
-		if (!Calypso_ATFile_AddArgumentsFileWrite(pRequestCommand, fileID, offset + chunkOffset, format, chunkSize, data + chunkOffset))
+		if (!Calypso_ATFile_AddArgumentsFileWrite(&requestCommand, fileID, offset + chunkOffset, format, chunkSize, data + chunkOffset))
 		{
 			return false;
 		}
@@ -350,20 +355,21 @@ bool encodeAsBase64, uint16_t bytesToWrite, const char *data, uint16_t *bytesWri
  */
 bool Calypso_ATFile_GetInfo(const char *fileName, uint32_t secureToken, Calypso_ATFile_FileInfo_t *fileInfo)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(AT_commandBuffer, "AT+fileGetInfo=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+fileGetInfo=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, secureToken, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, secureToken, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -493,7 +499,7 @@ bool Calypso_ATFile_PrintFileProperties(uint32_t properties, char *pOutStr, size
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATFile_AddArgumentsFileOpen(char *pAtCommand, const char *fileName, uint32_t options, uint16_t fileSize)
+static bool Calypso_ATFile_AddArgumentsFileOpen(ATCommand_Builder_t *pAtCommand, const char *fileName, uint32_t options, uint16_t fileSize)
 {
 
 	if ((NULL == pAtCommand) || (NULL == fileName))
@@ -506,24 +512,24 @@ static bool Calypso_ATFile_AddArgumentsFileOpen(char *pAtCommand, const char *fi
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentBitmask(pAtCommand, Calypso_ATFile_OpenFlags_Strings, Calypso_ATFile_OpenFlags_NumberOfValues, options,
+	if (!ATCommand_BuilderAppendArgumentBitmask(pAtCommand, Calypso_ATFile_OpenFlags_Strings, Calypso_ATFile_OpenFlags_NumberOfValues, options,
 	ATCOMMAND_ARGUMENT_DELIM,
-	AT_MAX_COMMAND_BUFFER_SIZE))
+	CALYPSO_COMMAND_BUFFER_SIZE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, fileSize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, fileSize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -537,7 +543,7 @@ static bool Calypso_ATFile_AddArgumentsFileOpen(char *pAtCommand, const char *fi
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATFile_AddArgumentsFileClose(char *pAtCommand, uint32_t fileID, const char *certName, const char *signature)
+static bool Calypso_ATFile_AddArgumentsFileClose(ATCommand_Builder_t *pAtCommand, uint32_t fileID, const char *certName, const char *signature)
 {
 
 	if (NULL == pAtCommand)
@@ -545,21 +551,21 @@ static bool Calypso_ATFile_AddArgumentsFileClose(char *pAtCommand, uint32_t file
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, certName, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, certName, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pAtCommand, signature, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, signature, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -572,7 +578,7 @@ static bool Calypso_ATFile_AddArgumentsFileClose(char *pAtCommand, uint32_t file
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATFile_AddArgumentsFileDel(char *pAtCommand, const char *fileName, uint32_t secureToken)
+static bool Calypso_ATFile_AddArgumentsFileDel(ATCommand_Builder_t *pAtCommand, const char *fileName, uint32_t secureToken)
 {
 
 	if (NULL == pAtCommand)
@@ -580,17 +586,17 @@ static bool Calypso_ATFile_AddArgumentsFileDel(char *pAtCommand, const char *fil
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, secureToken, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, secureToken, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
@@ -604,7 +610,7 @@ static bool Calypso_ATFile_AddArgumentsFileDel(char *pAtCommand, const char *fil
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATFile_AddArgumentsFileRead(char *pAtCommand, uint32_t fileID, uint16_t offset, Calypso_DataFormat_t format, uint16_t bytesToRead)
+static bool Calypso_ATFile_AddArgumentsFileRead(ATCommand_Builder_t *pAtCommand, uint32_t fileID, uint16_t offset, Calypso_DataFormat_t format, uint16_t bytesToRead)
 {
 
 	if (NULL == pAtCommand)
@@ -612,27 +618,27 @@ static bool Calypso_ATFile_AddArgumentsFileRead(char *pAtCommand, uint32_t fileI
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, bytesToRead, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, bytesToRead, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -648,7 +654,7 @@ static bool Calypso_ATFile_AddArgumentsFileRead(char *pAtCommand, uint32_t fileI
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATFile_AddArgumentsFileWrite(char *pAtCommand, uint32_t fileID, uint16_t offset, Calypso_DataFormat_t format, uint16_t bytesToWrite, const char *data)
+static bool Calypso_ATFile_AddArgumentsFileWrite(ATCommand_Builder_t *pAtCommand, uint32_t fileID, uint16_t offset, Calypso_DataFormat_t format, uint16_t bytesToWrite, const char *data)
 {
 
 	if (NULL == pAtCommand)
@@ -656,32 +662,32 @@ static bool Calypso_ATFile_AddArgumentsFileWrite(char *pAtCommand, uint32_t file
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, bytesToWrite, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, bytesToWrite, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentBytes(pAtCommand, data, bytesToWrite, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentBytes(pAtCommand, data, bytesToWrite, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
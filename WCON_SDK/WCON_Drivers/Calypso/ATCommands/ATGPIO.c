@@ -60,23 +60,24 @@ bool Calypso_ATGPIO_Get(Calypso_ATGPIO_GPIOId_t id, bool defaultSetting, Calypso
 {
 	gpio->type = Calypso_ATGPIO_GPIOType_Unused;
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+gpioGet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+gpioGet=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, id,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, id,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, defaultSetting ? "true" : "false",
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, defaultSetting ? "true" : "false",
 	ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
@@ -182,22 +183,23 @@ bool Calypso_ATGPIO_Get(Calypso_ATGPIO_GPIOId_t id, bool defaultSetting, Calypso
  */
 bool Calypso_ATGPIO_Set(Calypso_ATGPIO_GPIO_t *gpio, bool save)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+gpioSet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+gpioSet=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, gpio->id,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, gpio->id,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, save ? "true" : "false",
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, save ? "true" : "false",
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATGPIO_GPIOType_Strings[gpio->type],
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATGPIO_GPIOType_Strings[gpio->type],
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
@@ -205,7 +207,7 @@ bool Calypso_ATGPIO_Set(Calypso_ATGPIO_GPIO_t *gpio, bool save)
 	switch (gpio->type)
 	{
 	case Calypso_ATGPIO_GPIOType_Unused:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, "",
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, "",
 		ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
@@ -213,7 +215,7 @@ bool Calypso_ATGPIO_Set(Calypso_ATGPIO_GPIO_t *gpio, bool save)
 		break;
 
 	case Calypso_ATGPIO_GPIOType_Input:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATGPIO_PullType_Strings[gpio->parameters.input.pullType],
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATGPIO_PullType_Strings[gpio->parameters.input.pullType],
 		ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
@@ -221,7 +223,7 @@ bool Calypso_ATGPIO_Set(Calypso_ATGPIO_GPIO_t *gpio, bool save)
 		break;
 
 	case Calypso_ATGPIO_GPIOType_Output:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATGPIO_GPIOState_Strings[gpio->parameters.output.state],
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATGPIO_GPIOState_Strings[gpio->parameters.output.state],
 		ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
@@ -229,13 +231,13 @@ bool Calypso_ATGPIO_Set(Calypso_ATGPIO_GPIO_t *gpio, bool save)
 		break;
 
 	case Calypso_ATGPIO_GPIOType_PWM:
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, gpio->parameters.pwm.period,
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, gpio->parameters.pwm.period,
 		ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 		ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, gpio->parameters.pwm.ratio,
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, gpio->parameters.pwm.ratio,
 		ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 		ATCOMMAND_STRING_TERMINATE))
 		{
@@ -246,7 +248,7 @@ bool Calypso_ATGPIO_Set(Calypso_ATGPIO_GPIO_t *gpio, bool save)
 	default:
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
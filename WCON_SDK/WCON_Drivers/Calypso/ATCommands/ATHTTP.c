@@ -127,7 +127,7 @@ bool Calypso_ATHTTP_Create(uint8_t *clientHandle)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = Calypso_commandBuffer;
 	if (!Calypso_WaitForConfirm(Calypso_GetTimeout(Calypso_Timeout_General), Calypso_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -157,15 +157,16 @@ bool Calypso_ATHTTP_Create(uint8_t *clientHandle)
  */
 bool Calypso_ATHTTP_Destroy(uint8_t clientHandle)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpDestroy=");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle,
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpDestroy=");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, clientHandle,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
@@ -192,42 +193,43 @@ bool Calypso_ATHTTP_Destroy(uint8_t clientHandle)
  */
 bool Calypso_ATHTTP_Connect(uint8_t clientHandle, const char *host, uint8_t flags, const char *privateKey, const char *certificate, const char *rootCaCertificate)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpConnect=");
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpConnect=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, clientHandle,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, host,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, host,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATHTTP_ConnectFlags_Strings, Calypso_ATHTTP_ConnectFlags_NumberOfValues, flags,
+	if (!ATCommand_BuilderAppendArgumentBitmask(&requestCommand, Calypso_ATHTTP_ConnectFlags_Strings, Calypso_ATHTTP_ConnectFlags_NumberOfValues, flags,
 	ATCOMMAND_ARGUMENT_DELIM,
-	AT_MAX_COMMAND_BUFFER_SIZE))
+	CALYPSO_COMMAND_BUFFER_SIZE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, privateKey,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, privateKey,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, certificate,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, certificate,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, rootCaCertificate,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, rootCaCertificate,
 	ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
@@ -250,15 +252,16 @@ bool Calypso_ATHTTP_Connect(uint8_t clientHandle, const char *host, uint8_t flag
  */
 bool Calypso_ATHTTP_Disconnect(uint8_t clientHandle)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpDisconnect=");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle,
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpDisconnect=");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, clientHandle,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
@@ -280,13 +283,14 @@ bool Calypso_ATHTTP_Disconnect(uint8_t clientHandle)
  */
 bool Calypso_ATHTTP_SetProxy(Calypso_ATSocket_Descriptor_t proxy)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpSetProxy=");
-	if (!Calypso_ATSocket_AppendSocketDescriptor(pRequestCommand, proxy, ATCOMMAND_STRING_TERMINATE))
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpSetProxy=");
+	if (!Calypso_ATSocket_AppendSocketDescriptor(&requestCommand, proxy, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
@@ -348,44 +352,45 @@ bool encodeAsBase64, uint16_t length, const char *data, uint32_t *status)
 		false, lengthEncoded, base64Buffer, status);
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpSendReq=");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle,
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpSendReq=");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, clientHandle,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATHTTP_Method_Strings[method],
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATHTTP_Method_Strings[method],
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, uri,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, uri,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATHTTP_RequestFlags_Strings, Calypso_ATHTTP_RequestFlags_NumberOfValues, flags,
+	if (!ATCommand_BuilderAppendArgumentBitmask(&requestCommand, Calypso_ATHTTP_RequestFlags_Strings, Calypso_ATHTTP_RequestFlags_NumberOfValues, flags,
 	ATCOMMAND_ARGUMENT_DELIM,
-	AT_MAX_COMMAND_BUFFER_SIZE))
+	CALYPSO_COMMAND_BUFFER_SIZE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentBytes(pRequestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentBytes(&requestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
@@ -438,24 +443,25 @@ bool decodeBase64, uint16_t length, Calypso_ATHTTP_ResponseBody_t *responseBody)
 	responseBody->hasMoreData = false;
 	responseBody->length = 0;
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpReadResBody=");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle,
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpReadResBody=");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, clientHandle,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
@@ -590,37 +596,38 @@ bool encodeAsBase64, uint16_t length, const char *data)
 		false, lengthEncoded, base64Buffer);
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpSetHeader=");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle,
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpSetHeader=");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, clientHandle,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATHTTP_HeaderField_Strings[field],
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATHTTP_HeaderField_Strings[field],
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATHTTP_HeaderPersistency_Strings[persistency],
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATHTTP_HeaderPersistency_Strings[persistency],
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentBytes(pRequestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentBytes(&requestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -647,29 +654,30 @@ bool encodeAsBase64, uint16_t length, const char *data)
 bool Calypso_ATHTTP_GetHeader(uint8_t clientHandle, Calypso_ATHTTP_HeaderField_t field, Calypso_DataFormat_t format,
 bool decodeBase64, uint16_t length, Calypso_ATHTTP_HeaderData_t *header)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpGetHeader=");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle,
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpGetHeader=");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, clientHandle,
 	ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC,
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATHTTP_HeaderField_Strings[field],
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATHTTP_HeaderField_Strings[field],
 	ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand,
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand,
 	ATCOMMAND_CRLF,
 	ATCOMMAND_STRING_TERMINATE))
 	{
@@ -791,21 +799,22 @@ bool encodeAsBase64, uint16_t length, const char *data)
 		return Calypso_ATHTTP_SendCustomResponse(format, false, lengthEncoded, base64Buffer);
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+httpCustomResponse=");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+httpCustomResponse=");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentBytes(pRequestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentBytes(&requestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
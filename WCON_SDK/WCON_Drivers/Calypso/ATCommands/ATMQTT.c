@@ -63,11 +63,11 @@ static const char *Calypso_ATMQTT_CreateFlagsStrings[Calypso_ATMQTT_CreateFlags_
 		"skip_cert_verify",
 		"skip_date_verify" };
 
-static bool Calypso_ATMQTT_AddArgumentsCreate(char *pAtCommand, char *clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams);
-static bool Calypso_ATMQTT_AddArgumentsPublish(char *pAtCommand, uint8_t index, char *topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char *pMessage);
-static bool Calypso_ATMQTT_AddArgumentsSubscribe(char *pAtCommand, uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t *pTopics);
-static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(char *pAtCommand, uint8_t index, char *topic1, char *topic2, char *topic3, char *topic4);
-static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t *pValues);
+static bool Calypso_ATMQTT_AddArgumentsCreate(ATCommand_Builder_t *pAtCommand, char *clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams);
+static bool Calypso_ATMQTT_AddArgumentsPublish(ATCommand_Builder_t *pAtCommand, uint8_t index, char *topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char *pMessage);
+static bool Calypso_ATMQTT_AddArgumentsSubscribe(ATCommand_Builder_t *pAtCommand, uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t *pTopics);
+static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(ATCommand_Builder_t *pAtCommand, uint8_t index, char *topic1, char *topic2, char *topic3, char *topic4);
+static bool Calypso_ATMQTT_AddArgumentsSet(ATCommand_Builder_t *pAtCommand, uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t *pValues);
 static bool Calypso_ATMQTT_ParseResponseCreate(char **pAtCommand, uint8_t *pOutIndex);
 
 /**
@@ -84,12 +84,13 @@ static bool Calypso_ATMQTT_ParseResponseCreate(char **pAtCommand, uint8_t *pOutI
  */
 bool Calypso_ATMQTT_Create(char *clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams, uint8_t *pIndex)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+mqttCreate=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+mqttCreate=");
 
-	if (!Calypso_ATMQTT_AddArgumentsCreate(pRequestCommand, clientID, flags, serverInfo, securityParams, connectionParams))
+	if (!Calypso_ATMQTT_AddArgumentsCreate(&requestCommand, clientID, flags, serverInfo, securityParams, connectionParams))
 	{
 		return false;
 	}
@@ -116,15 +117,16 @@ bool Calypso_ATMQTT_Create(char *clientID, uint32_t flags, Calypso_ATMQTT_Server
 bool Calypso_ATMQTT_Delete(uint8_t index)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+mqttDelete=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+mqttDelete=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -148,15 +150,16 @@ bool Calypso_ATMQTT_Delete(uint8_t index)
 bool Calypso_ATMQTT_Connect(uint8_t index)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+mqttConnect=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+mqttConnect=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -179,15 +182,16 @@ bool Calypso_ATMQTT_Connect(uint8_t index)
 bool Calypso_ATMQTT_Disconnect(uint8_t index)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+mqttDisconnect=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+mqttDisconnect=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -215,11 +219,12 @@ bool Calypso_ATMQTT_Disconnect(uint8_t index)
 bool Calypso_ATMQTT_Publish(uint8_t index, char *topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char *pMessage)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+mqttPublish=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+mqttPublish=");
 
-	if (!Calypso_ATMQTT_AddArgumentsPublish(pRequestCommand, index, topic, QoS, retain, messageLength, pMessage))
+	if (!Calypso_ATMQTT_AddArgumentsPublish(&requestCommand, index, topic, QoS, retain, messageLength, pMessage))
 	{
 		return false;
 	}
@@ -243,11 +248,12 @@ bool Calypso_ATMQTT_Publish(uint8_t index, char *topic, Calypso_ATMQTT_QoS_t QoS
 bool Calypso_ATMQTT_Subscribe(uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t *pTopics)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+mqttSubscribe=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+mqttSubscribe=");
 
-	if (!Calypso_ATMQTT_AddArgumentsSubscribe(pRequestCommand, index, numOfTopics, pTopics))
+	if (!Calypso_ATMQTT_AddArgumentsSubscribe(&requestCommand, index, numOfTopics, pTopics))
 	{
 		return false;
 	}
@@ -273,11 +279,12 @@ bool Calypso_ATMQTT_Subscribe(uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT
 bool Calypso_ATMQTT_Unsubscribe(uint8_t index, char *topic1, char *topic2, char *topic3, char *topic4)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+mqttUnsubscribe=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+mqttUnsubscribe=");
 
-	if (!Calypso_ATMQTT_AddArgumentsUnsubscribe(pRequestCommand, index, topic1, topic2, topic3, topic4))
+	if (!Calypso_ATMQTT_AddArgumentsUnsubscribe(&requestCommand, index, topic1, topic2, topic3, topic4))
 	{
 		return false;
 	}
@@ -304,11 +311,12 @@ bool Calypso_ATMQTT_Unsubscribe(uint8_t index, char *topic1, char *topic2, char
 bool Calypso_ATMQTT_Set(uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t *pValues)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+mqttSet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+mqttSet=");
 
-	if (!Calypso_ATMQTT_AddArgumentsSet(pRequestCommand, index, option, pValues))
+	if (!Calypso_ATMQTT_AddArgumentsSet(&requestCommand, index, option, pValues))
 	{
 		return false;
 	}
@@ -333,32 +341,32 @@ bool Calypso_ATMQTT_Set(uint8_t index, Calypso_ATMQTT_SetOption_t option, Calyps
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsCreate(char *pAtCommand, char *clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams)
+static bool Calypso_ATMQTT_AddArgumentsCreate(ATCommand_Builder_t *pAtCommand, char *clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams)
 {
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentBitmask(pAtCommand, Calypso_ATMQTT_CreateFlagsStrings, Calypso_ATMQTT_CreateFlags_NumberOfValues, flags,
+	if (!ATCommand_BuilderAppendArgumentBitmask(pAtCommand, Calypso_ATMQTT_CreateFlagsStrings, Calypso_ATMQTT_CreateFlags_NumberOfValues, flags,
 	ATCOMMAND_ARGUMENT_DELIM,
-	AT_MAX_COMMAND_BUFFER_SIZE))
+	CALYPSO_COMMAND_BUFFER_SIZE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, serverInfo.address, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, serverInfo.address, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, serverInfo.port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, serverInfo.port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_SecurityMethodsStrings[securityParams.securityMethod], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATMQTT_SecurityMethodsStrings[securityParams.securityMethod], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -368,47 +376,47 @@ static bool Calypso_ATMQTT_AddArgumentsCreate(char *pAtCommand, char *clientID,
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, "", ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, "", ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, securityParams.privateKeyFile, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, securityParams.privateKeyFile, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, securityParams.certificateFile, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, securityParams.certificateFile, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, securityParams.CAFile, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, securityParams.CAFile, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, securityParams.DHKey, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, securityParams.DHKey, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_ProtocolStrings[connectionParams.protocolVersion], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATMQTT_ProtocolStrings[connectionParams.protocolVersion], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, connectionParams.blockingSend, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, connectionParams.blockingSend, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, connectionParams.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, connectionParams.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
@@ -424,40 +432,40 @@ static bool Calypso_ATMQTT_AddArgumentsCreate(char *pAtCommand, char *clientID,
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsPublish(char *pAtCommand, uint8_t index, char *topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char *pMessage)
+static bool Calypso_ATMQTT_AddArgumentsPublish(ATCommand_Builder_t *pAtCommand, uint8_t index, char *topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char *pMessage)
 {
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, topic, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, topic, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[QoS], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[QoS], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, retain, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, retain, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, messageLength, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, messageLength, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentBytes(pAtCommand, pMessage, messageLength, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentBytes(pAtCommand, pMessage, messageLength, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -471,7 +479,7 @@ static bool Calypso_ATMQTT_AddArgumentsPublish(char *pAtCommand, uint8_t index,
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsSubscribe(char *pAtCommand, uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t *pTopics)
+static bool Calypso_ATMQTT_AddArgumentsSubscribe(ATCommand_Builder_t *pAtCommand, uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t *pTopics)
 {
 
 	if (numOfTopics > MQTT_MAX_NUM_TOPICS_TO_SUBSCRIBE)
@@ -479,12 +487,12 @@ static bool Calypso_ATMQTT_AddArgumentsSubscribe(char *pAtCommand, uint8_t index
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, numOfTopics, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, numOfTopics, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -492,17 +500,17 @@ static bool Calypso_ATMQTT_AddArgumentsSubscribe(char *pAtCommand, uint8_t index
 	for (uint8_t i = 0; i < numOfTopics; i++)
 	{
 
-		if (!ATCommand_AppendArgumentString(pAtCommand, pTopics[i].topic, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pTopics[i].topic, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[pTopics[i].QoS], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[pTopics[i].QoS], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 		/* Reserved argument */
-		if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -511,15 +519,13 @@ static bool Calypso_ATMQTT_AddArgumentsSubscribe(char *pAtCommand, uint8_t index
 	/* Add empty, unused topics*/
 	for (uint8_t i = numOfTopics; i <= MQTT_MAX_NUM_TOPICS_TO_SUBSCRIBE; i++)
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, ",,", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ",,", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
 
-	pAtCommand[strlen(pAtCommand)] = ATCOMMAND_STRING_TERMINATE;
-
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -535,7 +541,7 @@ static bool Calypso_ATMQTT_AddArgumentsSubscribe(char *pAtCommand, uint8_t index
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(char *pAtCommand, uint8_t index, char *topic1, char *topic2, char *topic3, char *topic4)
+static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(ATCommand_Builder_t *pAtCommand, uint8_t index, char *topic1, char *topic2, char *topic3, char *topic4)
 {
 
 	uint32_t numOfTopics = 0;
@@ -556,57 +562,57 @@ static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(char *pAtCommand, uint8_t ind
 		numOfTopics++;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, numOfTopics, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, numOfTopics, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, (NULL != topic1 ? topic1 : ""), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, (NULL != topic1 ? topic1 : ""), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, (NULL != topic2 ? topic2 : ""), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, (NULL != topic2 ? topic2 : ""), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, (NULL != topic3 ? topic3 : ""), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, (NULL != topic3 ? topic3 : ""), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, (NULL != topic4 ? topic4 : ""), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, (NULL != topic4 ? topic4 : ""), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -620,10 +626,10 @@ static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(char *pAtCommand, uint8_t ind
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t *pValues)
+static bool Calypso_ATMQTT_AddArgumentsSet(ATCommand_Builder_t *pAtCommand, uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t *pValues)
 {
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -633,7 +639,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Caly
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_SetOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATMQTT_SetOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -642,7 +648,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Caly
 	{
 	case Calypso_ATMQTT_SetOption_User:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, pValues->username, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->username, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -651,7 +657,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Caly
 
 	case Calypso_ATMQTT_SetOption_Password:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, pValues->password, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->password, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -662,26 +668,26 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Caly
 	{
 		Calypso_ATMQTT_SetWillParams_t *pWillValues = &pValues->will;
 
-		if (!ATCommand_AppendArgumentString(pAtCommand, pWillValues->topic, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pWillValues->topic, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 
-			if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[pWillValues->QoS], ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[pWillValues->QoS], ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pWillValues->retain, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pWillValues->retain, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pWillValues->messageLength, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pWillValues->messageLength, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
 
-			if (!ATCommand_AppendArgumentString(pAtCommand, pWillValues->message, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pWillValues->message, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -691,7 +697,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Caly
 
 		case Calypso_ATMQTT_SetOption_KeepAlive:
 		{
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->keepAliveSeconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->keepAliveSeconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -700,7 +706,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Caly
 
 		case Calypso_ATMQTT_SetOption_Clean:
 		{
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->clean, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->clean, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -714,7 +720,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char *pAtCommand, uint8_t index, Caly
 	}
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
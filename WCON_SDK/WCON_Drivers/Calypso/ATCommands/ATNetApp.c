@@ -98,7 +98,7 @@ static const char *Calypso_ATNetApp_DeviceOptionStrings[Calypso_ATNetApp_DeviceO
 		"URN",
 		"DOMAIN" };
 
-static bool Calypso_ATNetApp_AddStartStopArguments(char *pOutString, uint8_t apps);
+static bool Calypso_ATNetApp_AddStartStopArguments(ATCommand_Builder_t *pOutString, uint8_t apps);
 
 /**
  * @brief Starts one or more networking applications.
@@ -127,11 +127,12 @@ bool Calypso_ATNetApp_StartApplications(uint8_t apps)
 		}
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+netAppStart=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netAppStart=");
 
-	if (!Calypso_ATNetApp_AddStartStopArguments(pRequestCommand, apps))
+	if (!Calypso_ATNetApp_AddStartStopArguments(&requestCommand, apps))
 	{
 		return false;
 	}
@@ -170,11 +171,12 @@ bool Calypso_ATNetApp_StopApplications(uint8_t apps)
 		}
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+netAppStop=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netAppStop=");
 
-	if (!Calypso_ATNetApp_AddStartStopArguments(pRequestCommand, apps))
+	if (!Calypso_ATNetApp_AddStartStopArguments(&requestCommand, apps))
 	{
 		return false;
 	}
@@ -222,18 +224,19 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 				continue;
 			}
 
-			char *pRequestCommand = AT_commandBuffer;
-			strcpy(pRequestCommand, "AT+netAppSet=SNTP_CLIENT,server_address,");
+			char *pRequestCommand = Calypso_commandBuffer;
+			ATCommand_Builder_t requestCommand;
+			ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netAppSet=SNTP_CLIENT,server_address,");
 
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, i, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, i, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->sntp.servers[i], ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->sntp.servers[i], ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -250,10 +253,11 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		return true;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+netAppSet=");
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netAppSet=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_ApplicationStrings[appIdx], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_ApplicationStrings[appIdx], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -261,7 +265,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 	switch (app)
 	{
 	case Calypso_ATNetApp_Application_HttpServer:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_HttpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_HttpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -269,98 +273,98 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		switch (option)
 		{
 		case Calypso_ATNetApp_HttpOption_PrimPortNum:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.primPortNum, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->http.primPortNum, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_AuthCheck:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.authCheck, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->http.authCheck, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_AuthName:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.authName, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->http.authName, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_AuthPassword:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.authPassword, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->http.authPassword, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_AuthRealm:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.authRealm, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->http.authRealm, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_RomPagesAccess:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.romPagesAccess, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->http.romPagesAccess, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_SecondPortNum:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.secondPortNum, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->http.secondPortNum, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_SecondPortEn:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.secondPortEn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->http.secondPortEn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_PrimPortSecEn:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.primPortSecEn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->http.primPortSecEn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_PrivKeyFile:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.privKeyFile, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->http.privKeyFile, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_DevCertFile:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.devCertFile, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->http.devCertFile, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_CaCertFile:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.caCertFile, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->http.caCertFile, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_TmpRegisterService:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.tmpRegisterService, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->http.tmpRegisterService, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_HttpOption_TmpUnregisterService:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.tmpUnregisterService, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->http.tmpUnregisterService, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -372,7 +376,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		break;
 
 	case Calypso_ATNetApp_Application_DhcpServer:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DhcpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_DhcpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -380,15 +384,15 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		switch (option)
 		{
 		case Calypso_ATNetApp_DhcpOption_Basic:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->dhcp.basic.leaseTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->dhcp.basic.leaseTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->dhcp.basic.firstIpAddress, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->dhcp.basic.firstIpAddress, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->dhcp.basic.lastIpAddress, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->dhcp.basic.lastIpAddress, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -400,7 +404,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		break;
 
 	case Calypso_ATNetApp_Application_mDns:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_mDnsOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_mDnsOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -408,43 +412,43 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		switch (option)
 		{
 		case Calypso_ATNetApp_mDnsOption_ContQuery:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->mDns.contQuery, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->mDns.contQuery, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_mDnsOption_QeventMask:
-			if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATNetApp_mDnsEventMaskStrings, Calypso_ATNetApp_mDnsEventMask_NumberOfValues, value->mDns.qeventMask,
+			if (!ATCommand_BuilderAppendArgumentBitmask(&requestCommand, Calypso_ATNetApp_mDnsEventMaskStrings, Calypso_ATNetApp_mDnsEventMask_NumberOfValues, value->mDns.qeventMask,
 			ATCOMMAND_STRING_TERMINATE,
-			AT_MAX_COMMAND_BUFFER_SIZE))
+			CALYPSO_COMMAND_BUFFER_SIZE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_mDnsOption_TimingParams:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.period, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->mDns.timingParams.period, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.repetitions, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->mDns.timingParams.repetitions, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.telescopicFactor, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->mDns.timingParams.telescopicFactor, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.retransmissionInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->mDns.timingParams.retransmissionInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.maxPeriodInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->mDns.timingParams.maxPeriodInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.maxTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->mDns.timingParams.maxTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -461,7 +465,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 
 	case Calypso_ATNetApp_Application_SntpClient:
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_SntpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_SntpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -469,21 +473,21 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		switch (option)
 		{
 		case Calypso_ATNetApp_SntpOption_Enable:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->sntp.enable, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->sntp.enable, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_SntpOption_UpdateInterval:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->sntp.updateInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->sntp.updateInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_SntpOption_TimeZone:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->sntp.timeZone, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->sntp.timeZone, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -497,7 +501,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 	}
 
 	case Calypso_ATNetApp_Application_DnsClient:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DnsClientOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_DnsClientOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -505,11 +509,11 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		switch (option)
 		{
 		case Calypso_ATNetApp_DnsClientOption_Time:
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->dnsClient.time.maxResponseTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->dnsClient.time.maxResponseTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, value->dnsClient.time.numberOfRetries, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, value->dnsClient.time.numberOfRetries, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -521,7 +525,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		break;
 
 	case Calypso_ATNetApp_Application_Device:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DeviceOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_DeviceOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -529,14 +533,14 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		switch (option)
 		{
 		case Calypso_ATNetApp_DeviceOption_URN:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->device.urn, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->device.urn, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATNetApp_DeviceOption_Domain:
-			if (!ATCommand_AppendArgumentString(pRequestCommand, value->device.domain, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(&requestCommand, value->device.domain, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -551,7 +555,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -590,12 +594,13 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 
 	memset(value, 0, sizeof(*value));
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+netAppGet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netAppGet=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_ApplicationStrings[appIdx], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_ApplicationStrings[appIdx], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -603,21 +608,21 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 	switch (app)
 	{
 	case Calypso_ATNetApp_Application_HttpServer:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_HttpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_HttpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		break;
 
 	case Calypso_ATNetApp_Application_DhcpServer:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DhcpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_DhcpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		break;
 
 	case Calypso_ATNetApp_Application_mDns:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_mDnsOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_mDnsOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -628,21 +633,21 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		return false;
 
 	case Calypso_ATNetApp_Application_SntpClient:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_SntpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_SntpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		break;
 
 	case Calypso_ATNetApp_Application_DnsClient:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DnsClientOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_DnsClientOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		break;
 
 	case Calypso_ATNetApp_Application_Device:
-		if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DeviceOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetApp_DeviceOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -652,7 +657,7 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -945,12 +950,13 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
  */
 bool Calypso_ATNetApp_GetHostByName(const char *hostName, Calypso_ATSocket_Family_t family, Calypso_ATNetApp_GetHostByNameResult_t *lookupResult)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+netAppGetHostByName=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netAppGetHostByName=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, hostName, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, hostName, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -960,12 +966,12 @@ bool Calypso_ATNetApp_GetHostByName(const char *hostName, Calypso_ATSocket_Famil
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, temp, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, temp, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1015,44 +1021,45 @@ bool Calypso_ATNetApp_GetHostByName(const char *hostName, Calypso_ATSocket_Famil
  */
 bool Calypso_ATNetApp_Ping(Calypso_ATNetApp_PingParameters_t *parameters)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+netAppPing=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netAppPing=");
 
 	char temp[32];
 	if (!Calypso_ATSocket_GetSocketFamilyString(parameters->family, temp))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, temp, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, temp, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, parameters->destination, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, parameters->destination, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->size, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, parameters->size, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->delayMs, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, parameters->delayMs, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->timeoutMs, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, parameters->timeoutMs, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->maxNumberOfPings, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, parameters->maxNumberOfPings, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->mode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, parameters->mode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1089,13 +1096,13 @@ bool Calypso_ATNetApp_UpdateTime()
  *
  * @return true if successful, false otherwise
  */
-bool Calypso_ATNetApp_AddStartStopArguments(char *pOutString, uint8_t apps)
+bool Calypso_ATNetApp_AddStartStopArguments(ATCommand_Builder_t *pOutString, uint8_t apps)
 {
-	if (!ATCommand_AppendArgumentBitmask(pOutString, Calypso_ATNetApp_ApplicationStrings, Calypso_ATNetApp_Application_NumberOfValues, apps,
+	if (!ATCommand_BuilderAppendArgumentBitmask(pOutString, Calypso_ATNetApp_ApplicationStrings, Calypso_ATNetApp_Application_NumberOfValues, apps,
 	ATCOMMAND_STRING_TERMINATE,
-	AT_MAX_COMMAND_BUFFER_SIZE))
+	CALYPSO_COMMAND_BUFFER_SIZE))
 	{
 		return false;
 	}
-	return ATCommand_AppendArgumentString(pOutString, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pOutString, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
@@ -74,18 +74,19 @@ static const char *Calypso_ATNetCfg_IPv6MethodStrings[Calypso_ATNetCfg_IPv6Metho
  */
 bool Calypso_ATNetCfg_SetInterfaceModes(uint16_t modes)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+netCfgSet=IF,STATE,");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netCfgSet=IF,STATE,");
 
-	if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATNetCfg_InterfaceModeStrings, Calypso_ATNetCfg_InterfaceMode_NumberOfValues, modes,
+	if (!ATCommand_BuilderAppendArgumentBitmask(&requestCommand, Calypso_ATNetCfg_InterfaceModeStrings, Calypso_ATNetCfg_InterfaceMode_NumberOfValues, modes,
 	ATCOMMAND_STRING_TERMINATE,
-	AT_MAX_COMMAND_BUFFER_SIZE))
+	CALYPSO_COMMAND_BUFFER_SIZE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -111,11 +112,12 @@ bool Calypso_ATNetCfg_GetMacAddress(uint8_t macAddress[6])
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+netCfgGet=GET_MAC_ADDR");
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netCfgGet=GET_MAC_ADDR");
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -160,20 +162,21 @@ bool Calypso_ATNetCfg_SetMacAddress(uint8_t macAddress[6])
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+netCfgSet=SET_MAC_ADDR,,");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netCfgSet=SET_MAC_ADDR,,");
 
 	for (uint8_t i = 0; i < 6; i++)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, macAddress[i],
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, macAddress[i],
 		ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX, i < 5 ? ':' : ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -258,11 +261,12 @@ bool Calypso_ATNetCfg_GetIPv4Address(Calypso_ATNetCfg_IPv4Config_t *ipConfig, bo
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, ap ? "AT+netCfgGet=IPV4_AP_ADDR" : "AT+netCfgGet=IPV4_STA_ADDR");
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), ap ? "AT+netCfgGet=IPV4_AP_ADDR" : "AT+netCfgGet=IPV4_STA_ADDR");
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -347,41 +351,42 @@ bool Calypso_ATNetCfg_SetIPv4Address(Calypso_ATNetCfg_IPv4Config_t *ipConfig, bo
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, ap ? "AT+netCfgSet=IPV4_AP_ADDR," : "AT+netCfgSet=IPV4_STA_ADDR,");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), ap ? "AT+netCfgSet=IPV4_AP_ADDR," : "AT+netCfgSet=IPV4_STA_ADDR,");
 
 	if (ap)
 	{
 		ipConfig->method = Calypso_ATNetCfg_IPv4Method_Static;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetCfg_IPv4MethodStrings[ipConfig->method], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetCfg_IPv4MethodStrings[ipConfig->method], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (Calypso_ATNetCfg_IPv4Method_Static == ipConfig->method)
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->ipAddress, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ipConfig->ipAddress, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->subnetMask, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ipConfig->subnetMask, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->gatewayAddress, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ipConfig->gatewayAddress, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->dnsAddress, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ipConfig->dnsAddress, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -453,11 +458,12 @@ bool Calypso_ATNetCfg_GetIPv6Address(Calypso_ATNetCfg_IPv6Config_t *ipConfig, bo
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, global ? "AT+netCfgGet=IPV6_ADDR_GLOBAL" : "AT+netCfgGet=IPV6_ADDR_LOCAL");
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), global ? "AT+netCfgGet=IPV6_ADDR_GLOBAL" : "AT+netCfgGet=IPV6_ADDR_LOCAL");
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -521,26 +527,27 @@ bool Calypso_ATNetCfg_SetIPv6Address(Calypso_ATNetCfg_IPv6Config_t *ipConfig, bo
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, global ? "AT+netCfgSet=IPV6_ADDR_GLOBAL," : "AT+netCfgSet=IPV6_ADDR_LOCAL,");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), global ? "AT+netCfgSet=IPV6_ADDR_GLOBAL," : "AT+netCfgSet=IPV6_ADDR_LOCAL,");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetCfg_IPv6MethodStrings[ipConfig->method], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATNetCfg_IPv6MethodStrings[ipConfig->method], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->ipAddress, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ipConfig->ipAddress, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->dnsAddress, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ipConfig->dnsAddress, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -563,20 +570,21 @@ bool Calypso_ATNetCfg_DisconnectApStation(uint8_t macAddress[6])
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+netCfgSet=AP_STATION_DISCONNECT,,");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netCfgSet=AP_STATION_DISCONNECT,,");
 
 	for (uint8_t i = 0; i < 6; i++)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, macAddress[i],
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, macAddress[i],
 		ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX, i < 5 ? ':' : ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -599,11 +607,12 @@ bool Calypso_ATNetCfg_GetIPv4DnsClient(char dns2ndServerAddress[16])
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+netCfgGet=IPV4_DNS_CLIENT");
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netCfgGet=IPV4_DNS_CLIENT");
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -640,12 +649,13 @@ bool Calypso_ATNetCfg_SetIPv4DnsClient(const char dns2ndServerAddress[16])
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+netCfgSet=IPV4_DNS_CLIENT,,");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+netCfgSet=IPV4_DNS_CLIENT,,");
 
-	ATCommand_AppendArgumentString(pRequestCommand, dns2ndServerAddress, ATCOMMAND_STRING_TERMINATE);
-	ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderAppendArgumentString(&requestCommand, dns2ndServerAddress, ATCOMMAND_STRING_TERMINATE);
+	ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 	if (!Calypso_SendRequest(pRequestCommand))
 	{
@@ -31,6 +31,11 @@
 #include <Calypso/Calypso.h>
 #include <global/global.h>
 
+static const ATCommand_CommandName_t ATSocketSendCommandName = ATCOMMAND_COMMAND_NAME("send");
+static const ATCommand_CommandName_t ATSocketSendToCommandName = ATCOMMAND_COMMAND_NAME("sendTo");
+static const ATCommand_CommandName_t ATSocketRecvCommandName = ATCOMMAND_COMMAND_NAME("recv");
+static const ATCommand_CommandName_t ATSocketRecvFromCommandName = ATCOMMAND_COMMAND_NAME("recvFrom");
+
 static const char *ATSocketFamilyString[Calypso_ATSocket_Family_NumberOfValues] = {
 		"INET",
 		"INET6" };
@@ -100,12 +105,13 @@ static const char *Calypso_ATSocket_CipherStrings[Calypso_ATSocket_Cipher_Number
 		"TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256",
 		"TLS_DHE_RSA_WITH_CHACHA20_POLY1305_SHA256" };
 
-static bool Calypso_ATSocket_AddArgumentsCreate(char *pAtCommand, Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol);
-static bool Calypso_ATSocket_AddArgumentsBindConnect(char *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socket);
-static bool Calypso_ATSocket_AddArgumentsRecv(char *pAtCommand, uint8_t socketID, Calypso_DataFormat_t format, uint16_t length);
-static bool Calypso_ATSocket_AddArgumentsRecvFrom(char *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socketFrom, Calypso_DataFormat_t format, uint16_t length);
-static bool Calypso_ATSocket_AddArgumentsSendTo(char *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format, uint16_t length, char *data);
-static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char *pAtCommand, uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t *data);
+static bool Calypso_ATSocket_AddArgumentsCreate(ATCommand_Builder_t *pAtCommand, Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol);
+static bool Calypso_ATSocket_AddArgumentsBindConnect(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socket);
+static bool Calypso_ATSocket_AddArgumentsRecv(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_DataFormat_t format, uint16_t length);
+static bool Calypso_ATSocket_AddArgumentsRecvFrom(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socketFrom, Calypso_DataFormat_t format, uint16_t length);
+static bool Calypso_ATSocket_AddArgumentsSendTo(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format, uint16_t length);
+static bool Calypso_ATSocket_BuildSendHeader(char *pBuffer, uint16_t bufferSize, uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format, bool encodeAsBase64, uint16_t length, const ATCommand_CommandName_t **pCommandName);
+static bool Calypso_ATSocket_AddArgumentsSetSockOpt(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t *data);
 
 static bool Calypso_ATSocket_ParseResponseCreate(char **pAtCommand, uint8_t *pOutSocketID);
 static bool Calypso_ATSocket_ParseResponseGetOptions(Calypso_ATSocket_SockOptLevel_t level, uint8_t option, char **pAtCommand, Calypso_ATSocket_Options_t *pValues);
@@ -124,12 +130,13 @@ static bool Calypso_ATSocket_ParseResponseGetOptions(Calypso_ATSocket_SockOptLev
 bool Calypso_ATSocket_Create(Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol, uint8_t *socketID)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+socket=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+socket=");
 
-	if (!Calypso_ATSocket_AddArgumentsCreate(pRequestCommand, family, type, protocol))
+	if (!Calypso_ATSocket_AddArgumentsCreate(&requestCommand, family, type, protocol))
 	{
 		return false;
 	}
@@ -157,16 +164,17 @@ bool Calypso_ATSocket_Create(Calypso_ATSocket_Family_t family, Calypso_ATSocket_
 bool Calypso_ATSocket_Close(uint8_t socketID)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+close=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+close=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -190,11 +198,12 @@ bool Calypso_ATSocket_Close(uint8_t socketID)
 bool Calypso_ATSocket_Bind(uint8_t socketID, Calypso_ATSocket_Descriptor_t socket)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+bind=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+bind=");
 
-	if (!Calypso_ATSocket_AddArgumentsBindConnect(pRequestCommand, socketID, socket))
+	if (!Calypso_ATSocket_AddArgumentsBindConnect(&requestCommand, socketID, socket))
 	{
 		return false;
 	}
@@ -217,21 +226,22 @@ bool Calypso_ATSocket_Bind(uint8_t socketID, Calypso_ATSocket_Descriptor_t socke
 bool Calypso_ATSocket_Listen(uint8_t socketID, uint16_t backlog)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+listen=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+listen=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, backlog, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, backlog, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -255,11 +265,12 @@ bool Calypso_ATSocket_Listen(uint8_t socketID, uint16_t backlog)
 bool Calypso_ATSocket_Connect(uint8_t socketID, Calypso_ATSocket_Descriptor_t remoteSocket)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+connect=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+connect=");
 
-	if (!Calypso_ATSocket_AddArgumentsBindConnect(pRequestCommand, socketID, remoteSocket))
+	if (!Calypso_ATSocket_AddArgumentsBindConnect(&requestCommand, socketID, remoteSocket))
 	{
 		return false;
 	}
@@ -282,21 +293,22 @@ bool Calypso_ATSocket_Connect(uint8_t socketID, Calypso_ATSocket_Descriptor_t re
 bool Calypso_ATSocket_Accept(uint8_t socketID, Calypso_ATSocket_Family_t family)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+accept=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+accept=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATSocketFamilyString[family], ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATSocketFamilyString[family], ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -311,7 +323,8 @@ bool Calypso_ATSocket_Accept(uint8_t socketID, Calypso_ATSocket_Family_t family)
 /**
  * @brief Trigger receiving of data via the supplied local socket (using the AT+recv command).
  *
- * Note that any received data is provided asynchronously in events of type Calypso_ATEvent_SocketRcvd.
+ * Note that any received data is provided asynchronously in events of type Calypso_ATEvent_SocketRcvd
+ * or written to a buffer posted using Calypso_PostSocketReceiveBuffer().
  *
  * @param[in] socketID ID of the local socket which should receive
  * @param[in] format Format in which the data is to be provided. Setting the format to Calypso_DataFormat_Base64
@@ -323,16 +336,17 @@ bool Calypso_ATSocket_Accept(uint8_t socketID, Calypso_ATSocket_Family_t family)
 bool Calypso_ATSocket_Receive(uint8_t socketID, Calypso_DataFormat_t format, uint16_t length)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+recv=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+recv=");
 
-	if (!Calypso_ATSocket_AddArgumentsRecv(pRequestCommand, socketID, format, length))
+	if (!Calypso_ATSocket_AddArgumentsRecv(&requestCommand, socketID, format, length))
 	{
 		return false;
 	}
 
-	if (!Calypso_SendRequest(pRequestCommand))
+	if (!Calypso_SendRequestWithCommandName(pRequestCommand, &ATSocketRecvCommandName))
 	{
 		return false;
 	}
@@ -342,7 +356,8 @@ bool Calypso_ATSocket_Receive(uint8_t socketID, Calypso_DataFormat_t format, uin
 /**
  * Trigger receiving of data from the supplied remote socket via the supplied local socket (using the AT+recvFrom command).
  *
- * Note that any received data is provided asynchronously in events of type Calypso_ATEvent_SocketRcvdFrom.
+ * Note that any received data is provided asynchronously in events of type Calypso_ATEvent_SocketRcvdFrom
+ * or written to a buffer posted using Calypso_PostSocketReceiveBuffer().
  *
  * @param[in] socketID ID of the local socket which should receive
  * @param[in] remoteSocket Remote socket from which the data should be received
@@ -355,15 +370,16 @@ bool Calypso_ATSocket_Receive(uint8_t socketID, Calypso_DataFormat_t format, uin
 bool Calypso_ATSocket_ReceiveFrom(uint8_t socketID, Calypso_ATSocket_Descriptor_t remoteSocket, Calypso_DataFormat_t format, uint16_t length)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+recvFrom=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+recvFrom=");
 
-	if (!Calypso_ATSocket_AddArgumentsRecvFrom(pRequestCommand, socketID, remoteSocket, format, length))
+	if (!Calypso_ATSocket_AddArgumentsRecvFrom(&requestCommand, socketID, remoteSocket, format, length))
 	{
 		return false;
 	}
-	if (!Calypso_SendRequest(pRequestCommand))
+	if (!Calypso_SendRequestWithCommandName(pRequestCommand, &ATSocketRecvFromCommandName))
 	{
 		return false;
 	}
@@ -418,80 +434,30 @@ bool encodeAsBase64, uint16_t length, char *data, uint16_t *bytesSent)
 {
 	*bytesSent = 0;
 
-	if (encodeAsBase64)
-	{
-		/* Base64 encoded data might exceed the max. chunk size. To limit the required buffer size,
-		 * the data is encoded in chunks, if necessary. */
-
-		uint16_t maxChunkSize = (((CALYPSO_MAX_PAYLOAD_SIZE - 1) * 3) / 4) - 2;
-		uint16_t chunkSize = 0;
-		for (uint16_t chunkOffset = 0; chunkOffset < length; chunkOffset += chunkSize)
-		{
-			chunkSize = length - chunkOffset;
-			if (chunkSize > maxChunkSize)
-			{
-				chunkSize = maxChunkSize;
-			}
-
-			/* Encode as Base64 */
-			uint32_t lengthEncoded;
-			if (!Base64_GetEncBufSize(chunkSize, &lengthEncoded))
-			{
-				return false;
-			}
-			char base64Buffer[lengthEncoded];
-			if (!Base64_Encode((uint8_t*) data + chunkOffset, chunkSize, (uint8_t*) base64Buffer, &lengthEncoded))
-			{
-				return false;
-			}
-
-			/* Recursively call Calypso_ATSocket_Send() with the encoded binary data (excluding '\0') */
-			uint16_t chunkBytesWritten = 0;
-			bool ok = Calypso_ATSocket_SendTo(socketID, remoteSocket, format,
-			false, lengthEncoded, base64Buffer, &chunkBytesWritten);
-			if (!ok)
-			{
-				return false;
-			}
-
-			*bytesSent += chunkSize;
-		}
-
-		return true;
-	}
-
-	/* Send data using either AT+send or AT+sendTo, splitting the payload into
-	 * chunks of max. CALYPSO_MAX_PAYLOAD_SIZE, if necessary. */
+	/* Send data using either AT+send or AT+sendTo, splitting the payload into chunks, if necessary.
+	 * Only the command header is assembled in Calypso_commandBuffer, the payload is streamed
+	 * to the module directly from the supplied buffer (and Base64 encoded on the fly, if requested). */
+	uint16_t maxChunkSize = Calypso_ATSocket_GetMaxSendLength(encodeAsBase64);
 	uint16_t chunkBytesSent = 0;
 	for (uint16_t chunkOffset = 0; chunkOffset < length; chunkOffset += chunkBytesSent)
 	{
 		uint16_t chunkSize = length - chunkOffset;
-		if (chunkSize > CALYPSO_MAX_PAYLOAD_SIZE)
+		if (chunkSize > maxChunkSize)
 		{
-			chunkSize = CALYPSO_MAX_PAYLOAD_SIZE;
+			chunkSize = maxChunkSize;
 		}
 
-		char *pRequestCommand = AT_commandBuffer;
-
-		if (NULL == remoteSocket)
-		{
-			/* Stream / TCP */
-			strcpy(pRequestCommand, "AT+send=");
-		}
-		else
-		{
-			/* Datagram / UDP */
-			strcpy(pRequestCommand, "AT+sendTo=");
-		}
+		char *pRequestCommand = Calypso_commandBuffer;
+		const ATCommand_CommandName_t *commandName;
 
-		if (!Calypso_ATSocket_AddArgumentsSendTo(pRequestCommand, socketID, remoteSocket, format, chunkSize, data + chunkOffset))
+		if (!Calypso_ATSocket_BuildSendHeader(Calypso_commandBuffer, sizeof(Calypso_commandBuffer), socketID, remoteSocket, format, encodeAsBase64, chunkSize, &commandName))
 		{
 			return false;
 		}
 
 		chunkBytesSent = chunkSize;
 
-		if (!Calypso_SendRequest(pRequestCommand))
+		if (!Calypso_SendRequestWithPayload(pRequestCommand, (const uint8_t*) data + chunkOffset, chunkSize, encodeAsBase64, commandName))
 		{
 			return false;
 		}
@@ -511,6 +477,62 @@ bool encodeAsBase64, uint16_t length, char *data, uint16_t *bytesSent)
 	return true;
 }
 
+/**
+ * @brief Queues data to be sent via the supplied local socket (using the AT+send or AT+sendTo command)
+ * without waiting for the confirmation.
+ *
+ * Asynchronous variant of Calypso_ATSocket_SendTo(), which uses Calypso_SendRequestWithPayloadAsync().
+ * The complete command (header and payload, Base64 encoded if requested) is assembled in the
+ * supplied request object instead of Calypso_commandBuffer, so the application may queue several
+ * chunks (using one request object per chunk) and prepare further data while earlier chunks
+ * are being sent. The requests are processed by Calypso_ProcessRequests().
+ *
+ * Unlike Calypso_ATSocket_SendTo(), the data is not split into chunks, i.e. length must not
+ * exceed Calypso_ATSocket_GetMaxSendLength().
+ *
+ * @param[out] request Request object receiving the command. Must not be modified
+ *             until the request has been completed.
+ * @param[in] socketID ID of the local socket via which the data should be sent
+ * @param[in] remoteSocket Remote socket to which the data should be sent (optional, is
+ *            only used while the command is being assembled)
+ * @param[in] format Format in which the data is provided (see Calypso_ATSocket_SendTo())
+ * @param[in] encodeAsBase64 Encode the data in Base64 format before sending it to the Calypso module
+ * @param[in] length Number of bytes to be sent
+ * @param[in] data Data to be sent. Is copied to the request object, i.e. may be modified as soon
+ *            as this function returns.
+ * @param[in] callback Function to be called when the request has been completed (optional)
+ * @param[in] context Pointer passed to callback (optional)
+ *
+ * @return true if the request has been queued, false otherwise
+ */
+bool Calypso_ATSocket_SendAsync(Calypso_ATSocket_SendRequest_t *request, uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format, bool encodeAsBase64, uint16_t length, const char *data, Calypso_RequestCompleteCallback_t callback, void *context)
+{
+	if ((NULL == request) || (length > Calypso_ATSocket_GetMaxSendLength(encodeAsBase64)))
+	{
+		return false;
+	}
+
+	const ATCommand_CommandName_t *commandName;
+	if (!Calypso_ATSocket_BuildSendHeader(request->command, CALYPSO_ATSOCKET_SEND_HEADER_SIZE, socketID, remoteSocket, format, encodeAsBase64, length, &commandName))
+	{
+		return false;
+	}
+
+	return Calypso_SendRequestWithPayloadAsync(request->command, sizeof(request->command), (const uint8_t*) data, length, encodeAsBase64, commandName, Calypso_GetTimeout(Calypso_Timeout_General), callback, context);
+}
+
+/**
+ * @brief Returns the max. number of bytes that can be sent using a single AT+send or AT+sendTo command.
+ *
+ * @param[in] encodeAsBase64 True if the data is Base64 encoded before sending it to the Calypso module
+ *
+ * @return Max. number of bytes (before encoding)
+ */
+uint16_t Calypso_ATSocket_GetMaxSendLength(bool encodeAsBase64)
+{
+	return encodeAsBase64 ? ((((CALYPSO_MAX_PAYLOAD_SIZE - 1) * 3) / 4) - 2) : CALYPSO_MAX_PAYLOAD_SIZE;
+}
+
 /**
  * @brief Sets socket options (using the AT+setSockOpt command).
  *
@@ -524,11 +546,12 @@ bool encodeAsBase64, uint16_t length, char *data, uint16_t *bytesSent)
 bool Calypso_ATSocket_SetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t *pValues)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+setSockOpt=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+setSockOpt=");
 
-	if (!Calypso_ATSocket_AddArgumentsSetSockOpt(pRequestCommand, socketID, level, option, pValues))
+	if (!Calypso_ATSocket_AddArgumentsSetSockOpt(&requestCommand, socketID, level, option, pValues))
 	{
 		return false;
 	}
@@ -552,17 +575,18 @@ bool Calypso_ATSocket_SetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
  */
 bool Calypso_ATSocket_GetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t *pValues)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+getSockOpt=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+getSockOpt=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATSocketSockOptLevelString[level], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATSocketSockOptLevelString[level], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -574,14 +598,14 @@ bool Calypso_ATSocket_GetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
 			/* Not supported */
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATSocketSockOptSocketString[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATSocketSockOptSocketString[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 	else if (Calypso_ATSocket_SockOptLevel_IP == level)
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATSocketSockOptIPString[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATSocketSockOptIPString[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -591,7 +615,7 @@ bool Calypso_ATSocket_GetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -617,24 +641,24 @@ bool Calypso_ATSocket_GetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
  *
  * @return true if successful, false otherwise
  */
-bool Calypso_ATSocket_AppendSocketDescriptor(char *pAtCommand, Calypso_ATSocket_Descriptor_t socket, char lastDelim)
+bool Calypso_ATSocket_AppendSocketDescriptor(ATCommand_Builder_t *pAtCommand, Calypso_ATSocket_Descriptor_t socket, char lastDelim)
 {
 	if (socket.family >= Calypso_ATSocket_Family_NumberOfValues)
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketFamilyString[socket.family], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATSocketFamilyString[socket.family], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, socket.port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, socket.port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, socket.address, lastDelim);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, socket.address, lastDelim);
 
 }
 
@@ -648,7 +672,7 @@ bool Calypso_ATSocket_AppendSocketDescriptor(char *pAtCommand, Calypso_ATSocket_
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsCreate(char *pAtCommand, Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol)
+static bool Calypso_ATSocket_AddArgumentsCreate(ATCommand_Builder_t *pAtCommand, Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol)
 {
 
 	if (family >= Calypso_ATSocket_Family_NumberOfValues)
@@ -656,7 +680,7 @@ static bool Calypso_ATSocket_AddArgumentsCreate(char *pAtCommand, Calypso_ATSock
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketFamilyString[family], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATSocketFamilyString[family], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -666,7 +690,7 @@ static bool Calypso_ATSocket_AddArgumentsCreate(char *pAtCommand, Calypso_ATSock
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketTypeString[type], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATSocketTypeString[type], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -676,12 +700,12 @@ static bool Calypso_ATSocket_AddArgumentsCreate(char *pAtCommand, Calypso_ATSock
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketProcotolString[protocol], ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATSocketProcotolString[protocol], ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
@@ -693,10 +717,10 @@ static bool Calypso_ATSocket_AddArgumentsCreate(char *pAtCommand, Calypso_ATSock
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsBindConnect(char *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socket)
+static bool Calypso_ATSocket_AddArgumentsBindConnect(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socket)
 {
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -706,7 +730,7 @@ static bool Calypso_ATSocket_AddArgumentsBindConnect(char *pAtCommand, uint8_t s
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
@@ -719,7 +743,7 @@ static bool Calypso_ATSocket_AddArgumentsBindConnect(char *pAtCommand, uint8_t s
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsRecv(char *pAtCommand, uint8_t socketID, Calypso_DataFormat_t format, uint16_t length)
+static bool Calypso_ATSocket_AddArgumentsRecv(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_DataFormat_t format, uint16_t length)
 {
 
 	if (format >= Calypso_DataFormat_NumberOfValues)
@@ -727,23 +751,23 @@ static bool Calypso_ATSocket_AddArgumentsRecv(char *pAtCommand, uint8_t socketID
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, length < CALYPSO_MAX_PAYLOAD_SIZE ? length : CALYPSO_MAX_PAYLOAD_SIZE, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ),
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, length < CALYPSO_MAX_PAYLOAD_SIZE ? length : CALYPSO_MAX_PAYLOAD_SIZE, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ),
 	ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -758,10 +782,10 @@ static bool Calypso_ATSocket_AddArgumentsRecv(char *pAtCommand, uint8_t socketID
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsRecvFrom(char *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socketFrom, Calypso_DataFormat_t format, uint16_t length)
+static bool Calypso_ATSocket_AddArgumentsRecvFrom(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socketFrom, Calypso_DataFormat_t format, uint16_t length)
 {
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -771,41 +795,43 @@ static bool Calypso_ATSocket_AddArgumentsRecvFrom(char *pAtCommand, uint8_t sock
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, length < CALYPSO_MAX_PAYLOAD_SIZE ? length : CALYPSO_MAX_PAYLOAD_SIZE, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ),
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, length < CALYPSO_MAX_PAYLOAD_SIZE ? length : CALYPSO_MAX_PAYLOAD_SIZE, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ),
 	ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
 /**
  * @brief Adds arguments to the AT+send or AT+sendTo command string.
  *
+ * Adds all arguments preceding the payload (the string ends with the argument
+ * delimiter). The payload is sent using Calypso_SendRequestWithPayload().
+ *
  * @param[out] pAtCommand The AT command string to add the arguments to
  * @param[in] socketID ID of the local socket via which the data should be sent
  * @param[in] remoteSocket Remote socket to which the data should be sent. Optional (to be used with AT+sendTo).
  * @param[in] format Format in which the data is provided
  * @param[in] length Number of bytes to be sent
- * @param[in] data Data to be sent
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsSendTo(char *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format, uint16_t length, char *data)
+static bool Calypso_ATSocket_AddArgumentsSendTo(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format, uint16_t length)
 {
 	if (format >= Calypso_DataFormat_NumberOfValues)
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -818,22 +844,53 @@ static bool Calypso_ATSocket_AddArgumentsSendTo(char *pAtCommand, uint8_t socket
 		}
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	return ATCommand_BuilderAppendArgumentInt(pAtCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM);
+}
+
+/**
+ * @brief Assembles the header of an AT+send or AT+sendTo command (i.e. the command without payload and line ending).
+ *
+ * @param[out] pBuffer Buffer receiving the header
+ * @param[in] bufferSize Size of buffer
+ * @param[in] socketID ID of the local socket via which the data should be sent
+ * @param[in] remoteSocket Remote socket to which the data should be sent (NULL to use AT+send)
+ * @param[in] format Format in which the data is provided
+ * @param[in] encodeAsBase64 True if the payload is Base64 encoded while being sent
+ * @param[in] length Number of payload bytes (before encoding)
+ * @param[out] pCommandName Name of the assembled command
+ *
+ * @return true if successful, false otherwise
+ */
+static bool Calypso_ATSocket_BuildSendHeader(char *pBuffer, uint16_t bufferSize, uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format, bool encodeAsBase64, uint16_t length, const ATCommand_CommandName_t **pCommandName)
+{
+	/* Length argument is the number of bytes transmitted to the module (i.e. after encoding) */
+	uint32_t transmitLength = length;
+	if (encodeAsBase64 && !Base64_GetEncBufSize(length, &transmitLength))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentBytes(pAtCommand, data, length, ATCOMMAND_STRING_TERMINATE))
+	ATCommand_Builder_t requestCommand;
+
+	if (NULL == remoteSocket)
 	{
-		return false;
+		/* Stream / TCP */
+		ATCommand_BuilderInit(&requestCommand, pBuffer, bufferSize, "AT+send=");
+		*pCommandName = &ATSocketSendCommandName;
+	}
+	else
+	{
+		/* Datagram / UDP */
+		ATCommand_BuilderInit(&requestCommand, pBuffer, bufferSize, "AT+sendTo=");
+		*pCommandName = &ATSocketSendToCommandName;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return Calypso_ATSocket_AddArgumentsSendTo(&requestCommand, socketID, remoteSocket, format, (uint16_t) transmitLength);
 }
 
 /**
@@ -847,22 +904,22 @@ static bool Calypso_ATSocket_AddArgumentsSendTo(char *pAtCommand, uint8_t socket
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char *pAtCommand, uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t *pValues)
+static bool Calypso_ATSocket_AddArgumentsSetSockOpt(ATCommand_Builder_t *pAtCommand, uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t *pValues)
 {
 
-	if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketSockOptLevelString[level], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATSocketSockOptLevelString[level], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
 	if (Calypso_ATSocket_SockOptLevel_Socket == level)
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketSockOptSocketString[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATSocketSockOptSocketString[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -870,53 +927,53 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char *pAtCommand, uint8_t so
 		switch (option)
 		{
 		case Calypso_ATSocket_SockOptSocket_KeepAlive:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->keepAlive, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->keepAlive, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATSocket_SockOptSocket_KeepAliveTime:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->keepAliveTimeSeconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->keepAliveTimeSeconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATSocket_SockOptSocket_RXNoIPBoundary:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->rxNoIpBoundary, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->rxNoIpBoundary, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATSocket_SockOptSocket_RCVTimeout:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->rcvTimeout.seconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->rcvTimeout.seconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->rcvTimeout.microseconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->rcvTimeout.microseconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATSocket_SockOptSocket_RCVBuf:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->rcvBuf, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->rcvBuf, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATSocket_SockOptSocket_NonBlocking:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->nonBlocking, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->nonBlocking, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATSocket_SockOptSocket_SecMethod:
-			if (!ATCommand_AppendArgumentString(pAtCommand, AtSocketSockOptSecMethod[pValues->secMethod], ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, AtSocketSockOptSecMethod[pValues->secMethod], ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -934,21 +991,21 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char *pAtCommand, uint8_t so
 		case Calypso_ATSocket_SockOptSocket_SecureFilesCertificateFileName:
 		case Calypso_ATSocket_SockOptSocket_SecureFilesDHKeyFileName:
 			/* File name strings to append */
-			if (!ATCommand_AppendArgumentString(pAtCommand, pValues->fileName, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->fileName, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATSocket_SockOptSocket_SecureDomainNameVerification:
-			if (!ATCommand_AppendArgumentString(pAtCommand, pValues->secureDomainNameVerification, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->secureDomainNameVerification, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATSocket_SockOptSocket_DisableCertificateStore:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->disableCertificateStore, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->disableCertificateStore, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -963,7 +1020,7 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char *pAtCommand, uint8_t so
 	}
 	else if (Calypso_ATSocket_SockOptLevel_IP == level)
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketSockOptIPString[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, ATSocketSockOptIPString[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -971,7 +1028,7 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char *pAtCommand, uint8_t so
 		switch (option)
 		{
 		case Calypso_ATSocket_SockOptIP_MulticastTTL:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->multicastTTL, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->multicastTTL, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -979,11 +1036,11 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char *pAtCommand, uint8_t so
 
 		case Calypso_ATSocket_SockOptIP_AddMembership:
 		case Calypso_ATSocket_SockOptIP_DropMembership:
-			if (!ATCommand_AppendArgumentString(pAtCommand, pValues->multicastGroup.ipv4Address, ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->multicastGroup.ipv4Address, ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentString(pAtCommand, pValues->multicastGroup.interfaceAddress, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->multicastGroup.interfaceAddress, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -999,7 +1056,7 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char *pAtCommand, uint8_t so
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -1214,13 +1271,13 @@ bool Calypso_ATSocket_GetSocketFamilyString(Calypso_ATSocket_Family_t family, ch
 }
 
 /**
- * @brief Appends cipher mask flags to the supplied string.
+ * @brief Appends cipher mask flags to the supplied AT command.
  *
- * @param[out] pOutStr The string to which the flags should be added (must be null terminated)
+ * @param[out] pAtCommand The AT command to which the flags should be added
  * @param[in] cipherMask Cipher mask flags (see Calypso_ATSocket_Cipher_t)
  */
-bool Calypso_ATSocket_AppendCipherMask(char *pOutStr, uint32_t cipherMask)
+bool Calypso_ATSocket_AppendCipherMask(ATCommand_Builder_t *pAtCommand, uint32_t cipherMask)
 {
-	return ATCommand_AppendArgumentBitmask(pOutStr, Calypso_ATSocket_CipherStrings, Calypso_ATSocket_Cipher_NumberOfValues, cipherMask,
-	ATCOMMAND_STRING_TERMINATE, AT_MAX_COMMAND_BUFFER_SIZE);
+	return ATCommand_BuilderAppendArgumentBitmask(pAtCommand, Calypso_ATSocket_CipherStrings, Calypso_ATSocket_Cipher_NumberOfValues, cipherMask,
+	ATCOMMAND_STRING_TERMINATE, CALYPSO_COMMAND_BUFFER_SIZE);
 }
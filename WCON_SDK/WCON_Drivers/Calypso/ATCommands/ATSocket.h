@@ -217,6 +217,29 @@ typedef union Calypso_ATSocket_Options_t
 	Calypso_ATSocket_MulticastGroup_t multicastGroup; /**< Used for joining/leaving a multicast group (UDP, used with Calypso_ATSocket_SockOptIP_AddMembership, Calypso_ATSocket_SockOptIP_DropMembership) */
 } Calypso_ATSocket_Options_t;
 
+/**
+ * @brief Max. size of the command header of an asynchronous send request.
+ * @see Calypso_ATSocket_SendRequest_t
+ */
+#define CALYPSO_ATSOCKET_SEND_HEADER_SIZE 128
+
+/**
+ * @brief Size of the buffer holding the complete command (header, payload and line ending)
+ * of an asynchronous send request.
+ * @see Calypso_ATSocket_SendRequest_t
+ */
+#define CALYPSO_ATSOCKET_SEND_COMMAND_SIZE (CALYPSO_ATSOCKET_SEND_HEADER_SIZE + CALYPSO_MAX_PAYLOAD_SIZE + 2)
+
+/**
+ * @brief Request object used for sending data asynchronously using Calypso_ATSocket_SendAsync().
+ *
+ * Is owned by the caller and must stay valid until the request has been completed.
+ */
+typedef struct Calypso_ATSocket_SendRequest_t
+{
+	char command[CALYPSO_ATSOCKET_SEND_COMMAND_SIZE]; /**< Complete command (is assembled by Calypso_ATSocket_SendAsync()) */
+} Calypso_ATSocket_SendRequest_t;
+
 extern bool Calypso_ATSocket_Create(Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol, uint8_t *socketID);
 extern bool Calypso_ATSocket_Close(uint8_t socketID);
 extern bool Calypso_ATSocket_Bind(uint8_t socketID, Calypso_ATSocket_Descriptor_t socket);
@@ -232,11 +255,14 @@ bool encodeAsBase64, uint16_t length, char *data, uint16_t *bytesSent);
 extern bool Calypso_ATSocket_SendTo(uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format,
 bool encodeAsBase64, uint16_t length, char *data, uint16_t *bytesSent);
 
+extern bool Calypso_ATSocket_SendAsync(Calypso_ATSocket_SendRequest_t *request, uint8_t socketID, Calypso_ATSocket_Descriptor_t *remoteSocket, Calypso_DataFormat_t format, bool encodeAsBase64, uint16_t length, const char *data, Calypso_RequestCompleteCallback_t callback, void *context);
+extern uint16_t Calypso_ATSocket_GetMaxSendLength(bool encodeAsBase64);
+
 extern bool Calypso_ATSocket_ParseSocketFamily(const char *familyString, Calypso_ATSocket_Family_t *pOutFamily);
 extern bool Calypso_ATSocket_GetSocketFamilyString(Calypso_ATSocket_Family_t family, char *pOutFamilyStr);
 
-extern bool Calypso_ATSocket_AppendSocketDescriptor(char *pAtCommand, Calypso_ATSocket_Descriptor_t socket, char lastDelim);
-extern bool Calypso_ATSocket_AppendCipherMask(char *pOutStr, uint32_t cipherMask);
+extern bool Calypso_ATSocket_AppendSocketDescriptor(ATCommand_Builder_t *pAtCommand, Calypso_ATSocket_Descriptor_t socket, char lastDelim);
+extern bool Calypso_ATSocket_AppendCipherMask(ATCommand_Builder_t *pAtCommand, uint32_t cipherMask);
 
 #ifdef __cplusplus
 }
@@ -160,9 +160,9 @@ static const char *Calypso_ATWLAN_SecurityStatusStrings[Calypso_ATWLAN_SecurityS
 static bool Calypso_ATWLAN_IsInputValidWlanGet(Calypso_ATWLAN_SetID_t id, uint8_t option);
 static bool Calypso_ATWLAN_IsInputValidWlanSet(Calypso_ATWLAN_SetID_t id, uint8_t option);
 
-static bool Calypso_ATWLAN_AddConnectionArguments(char *pOutString, Calypso_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim);
-static bool Calypso_ATWLAN_AddArgumentsWlanGet(char *pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option);
-static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLAN_Settings_t *pValues);
+static bool Calypso_ATWLAN_AddConnectionArguments(ATCommand_Builder_t *pOutString, Calypso_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim);
+static bool Calypso_ATWLAN_AddArgumentsWlanGet(ATCommand_Builder_t *pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option);
+static bool Calypso_ATWLAN_AddArgumentsWlanSet(ATCommand_Builder_t *pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLAN_Settings_t *pValues);
 
 static bool Calypso_ATWLAN_ParseResponseWlanScanEntry(char **pAtCommand, Calypso_ATWLAN_ScanEntry_t *pOutScanEntry);
 static bool Calypso_ATWLAN_ParseResponseWlanAddProfile(char **pAtCommand, uint8_t *pOutIndex);
@@ -186,16 +186,17 @@ bool Calypso_ATWLAN_SetMode(Calypso_ATWLAN_SetMode_t mode)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+wlanSetMode=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanSetMode=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_SetModeStrings[mode], ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_SetModeStrings[mode], ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -228,22 +229,23 @@ bool Calypso_ATWLAN_Scan(uint8_t index, uint8_t deviceCount, Calypso_ATWLAN_Scan
 	{
 		return false;
 	}
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+wlanScan=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanScan=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, deviceCount, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, deviceCount, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -280,16 +282,17 @@ bool Calypso_ATWLAN_Scan(uint8_t index, uint8_t deviceCount, Calypso_ATWLAN_Scan
 bool Calypso_ATWLAN_Connect(Calypso_ATWLAN_ConnectionArguments_t connectArgs)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+wlanConnect=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanConnect=");
 
-	if (!Calypso_ATWLAN_AddConnectionArguments(pRequestCommand, connectArgs, ATCOMMAND_STRING_TERMINATE))
+	if (!Calypso_ATWLAN_AddConnectionArguments(&requestCommand, connectArgs, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -334,22 +337,23 @@ bool Calypso_ATWLAN_AddProfile(Calypso_ATWLAN_Profile_t profile, uint8_t *pOutIn
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+wlanProfileAdd=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanProfileAdd=");
 
-	if (!Calypso_ATWLAN_AddConnectionArguments(pRequestCommand, profile.connection, ATCOMMAND_ARGUMENT_DELIM))
+	if (!Calypso_ATWLAN_AddConnectionArguments(&requestCommand, profile.connection, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, profile.priority, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, profile.priority, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -383,17 +387,18 @@ bool Calypso_ATWLAN_GetProfile(uint8_t index, Calypso_ATWLAN_Profile_t *pOutProf
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+wlanProfileGet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanProfileGet=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -420,16 +425,17 @@ bool Calypso_ATWLAN_GetProfile(uint8_t index, Calypso_ATWLAN_Profile_t *pOutProf
 bool Calypso_ATWLAN_DeleteProfile(uint8_t index)
 {
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+wlanProfileDel=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanProfileDel=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -462,12 +468,13 @@ bool Calypso_ATWLAN_Get(Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLA
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	char *pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+wlanGet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanGet=");
 
-	if (!Calypso_ATWLAN_AddArgumentsWlanGet(pRequestCommand, id, option))
+	if (!Calypso_ATWLAN_AddArgumentsWlanGet(&requestCommand, id, option))
 	{
 		return false;
 	}
@@ -501,11 +508,12 @@ bool Calypso_ATWLAN_Set(Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLA
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+wlanSet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanSet=");
 
-	if (!Calypso_ATWLAN_AddArgumentsWlanSet(pRequestCommand, id, option, pValues))
+	if (!Calypso_ATWLAN_AddArgumentsWlanSet(&requestCommand, id, option, pValues))
 	{
 		return false;
 	}
@@ -531,23 +539,24 @@ bool Calypso_ATWLAN_Set(Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLA
  */
 bool Calypso_ATWLAN_SetConnectionPolicy(uint8_t policy)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+wlanPolicySet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanPolicySet=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_Connection], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_Connection], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATWLAN_PolicyConnectionStrings, Calypso_ATWLAN_PolicyConnection_NumberOfValues, policy,
+	if (!ATCommand_BuilderAppendArgumentBitmask(&requestCommand, Calypso_ATWLAN_PolicyConnectionStrings, Calypso_ATWLAN_PolicyConnection_NumberOfValues, policy,
 	ATCOMMAND_ARGUMENT_DELIM,
-	AT_MAX_COMMAND_BUFFER_SIZE))
+	CALYPSO_COMMAND_BUFFER_SIZE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -597,23 +606,24 @@ bool Calypso_ATWLAN_GetConnectionPolicy(uint8_t *policy)
  */
 bool Calypso_ATWLAN_SetScanPolicy(Calypso_ATWLAN_PolicyScan_t policy, uint32_t scanIntervalSeconds)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+wlanPolicySet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanPolicySet=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_Scan], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_Scan], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyScanStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyScanStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, scanIntervalSeconds, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, scanIntervalSeconds, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -670,23 +680,24 @@ bool Calypso_ATWLAN_GetScanPolicy(Calypso_ATWLAN_PolicyScan_t *policy, uint32_t
  */
 bool Calypso_ATWLAN_SetPMPolicy(Calypso_ATWLAN_PolicyPM_t policy, uint32_t maxSleepTimeMs)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+wlanPolicySet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanPolicySet=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_PowerManagement], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_PowerManagement], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyPMStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyPMStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, maxSleepTimeMs, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, maxSleepTimeMs, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -743,23 +754,24 @@ bool Calypso_ATWLAN_GetPMPolicy(Calypso_ATWLAN_PolicyPM_t *policy, uint32_t *max
  */
 bool Calypso_ATWLAN_SetP2PPolicy(Calypso_ATWLAN_PolicyP2P_t policy, Calypso_ATWLAN_PolicyP2PValue_t value)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+wlanPolicySet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanPolicySet=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_P2P], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_P2P], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyP2PStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyP2PStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyP2PValue_Strings[value], ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyP2PValue_Strings[value], ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -830,17 +842,18 @@ bool Calypso_ATWLAN_SendPolicyGet(Calypso_ATWLAN_PolicyID_t id, char **pRespondC
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	*pRespondCommand = AT_commandBuffer;
+	char *pRequestCommand = Calypso_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	*pRespondCommand = Calypso_commandBuffer;
 
-	strcpy(pRequestCommand, "AT+wlanPolicyGet=");
+	ATCommand_BuilderInit(&requestCommand, Calypso_commandBuffer, sizeof(Calypso_commandBuffer), "AT+wlanPolicyGet=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[id], ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, Calypso_ATWLAN_PolicyStrings[id], ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -950,40 +963,40 @@ static bool Calypso_ATWLAN_IsInputValidWlanSet(Calypso_ATWLAN_SetID_t id, uint8_
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATWLAN_AddConnectionArguments(char *pOutString, Calypso_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim)
+static bool Calypso_ATWLAN_AddConnectionArguments(ATCommand_Builder_t *pOutString, Calypso_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim)
 {
 
-	if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.SSID, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pOutString, connectionArgs.SSID, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.BSSID, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pOutString, connectionArgs.BSSID, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pOutString, Calypso_ATWLAN_SecurityTypeStrings[connectionArgs.securityParams.securityType], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pOutString, Calypso_ATWLAN_SecurityTypeStrings[connectionArgs.securityParams.securityType], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityParams.securityKey, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pOutString, connectionArgs.securityParams.securityKey, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityExtParams.extUser, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pOutString, connectionArgs.securityExtParams.extUser, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityExtParams.extAnonUser, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pOutString, connectionArgs.securityExtParams.extAnonUser, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pOutString, Calypso_ATWLAN_SecurityEAPStrings[connectionArgs.securityExtParams.eapMethod], lastDelim);
+	return ATCommand_BuilderAppendArgumentString(pOutString, Calypso_ATWLAN_SecurityEAPStrings[connectionArgs.securityExtParams.eapMethod], lastDelim);
 
 }
 
@@ -996,10 +1009,10 @@ static bool Calypso_ATWLAN_AddConnectionArguments(char *pOutString, Calypso_ATWL
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATWLAN_AddArgumentsWlanGet(char *pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option)
+static bool Calypso_ATWLAN_AddArgumentsWlanGet(ATCommand_Builder_t *pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option)
 {
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -1007,28 +1020,28 @@ static bool Calypso_ATWLAN_AddArgumentsWlanGet(char *pAtCommand, Calypso_ATWLAN_
 	switch (id)
 	{
 	case Calypso_ATWLAN_SetID_General:
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		break;
 
 	case Calypso_ATWLAN_SetID_P2P:
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetP2PStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetP2PStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		break;
 
 	case Calypso_ATWLAN_SetID_Connection:
-		if (!ATCommand_AppendArgumentString(pAtCommand, "", ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, "", ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		break;
 
 	case Calypso_ATWLAN_SetID_AccessPoint:
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetAPStrings[option], ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetAPStrings[option], ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -1038,7 +1051,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanGet(char *pAtCommand, Calypso_ATWLAN_
 		return false;
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -1052,10 +1065,10 @@ static bool Calypso_ATWLAN_AddArgumentsWlanGet(char *pAtCommand, Calypso_ATWLAN_
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLAN_Settings_t *pValues)
+static bool Calypso_ATWLAN_AddArgumentsWlanSet(ATCommand_Builder_t *pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLAN_Settings_t *pValues)
 {
 
-	if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
@@ -1064,7 +1077,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_
 	{
 	case Calypso_ATWLAN_SetID_General:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -1072,46 +1085,46 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_
 		switch (option)
 		{
 		case Calypso_ATWLAN_SetGeneral_CountryCode:
-			if (!ATCommand_AppendArgumentString(pAtCommand, pValues->general.countryCode, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->general.countryCode, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetGeneral_StationTxPower:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.staTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->general.staTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetGeneral_AccessPointTxPower:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.apTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->general.apTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetGeneral_ScanParams:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.scanParams.channelMask, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX ), ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->general.scanParams.channelMask, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX ), ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.scanParams.rssiTreshold, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->general.scanParams.rssiTreshold, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetGeneral_SuspendProfiles:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.suspendProfiles, (ATCOMMAND_INTFLAGS_NOTATION_HEX | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->general.suspendProfiles, (ATCOMMAND_INTFLAGS_NOTATION_HEX | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetGeneral_DisableEntServerAuth:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.disableEntServerAuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->general.disableEntServerAuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -1128,7 +1141,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_
 
 	case Calypso_ATWLAN_SetID_P2P:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetP2PStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetP2PStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -1140,22 +1153,22 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_
 
 		Calypso_ATWLAN_P2PChannelNRegs_t *pChannelNRegs = &pValues->p2p.p2pChannelNRegs;
 
-		if (!ATCommand_AppendArgumentInt(pAtCommand, pChannelNRegs->listenChannel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pChannelNRegs->listenChannel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentInt(pAtCommand, pChannelNRegs->listenRegulatoryClass, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pChannelNRegs->listenRegulatoryClass, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentInt(pAtCommand, pChannelNRegs->operatingChannel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pChannelNRegs->operatingChannel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 
-		if (!ATCommand_AppendArgumentInt(pAtCommand, pChannelNRegs->operatingRegulatoryClass, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pChannelNRegs->operatingRegulatoryClass, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -1165,7 +1178,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_
 
 	case Calypso_ATWLAN_SetID_AccessPoint:
 	{
-		if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetAPStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetAPStrings[option], ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -1176,47 +1189,47 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_
 			if (Calypso_firmwareVersionMajor > 1 || (Calypso_firmwareVersionMajor == 1 && Calypso_firmwareVersionMinor >= 9))
 			{
 				/* Starting with firmware version 1.9.0, there is an appendMac argument */
-				if (!ATCommand_AppendArgumentString(pAtCommand, pValues->ap.ssidConfig.appendMac ? "true" : "false", ATCOMMAND_ARGUMENT_DELIM))
+				if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->ap.ssidConfig.appendMac ? "true" : "false", ATCOMMAND_ARGUMENT_DELIM))
 				{
 					return false;
 				}
 			}
-			if (!ATCommand_AppendArgumentString(pAtCommand, pValues->ap.ssidConfig.ssid, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->ap.ssidConfig.ssid, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetAP_Channel:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->ap.channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->ap.channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetAP_HiddenSSID:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->ap.hiddenSSID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->ap.hiddenSSID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetAP_Security:
-			if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_APSecurityTypeStrings[pValues->ap.security], ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, Calypso_ATWLAN_APSecurityTypeStrings[pValues->ap.security], ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetAP_Password:
-			if (!ATCommand_AppendArgumentString(pAtCommand, pValues->ap.password, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentString(pAtCommand, pValues->ap.password, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 			break;
 
 		case Calypso_ATWLAN_SetAP_MaxStations:
-			if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->ap.maxStations, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(pAtCommand, pValues->ap.maxStations, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
@@ -1237,7 +1250,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char *pAtCommand, Calypso_ATWLAN_
 	}
 	}
 
-	return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ATCommand_BuilderAppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
 }
 
@@ -36,6 +36,19 @@
 
 static void Calypso_HandleRxByte(uint8_t *dataP, size_t size);
 static void Calypso_HandleRxLine(char *rxPacket, uint16_t rxLength);
+static void Calypso_CompleteRxLine();
+static void Calypso_HandleRxBufferFull();
+static void Calypso_StartSocketRx();
+static size_t Calypso_HandleSocketRxData(const uint8_t *dataP, size_t size);
+static void Calypso_CompleteSocketRx(bool complete);
+static void Calypso_UpdateRequestTiming();
+static bool Calypso_TransmitRequest(char *data, const ATCommand_CommandName_t *commandName);
+static void Calypso_BeginRequest(const char *data, size_t dataLength, const ATCommand_CommandName_t *commandName);
+static bool Calypso_TransmitPayloadBase64(const uint8_t *payload, uint16_t payloadLength);
+static bool Calypso_TransmitRequestWithPayload(char *header, const uint8_t *payload, uint16_t payloadLength, bool encodeAsBase64, const ATCommand_CommandName_t *commandName);
+static bool Calypso_QueueRequest(const char *data, uint16_t length, const ATCommand_CommandName_t *commandName, uint32_t timeoutMs, Calypso_RequestCompleteCallback_t callback, void *context);
+static void Calypso_TransmitQueuedRequest(const char *data, uint16_t length, const ATCommand_CommandName_t *commandName);
+static void Calypso_HandleTxComplete(void);
 
 /**
  * @brief Timeouts for responses to AT commands (milliseconds).
@@ -56,9 +69,17 @@ static char Calypso_pendingCommandName[64] = {
 		0 };
 
 /**
- * @brief Length of Calypso_pendingCommandName.
+ * @brief Name of the pending command (points to Calypso_pendingCommandName or to a
+ * name supplied to Calypso_SendRequestWithCommandName()).
  */
-static size_t Calypso_pendingCommandNameLength = 0;
+static ATCommand_CommandName_t Calypso_pendingCommand = {
+		NULL,
+		0 };
+
+/**
+ * @brief Buffer used for assembling commands and storing responses.
+ */
+char Calypso_commandBuffer[CALYPSO_COMMAND_BUFFER_SIZE];
 
 /**
  * @brief Buffer used for current response text.
@@ -104,6 +125,24 @@ static uint16_t Calypso_rxByteCounter = 0;
  */
 static bool Calypso_eolChar1Found = false;
 
+/**
+ * @brief Is set if the current line didn't fit into the receive buffer and is
+ * passed to Calypso_lineFragmentRxCallback in fragments.
+ */
+static bool Calypso_rxLineFragmented = false;
+
+/**
+ * @brief Is set if the current line didn't fit into the receive buffer and is
+ * discarded (because no line fragment callback has been set).
+ */
+static bool Calypso_rxLineDiscarded = false;
+
+/**
+ * @brief Optional callback function which receives lines that don't fit into the receive buffer.
+ * @see Calypso_SetLineFragmentRxCallback()
+ */
+static Calypso_LineFragmentRxCallback_t Calypso_lineFragmentRxCallback = NULL;
+
 /**
  * @brief First EOL character expected for responses received from Calypso.
  * @see Calypso_eolChar2, Calypso_twoEolCharacters, Calypso_SetEolCharacters()
@@ -124,14 +163,20 @@ static uint8_t Calypso_eolChar2 = '\n';
 static bool Calypso_twoEolCharacters = true;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from Calypso.
+ * @brief Max. time (microseconds) to sleep between checks when waiting for responses from Calypso.
  *
- * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+ * Waiting ends as soon as a line has been received (see Calypso_lineReceived). If set to 0, the
+ * driver polls for responses without sleeping.
  *
  * @see Calypso_SetTimingParameters
  */
 static uint32_t Calypso_waitTimeStepUsec = 5 * 1000;
 
+/**
+ * @brief Is set when a line has been received from Calypso (used to wake up Calypso_WaitForConfirm()).
+ */
+static volatile bool Calypso_lineReceived = false;
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to Calypso
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -150,6 +195,40 @@ static uint32_t Calypso_minCommandIntervalUsec = 3 * 1000;
  */
 static uint32_t Calypso_lastConfirmTimeUsec = 0;
 
+/**
+ * @brief Time (microseconds) at which the transmission of the pending request has been started.
+ */
+static uint32_t Calypso_requestStartTimeUsec = 0;
+
+/**
+ * @brief Time (microseconds) at which the transmission of the pending request has been completed.
+ */
+static uint32_t Calypso_requestSentTimeUsec = 0;
+
+/**
+ * @brief Time (microseconds) at which the first byte after sending the pending request has been received.
+ * Is only valid if Calypso_firstByteReceived is true.
+ */
+static uint32_t Calypso_firstByteTimeUsec = 0;
+static volatile bool Calypso_firstByteReceived = false;
+
+/**
+ * @brief Time (microseconds) at which the confirmation of the pending request has been received.
+ * Is only valid if Calypso_confirmReceived is true.
+ */
+static uint32_t Calypso_confirmTimeUsec = 0;
+static volatile bool Calypso_confirmReceived = false;
+
+/**
+ * @brief Timing of the last completed (or timed out) request.
+ * @see Calypso_GetLastRequestTiming()
+ */
+static WE_RequestTiming_t Calypso_lastRequestTiming = {
+		.transmitTime = WE_REQUEST_TIMING_INVALID,
+		.firstByteLatency = WE_REQUEST_TIMING_INVALID,
+		.confirmLatency = WE_REQUEST_TIMING_INVALID,
+		.processingDelay = WE_REQUEST_TIMING_INVALID };
+
 /**
  * @brief Major firmware version of the connected module.
  *
@@ -196,6 +275,120 @@ Calypso_EventCallback_t Calypso_eventCallback;
  */
 static bool Calypso_executingEventCallback = false;
 
+/**
+ * @brief Request queued using Calypso_SendRequestAsync().
+ */
+typedef struct Calypso_QueuedRequest_t
+{
+	const char *data; /**< Complete AT command including the line ending (owned by the caller until the request has been completed) */
+	uint16_t length; /**< Length of data */
+	const ATCommand_CommandName_t *commandName; /**< Name of the command (NULL to extract the name from data) */
+	uint32_t timeoutMs; /**< Max. time to wait for the confirmation */
+	uint32_t sentTick; /**< Time at which the request has been sent (only valid for the active request) */
+	Calypso_RequestCompleteCallback_t callback; /**< Completion callback (optional) */
+	void *context; /**< Context pointer passed to callback */
+} Calypso_QueuedRequest_t;
+
+/**
+ * @brief Queue of requests sent using Calypso_SendRequestAsync() (ring buffer).
+ */
+static Calypso_QueuedRequest_t Calypso_requestQueue[CALYPSO_REQUEST_QUEUE_SIZE];
+
+/**
+ * @brief Index of the oldest entry in Calypso_requestQueue.
+ */
+static uint8_t Calypso_requestQueueHead = 0;
+
+/**
+ * @brief Number of entries in Calypso_requestQueue.
+ */
+static uint8_t Calypso_requestQueueCount = 0;
+
+/**
+ * @brief Is set to true while the oldest entry in Calypso_requestQueue has been sent and is waiting for confirmation.
+ */
+static bool Calypso_requestQueueActive = false;
+
+/**
+ * @brief Is set to true while the active entry in Calypso_requestQueue is being transmitted using
+ * the UART's uartTransmitAsync function (is reset by the transmission complete callback).
+ */
+static volatile bool Calypso_requestTxActive = false;
+
+/**
+ * @brief Receive buffer posted using Calypso_PostSocketReceiveBuffer().
+ */
+typedef struct Calypso_PostedReceiveBuffer_t
+{
+	uint8_t *buffer; /**< Buffer receiving the (decoded) data */
+	uint16_t size; /**< Size of buffer */
+	volatile Calypso_SocketReceiveCallback_t callback; /**< Completion callback (NULL if no buffer is posted) */
+	void *context; /**< Context pointer passed to callback */
+} Calypso_PostedReceiveBuffer_t;
+
+static void Calypso_ReleaseSocketRxBuffer(Calypso_PostedReceiveBuffer_t *releasedP);
+
+/**
+ * @brief Receive buffers posted using Calypso_PostSocketReceiveBuffer() (indexed by socket ID).
+ *
+ * Is accessed by the application and by the rx byte handler, so entries must only be
+ * modified by the application inside a critical section (see WE_EnterCriticalSection()).
+ */
+static Calypso_PostedReceiveBuffer_t Calypso_postedReceiveBuffers[CALYPSO_MAX_SOCKETS];
+
+/**
+ * @brief Number of entries in Calypso_postedReceiveBuffers that are currently posted.
+ */
+static volatile uint8_t Calypso_postedReceiveBufferCount = 0;
+
+/**
+ * @brief Posted receive buffer into which the payload of the current +recv/+recvfrom line
+ * is written (NULL if the current line is processed as usual).
+ */
+static Calypso_PostedReceiveBuffer_t *volatile Calypso_socketRxBuffer = NULL;
+
+/**
+ * @brief Socket ID of the +recv/+recvfrom line currently being written to Calypso_socketRxBuffer.
+ */
+static uint8_t Calypso_socketRxSocketID = 0;
+
+/**
+ * @brief Number of payload bytes (as sent by the module, i.e. before decoding) of the
+ * current +recv/+recvfrom line that have not been received yet.
+ */
+static uint16_t Calypso_socketRxRemaining = 0;
+
+/**
+ * @brief Time (milliseconds, see WE_UART_GetRxTick()) at which payload data of the current
+ * +recv/+recvfrom line has last been received.
+ *
+ * The millisecond tick is used, as it wraps around at 2^32 (unlike the microsecond tick,
+ * e.g. derived from the cycle counter), so that the difference is correct across the wrap.
+ *
+ * @see Calypso_Timeout_SocketReceive
+ */
+static uint32_t Calypso_socketRxTick = 0;
+
+/**
+ * @brief Number of (decoded) bytes written to Calypso_socketRxBuffer.
+ */
+static uint16_t Calypso_socketRxLength = 0;
+
+/**
+ * @brief Is set to true if the payload of the current +recv/+recvfrom line is Base64 encoded.
+ */
+static bool Calypso_socketRxBase64 = false;
+
+/**
+ * @brief Base64 characters of the current +recv/+recvfrom line that haven't been decoded yet.
+ */
+static uint8_t Calypso_socketRxQuad[4];
+
+/**
+ * @brief Number of characters in Calypso_socketRxQuad.
+ */
+static uint8_t Calypso_socketRxQuadLength = 0;
+
 /**
  * @brief Callback function which is executed if a single byte has been received from Calypso.
  * The default callback is Calypso_HandleRxByte().
@@ -232,6 +425,13 @@ static WE_UART_t *Calypso_uartP = NULL;
 bool Calypso_Init(WE_UART_t *uartP, Calypso_Pins_t *pinoutP, Calypso_EventCallback_t eventCallback)
 {
 	Calypso_requestPending = false;
+	Calypso_requestQueueHead = 0;
+	Calypso_requestQueueCount = 0;
+	Calypso_requestQueueActive = false;
+	Calypso_requestTxActive = false;
+	memset(Calypso_postedReceiveBuffers, 0, sizeof(Calypso_postedReceiveBuffers));
+	Calypso_postedReceiveBufferCount = 0;
+	Calypso_socketRxBuffer = NULL;
 
 	/* Callbacks */
 	byteRxCallback = Calypso_HandleRxByte;
@@ -279,6 +479,10 @@ bool Calypso_Init(WE_UART_t *uartP, Calypso_Pins_t *pinoutP, Calypso_EventCallba
 	{
 		return false;
 	}
+	if (NULL != Calypso_uartP->uartSetTxCompleteCallback)
+	{
+		Calypso_uartP->uartSetTxCompleteCallback(Calypso_HandleTxComplete);
+	}
 	WE_Delay(10);
 
 	/* Set response timeouts */
@@ -292,6 +496,7 @@ bool Calypso_Init(WE_UART_t *uartP, Calypso_Pins_t *pinoutP, Calypso_EventCallba
 	Calypso_timeouts[Calypso_Timeout_HttpRequest] = 30000;
 	Calypso_timeouts[Calypso_Timeout_FileIO] = 2000;
 	Calypso_timeouts[Calypso_Timeout_GPIO] = 2000;
+	Calypso_timeouts[Calypso_Timeout_SocketReceive] = 100;
 
 	return true;
 }
@@ -309,6 +514,18 @@ bool Calypso_Deinit(void)
 	Calypso_eolChar1Found = 0;
 	Calypso_requestPending = false;
 	Calypso_currentResponseLength = 0;
+	Calypso_requestQueueHead = 0;
+	Calypso_requestQueueCount = 0;
+	Calypso_requestQueueActive = false;
+	Calypso_requestTxActive = false;
+	memset(Calypso_postedReceiveBuffers, 0, sizeof(Calypso_postedReceiveBuffers));
+	Calypso_postedReceiveBufferCount = 0;
+	Calypso_socketRxBuffer = NULL;
+
+	if (NULL != Calypso_uartP->uartSetTxCompleteCallback)
+	{
+		Calypso_uartP->uartSetTxCompleteCallback(NULL);
+	}
 
 	return Calypso_uartP->uartDeinit();
 }
@@ -378,6 +595,24 @@ WE_Pin_Level_t Calypso_GetPinLevel(WE_Pin_t pin)
  * @return true if successful, false otherwise
  */
 bool Calypso_SendRequest(char *data)
+{
+	return Calypso_SendRequestWithCommandName(data, NULL);
+}
+
+/**
+ * @brief Sends the supplied AT command to the module
+ *
+ * Same as Calypso_SendRequest(), but the name of the command (which is used for
+ * assigning responses to the request) is supplied by the caller instead of being
+ * extracted from the command.
+ *
+ * @param[in] data AT command to send. Note that the command has to end with "\r\n\0".
+ * @param[in] commandName Name of the command (see ATCOMMAND_COMMAND_NAME()). Must stay valid
+ *            until the next request is sent. If NULL, the name is extracted from the command.
+ *
+ * @return true if successful, false otherwise
+ */
+bool Calypso_SendRequestWithCommandName(char *data, const ATCommand_CommandName_t *commandName)
 {
 	if (Calypso_executingEventCallback)
 	{
@@ -386,6 +621,161 @@ bool Calypso_SendRequest(char *data)
 		return false;
 	}
 
+	if (Calypso_requestQueueCount > 0)
+	{
+		/* Asynchronous requests are pending (see Calypso_SendRequestAsync()) */
+		return false;
+	}
+
+	return Calypso_TransmitRequest(data, commandName);
+}
+
+/**
+ * @brief Sends the supplied AT command to the module (see Calypso_SendRequestWithCommandName()).
+ *
+ * @param[in] data AT command to send. Note that the command has to end with "\r\n\0".
+ * @param[in] commandName Name of the command (NULL to extract the name from the command)
+ *
+ * @return true if successful, false otherwise
+ */
+static bool Calypso_TransmitRequest(char *data, const ATCommand_CommandName_t *commandName)
+{
+	size_t dataLength = strlen(data);
+
+	Calypso_BeginRequest(data, dataLength, commandName);
+
+	Calypso_Transparent_Transmit(data, dataLength);
+
+	Calypso_requestSentTimeUsec = WE_GetTickMicroseconds();
+
+	return true;
+}
+
+/**
+ * @brief Sends an AT command consisting of a header, a (binary) payload and the line ending to the module.
+ *
+ * The parts are streamed directly to the UART, i.e. the payload is neither copied
+ * to the command buffer nor required to be free of '\0' characters. If encodeAsBase64
+ * is true, the payload is Base64 encoded block by block while being transmitted
+ * (see CALYPSO_BASE64_ENCODE_BLOCK_SIZE).
+ *
+ * @param[in] header Command string preceding the payload, including all arguments and the
+ *            trailing argument delimiter (e.g. "AT+send=1,0,5,"). Must not contain "\r\n".
+ * @param[in] payload Payload to be sent
+ * @param[in] payloadLength Number of payload bytes (before encoding)
+ * @param[in] encodeAsBase64 Encode the payload in Base64 format while sending it
+ * @param[in] commandName Name of the command (NULL to extract the name from the header)
+ *
+ * @return true if successful, false otherwise
+ */
+bool Calypso_SendRequestWithPayload(char *header, const uint8_t *payload, uint16_t payloadLength, bool encodeAsBase64, const ATCommand_CommandName_t *commandName)
+{
+	if ((NULL == header) || ((NULL == payload) && (payloadLength > 0)))
+	{
+		return false;
+	}
+
+	if (Calypso_executingEventCallback || (Calypso_requestQueueCount > 0))
+	{
+		/* See Calypso_SendRequestWithCommandName() */
+		return false;
+	}
+
+	return Calypso_TransmitRequestWithPayload(header, payload, payloadLength, encodeAsBase64, commandName);
+}
+
+/**
+ * @brief Sends an AT command consisting of a header, a payload and the line ending to the module
+ * (see Calypso_SendRequestWithPayload()).
+ *
+ * @param[in] header Command string preceding the payload
+ * @param[in] payload Payload to be sent
+ * @param[in] payloadLength Number of payload bytes (before encoding)
+ * @param[in] encodeAsBase64 Encode the payload in Base64 format while sending it
+ * @param[in] commandName Name of the command (NULL to extract the name from the header)
+ *
+ * @return true if successful, false otherwise
+ */
+static bool Calypso_TransmitRequestWithPayload(char *header, const uint8_t *payload, uint16_t payloadLength, bool encodeAsBase64, const ATCommand_CommandName_t *commandName)
+{
+	size_t headerLength = strlen(header);
+
+	Calypso_BeginRequest(header, headerLength, commandName);
+
+	bool ok;
+	if (encodeAsBase64)
+	{
+		ok = Calypso_Transparent_Transmit(header, headerLength) && Calypso_TransmitPayloadBase64(payload, payloadLength) && Calypso_Transparent_Transmit(ATCOMMAND_CRLF, 2);
+	}
+	else if (NULL != Calypso_uartP->uartTransmitV)
+	{
+		WE_UART_Segment_t segments[] = {
+				{
+						.data = (const uint8_t*) header,
+						.length = headerLength },
+				{
+						.data = payload,
+						.length = payloadLength },
+				{
+						.data = (const uint8_t*) ATCOMMAND_CRLF,
+						.length = 2 } };
+		ok = Calypso_uartP->uartTransmitV(segments, sizeof(segments) / sizeof(segments[0]));
+	}
+	else
+	{
+		ok = Calypso_Transparent_Transmit(header, headerLength) && ((0 == payloadLength) || Calypso_Transparent_Transmit((const char*) payload, payloadLength)) && Calypso_Transparent_Transmit(ATCOMMAND_CRLF, 2);
+	}
+
+	Calypso_requestSentTimeUsec = WE_GetTickMicroseconds();
+
+	return ok;
+}
+
+/**
+ * @brief Base64 encodes the supplied payload block by block and sends the encoded data to the module.
+ *
+ * @param[in] payload Payload to be sent
+ * @param[in] payloadLength Number of payload bytes
+ *
+ * @return true if successful, false otherwise
+ */
+static bool Calypso_TransmitPayloadBase64(const uint8_t *payload, uint16_t payloadLength)
+{
+	uint8_t encoded[(CALYPSO_BASE64_ENCODE_BLOCK_SIZE / 3) * 4];
+
+	for (uint16_t offset = 0; offset < payloadLength; offset += CALYPSO_BASE64_ENCODE_BLOCK_SIZE)
+	{
+		uint16_t blockLength = payloadLength - offset;
+		if (blockLength > CALYPSO_BASE64_ENCODE_BLOCK_SIZE)
+		{
+			blockLength = CALYPSO_BASE64_ENCODE_BLOCK_SIZE;
+		}
+
+		/* Block size is a multiple of 3, so padding is only added to the last block */
+		uint32_t encodedLength = sizeof(encoded);
+		if (!Base64_Encode((uint8_t*) payload + offset, blockLength, encoded, &encodedLength))
+		{
+			return false;
+		}
+		if (!Calypso_Transparent_Transmit((const char*) encoded, (uint16_t) encodedLength))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Prepares the driver's state for sending a new request (resets response state,
+ * waits for the min. command interval and determines the name of the pending command).
+ *
+ * @param[in] data Command to be sent (at least the part containing the command name)
+ * @param[in] dataLength Length of data
+ * @param[in] commandName Name of the command (NULL to extract the name from data)
+ */
+static void Calypso_BeginRequest(const char *data, size_t dataLength, const ATCommand_CommandName_t *commandName)
+{
 	Calypso_requestPending = true;
 	Calypso_currentResponseLength = 0;
 	*Calypso_lastErrorText = '\0';
@@ -399,30 +789,39 @@ bool Calypso_SendRequest(char *data)
 		WE_DelayMicroseconds(Calypso_minCommandIntervalUsec - t);
 	}
 
-	size_t dataLength = strlen(data);
-
-	/* Get command name from request string (remove prefix "AT+" and parameters) */
-	Calypso_pendingCommandName[0] = '\0';
-	Calypso_pendingCommandNameLength = 0;
-	if (dataLength > 3 && (data[0] == 'a' || data[0] == 'A') && (data[1] == 't' || data[1] == 'T') && data[2] == '+')
+	if (NULL != commandName)
+	{
+		Calypso_pendingCommand = *commandName;
+	}
+	else
 	{
-		char *pData = data + 3;
-		char delimiters[] = {
-				ATCOMMAND_COMMAND_DELIM,
-				'\r' };
-		if (ATCommand_GetCmdName(&pData, Calypso_pendingCommandName, sizeof(Calypso_pendingCommandName), delimiters, sizeof(delimiters)))
+		/* Get command name from request string (remove prefix "AT+" and parameters) */
+		Calypso_pendingCommandName[0] = '\0';
+		Calypso_pendingCommand.name = Calypso_pendingCommandName;
+		Calypso_pendingCommand.length = 0;
+		if (dataLength > 3 && (data[0] == 'a' || data[0] == 'A') && (data[1] == 't' || data[1] == 'T') && data[2] == '+')
 		{
-			Calypso_pendingCommandNameLength = strlen(Calypso_pendingCommandName);
+			char *pData = (char*) data + 3;
+			char delimiters[] = {
+					ATCOMMAND_COMMAND_DELIM,
+					'\r' };
+			if (ATCommand_GetCmdName(&pData, Calypso_pendingCommandName, sizeof(Calypso_pendingCommandName), delimiters, sizeof(delimiters)))
+			{
+				Calypso_pendingCommand.length = (uint8_t) strlen(Calypso_pendingCommandName);
+			}
 		}
 	}
 
 #ifdef WE_DEBUG
-	printf("> %s", data);
+	WE_LOG("> %.*s", (int) dataLength, data);
 #endif
 
-	Calypso_Transparent_Transmit(data, dataLength);
-
-	return true;
+	/* Reset the confirmation status before sending (rather than in Calypso_WaitForConfirm()),
+	 * so that a confirmation received before the caller starts waiting is not discarded */
+	Calypso_cmdConfirmStatus = Calypso_CNFStatus_Invalid;
+	Calypso_firstByteReceived = false;
+	Calypso_confirmReceived = false;
+	Calypso_requestStartTimeUsec = WE_GetTickMicroseconds();
 }
 
 /**
@@ -456,18 +855,21 @@ bool Calypso_Transparent_Transmit(const char *data, uint16_t dataLength)
  */
 bool Calypso_WaitForConfirm(uint32_t maxTimeMs, Calypso_CNFStatus_t expectedStatus, char *pOutResponse)
 {
-	Calypso_cmdConfirmStatus = Calypso_CNFStatus_Invalid;
-
 	uint32_t t0 = WE_GetTick();
 
 	while (1)
 	{
+		/* Reset flag before checking, so that a line received in the meantime is not missed */
+		Calypso_lineReceived = false;
+
 		if (Calypso_CNFStatus_Invalid != Calypso_cmdConfirmStatus)
 		{
-			/* Store current time to enable check for min. time between received confirm and next command. */
-			Calypso_lastConfirmTimeUsec = WE_GetTickMicroseconds();
+			/* Store the time at which the confirmation has been received to enable check for min. time
+			 * between received confirm and next command. */
+			Calypso_lastConfirmTimeUsec = Calypso_confirmReceived ? Calypso_confirmTimeUsec : WE_GetTickMicroseconds();
 
 			Calypso_requestPending = false;
+			Calypso_UpdateRequestTiming();
 
 			if (Calypso_cmdConfirmStatus == expectedStatus)
 			{
@@ -484,8 +886,8 @@ bool Calypso_WaitForConfirm(uint32_t maxTimeMs, Calypso_CNFStatus_t expectedStat
 			}
 		}
 
-		uint32_t now = WE_GetTick();
-		if (now - t0 > maxTimeMs)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= maxTimeMs)
 		{
 			/* Timeout */
 			break;
@@ -493,57 +895,387 @@ bool Calypso_WaitForConfirm(uint32_t maxTimeMs, Calypso_CNFStatus_t expectedStat
 
 		if (Calypso_waitTimeStepUsec > 0)
 		{
-			WE_DelayMicroseconds(Calypso_waitTimeStepUsec);
+			/* Sleep until the next line has been received (but not longer than one time step) */
+			uint32_t timeStepMs = (Calypso_waitTimeStepUsec + 999) / 1000;
+			WE_WaitForEvent(&Calypso_lineReceived, (maxTimeMs - elapsed < timeStepMs) ? maxTimeMs - elapsed : timeStepMs);
 		}
 	}
 
 	Calypso_requestPending = false;
+	Calypso_UpdateRequestTiming();
 	return false;
 }
 
 /**
- * @brief Returns the code of the last error (if any).
+ * @brief Queues an AT command to be sent to the module without waiting for its confirmation.
  *
- * @param[out] lastErrorText Text of last error (if any). See Calypso_lastErrorText for max. buffer size.
+ * Queued requests are sent one after the other in FIFO order by Calypso_ProcessRequests(),
+ * which also checks for their confirmation and executes the completion callbacks. Unlike
+ * Calypso_SendRequest(), this function returns immediately, so the application may
+ * prepare further requests while earlier requests are being processed by the module.
  *
- * @return Last error code (if any)
+ * Requests are transmitted using the UART's uartTransmitAsync function, if both uartTransmitAsync
+ * and uartSetTxCompleteCallback are available (see WE_UART_t). Otherwise, they are transmitted
+ * using uartTransmit, i.e. Calypso_ProcessRequests() blocks while a request is being transmitted.
+ *
+ * Synchronous requests (Calypso_SendRequest()) are rejected while asynchronous requests
+ * are queued.
+ *
+ * @param[in] data AT command to send. Note that the command has to end with "\r\n\0".
+ *                 The buffer must not be modified until the request has been completed.
+ * @param[in] timeoutMs Max. time to wait for the confirmation (milliseconds)
+ * @param[in] callback Function to be called when the request has been completed (optional)
+ * @param[in] context Pointer passed to callback (optional)
+ *
+ * @return true if the request has been queued, false if the queue is full
  */
-int32_t Calypso_GetLastError(char *lastErrorText)
+bool Calypso_SendRequestAsync(char *data, uint32_t timeoutMs, Calypso_RequestCompleteCallback_t callback, void *context)
 {
-	if (NULL != lastErrorText)
+	if (NULL == data)
 	{
-		strcpy(lastErrorText, Calypso_lastErrorText);
+		return false;
 	}
-	return Calypso_lastErrorCode;
+	return Calypso_QueueRequest(data, (uint16_t) strlen(data), NULL, timeoutMs, callback, context);
 }
 
 /**
- * @brief Set timing parameters used by the Calypso driver.
+ * @brief Queues an AT command consisting of a header, a (binary) payload and the line ending
+ * to be sent to the module without waiting for its confirmation.
  *
- * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+ * Asynchronous variant of Calypso_SendRequestWithPayload(), see Calypso_SendRequestAsync()
+ * for details on how queued requests are processed. The payload (Base64 encoded, if requested)
+ * and the line ending are appended to the header in the supplied buffer before the request is
+ * queued, so that the command can be transmitted in one piece (e.g. via DMA) without encoding
+ * data in Calypso_ProcessRequests(). Thus, the payload buffer may be reused as soon as this
+ * function returns, whereas each queued request needs its own command buffer (e.g. see
+ * Calypso_ATSocket_SendAsync()). The buffer and the command name must not be modified until
+ * the request has been completed.
  *
- * @param[in] waitTimeStepUsec Time step (microseconds) when waiting for responses from Calypso.
- * @param[in] minCommandIntervalUsec Minimum interval (microseconds) between subsequent commands sent to Calypso.
+ * @param[in,out] buffer Buffer containing the (null-terminated) command string preceding the payload,
+ *                including all arguments and the trailing argument delimiter (e.g. "AT+send=1,0,5,").
+ *                Receives the complete command.
+ * @param[in] bufferSize Size of buffer
+ * @param[in] payload Payload to be sent
+ * @param[in] payloadLength Number of payload bytes (before encoding)
+ * @param[in] encodeAsBase64 Encode the payload in Base64 format before queuing the request
+ * @param[in] commandName Name of the command (NULL to extract the name from the header)
+ * @param[in] timeoutMs Max. time to wait for the confirmation (milliseconds)
+ * @param[in] callback Function to be called when the request has been completed (optional)
+ * @param[in] context Pointer passed to callback (optional)
  *
- * @return true if successful, false otherwise
+ * @return true if the request has been queued, false if the arguments are invalid, the
+ *         command doesn't fit into the buffer or the queue is full
  */
-bool Calypso_SetTimingParameters(uint32_t waitTimeStepUsec, uint32_t minCommandIntervalUsec)
+bool Calypso_SendRequestWithPayloadAsync(char *buffer, uint16_t bufferSize, const uint8_t *payload, uint16_t payloadLength, bool encodeAsBase64, const ATCommand_CommandName_t *commandName, uint32_t timeoutMs, Calypso_RequestCompleteCallback_t callback, void *context)
 {
-	Calypso_waitTimeStepUsec = waitTimeStepUsec;
-	Calypso_minCommandIntervalUsec = minCommandIntervalUsec;
-	return true;
+	if ((NULL == buffer) || ((NULL == payload) && (payloadLength > 0)))
+	{
+		return false;
+	}
+
+	if (Calypso_requestQueueCount >= CALYPSO_REQUEST_QUEUE_SIZE)
+	{
+		/* Check before assembling the command, as the buffer might still be in use by a queued request */
+		return false;
+	}
+
+	uint32_t length = strnlen(buffer, bufferSize);
+	if (length + 2 > bufferSize)
+	{
+		return false;
+	}
+
+	uint32_t payloadSize = bufferSize - length - 2;
+	if (encodeAsBase64)
+	{
+		if ((payloadLength > 0) && !Base64_Encode((uint8_t*) payload, payloadLength, (uint8_t*) buffer + length, &payloadSize))
+		{
+			return false;
+		}
+		if (0 == payloadLength)
+		{
+			payloadSize = 0;
+		}
+	}
+	else
+	{
+		if (payloadLength > payloadSize)
+		{
+			return false;
+		}
+		memcpy(buffer + length, payload, payloadLength);
+		payloadSize = payloadLength;
+	}
+	length += payloadSize;
+	if (length + 2 > UINT16_MAX)
+	{
+		return false;
+	}
+	memcpy(buffer + length, ATCOMMAND_CRLF, 2);
+	length += 2;
+
+	return Calypso_QueueRequest(buffer, (uint16_t) length, commandName, timeoutMs, callback, context);
 }
 
 /**
- * @brief Sets the timeout for responses to AT commands of the given type.
+ * @brief Adds a request to the queue (see Calypso_SendRequestAsync(), Calypso_SendRequestWithPayloadAsync()).
  *
- * @param[in] type Timeout (i.e. command) type
- * @param[in] timeout Timeout in milliseconds
+ * @return true if the request has been queued, false otherwise
  */
-void Calypso_SetTimeout(Calypso_Timeout_t type, uint32_t timeout)
+static bool Calypso_QueueRequest(const char *data, uint16_t length, const ATCommand_CommandName_t *commandName, uint32_t timeoutMs, Calypso_RequestCompleteCallback_t callback, void *context)
 {
-	Calypso_timeouts[type] = timeout;
-}
+	if ((NULL == data) || Calypso_executingEventCallback)
+	{
+		return false;
+	}
+
+	if (Calypso_requestQueueCount >= CALYPSO_REQUEST_QUEUE_SIZE)
+	{
+		return false;
+	}
+
+	Calypso_QueuedRequest_t *request = &Calypso_requestQueue[(Calypso_requestQueueHead + Calypso_requestQueueCount) % CALYPSO_REQUEST_QUEUE_SIZE];
+	request->data = data;
+	request->length = length;
+	request->commandName = commandName;
+	request->timeoutMs = timeoutMs;
+	request->sentTick = 0;
+	request->callback = callback;
+	request->context = context;
+	Calypso_requestQueueCount++;
+
+	Calypso_ProcessRequests();
+	return true;
+}
+
+/**
+ * @brief Processes the requests queued using Calypso_SendRequestAsync().
+ *
+ * Completes the active request, if it has been confirmed by the module or has timed out,
+ * and starts sending the next request once the min. command interval (see Calypso_SetTimingParameters())
+ * has elapsed. Doesn't block, unless the UART doesn't support asynchronous transmission
+ * (see Calypso_SendRequestAsync()).
+ *
+ * Is to be called regularly from the application's main loop (not from event callbacks).
+ */
+void Calypso_ProcessRequests(void)
+{
+	if (Calypso_executingEventCallback || (Calypso_requestQueueCount == 0))
+	{
+		return;
+	}
+
+	Calypso_QueuedRequest_t *request = &Calypso_requestQueue[Calypso_requestQueueHead];
+
+	if (Calypso_requestQueueActive)
+	{
+		if (Calypso_requestTxActive)
+		{
+			/* Still transmitting - the request's buffer must not be released before the transmission is complete */
+			return;
+		}
+
+		Calypso_CNFStatus_t status = Calypso_cmdConfirmStatus;
+		if ((Calypso_CNFStatus_Invalid == status) && (WE_GetTick() - request->sentTick < request->timeoutMs))
+		{
+			/* Still waiting for confirmation */
+			return;
+		}
+
+		if (Calypso_CNFStatus_Invalid != status)
+		{
+			/* Store the time at which the confirmation has been received (rather than the time at which
+			 * it is processed here) to enable check for min. time between received confirm and next command.
+			 * Thus, the interval isn't prolonged by the time elapsed until this function is called. */
+			Calypso_lastConfirmTimeUsec = Calypso_confirmReceived ? Calypso_confirmTimeUsec : WE_GetTickMicroseconds();
+		}
+		Calypso_requestPending = false;
+		Calypso_UpdateRequestTiming();
+
+		/* Remove request from queue before executing the callback, so the callback may queue further requests */
+		Calypso_RequestCompleteCallback_t callback = request->callback;
+		void *context = request->context;
+		Calypso_requestQueueHead = (Calypso_requestQueueHead + 1) % CALYPSO_REQUEST_QUEUE_SIZE;
+		Calypso_requestQueueCount--;
+		Calypso_requestQueueActive = false;
+
+		if (NULL != callback)
+		{
+			callback(status, Calypso_currentResponseText, Calypso_currentResponseLength, context);
+		}
+
+		if (Calypso_requestQueueCount == 0)
+		{
+			return;
+		}
+		request = &Calypso_requestQueue[Calypso_requestQueueHead];
+	}
+
+	/* Make sure that the time between the last confirmation received from the module
+	 * and the next command sent to the module is not shorter than Calypso_minCommandIntervalUsec */
+	if (WE_GetTickMicroseconds() - Calypso_lastConfirmTimeUsec < Calypso_minCommandIntervalUsec)
+	{
+		return;
+	}
+
+	request->sentTick = WE_GetTick();
+	Calypso_requestQueueActive = true;
+	Calypso_TransmitQueuedRequest(request->data, request->length, request->commandName);
+}
+
+/**
+ * @brief Starts transmitting a queued request.
+ *
+ * Uses the UART's uartTransmitAsync function, if available. The transmission is then completed
+ * by Calypso_HandleTxComplete(). If the transmission cannot be started, the request times out.
+ *
+ * @param[in] data Complete AT command including the line ending
+ * @param[in] length Length of data
+ * @param[in] commandName Name of the command (NULL to extract the name from data)
+ */
+static void Calypso_TransmitQueuedRequest(const char *data, uint16_t length, const ATCommand_CommandName_t *commandName)
+{
+	Calypso_BeginRequest(data, length, commandName);
+
+	if ((NULL != Calypso_uartP->uartTransmitAsync) && (NULL != Calypso_uartP->uartSetTxCompleteCallback))
+	{
+		/* Set before starting, as the callback may be executed before uartTransmitAsync returns */
+		Calypso_requestTxActive = true;
+		if (!Calypso_uartP->uartTransmitAsync((const uint8_t*) data, length))
+		{
+			Calypso_requestTxActive = false;
+		}
+		return;
+	}
+
+	Calypso_uartP->uartTransmit((const uint8_t*) data, length);
+	Calypso_requestSentTimeUsec = WE_GetTickMicroseconds();
+}
+
+/**
+ * @brief Is called (from interrupt context) when an asynchronous transmission started by
+ * Calypso_TransmitQueuedRequest() has been completed.
+ */
+static void Calypso_HandleTxComplete(void)
+{
+	if (Calypso_requestTxActive)
+	{
+		Calypso_requestSentTimeUsec = WE_GetTickMicroseconds();
+		Calypso_requestTxActive = false;
+	}
+}
+
+/**
+ * @brief Returns the number of requests queued using Calypso_SendRequestAsync() (including the active request).
+ *
+ * @return Number of queued requests
+ */
+uint8_t Calypso_GetQueuedRequestCount(void)
+{
+	return Calypso_requestQueueCount;
+}
+
+/**
+ * @brief Returns the timing of the last request (i.e. of the last call of Calypso_WaitForConfirm()).
+ *
+ * Entries that could not be determined (e.g. confirmation not received) are set to WE_REQUEST_TIMING_INVALID.
+ *
+ * @param[out] timingP Timing of the last request
+ *
+ * @return true if successful, false otherwise
+ */
+bool Calypso_GetLastRequestTiming(WE_RequestTiming_t *timingP)
+{
+	if (NULL == timingP)
+	{
+		return false;
+	}
+	*timingP = Calypso_lastRequestTiming;
+	return true;
+}
+
+/**
+ * @brief Returns the time elapsed between the end of transmission of the pending request and the supplied time.
+ *
+ * @param[in] timeUsec Time (microseconds)
+ *
+ * @return Elapsed time (microseconds), 0 if timeUsec lies before the end of transmission
+ */
+static uint32_t Calypso_GetTimeSinceRequestSent(uint32_t timeUsec)
+{
+	int32_t diff = (int32_t) (timeUsec - Calypso_requestSentTimeUsec);
+	return diff > 0 ? (uint32_t) diff : 0;
+}
+
+/**
+ * @brief Updates Calypso_lastRequestTiming after the pending request has been completed (or timed out).
+ */
+static void Calypso_UpdateRequestTiming()
+{
+	uint32_t now = WE_GetTickMicroseconds();
+
+	Calypso_lastRequestTiming.transmitTime = Calypso_requestSentTimeUsec - Calypso_requestStartTimeUsec;
+	Calypso_lastRequestTiming.firstByteLatency = Calypso_firstByteReceived ? Calypso_GetTimeSinceRequestSent(Calypso_firstByteTimeUsec) : WE_REQUEST_TIMING_INVALID;
+	if (Calypso_confirmReceived)
+	{
+		Calypso_lastRequestTiming.confirmLatency = Calypso_GetTimeSinceRequestSent(Calypso_confirmTimeUsec);
+		Calypso_lastRequestTiming.processingDelay = now - Calypso_confirmTimeUsec;
+	}
+	else
+	{
+		Calypso_lastRequestTiming.confirmLatency = WE_REQUEST_TIMING_INVALID;
+		Calypso_lastRequestTiming.processingDelay = WE_REQUEST_TIMING_INVALID;
+	}
+
+#ifdef WE_DEBUG
+	WE_LOG("%.*s: tx %lu us, first byte %lu us, confirm %lu us, processing %lu us\r\n", (int) Calypso_pendingCommand.length, Calypso_pendingCommand.name, (unsigned long) Calypso_lastRequestTiming.transmitTime, (unsigned long) Calypso_lastRequestTiming.firstByteLatency, (unsigned long) Calypso_lastRequestTiming.confirmLatency,
+			(unsigned long) Calypso_lastRequestTiming.processingDelay);
+#endif
+}
+
+/**
+ * @brief Returns the code of the last error (if any).
+ *
+ * @param[out] lastErrorText Text of last error (if any). See Calypso_lastErrorText for max. buffer size.
+ *
+ * @return Last error code (if any)
+ */
+int32_t Calypso_GetLastError(char *lastErrorText)
+{
+	if (NULL != lastErrorText)
+	{
+		strcpy(lastErrorText, Calypso_lastErrorText);
+	}
+	return Calypso_lastErrorCode;
+}
+
+/**
+ * @brief Set timing parameters used by the Calypso driver.
+ *
+ * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+ *
+ * @param[in] waitTimeStepUsec Max. time (microseconds) to sleep between checks when waiting for responses from Calypso (0 = poll without sleeping).
+ * @param[in] minCommandIntervalUsec Minimum interval (microseconds) between subsequent commands sent to Calypso.
+ *
+ * @return true if successful, false otherwise
+ */
+bool Calypso_SetTimingParameters(uint32_t waitTimeStepUsec, uint32_t minCommandIntervalUsec)
+{
+	Calypso_waitTimeStepUsec = waitTimeStepUsec;
+	Calypso_minCommandIntervalUsec = minCommandIntervalUsec;
+	return true;
+}
+
+/**
+ * @brief Sets the timeout for responses to AT commands of the given type.
+ *
+ * @param[in] type Timeout (i.e. command) type
+ * @param[in] timeout Timeout in milliseconds
+ */
+void Calypso_SetTimeout(Calypso_Timeout_t type, uint32_t timeout)
+{
+	Calypso_timeouts[type] = timeout;
+}
 
 /**
  * @brief Gets the timeout for responses to AT commands of the given type.
@@ -566,13 +1298,37 @@ uint32_t Calypso_GetTimeout(Calypso_Timeout_t type)
  */
 static void Calypso_HandleRxByte(uint8_t *dataP, size_t size)
 {
+	if (Calypso_requestPending && !Calypso_firstByteReceived)
+	{
+		Calypso_firstByteTimeUsec = WE_UART_GetRxTimestamp();
+		Calypso_firstByteReceived = true;
+	}
+
 	uint8_t receivedByte;
-	for (; size > 0; size--, dataP++)
+	while (size > 0)
 	{
-		receivedByte = *dataP;
+		if (NULL != Calypso_socketRxBuffer)
+		{
+			if (WE_UART_GetRxTick() - Calypso_socketRxTick > Calypso_timeouts[Calypso_Timeout_SocketReceive])
+			{
+				/* The rest of the payload has not been received in time (e.g. due to a UART error
+				 * or a reset of the module), so the received data is processed as lines again */
+				Calypso_CompleteSocketRx(false);
+				continue;
+			}
+
+			/* Payload of a +recv/+recvfrom line is written directly to the posted receive buffer */
+			size_t consumed = Calypso_HandleSocketRxData(dataP, size);
+			dataP += consumed;
+			size -= consumed;
+			continue;
+		}
+
+		receivedByte = *dataP++;
+		size--;
 
 		/* Interpret received byte */
-		if (Calypso_rxByteCounter == 0)
+		if ((Calypso_rxByteCounter == 0) && !Calypso_rxLineFragmented && !Calypso_rxLineDiscarded)
 		{
 			/* This is the first character - i.e. the start of a new line */
 			/* Possible responses: OK, Error, +[event], +[cmdResponse] */
@@ -584,13 +1340,6 @@ static void Calypso_HandleRxByte(uint8_t *dataP, size_t size)
 		}
 		else
 		{
-			if (Calypso_rxByteCounter >= CALYPSO_LINE_MAX_SIZE)
-			{
-				Calypso_rxByteCounter = 0;
-				Calypso_eolChar1Found = false;
-				return;
-			}
-
 			if (receivedByte == Calypso_eolChar1)
 			{
 				Calypso_eolChar1Found = true;
@@ -598,11 +1347,7 @@ static void Calypso_HandleRxByte(uint8_t *dataP, size_t size)
 				if (!Calypso_twoEolCharacters)
 				{
 					/* Interpret it now */
-					Calypso_rxBuffer[Calypso_rxByteCounter] = '\0';
-					Calypso_rxByteCounter++;
-					Calypso_HandleRxLine(Calypso_rxBuffer, Calypso_rxByteCounter);
-					Calypso_eolChar1Found = false;
-					Calypso_rxByteCounter = 0;
+					Calypso_CompleteRxLine();
 				}
 			}
 			else if (Calypso_eolChar1Found)
@@ -610,21 +1355,247 @@ static void Calypso_HandleRxByte(uint8_t *dataP, size_t size)
 				if (receivedByte == Calypso_eolChar2)
 				{
 					/* Interpret it now */
-					Calypso_rxBuffer[Calypso_rxByteCounter] = '\0';
-					Calypso_rxByteCounter++;
-					Calypso_HandleRxLine(Calypso_rxBuffer, Calypso_rxByteCounter);
-					Calypso_eolChar1Found = false;
-					Calypso_rxByteCounter = 0;
+					Calypso_CompleteRxLine();
 				}
 			}
 			else
 			{
-				Calypso_rxBuffer[Calypso_rxByteCounter++] = receivedByte;
+				if (Calypso_rxByteCounter >= CALYPSO_LINE_MAX_SIZE - 1)
+				{
+					/* Line doesn't fit into the receive buffer (last byte is reserved for termination character) */
+					Calypso_HandleRxBufferFull();
+				}
+				if (!Calypso_rxLineDiscarded)
+				{
+					Calypso_rxBuffer[Calypso_rxByteCounter++] = receivedByte;
+
+					if ((ATCOMMAND_ARGUMENT_DELIM == receivedByte) && (Calypso_postedReceiveBufferCount > 0) && !Calypso_rxLineFragmented)
+					{
+						/* Check if this is the end of the header of a +recv/+recvfrom line */
+						Calypso_StartSocketRx();
+					}
+				}
 			}
 		}
 	}
 }
 
+/**
+ * @brief Is called when the end of a line has been received.
+ *
+ * Passes the line to Calypso_HandleRxLine() or, if the line didn't fit into the receive
+ * buffer, passes its last fragment to the line fragment callback. Resets the receive buffer.
+ */
+static void Calypso_CompleteRxLine()
+{
+	if (Calypso_rxLineFragmented)
+	{
+		if (NULL != Calypso_lineFragmentRxCallback)
+		{
+			Calypso_lineFragmentRxCallback(Calypso_rxBuffer, Calypso_rxByteCounter, false, true);
+		}
+	}
+	else if (!Calypso_rxLineDiscarded)
+	{
+		Calypso_rxBuffer[Calypso_rxByteCounter] = '\0';
+		Calypso_rxByteCounter++;
+		Calypso_HandleRxLine(Calypso_rxBuffer, Calypso_rxByteCounter);
+	}
+	Calypso_lineReceived = true;
+	Calypso_eolChar1Found = false;
+	Calypso_rxLineFragmented = false;
+	Calypso_rxLineDiscarded = false;
+	Calypso_rxByteCounter = 0;
+}
+
+/**
+ * @brief Is called when the receive buffer is full before the end of the current line has been received.
+ *
+ * Passes the buffered data to the line fragment callback (if set), otherwise the
+ * rest of the line is discarded.
+ */
+static void Calypso_HandleRxBufferFull()
+{
+	if (NULL != Calypso_lineFragmentRxCallback)
+	{
+		Calypso_lineFragmentRxCallback(Calypso_rxBuffer, Calypso_rxByteCounter, !Calypso_rxLineFragmented, false);
+		Calypso_rxLineFragmented = true;
+	}
+	else
+	{
+		Calypso_rxLineDiscarded = true;
+	}
+	Calypso_rxByteCounter = 0;
+}
+
+/**
+ * @brief Checks if the current line is a +recv/+recvfrom line for a socket with a posted
+ * receive buffer and if so, starts writing the line's payload to the posted buffer.
+ *
+ * Is called whenever an argument delimiter has been received. Does nothing unless the
+ * complete header (socket ID, format and length) has been received, a buffer has been
+ * posted for the socket and the payload fits into the buffer. Otherwise, the line is
+ * processed as usual.
+ */
+static void Calypso_StartSocketRx()
+{
+	uint16_t prefixLength;
+	if ((Calypso_rxByteCounter > 10) && (0 == strncasecmp(Calypso_rxBuffer, "+recvfrom:", 10)))
+	{
+		prefixLength = 10;
+	}
+	else if ((Calypso_rxByteCounter > 6) && (0 == strncasecmp(Calypso_rxBuffer, "+recv:", 6)))
+	{
+		prefixLength = 6;
+	}
+	else
+	{
+		return;
+	}
+
+	/* Header is complete when the delimiter following the length argument has been received */
+	uint8_t delimCount = 0;
+	for (uint16_t i = prefixLength; i < Calypso_rxByteCounter; i++)
+	{
+		if (ATCOMMAND_ARGUMENT_DELIM == Calypso_rxBuffer[i])
+		{
+			delimCount++;
+		}
+	}
+	if (3 != delimCount)
+	{
+		return;
+	}
+
+	Calypso_rxBuffer[Calypso_rxByteCounter] = '\0';
+	char *pArguments = Calypso_rxBuffer + prefixLength;
+
+	uint8_t socketID;
+	uint8_t format;
+	uint16_t length;
+	if (!ATCommand_GetNextArgumentInt(&pArguments, &socketID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM) || !ATCommand_GetNextArgumentInt(&pArguments, &format, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM) || !ATCommand_GetNextArgumentInt(&pArguments, &length, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return;
+	}
+
+	if ((socketID >= CALYPSO_MAX_SOCKETS) || (NULL == Calypso_postedReceiveBuffers[socketID].callback))
+	{
+		return;
+	}
+
+	bool base64 = (Calypso_DataFormat_Base64 == format);
+	uint32_t maxDecodedLength = base64 ? ((uint32_t) length / 4 * 3) : length;
+	if (maxDecodedLength > Calypso_postedReceiveBuffers[socketID].size)
+	{
+		/* Payload doesn't fit into the posted buffer */
+		return;
+	}
+
+	Calypso_socketRxBuffer = &Calypso_postedReceiveBuffers[socketID];
+	Calypso_socketRxSocketID = socketID;
+	Calypso_socketRxRemaining = length;
+	Calypso_socketRxLength = 0;
+	Calypso_socketRxBase64 = base64;
+	Calypso_socketRxQuadLength = 0;
+	Calypso_socketRxTick = WE_UART_GetRxTick();
+
+	if (0 == length)
+	{
+		Calypso_CompleteSocketRx(true);
+	}
+}
+
+/**
+ * @brief Writes received payload bytes of the current +recv/+recvfrom line to the posted
+ * receive buffer (decoding Base64 data on the fly).
+ *
+ * @param[in] dataP Received data
+ * @param[in] size Number of received bytes
+ *
+ * @return Number of bytes consumed (the remaining bytes belong to the following lines)
+ */
+static size_t Calypso_HandleSocketRxData(const uint8_t *dataP, size_t size)
+{
+	size_t count = (size < Calypso_socketRxRemaining) ? size : Calypso_socketRxRemaining;
+
+	if (Calypso_socketRxBase64)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			Calypso_socketRxQuad[Calypso_socketRxQuadLength++] = dataP[i];
+			if (sizeof(Calypso_socketRxQuad) == Calypso_socketRxQuadLength)
+			{
+				uint32_t decodedLength = Calypso_socketRxBuffer->size - Calypso_socketRxLength;
+				if (Base64_Decode(Calypso_socketRxQuad, sizeof(Calypso_socketRxQuad), Calypso_socketRxBuffer->buffer + Calypso_socketRxLength, &decodedLength))
+				{
+					Calypso_socketRxLength += decodedLength;
+				}
+				Calypso_socketRxQuadLength = 0;
+			}
+		}
+	}
+	else
+	{
+		memcpy(Calypso_socketRxBuffer->buffer + Calypso_socketRxLength, dataP, count);
+		Calypso_socketRxLength += count;
+	}
+
+	Calypso_socketRxRemaining -= count;
+	Calypso_socketRxTick = WE_UART_GetRxTick();
+	if (0 == Calypso_socketRxRemaining)
+	{
+		Calypso_CompleteSocketRx(true);
+	}
+
+	return count;
+}
+
+/**
+ * @brief Is called when the complete payload of the current +recv/+recvfrom line has been
+ * written to the posted receive buffer or when the rest of the payload has not been received
+ * in time (see Calypso_Timeout_SocketReceive). Releases the buffer and executes its callback.
+ *
+ * Base64 characters that don't form a complete group of four characters at the end of the
+ * payload are dropped (i.e. the payload is expected to be padded by the module).
+ *
+ * @param[in] complete True if the complete payload has been received
+ */
+static void Calypso_CompleteSocketRx(bool complete)
+{
+	/* Release buffer before executing the callback, so that the callback can post a new buffer */
+	Calypso_PostedReceiveBuffer_t posted;
+	Calypso_ReleaseSocketRxBuffer(&posted);
+
+	/* The line end following the payload is ignored, as it doesn't start a new line */
+	Calypso_rxByteCounter = 0;
+	Calypso_eolChar1Found = false;
+	Calypso_lineReceived = true;
+
+	Calypso_executingEventCallback = true;
+	posted.callback(Calypso_socketRxSocketID, posted.buffer, Calypso_socketRxLength, complete, posted.context);
+	Calypso_executingEventCallback = false;
+}
+
+/**
+ * @brief Releases the posted receive buffer into which the payload of the current
+ * +recv/+recvfrom line is written (Calypso_socketRxBuffer).
+ *
+ * Must be called from the rx byte handler or inside a critical section.
+ *
+ * @param[out] releasedP Receives a copy of the released buffer (for executing its callback)
+ */
+static void Calypso_ReleaseSocketRxBuffer(Calypso_PostedReceiveBuffer_t *releasedP)
+{
+	releasedP->buffer = Calypso_socketRxBuffer->buffer;
+	releasedP->size = Calypso_socketRxBuffer->size;
+	releasedP->callback = Calypso_socketRxBuffer->callback;
+	releasedP->context = Calypso_socketRxBuffer->context;
+
+	Calypso_socketRxBuffer->callback = NULL;
+	Calypso_postedReceiveBufferCount--;
+	Calypso_socketRxBuffer = NULL;
+}
+
 /**
  * @brief Is called when a complete line has been received.
  *
@@ -634,7 +1605,7 @@ static void Calypso_HandleRxByte(uint8_t *dataP, size_t size)
 static void Calypso_HandleRxLine(char *rxPacket, uint16_t rxLength)
 {
 #ifdef WE_DEBUG
-	printf("< %s\r\n", rxPacket);
+	WE_LOG("< %s\r\n", rxPacket);
 #endif
 
 	/* Check if a custom line rx callback is specified and call it if so */
@@ -693,7 +1664,7 @@ static void Calypso_HandleRxLine(char *rxPacket, uint16_t rxLength)
 		{
 			/* Doesn't start with o or e - copy to response text buffer, if the start
 			 * of the response matches the pending command name preceded by '+' */
-			if (rxLength < CALYPSO_LINE_MAX_SIZE && rxLength > 1 && Calypso_rxBuffer[0] == '+' && Calypso_pendingCommandName[0] != '\0' && 0 == strncasecmp(Calypso_pendingCommandName, Calypso_rxBuffer + 1, Calypso_pendingCommandNameLength))
+			if (rxLength < CALYPSO_LINE_MAX_SIZE && rxLength > 1 && Calypso_rxBuffer[0] == '+' && ATCommand_MatchCommandName(&Calypso_pendingCommand, Calypso_rxBuffer + 1, rxLength - 1, true))
 			{
 				/* Copy to response text buffer, taking care not to exceed buffer size */
 				uint16_t chunkLength = rxLength;
@@ -705,6 +1676,12 @@ static void Calypso_HandleRxLine(char *rxPacket, uint16_t rxLength)
 				Calypso_currentResponseLength += chunkLength;
 			}
 		}
+
+		if ((Calypso_CNFStatus_Invalid != Calypso_cmdConfirmStatus) && !Calypso_confirmReceived)
+		{
+			Calypso_confirmTimeUsec = WE_UART_GetRxTimestamp();
+			Calypso_confirmReceived = true;
+		}
 	}
 
 	if ('+' == rxPacket[0])
@@ -758,3 +1735,123 @@ void Calypso_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacters)
 	Calypso_eolChar2 = eol2;
 	Calypso_twoEolCharacters = twoEolCharacters;
 }
+
+/**
+ * @brief Sets an optional callback function which receives lines that don't fit into the receive buffer.
+ *
+ * Lines exceeding CALYPSO_LINE_MAX_SIZE (e.g. responses containing large amounts of data) are
+ * passed to this callback in fragments instead of being processed by the driver. The callback
+ * is executed in the context of the rx byte handler. If no callback is set, such lines are discarded.
+ *
+ * @param[in] callback Pointer to line fragment received callback function (may be NULL)
+ */
+void Calypso_SetLineFragmentRxCallback(Calypso_LineFragmentRxCallback_t callback)
+{
+	Calypso_lineFragmentRxCallback = callback;
+}
+
+/**
+ * @brief Posts a buffer for receiving data via the supplied socket.
+ *
+ * The payload of the next +recv or +recvfrom line received for the socket is written
+ * directly to the buffer as it is received from the module (Base64 encoded data is
+ * decoded on the fly), instead of being passed to the event callback. This also means
+ * that the payload size is not limited by CALYPSO_LINE_MAX_SIZE. Lines with payloads
+ * exceeding the buffer's size are processed as usual.
+ *
+ * When the payload has been received, the buffer is released and the callback is executed
+ * in the context of the rx byte handler (a new buffer may be posted from within the callback).
+ * The buffer must stay valid until then or until Calypso_CancelSocketReceiveBuffer() is called.
+ *
+ * If the rest of the payload is not received within the timeout Calypso_Timeout_SocketReceive
+ * (e.g. due to a UART error or a reset of the module), reception is aborted as soon as further
+ * data is received. In this case, the callback is executed with complete set to false and the
+ * further data is processed as usual. Trailing Base64 characters that don't form a complete group
+ * of four characters (i.e. payloads whose length is not a multiple of 4) are silently dropped.
+ *
+ * @param[in] socketID ID of the socket
+ * @param[in] buffer Buffer receiving the data
+ * @param[in] size Size of buffer
+ * @param[in] callback Callback executed when data has been received into the buffer
+ * @param[in] context Context pointer passed to callback (optional)
+ *
+ * @return true if successful, false if the arguments are invalid or a buffer has already been posted for the socket
+ */
+bool Calypso_PostSocketReceiveBuffer(uint8_t socketID, uint8_t *buffer, uint16_t size, Calypso_SocketReceiveCallback_t callback, void *context)
+{
+	if ((socketID >= CALYPSO_MAX_SOCKETS) || (NULL == buffer) || (0 == size) || (NULL == callback))
+	{
+		return false;
+	}
+
+	Calypso_PostedReceiveBuffer_t *posted = &Calypso_postedReceiveBuffers[socketID];
+
+	/* The rx byte handler must not use the entry while it is being modified */
+	uint32_t state = WE_EnterCriticalSection();
+	if (NULL != posted->callback)
+	{
+		WE_ExitCriticalSection(state);
+		return false;
+	}
+
+	posted->buffer = buffer;
+	posted->size = size;
+	posted->context = context;
+	posted->callback = callback;
+	Calypso_postedReceiveBufferCount++;
+	WE_ExitCriticalSection(state);
+
+	return true;
+}
+
+/**
+ * @brief Releases a buffer posted using Calypso_PostSocketReceiveBuffer().
+ *
+ * If data is currently being received into the buffer, reception is aborted: The rest of
+ * the current line is discarded and the buffer's callback is executed (in the context of the
+ * caller) with complete set to false and the number of bytes received so far. Note that if
+ * binary data is being received, a line end contained in the rest of the payload ends the
+ * discarded line early. Otherwise, the buffer is released without executing its callback.
+ *
+ * @param[in] socketID ID of the socket
+ *
+ * @return true if successful, false if no buffer has been posted for the socket
+ */
+bool Calypso_CancelSocketReceiveBuffer(uint8_t socketID)
+{
+	if (socketID >= CALYPSO_MAX_SOCKETS)
+	{
+		return false;
+	}
+
+	Calypso_PostedReceiveBuffer_t *posted = &Calypso_postedReceiveBuffers[socketID];
+
+	/* Checking and releasing the buffer must not be interrupted by the rx byte handler */
+	uint32_t state = WE_EnterCriticalSection();
+	if (NULL == posted->callback)
+	{
+		WE_ExitCriticalSection(state);
+		return false;
+	}
+
+	if (Calypso_socketRxBuffer != posted)
+	{
+		posted->callback = NULL;
+		Calypso_postedReceiveBufferCount--;
+		WE_ExitCriticalSection(state);
+		return true;
+	}
+
+	/* Data is currently being received into the buffer - abort reception and discard the rest of the line */
+	Calypso_PostedReceiveBuffer_t released;
+	Calypso_ReleaseSocketRxBuffer(&released);
+	uint16_t length = Calypso_socketRxLength;
+	Calypso_rxByteCounter = 0;
+	Calypso_eolChar1Found = false;
+	Calypso_rxLineDiscarded = true;
+	WE_ExitCriticalSection(state);
+
+	released.callback(socketID, released.buffer, length, false, released.context);
+
+	return true;
+}
@@ -35,6 +35,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <global/global_types.h>
+#include <global/ATCommands.h>
 #include <utils/base64.h>
 
 /**
@@ -68,6 +69,49 @@
  */
 #define CALYPSO_MAX_RESPONSE_TEXT_LENGTH CALYPSO_LINE_MAX_SIZE
 
+/**
+ * @brief Size of the buffer used for assembling the commands sent to Calypso and for
+ * storing the responses to these commands (see Calypso_commandBuffer).
+ *
+ * May be defined by the application, must not be smaller than CALYPSO_MAX_RESPONSE_TEXT_LENGTH.
+ */
+#ifndef CALYPSO_COMMAND_BUFFER_SIZE
+#define CALYPSO_COMMAND_BUFFER_SIZE CALYPSO_LINE_MAX_SIZE
+#endif
+
+#if CALYPSO_COMMAND_BUFFER_SIZE < CALYPSO_MAX_RESPONSE_TEXT_LENGTH
+#error "CALYPSO_COMMAND_BUFFER_SIZE must not be smaller than CALYPSO_MAX_RESPONSE_TEXT_LENGTH"
+#endif
+
+/**
+ * @brief Max. number of requests that can be queued using Calypso_SendRequestAsync().
+ *
+ * May be defined by the application.
+ */
+#ifndef CALYPSO_REQUEST_QUEUE_SIZE
+#define CALYPSO_REQUEST_QUEUE_SIZE 4
+#endif
+
+/**
+ * @brief Number of payload bytes that are Base64 encoded at a time when streaming
+ * a payload to Calypso using Calypso_SendRequestWithPayload().
+ *
+ * Determines the size of the encoding buffer on the stack (4/3 of this value).
+ * May be defined by the application, must be a multiple of 3.
+ */
+#ifndef CALYPSO_BASE64_ENCODE_BLOCK_SIZE
+#define CALYPSO_BASE64_ENCODE_BLOCK_SIZE 96
+#endif
+
+#if (CALYPSO_BASE64_ENCODE_BLOCK_SIZE % 3) != 0
+#error "CALYPSO_BASE64_ENCODE_BLOCK_SIZE must be a multiple of 3"
+#endif
+
+/**
+ * @brief Max. number of sockets (socket IDs range from 0 to CALYPSO_MAX_SOCKETS - 1).
+ */
+#define CALYPSO_MAX_SOCKETS 16
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -109,6 +153,7 @@ typedef enum Calypso_Timeout_t
 	Calypso_Timeout_HttpRequest,
 	Calypso_Timeout_FileIO,
 	Calypso_Timeout_GPIO,
+	Calypso_Timeout_SocketReceive, /**< Max. gap while receiving a payload into a posted receive buffer */
 	Calypso_Timeout_NumberOfValues
 } Calypso_Timeout_t;
 
@@ -143,6 +188,20 @@ typedef struct Calypso_Pins_t
  */
 typedef void (*Calypso_EventCallback_t)(char*);
 
+/**
+ * @brief Calypso line fragment received callback.
+ *
+ * Receives lines that don't fit into the receive buffer of the driver (CALYPSO_LINE_MAX_SIZE),
+ * e.g. responses containing large amounts of data. Such lines are not processed by the
+ * driver, but are passed to this callback in fragments as they are received.
+ *
+ * Arguments: Fragment text (not null-terminated), length of fragment,
+ *            true if first fragment of line, true if last fragment of line
+ *
+ * @see Calypso_SetLineFragmentRxCallback()
+ */
+typedef void (*Calypso_LineFragmentRxCallback_t)(const char*, uint16_t, bool, bool);
+
 /**
  * @brief Calypso line received callback.
  *
@@ -156,10 +215,41 @@ typedef void (*Calypso_EventCallback_t)(char*);
  */
 typedef bool (*Calypso_LineRxCallback_t)(char*, uint16_t);
 
+/**
+ * @brief Completion callback of a request sent using Calypso_SendRequestAsync().
+ *
+ * Arguments: Confirmation status (Calypso_CNFStatus_Invalid if the request has timed out),
+ *            response text (not null-terminated, only valid during the callback),
+ *            length of response text, context pointer passed to Calypso_SendRequestAsync()
+ *
+ * @see Calypso_SendRequestAsync()
+ */
+typedef void (*Calypso_RequestCompleteCallback_t)(Calypso_CNFStatus_t, const char*, uint16_t, void*);
+
+/**
+ * @brief Completion callback of a receive buffer posted using Calypso_PostSocketReceiveBuffer().
+ *
+ * Arguments: Socket ID, receive buffer (containing the decoded data), number of bytes received,
+ *            true if the complete payload has been received (false if reception has been aborted),
+ *            context pointer passed to Calypso_PostSocketReceiveBuffer()
+ *
+ * @see Calypso_PostSocketReceiveBuffer(), Calypso_CancelSocketReceiveBuffer()
+ */
+typedef void (*Calypso_SocketReceiveCallback_t)(uint8_t, uint8_t*, uint16_t, bool, void*);
+
 extern uint8_t Calypso_firmwareVersionMajor;
 extern uint8_t Calypso_firmwareVersionMinor;
 extern uint8_t Calypso_firmwareVersionPatch;
 
+/**
+ * @brief Buffer used by the Calypso driver for assembling commands and storing responses.
+ *
+ * Is owned by the Calypso driver, so commands for other modules can be assembled at the
+ * same time. Commands may also be assembled in a buffer supplied by the caller
+ * (see ATCommand_BuilderInit()) and sent using Calypso_SendRequest().
+ */
+extern char Calypso_commandBuffer[CALYPSO_COMMAND_BUFFER_SIZE];
+
 extern bool Calypso_Init(WE_UART_t *uartP, Calypso_Pins_t *pinoutP, Calypso_EventCallback_t eventCallback);
 
 extern bool Calypso_Deinit(void);
@@ -170,9 +260,16 @@ extern bool Calypso_PinWakeUp(void);
 extern WE_Pin_Level_t Calypso_GetPinLevel(WE_Pin_t pin);
 
 extern bool Calypso_SendRequest(char *data);
+extern bool Calypso_SendRequestWithCommandName(char *data, const ATCommand_CommandName_t *commandName);
+extern bool Calypso_SendRequestWithPayload(char *header, const uint8_t *payload, uint16_t payloadLength, bool encodeAsBase64, const ATCommand_CommandName_t *commandName);
 extern bool Calypso_WaitForConfirm(uint32_t maxTimeMs, Calypso_CNFStatus_t expectedStatus, char *pOutResponse);
+extern bool Calypso_SendRequestAsync(char *data, uint32_t timeoutMs, Calypso_RequestCompleteCallback_t callback, void *context);
+extern bool Calypso_SendRequestWithPayloadAsync(char *buffer, uint16_t bufferSize, const uint8_t *payload, uint16_t payloadLength, bool encodeAsBase64, const ATCommand_CommandName_t *commandName, uint32_t timeoutMs, Calypso_RequestCompleteCallback_t callback, void *context);
+extern void Calypso_ProcessRequests(void);
+extern uint8_t Calypso_GetQueuedRequestCount(void);
 
 extern int32_t Calypso_GetLastError(char *lastErrorText);
+extern bool Calypso_GetLastRequestTiming(WE_RequestTiming_t *timingP);
 
 extern bool Calypso_SetTimingParameters(uint32_t waitTimeStepMicroseconds, uint32_t minCommandIntervalMicroseconds);
 extern void Calypso_SetTimeout(Calypso_Timeout_t type, uint32_t timeout);
@@ -182,6 +279,9 @@ extern bool Calypso_Transparent_Transmit(const char *data, uint16_t dataLength);
 extern void Calypso_SetByteRxCallback(WE_UART_HandleRxByte_t callback);
 extern void Calypso_SetLineRxCallback(Calypso_LineRxCallback_t callback);
 extern void Calypso_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacters);
+extern void Calypso_SetLineFragmentRxCallback(Calypso_LineFragmentRxCallback_t callback);
+extern bool Calypso_PostSocketReceiveBuffer(uint8_t socketID, uint8_t *buffer, uint16_t size, Calypso_SocketReceiveCallback_t callback, void *context);
+extern bool Calypso_CancelSocketReceiveBuffer(uint8_t socketID);
 
 #ifdef __cplusplus
 }
@@ -80,7 +80,7 @@ bool DaphnisI_GetBatteryLevel(uint16_t *batteryLevelP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -31,29 +31,28 @@
 #include <DaphnisI/Commands/ATEvent.h>
 #include <DaphnisI/Commands/LoRaWAN.h>
 #include <global/ATCommands.h>
-#include <stdlib.h>
 
 const static ATCommand_Event_t ContextSubEvents[] = {
+				EVENTENTRY("NVM_DATA_RESTORED", DaphnisI_ATEvent_ContextState_Restored)
 				EVENTENTRY("NVM_DATA_STORED", DaphnisI_ATEvent_ContextState_Stored)
-				LASTEVENTENTRY("NVM_DATA_RESTORED", DaphnisI_ATEvent_ContextState_Restored)
 		};
 
 const static ATCommand_Event_t JoinSubEvents[] = {
 				EVENTENTRY("JOINED", DaphnisI_ATEvent_JoinState_Success)
-				LASTEVENTENTRY("JOIN_FAILED", DaphnisI_ATEvent_JoinState_Fail)
+				EVENTENTRY("JOIN_FAILED", DaphnisI_ATEvent_JoinState_Fail)
 		};
 
 static ATCommand_Event_t moduleMainEvents[] = {
+				EVENTENTRY("+BEACONINFO", DaphnisI_ATEvent_BeaconInfo)
+				EVENTENTRY("+BEACONLOST", DaphnisI_ATEvent_BeaconLost)
+				EVENTENTRY("+BEACONNOTRECEIVED", DaphnisI_ATEvent_BeaconNotReceived)
+				EVENTENTRY("+CLASSUPDATE", DaphnisI_ATEvent_Class)
 				PARENTEVENTENTRY("+CS", ContextSubEvents, ATCOMMAND_STRING_TERMINATE)
 				PARENTEVENTENTRY("+JOIN", JoinSubEvents, ATCOMMAND_STRING_TERMINATE)
-				EVENTENTRY("+SYSNOTF", DaphnisI_ATEvent_Sysnotf)
-				EVENTENTRY("+RXINFO", DaphnisI_ATEvent_RxInfo)
 				EVENTENTRY("+RXDATA", DaphnisI_ATEvent_RxData)
+				EVENTENTRY("+RXINFO", DaphnisI_ATEvent_RxInfo)
+				EVENTENTRY("+SYSNOTF", DaphnisI_ATEvent_Sysnotf)
 				EVENTENTRY("+TXCONF", DaphnisI_ATEvent_TxConf)
-				EVENTENTRY("+CLASSUPDATE", DaphnisI_ATEvent_Class)
-				EVENTENTRY("+BEACONINFO", DaphnisI_ATEvent_BeaconInfo)
-				EVENTENTRY("+BEACONLOST", DaphnisI_ATEvent_BeaconLost)
-				LASTEVENTENTRY("+BEACONNOTRECEIVED", DaphnisI_ATEvent_BeaconNotReceived)
 		};
 
 /**
@@ -70,7 +69,7 @@ bool DaphnisI_ATEvent_ParseEventType(char **pAtCommand, DaphnisI_ATEvent_t *pEve
 			ATCOMMAND_EVENT_DELIM,
 			ATCOMMAND_STRING_TERMINATE };
 
-	if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, delimiters, sizeof(delimiters), (uint16_t*) pEvent))
+	if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, ATCOMMAND_EVENT_COUNT(moduleMainEvents), delimiters, sizeof(delimiters), (uint16_t*) pEvent))
 	{
 		*pEvent = DaphnisI_ATEvent_Invalid;
 		return false;
@@ -182,8 +181,11 @@ bool DaphnisI_ATEvent_ParseRxInfo(char **pEventArguments, DaphnisI_RxInfo_t *pRx
 /**
  * @brief Parses the values of the join event arguments.
  *
+ * The received data is written to pRxData->data, which must provide space for at least
+ * DAPHNISI_MAX_PAYLOAD_SIZE bytes.
+ *
  * @param[in,out] pEventArguments String containing arguments of the AT command
- * @param[out] pRxData The parsed rx data parameters
+ * @param[in,out] pRxData The parsed rx data parameters
  *
  * @return true if parsed successfully, false otherwise
  */
@@ -199,22 +201,22 @@ bool DaphnisI_ATEvent_ParseRxData(char **pEventArguments, DaphnisI_RxData_t *pRx
 		return false;
 	}
 
-	uint8_t outLength = (strlen(*pEventArguments) >> 1);
-	if (outLength != pRxData->dataLength)
+	if (pRxData->dataLength > DAPHNISI_MAX_PAYLOAD_SIZE)
 	{
-		// not the expected length of data
+		// more data than fits into the receive buffer
 		return false;
 	}
 
-	char byteString[3];
-	byteString[2] = '\0';
-	// Read to characters of hex representation and convert to bytes
-	for (uint8_t i = 0; i < outLength; i++)
+	uint16_t outLength;
+	if (!ATCommand_GetNextArgumentHex(pEventArguments, pRxData->data, &outLength, pRxData->dataLength, ATCOMMAND_STRING_TERMINATE))
 	{
-		byteString[0] = (*pEventArguments)[2 * i];
-		byteString[1] = (*pEventArguments)[2 * i + 1];
+		return false;
+	}
 
-		pRxData->data[i] = (uint8_t) strtol(byteString, NULL, 16);
+	if (outLength != pRxData->dataLength)
+	{
+		// not the expected length of data
+		return false;
 	}
 
 	return true;
@@ -41,16 +41,17 @@
  */
 bool DaphnisI_SetUARTBaudRate(DaphnisI_UARTBaudRate baudRate)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+UARTBAUDRATE=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+UARTBAUDRATE=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, baudRate,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, baudRate,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -82,7 +83,7 @@ bool DaphnisI_GetUARTBaudRate(DaphnisI_UARTBaudRate *baudRateP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
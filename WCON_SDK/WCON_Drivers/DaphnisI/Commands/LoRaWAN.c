@@ -31,7 +31,8 @@
 #include <DaphnisI/DaphnisI.h>
 #include <global/ATCommands.h>
 #include <stdint.h>
-#include <stdio.h>
+
+static const ATCommand_CommandName_t DaphnisI_SendCommandName = ATCOMMAND_COMMAND_NAME("SEND");
 
 static char *DaphnisI_Delay_GetRequestStrings[DaphnisI_Delay_Count] = {
 		"AT+JN1DL=?\r\n",
@@ -68,15 +69,16 @@ bool DaphnisI_SetAPPEUI(pEui_t app_eui)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+APPEUI=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+APPEUI=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, app_eui, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, app_eui, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -108,7 +110,7 @@ bool DaphnisI_GetAPPEUI(pEui_t *app_euiP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -141,15 +143,16 @@ bool DaphnisI_SetDeviceEUI(pEui_t device_eui)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+DEUI=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+DEUI=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, device_eui, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, device_eui, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -181,7 +184,7 @@ bool DaphnisI_GetDeviceEUI(pEui_t *device_euiP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -215,15 +218,16 @@ bool DaphnisI_SetKey(DaphnisI_KEYTYPE keyType, pKey_t key)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, DaphnisI_Key_SetRequestStrings[keyType]);
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), DaphnisI_Key_SetRequestStrings[keyType]);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, key, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, key, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -250,15 +254,16 @@ bool DaphnisI_SetDeviceAddress(pDeviceAddress_t device_address)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+DADDR=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+DADDR=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, device_address, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, device_address, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -290,7 +295,7 @@ bool DaphnisI_GetDeviceAddress(pDeviceAddress_t *device_addressP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -318,15 +323,16 @@ bool DaphnisI_GetDeviceAddress(pDeviceAddress_t *device_addressP)
  */
 bool DaphnisI_SetNetworkID(uint8_t network_id)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+NWKID=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+NWKID=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, network_id, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, network_id, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -358,7 +364,7 @@ bool DaphnisI_GetNetworkID(uint8_t *network_idP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -414,15 +420,16 @@ bool DaphnisI_EraseStoredStackContext()
  */
 bool DaphnisI_SetDeviceClass(DaphnisI_DeviceClass device_class)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+CLASS=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+CLASS=");
 
-	*pRequestCommand = "ABC"[device_class];
-	pRequestCommand++;
-	*pRequestCommand = '\0';
-	pRequestCommand++;
+	if (!ATCommand_BuilderAppendArgumentBytes(&requestCommand, &"ABC"[device_class], 1, ATCOMMAND_STRING_TERMINATE))
+	{
+		return false;
+	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -454,7 +461,7 @@ bool DaphnisI_GetDeviceClass(DaphnisI_DeviceClass *device_classP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -482,13 +489,14 @@ bool DaphnisI_GetDeviceClass(DaphnisI_DeviceClass *device_classP)
  */
 bool DaphnisI_Join(DaphnisI_JoinMode join_Mode)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+JOIN=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+JOIN=");
 
-	ATCommand_AppendArgumentInt(pRequestCommand, join_Mode,
+	ATCommand_BuilderAppendArgumentInt(&requestCommand, join_Mode,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE);
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -498,7 +506,7 @@ bool DaphnisI_Join(DaphnisI_JoinMode join_Mode)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	return DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand);
 }
 
@@ -529,35 +537,31 @@ bool DaphnisI_Send(uint8_t port, const uint8_t *payload, uint16_t length, bool a
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+SEND=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+SEND=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, port, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_EVENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, port, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_EVENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, ack_Requested ? 1 : 0, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_EVENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, ack_Requested ? 1 : 0, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_EVENT_DELIM))
 	{
 		return false;
 	}
 
-	size_t pRequestCommandLength = strlen(pRequestCommand);
-
-	for (uint16_t i = 0; i < length; i++)
+	if (!ATCommand_BuilderAppendArgumentHex(&requestCommand, payload, length, ATCOMMAND_STRING_TERMINATE))
 	{
-		sprintf(&pRequestCommand[pRequestCommandLength], "%02X", payload[i]);
-		pRequestCommandLength += 2;
+		return false;
 	}
 
-	pRequestCommand[pRequestCommandLength] = '\0';
-
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!DaphnisI_SendRequest(pRequestCommand))
+	if (!DaphnisI_SendRequestWithCommandName(pRequestCommand, &DaphnisI_SendCommandName))
 	{
 		return false;
 	}
@@ -575,16 +579,17 @@ bool DaphnisI_Send(uint8_t port, const uint8_t *payload, uint16_t length, bool a
  */
 bool DaphnisI_SetDelay(DaphnisI_Delay delayType, uint16_t delayMS)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, DaphnisI_Delay_SetRequestStrings[delayType]);
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), DaphnisI_Delay_SetRequestStrings[delayType]);
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, delayMS,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, delayMS,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -617,7 +622,7 @@ bool DaphnisI_GetDelay(DaphnisI_Delay delayType, uint16_t *delayMSP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -646,16 +651,17 @@ bool DaphnisI_GetDelay(DaphnisI_Delay delayType, uint16_t *delayMSP)
  */
 bool DaphnisI_SetRX2Frequency(uint32_t frequency)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+RX2FQ=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+RX2FQ=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, frequency,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, frequency,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE32, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -687,7 +693,7 @@ bool DaphnisI_GetRX2Frequency(uint32_t *frequencyP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -723,16 +729,17 @@ bool DaphnisI_SetRX2DataRate(uint8_t dataRate)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+RX2DR=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+RX2DR=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, dataRate,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, dataRate,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -764,7 +771,7 @@ bool DaphnisI_GetRX2DataRate(uint8_t *dataRateP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -800,16 +807,17 @@ bool DaphnisI_SetPingSlotPeriodicityFactor(uint8_t factor)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+PGSLOT=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+PGSLOT=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, factor,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, factor,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -841,7 +849,7 @@ bool DaphnisI_GetPingSlotPeriodicityFactor(uint8_t *factorP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -877,16 +885,17 @@ bool DaphnisI_SetTxPower(uint8_t power)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+TXP=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+TXP=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, power,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, power,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -918,7 +927,7 @@ bool DaphnisI_GetTxPower(uint8_t *powerP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -948,16 +957,17 @@ bool DaphnisI_GetTxPower(uint8_t *powerP)
  */
 bool DaphnisI_SetAdaptiveDataRate(bool adr)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+ADR=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+ADR=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, adr,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, adr,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -989,7 +999,7 @@ bool DaphnisI_GetAdaptiveDataRate(bool *adrP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -1025,16 +1035,17 @@ bool DaphnisI_SetDataRate(uint8_t dataRate)
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+DR=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+DR=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, dataRate,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, dataRate,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1066,7 +1077,7 @@ bool DaphnisI_GetDataRate(uint8_t *dataRateP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -1096,16 +1107,17 @@ bool DaphnisI_GetDataRate(uint8_t *dataRateP)
  */
 bool DaphnisI_SetDutyCycleRestriction(bool dcRestriction)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+DCS=");
+	char *pRequestCommand = DaphnisI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, DaphnisI_commandBuffer, sizeof(DaphnisI_commandBuffer), "AT+DCS=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, dcRestriction,
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, dcRestriction,
 	ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1137,7 +1149,7 @@ bool DaphnisI_GetDutyCycleRestriction(bool *dcRestrictionP)
 		return false;
 	}
 
-	char *pRespondCommand = AT_commandBuffer;
+	char *pRespondCommand = DaphnisI_commandBuffer;
 	if (!DaphnisI_WaitForConfirm(DaphnisI_GetTimeout(DaphnisI_Timeout_General), DaphnisI_CNFStatus_Success, pRespondCommand))
 	{
 		return false;
@@ -35,6 +35,8 @@
 
 static void DaphnisI_HandleRxByte(uint8_t *dataP, size_t size);
 static void DaphnisI_HandleRxLine(char *rxPacket, uint16_t rxLength);
+static void DaphnisI_CompleteRxLine();
+static void DaphnisI_HandleRxBufferFull();
 static WE_UART_HandleRxByte_t byteRxCallback = DaphnisI_HandleRxByte;
 
 /**
@@ -56,9 +58,17 @@ static char DaphnisI_pendingCommandName[64] = {
 		0 };
 
 /**
- * @brief Length of DaphnisI_pendingCommandName.
+ * @brief Name of the pending command (points to DaphnisI_pendingCommandName or to a
+ * name supplied to DaphnisI_SendRequestWithCommandName()).
  */
-static size_t DaphnisI_pendingCommandNameLength = 0;
+static ATCommand_CommandName_t DaphnisI_pendingCommand = {
+		NULL,
+		0 };
+
+/**
+ * @brief Buffer used for assembling commands and storing responses.
+ */
+char DaphnisI_commandBuffer[DAPHNISI_COMMAND_BUFFER_SIZE];
 
 /**
  * @brief Buffer used for current response text.
@@ -98,6 +108,24 @@ static uint16_t DaphnisI_rxByteCounter = 0;
  */
 static bool DaphnisI_eolChar1Found = false;
 
+/**
+ * @brief Is set if the current line didn't fit into the receive buffer and is
+ * passed to DaphnisI_lineFragmentRxCallback in fragments.
+ */
+static bool DaphnisI_rxLineFragmented = false;
+
+/**
+ * @brief Is set if the current line didn't fit into the receive buffer and is
+ * discarded (because no line fragment callback has been set).
+ */
+static bool DaphnisI_rxLineDiscarded = false;
+
+/**
+ * @brief Optional callback function which receives lines that don't fit into the receive buffer.
+ * @see DaphnisI_SetLineFragmentRxCallback()
+ */
+static DaphnisI_LineFragmentRxCallback_t DaphnisI_lineFragmentRxCallback = NULL;
+
 /**
  * @brief First EOL character expected for responses received from DaphnisI.
  * @see DaphnisI_eolChar2, DaphnisI_twoEolCharacters, DaphnisI_SetEolCharacters()
@@ -128,14 +156,20 @@ static DaphnisI_Pins_t *DaphnisI_pinsP = NULL;
 static WE_UART_t *DaphnisI_uartP = NULL;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from DaphnisI.
+ * @brief Max. time (microseconds) to sleep between checks when waiting for responses from DaphnisI.
  *
- * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+ * Waiting ends as soon as a line has been received (see DaphnisI_lineReceived). If set to 0, the
+ * driver polls for responses without sleeping.
  *
  * @see DaphnisI_SetTimingParameters
  */
 static uint32_t DaphnisI_waitTimeStepUsec = 5 * 1000;
 
+/**
+ * @brief Is set when a line has been received from DaphnisI (used to wake up DaphnisI_WaitForConfirm()).
+ */
+static volatile bool DaphnisI_lineReceived = false;
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to DaphnisI
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -186,7 +220,7 @@ static const char *DaphnisI_ErrorMessage_Strings[DaphnisI_ErrorMessage_Count] =
 static void DaphnisI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 {
 #ifdef WE_DEBUG
-	printf("< %s\r\n", rxPacket);
+	WE_LOG("< %s\r\n", rxPacket);
 #endif
 
 	if (DaphnisI_requestPending)
@@ -224,7 +258,7 @@ static void DaphnisI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 		{
 			/* Copy to response text buffer, if the start
 			 * of the response matches the pending command name preceded by '+' */
-			if (rxLength < DAPHNISI_LINE_MAX_SIZE && rxLength > 1 && DaphnisI_rxBuffer[0] == '+' && DaphnisI_pendingCommandName[0] != '\0' && 0 == strncasecmp(DaphnisI_pendingCommandName, DaphnisI_rxBuffer + 1, DaphnisI_pendingCommandNameLength))
+			if (rxLength < DAPHNISI_LINE_MAX_SIZE && rxLength > 1 && DaphnisI_rxBuffer[0] == '+' && ATCommand_MatchCommandName(&DaphnisI_pendingCommand, DaphnisI_rxBuffer + 1, rxLength - 1, true))
 			{
 				/* Copy to response text buffer, taking care not to exceed buffer size */
 				uint16_t chunkLength = rxLength;
@@ -265,7 +299,7 @@ static void DaphnisI_HandleRxByte(uint8_t *dataP, size_t size)
 		receivedByte = *dataP;
 
 		/* Interpret received byte */
-		if (DaphnisI_rxByteCounter == 0)
+		if ((DaphnisI_rxByteCounter == 0) && !DaphnisI_rxLineFragmented && !DaphnisI_rxLineDiscarded)
 		{
 			/* This is the first character - i.e. the start of a new line */
 			/* Possible responses: OK, AT_, +[event], +[cmdResponse] */
@@ -277,13 +311,6 @@ static void DaphnisI_HandleRxByte(uint8_t *dataP, size_t size)
 		}
 		else
 		{
-			if (DaphnisI_rxByteCounter >= DAPHNISI_LINE_MAX_SIZE)
-			{
-				DaphnisI_rxByteCounter = 0;
-				DaphnisI_eolChar1Found = false;
-				return;
-			}
-
 			if (receivedByte == DaphnisI_eolChar1)
 			{
 				DaphnisI_eolChar1Found = true;
@@ -291,11 +318,7 @@ static void DaphnisI_HandleRxByte(uint8_t *dataP, size_t size)
 				if (!DaphnisI_twoEolCharacters)
 				{
 					/* Interpret it now */
-					DaphnisI_rxBuffer[DaphnisI_rxByteCounter] = '\0';
-					DaphnisI_rxByteCounter++;
-					DaphnisI_HandleRxLine(DaphnisI_rxBuffer, DaphnisI_rxByteCounter);
-					DaphnisI_eolChar1Found = false;
-					DaphnisI_rxByteCounter = 0;
+					DaphnisI_CompleteRxLine();
 				}
 			}
 			else if (DaphnisI_eolChar1Found)
@@ -303,21 +326,73 @@ static void DaphnisI_HandleRxByte(uint8_t *dataP, size_t size)
 				if (receivedByte == DaphnisI_eolChar2)
 				{
 					/* Interpret it now */
-					DaphnisI_rxBuffer[DaphnisI_rxByteCounter] = '\0';
-					DaphnisI_rxByteCounter++;
-					DaphnisI_HandleRxLine(DaphnisI_rxBuffer, DaphnisI_rxByteCounter);
-					DaphnisI_eolChar1Found = false;
-					DaphnisI_rxByteCounter = 0;
+					DaphnisI_CompleteRxLine();
 				}
 			}
 			else
 			{
-				DaphnisI_rxBuffer[DaphnisI_rxByteCounter++] = receivedByte;
+				if (DaphnisI_rxByteCounter >= DAPHNISI_LINE_MAX_SIZE - 1)
+				{
+					/* Line doesn't fit into the receive buffer (last byte is reserved for termination character) */
+					DaphnisI_HandleRxBufferFull();
+				}
+				if (!DaphnisI_rxLineDiscarded)
+				{
+					DaphnisI_rxBuffer[DaphnisI_rxByteCounter++] = receivedByte;
+				}
 			}
 		}
 	}
 }
 
+/**
+ * @brief Is called when the end of a line has been received.
+ *
+ * Passes the line to DaphnisI_HandleRxLine() or, if the line didn't fit into the receive
+ * buffer, passes its last fragment to the line fragment callback. Resets the receive buffer.
+ */
+static void DaphnisI_CompleteRxLine()
+{
+	if (DaphnisI_rxLineFragmented)
+	{
+		if (NULL != DaphnisI_lineFragmentRxCallback)
+		{
+			DaphnisI_lineFragmentRxCallback(DaphnisI_rxBuffer, DaphnisI_rxByteCounter, false, true);
+		}
+	}
+	else if (!DaphnisI_rxLineDiscarded)
+	{
+		DaphnisI_rxBuffer[DaphnisI_rxByteCounter] = '\0';
+		DaphnisI_rxByteCounter++;
+		DaphnisI_HandleRxLine(DaphnisI_rxBuffer, DaphnisI_rxByteCounter);
+	}
+	DaphnisI_lineReceived = true;
+	DaphnisI_eolChar1Found = false;
+	DaphnisI_rxLineFragmented = false;
+	DaphnisI_rxLineDiscarded = false;
+	DaphnisI_rxByteCounter = 0;
+}
+
+/**
+ * @brief Is called when the receive buffer is full before the end of the current line has been received.
+ *
+ * Passes the buffered data to the line fragment callback (if set), otherwise the
+ * rest of the line is discarded.
+ */
+static void DaphnisI_HandleRxBufferFull()
+{
+	if (NULL != DaphnisI_lineFragmentRxCallback)
+	{
+		DaphnisI_lineFragmentRxCallback(DaphnisI_rxBuffer, DaphnisI_rxByteCounter, !DaphnisI_rxLineFragmented, false);
+		DaphnisI_rxLineFragmented = true;
+	}
+	else
+	{
+		DaphnisI_rxLineDiscarded = true;
+	}
+	DaphnisI_rxByteCounter = 0;
+}
+
 /**
  * @brief Initializes the serial communication with the module
  *
@@ -486,6 +561,24 @@ WE_Pin_Level_t DaphnisI_GetPinLevel(WE_Pin_t pin)
  * @return true if successful, false otherwise
  */
 bool DaphnisI_SendRequest(char *data)
+{
+	return DaphnisI_SendRequestWithCommandName(data, NULL);
+}
+
+/**
+ * @brief Sends the supplied AT command to the module
+ *
+ * Same as DaphnisI_SendRequest(), but the name of the command (which is used for
+ * assigning responses to the request) is supplied by the caller instead of being
+ * extracted from the command.
+ *
+ * @param[in] data AT command to send. Note that the command has to end with "\r\n\0".
+ * @param[in] commandName Name of the command (see ATCOMMAND_COMMAND_NAME()). Must stay valid
+ *            until the next request is sent. If NULL, the name is extracted from the command.
+ *
+ * @return true if successful, false otherwise
+ */
+bool DaphnisI_SendRequestWithCommandName(char *data, const ATCommand_CommandName_t *commandName)
 {
 	if (DaphnisI_executingEventCallback)
 	{
@@ -508,23 +601,31 @@ bool DaphnisI_SendRequest(char *data)
 
 	size_t dataLength = strlen(data);
 
-	/* Get command name from request string (remove prefix "AT+" and parameters) */
-	DaphnisI_pendingCommandName[0] = '\0';
-	DaphnisI_pendingCommandNameLength = 0;
-	if (dataLength > 3 && (data[0] == 'a' || data[0] == 'A') && (data[1] == 't' || data[1] == 'T') && data[2] == '+')
+	if (NULL != commandName)
 	{
-		char *pData = data + 3;
-		char delimiters[] = {
-				ATCOMMAND_COMMAND_DELIM,
-				'\r' };
-		if (ATCommand_GetCmdName(&pData, DaphnisI_pendingCommandName, sizeof(DaphnisI_pendingCommandName), delimiters, sizeof(delimiters)))
+		DaphnisI_pendingCommand = *commandName;
+	}
+	else
+	{
+		/* Get command name from request string (remove prefix "AT+" and parameters) */
+		DaphnisI_pendingCommandName[0] = '\0';
+		DaphnisI_pendingCommand.name = DaphnisI_pendingCommandName;
+		DaphnisI_pendingCommand.length = 0;
+		if (dataLength > 3 && (data[0] == 'a' || data[0] == 'A') && (data[1] == 't' || data[1] == 'T') && data[2] == '+')
 		{
-			DaphnisI_pendingCommandNameLength = strlen(DaphnisI_pendingCommandName);
+			char *pData = data + 3;
+			char delimiters[] = {
+					ATCOMMAND_COMMAND_DELIM,
+					'\r' };
+			if (ATCommand_GetCmdName(&pData, DaphnisI_pendingCommandName, sizeof(DaphnisI_pendingCommandName), delimiters, sizeof(delimiters)))
+			{
+				DaphnisI_pendingCommand.length = (uint8_t) strlen(DaphnisI_pendingCommandName);
+			}
 		}
 	}
 
 #ifdef WE_DEBUG
-	printf("> %s", data);
+	WE_LOG("> %s", data);
 #endif
 
 	DaphnisI_Transparent_Transmit(data, dataLength);
@@ -549,6 +650,9 @@ bool DaphnisI_WaitForConfirm(uint32_t maxTimeMs, DaphnisI_CNFStatus_t expectedSt
 
 	while (1)
 	{
+		/* Reset flag before checking, so that a line received in the meantime is not missed */
+		DaphnisI_lineReceived = false;
+
 		if (DaphnisI_CNFStatus_Invalid != DaphnisI_cmdConfirmStatus)
 		{
 			/* Store current time to enable check for min. time between received confirm and next command. */
@@ -571,8 +675,8 @@ bool DaphnisI_WaitForConfirm(uint32_t maxTimeMs, DaphnisI_CNFStatus_t expectedSt
 			}
 		}
 
-		uint32_t now = WE_GetTick();
-		if (now - t0 > maxTimeMs)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= maxTimeMs)
 		{
 			/* Timeout */
 			break;
@@ -580,7 +684,9 @@ bool DaphnisI_WaitForConfirm(uint32_t maxTimeMs, DaphnisI_CNFStatus_t expectedSt
 
 		if (DaphnisI_waitTimeStepUsec > 0)
 		{
-			WE_DelayMicroseconds(DaphnisI_waitTimeStepUsec);
+			/* Sleep until the next line has been received (but not longer than one time step) */
+			uint32_t timeStepMs = (DaphnisI_waitTimeStepUsec + 999) / 1000;
+			WE_WaitForEvent(&DaphnisI_lineReceived, (maxTimeMs - elapsed < timeStepMs) ? maxTimeMs - elapsed : timeStepMs);
 		}
 	}
 
@@ -612,7 +718,7 @@ bool DaphnisI_GetLastError(DaphnisI_ErrorMessage_t *lastError)
  *
  * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
  *
- * @param[in] waitTimeStepUsec Time step (microseconds) when waiting for responses from DaphnisI.
+ * @param[in] waitTimeStepUsec Max. time (microseconds) to sleep between checks when waiting for responses from DaphnisI (0 = poll without sleeping).
  * @param[in] minCommandIntervalUsec Minimum interval (microseconds) between subsequent commands sent to DaphnisI.
  *
  * @return true if successful, false otherwise
@@ -660,3 +766,17 @@ void DaphnisI_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacters
 	DaphnisI_eolChar2 = eol2;
 	DaphnisI_twoEolCharacters = twoEolCharacters;
 }
+
+/**
+ * @brief Sets an optional callback function which receives lines that don't fit into the receive buffer.
+ *
+ * Lines exceeding DAPHNISI_LINE_MAX_SIZE (e.g. responses containing large amounts of data) are
+ * passed to this callback in fragments instead of being processed by the driver. The callback
+ * is executed in the context of the rx byte handler. If no callback is set, such lines are discarded.
+ *
+ * @param[in] callback Pointer to line fragment received callback function (may be NULL)
+ */
+void DaphnisI_SetLineFragmentRxCallback(DaphnisI_LineFragmentRxCallback_t callback)
+{
+	DaphnisI_lineFragmentRxCallback = callback;
+}
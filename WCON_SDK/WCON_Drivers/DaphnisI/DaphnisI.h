@@ -33,6 +33,7 @@
 
 #include <stdbool.h>
 #include <global/global_types.h>
+#include <global/ATCommands.h>
 
 /**
  * @brief Max recommended payload size is 242 bytes.
@@ -55,6 +56,20 @@
  */
 #define DAPHNISI_MAX_RESPONSE_TEXT_LENGTH DAPHNISI_LINE_MAX_SIZE
 
+/**
+ * @brief Size of the buffer used for assembling the commands sent to DaphnisI and for
+ * storing the responses to these commands (see DaphnisI_commandBuffer).
+ *
+ * May be defined by the application, must not be smaller than DAPHNISI_MAX_RESPONSE_TEXT_LENGTH.
+ */
+#ifndef DAPHNISI_COMMAND_BUFFER_SIZE
+#define DAPHNISI_COMMAND_BUFFER_SIZE DAPHNISI_LINE_MAX_SIZE
+#endif
+
+#if DAPHNISI_COMMAND_BUFFER_SIZE < DAPHNISI_MAX_RESPONSE_TEXT_LENGTH
+#error "DAPHNISI_COMMAND_BUFFER_SIZE must not be smaller than DAPHNISI_MAX_RESPONSE_TEXT_LENGTH"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -112,6 +127,29 @@ typedef enum DaphnisI_Timeout_t
  */
 typedef void (*DaphnisI_EventCallback_t)(char*);
 
+/**
+ * @brief DaphnisI line fragment received callback.
+ *
+ * Receives lines that don't fit into the receive buffer of the driver (DAPHNISI_LINE_MAX_SIZE),
+ * e.g. responses containing large amounts of data. Such lines are not processed by the
+ * driver, but are passed to this callback in fragments as they are received.
+ *
+ * Arguments: Fragment text (not null-terminated), length of fragment,
+ *            true if first fragment of line, true if last fragment of line
+ *
+ * @see DaphnisI_SetLineFragmentRxCallback()
+ */
+typedef void (*DaphnisI_LineFragmentRxCallback_t)(const char*, uint16_t, bool, bool);
+
+/**
+ * @brief Buffer used by the DaphnisI driver for assembling commands and storing responses.
+ *
+ * Is owned by the DaphnisI driver, so commands for other modules can be assembled at the
+ * same time. Commands may also be assembled in a buffer supplied by the caller
+ * (see ATCommand_BuilderInit()) and sent using DaphnisI_SendRequest().
+ */
+extern char DaphnisI_commandBuffer[DAPHNISI_COMMAND_BUFFER_SIZE];
+
 extern bool DaphnisI_Init(WE_UART_t *uartP, DaphnisI_Pins_t *pinoutP, DaphnisI_EventCallback_t eventCallback);
 
 extern bool DaphnisI_Deinit(void);
@@ -123,6 +161,7 @@ extern WE_Pin_Level_t DaphnisI_GetPinLevel(WE_Pin_t pin);
 
 extern bool DaphnisI_Transparent_Transmit(const char *data, uint16_t dataLength);
 extern bool DaphnisI_SendRequest(char *data);
+extern bool DaphnisI_SendRequestWithCommandName(char *data, const ATCommand_CommandName_t *commandName);
 extern bool DaphnisI_WaitForConfirm(uint32_t maxTimeMs, DaphnisI_CNFStatus_t expectedStatus, char *pOutResponse);
 
 extern bool DaphnisI_GetLastError(DaphnisI_ErrorMessage_t *lastError);
@@ -132,6 +171,7 @@ extern void DaphnisI_SetTimeout(DaphnisI_Timeout_t type, uint32_t timeout);
 extern uint32_t DaphnisI_GetTimeout(DaphnisI_Timeout_t type);
 
 extern void DaphnisI_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacters);
+extern void DaphnisI_SetLineFragmentRxCallback(DaphnisI_LineFragmentRxCallback_t callback);
 
 #ifdef __cplusplus
 }
@@ -180,6 +180,7 @@ static MetisE_CMD_Frame_t txPacket = {
 
 #define CMDCONFIRMATIONARRAY_LENGTH 2
 static MetisE_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static volatile bool rxPacketReceived = false; /* set when a valid packet has been received, used to wake up Wait4CNF() */
 /**
  * @brief Pin configuration struct pointer.
  */
@@ -336,9 +337,7 @@ static void HandleRxPacket(uint8_t *rxBuffer)
  */
 static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, MetisE_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-	int count = 0;
-	int time_step_ms = 5; /* 5ms */
-	int max_count = max_time_ms / time_step_ms;
+	uint32_t t0 = WE_GetTick();
 
 	if (reset_confirmstate)
 	{
@@ -350,6 +349,9 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, MetisE_CM
 
 	while (1)
 	{
+		/* reset flag before checking, so that a packet received in the meantime is not missed */
+		rxPacketReceived = false;
+
 		for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
 		{
 			if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
@@ -358,19 +360,16 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, MetisE_CM
 			}
 		}
 
-		if (count >= max_count)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= (uint32_t) max_time_ms)
 		{
 			/* received no correct response within timeout */
-			break;
+			return false;
 		}
 
-		/* wait */
-		count++;
-		WE_Delay(time_step_ms);
+		/* sleep until the next packet has been received */
+		WE_WaitForEvent(&rxPacketReceived, (uint32_t) max_time_ms - elapsed);
 	}
-
-	// if we get here, there was a timeout. Otherwise function returns from within the while-loop
-	return false;
 }
 
 /**
@@ -445,6 +444,7 @@ void MetisE_HandleRxByte(uint8_t *dataP, size_t size)
 				{
 					/* received frame ok, interpret it now */
 					HandleRxPacket(rxBuffer);
+					rxPacketReceived = true;
 				}
 
 				rxByteCounter = 0;
@@ -191,6 +191,7 @@ void MultiModule_ProteusIII_TarvosIII_Examples(void)
 	ProteusIII_uart.uartInit = WE_UART1_Init;
 	ProteusIII_uart.uartDeinit = WE_UART1_DeInit;
 	ProteusIII_uart.uartTransmit = WE_UART1_Transmit;
+	ProteusIII_uart.uartTransmitV = WE_UART1_TransmitV;
 
 	ProteusIII_CallbackConfig_t callbackConfig = {
 			0 };
@@ -216,10 +217,17 @@ void MultiModule_ProteusIII_TarvosIII_Examples(void)
 	TarvosIII_uart.uartInit = WE_UART4_Init;
 	TarvosIII_uart.uartDeinit = WE_UART4_DeInit;
 	TarvosIII_uart.uartTransmit = WE_UART4_Transmit;
+	TarvosIII_uart.uartTransmitV = WE_UART4_TransmitV;
 #elif defined(STM32F401xE)
 	TarvosIII_uart.uartInit = WE_UART6_Init;
 	TarvosIII_uart.uartDeinit = WE_UART6_DeInit;
 	TarvosIII_uart.uartTransmit = WE_UART6_Transmit;
+	TarvosIII_uart.uartTransmitV = WE_UART6_TransmitV;
+#elif defined(WE_PLATFORM_LINUX)
+	TarvosIII_uart.uartInit = WE_UART2_Init;
+	TarvosIII_uart.uartDeinit = WE_UART2_DeInit;
+	TarvosIII_uart.uartTransmit = WE_UART2_Transmit;
+	TarvosIII_uart.uartTransmitV = WE_UART2_TransmitV;
 #endif
 
 	if (false == ProteusIII_Init(&ProteusIII_uart, &ProteusIII_pins, ProteusIII_OperationMode_CommandMode, callbackConfig))
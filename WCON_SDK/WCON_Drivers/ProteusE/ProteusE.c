@@ -209,6 +209,7 @@ static ProteusE_CMD_Frame_t rxPacket = {
 
 #define CMDCONFIRMATIONARRAY_LENGTH 2
 static ProteusE_CMD_Confirmation_t cmdConfirmationArray[CMDCONFIRMATIONARRAY_LENGTH];
+static volatile bool rxPacketReceived = false; /* set when a valid packet has been received, used to wake up Wait4CNF() */
 static ProteusE_OperationMode_t operationMode = ProteusE_OperationMode_CommandMode;
 static ProteusE_DriverState_t bleState;
 /**
@@ -569,6 +570,7 @@ void ProteusE_HandleRxByte(uint8_t *dataP, size_t size)
 				{
 					/* received frame ok, interpret it now */
 					HandleRxPacket(rxBuffer);
+					rxPacketReceived = true;
 				}
 
 				rxByteCounter = 0;
@@ -586,9 +588,7 @@ void ProteusE_HandleRxByte(uint8_t *dataP, size_t size)
 static bool Wait4CNF(int maxTimeMs, uint8_t expectedCmdConfirmation, ProteusE_CMD_Status_t expectedStatus,
 bool resetConfirmState)
 {
-	int count = 0;
-	int timeStepMs = 5; /* 5ms */
-	int maxCount = maxTimeMs / timeStepMs;
+	uint32_t t0 = WE_GetTick();
 
 	if (resetConfirmState)
 	{
@@ -597,8 +597,12 @@ bool resetConfirmState)
 			cmdConfirmationArray[i].cmd = CNFINVALID;
 		}
 	}
+
 	while (1)
 	{
+		/* reset flag before checking, so that a packet received in the meantime is not missed */
+		rxPacketReceived = false;
+
 		for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
 		{
 			if (expectedCmdConfirmation == cmdConfirmationArray[i].cmd)
@@ -607,17 +611,16 @@ bool resetConfirmState)
 			}
 		}
 
-		if (count >= maxCount)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= (uint32_t) maxTimeMs)
 		{
 			/* received no correct response within timeout */
 			return false;
 		}
 
-		/* wait */
-		count++;
-		WE_Delay(timeStepMs);
+		/* sleep until the next packet has been received */
+		WE_WaitForEvent(&rxPacketReceived, (uint32_t) maxTimeMs - elapsed);
 	}
-	return true;
 }
 
 /**
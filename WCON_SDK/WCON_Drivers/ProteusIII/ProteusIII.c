@@ -30,6 +30,7 @@
 
 #include <ProteusIII/ProteusIII.h>
 #include <global/global.h>
+#include <global/baudrate.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -220,6 +221,7 @@ typedef struct
 {
 	uint8_t cmd; /**< Variable to check if correct CMD has been confirmed */
 	ProteusIII_CMD_Status_t status; /**< Variable used to check the response (*_CNF), when a request (*_REQ) was sent to the ProteusIII */
+	uint32_t timeUsec; /**< Time (microseconds) at which the confirmation has been received */
 } ProteusIII_CMD_Confirmation_t;
 
 /**************************************
@@ -234,6 +236,7 @@ static ProteusIII_CMD_Frame_t rxPacket = {
 
 #define CMDCONFIRMATIONARRAY_LENGTH 2
 static ProteusIII_CMD_Confirmation_t cmdConfirmationArray[CMDCONFIRMATIONARRAY_LENGTH];
+static volatile bool rxPacketReceived = false; /* set when a valid packet has been received, used to wake up Wait4CNF() */
 static ProteusIII_OperationMode_t operationMode = ProteusIII_OperationMode_CommandMode;
 static ProteusIII_GetDevices_t *ProteusIII_getDevicesP = NULL;
 static ProteusIII_DriverState_t bleState;
@@ -254,6 +257,17 @@ static uint16_t rxByteCounter = 0;
 static uint16_t bytesToReceive = 0;
 static uint8_t rxBuffer[sizeof(ProteusIII_CMD_Frame_t)]; /* For UART RX from module */
 
+/* Timing of requests (microseconds), see ProteusIII_GetLastRequestTiming() */
+static uint32_t requestStartTimeUsec = 0; /* transmission of last request started */
+static uint32_t requestSentTimeUsec = 0; /* transmission of last request completed */
+static uint32_t firstByteTimeUsec = 0; /* first byte received after last request (valid if firstByteReceived is true) */
+static volatile bool firstByteReceived = false;
+static WE_RequestTiming_t lastRequestTiming = {
+		.transmitTime = WE_REQUEST_TIMING_INVALID,
+		.firstByteLatency = WE_REQUEST_TIMING_INVALID,
+		.confirmLatency = WE_REQUEST_TIMING_INVALID,
+		.processingDelay = WE_REQUEST_TIMING_INVALID };
+
 /**************************************
  *         Static functions           *
  **************************************/
@@ -613,6 +627,7 @@ static void HandleRxPacket(uint8_t *prxBuffer)
 		{
 			cmdConfirmationArray[i].cmd = cmdConfirmation.cmd;
 			cmdConfirmationArray[i].status = cmdConfirmation.status;
+			cmdConfirmationArray[i].timeUsec = WE_UART_GetRxTimestamp();
 			break;
 		}
 	}
@@ -620,6 +635,12 @@ static void HandleRxPacket(uint8_t *prxBuffer)
 
 static void ProteusIII_HandleRxByte(uint8_t *dataP, size_t size)
 {
+	if (!firstByteReceived)
+	{
+		firstByteTimeUsec = WE_UART_GetRxTimestamp();
+		firstByteReceived = true;
+	}
+
 	for (; size > 0; size--, dataP++)
 	{
 		if (rxByteCounter < sizeof(rxBuffer))
@@ -671,6 +692,7 @@ static void ProteusIII_HandleRxByte(uint8_t *dataP, size_t size)
 				{
 					/* received frame ok, interpret it now */
 					HandleRxPacket(rxBuffer);
+					rxPacketReceived = true;
 				}
 
 				rxByteCounter = 0;
@@ -681,15 +703,43 @@ static void ProteusIII_HandleRxByte(uint8_t *dataP, size_t size)
 	}
 }
 
+/**
+ * @brief Returns the time elapsed between the end of transmission of the last request and the supplied time
+ * (0 if the supplied time lies before the end of transmission).
+ */
+static uint32_t GetTimeSinceRequestSent(uint32_t timeUsec)
+{
+	int32_t diff = (int32_t) (timeUsec - requestSentTimeUsec);
+	return diff > 0 ? (uint32_t) diff : 0;
+}
+
+/**
+ * @brief Updates the timing of the last request when its confirmation has been evaluated
+ * (cmdConfirmation is NULL if no confirmation has been received).
+ */
+static void UpdateRequestTiming(ProteusIII_CMD_Confirmation_t *cmdConfirmation)
+{
+	lastRequestTiming.transmitTime = requestSentTimeUsec - requestStartTimeUsec;
+	lastRequestTiming.firstByteLatency = firstByteReceived ? GetTimeSinceRequestSent(firstByteTimeUsec) : WE_REQUEST_TIMING_INVALID;
+	if (cmdConfirmation != NULL)
+	{
+		lastRequestTiming.confirmLatency = GetTimeSinceRequestSent(cmdConfirmation->timeUsec);
+		lastRequestTiming.processingDelay = WE_GetTickMicroseconds() - cmdConfirmation->timeUsec;
+	}
+	else
+	{
+		lastRequestTiming.confirmLatency = WE_REQUEST_TIMING_INVALID;
+		lastRequestTiming.processingDelay = WE_REQUEST_TIMING_INVALID;
+	}
+}
+
 /**
  * @brief Function that waits for the return value of ProteusIII (*_CNF),
  * when a command (*_REQ) was sent before.
  */
 static bool Wait4CNF(int maxTimeMs, uint8_t expectedCmdConfirmation, ProteusIII_CMD_Status_t expectedStatus, bool resetConfirmState)
 {
-	int count = 0;
-	int timeStepMs = 5; /* 5ms */
-	int maxCount = maxTimeMs / timeStepMs;
+	uint32_t t0 = WE_GetTick();
 
 	if (resetConfirmState)
 	{
@@ -698,27 +748,32 @@ static bool Wait4CNF(int maxTimeMs, uint8_t expectedCmdConfirmation, ProteusIII_
 			cmdConfirmationArray[i].cmd = CNFINVALID;
 		}
 	}
+
 	while (1)
 	{
+		/* reset flag before checking, so that a packet received in the meantime is not missed */
+		rxPacketReceived = false;
+
 		for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
 		{
 			if (expectedCmdConfirmation == cmdConfirmationArray[i].cmd)
 			{
+				UpdateRequestTiming(&cmdConfirmationArray[i]);
 				return (cmdConfirmationArray[i].status == expectedStatus);
 			}
 		}
 
-		if (count >= maxCount)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= (uint32_t) maxTimeMs)
 		{
 			/* received no correct response within timeout */
+			UpdateRequestTiming(NULL);
 			return false;
 		}
 
-		/* wait */
-		count++;
-		WE_Delay(timeStepMs);
+		/* sleep until the next packet has been received */
+		WE_WaitForEvent(&rxPacketReceived, (uint32_t) maxTimeMs - elapsed);
 	}
-	return true;
 }
 
 /**
@@ -736,6 +791,182 @@ static bool FillChecksum(ProteusIII_CMD_Frame_t *cmd)
 	return true;
 }
 
+/**
+ * @brief Sends the request prepared in txPacket, followed by the user payload.
+ *
+ * txPacket.Cmd and the first paramLength bytes of txPacket.Data (e.g. destination
+ * address) must have been set by the caller. If the UART supports gather transmit
+ * (uartTransmitV), the payload is sent directly from the caller's buffer, otherwise
+ * it is copied to txPacket.
+ *
+ * @param[in] paramLength    Number of parameter bytes in txPacket.Data preceding the payload
+ * @param[in] payloadP       Pointer to the payload
+ * @param[in] payloadLength  Length of the payload
+ *
+ * @return true if transmission succeeded,
+ *         false otherwise
+ */
+static bool TransmitRequestWithPayload(uint16_t paramLength, const uint8_t *payloadP, uint16_t payloadLength)
+{
+	txPacket.Length = paramLength + payloadLength;
+
+	if (ProteusIII_uartP->uartTransmitV == NULL)
+	{
+		memcpy(&txPacket.Data[paramLength], payloadP, payloadLength);
+		FillChecksum(&txPacket);
+		return ProteusIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD);
+	}
+
+	/* Checksum covers header, parameters and payload */
+	uint8_t checksum = (uint8_t) txPacket.Stx;
+	uint8_t *pArray = (uint8_t*) &txPacket;
+	for (uint16_t i = 1; i < (paramLength + LENGTH_CMD_OVERHEAD_WITHOUT_CRC ); i++)
+	{
+		checksum ^= pArray[i];
+	}
+	for (uint16_t i = 0; i < payloadLength; i++)
+	{
+		checksum ^= payloadP[i];
+	}
+
+	WE_UART_Segment_t segments[] = {
+			{
+					.data = pArray,
+					.length = paramLength + LENGTH_CMD_OVERHEAD_WITHOUT_CRC },
+			{
+					.data = payloadP,
+					.length = payloadLength },
+			{
+					.data = &checksum,
+					.length = 1 } };
+
+	firstByteReceived = false;
+	requestStartTimeUsec = WE_GetTickMicroseconds();
+	bool ret = ProteusIII_uartP->uartTransmitV(segments, sizeof(segments) / sizeof(segments[0]));
+	requestSentTimeUsec = WE_GetTickMicroseconds();
+	return ret;
+}
+
+/**
+ * @brief Baud rates supported by the module (descending order, used for baud rate negotiation).
+ */
+static const uint32_t ProteusIII_baudrates[] = {
+		1000000,
+		921600,
+		460800,
+		250000,
+		230400,
+		115200,
+		76800,
+		57600,
+		56000,
+		38400,
+		28800,
+		19200,
+		14400,
+		9600,
+		4800,
+		2400,
+		1200 };
+
+/**
+ * @brief Baud rate indices corresponding to the entries in ProteusIII_baudrates.
+ */
+static const ProteusIII_BaudRate_t ProteusIII_baudrateIndices[] = {
+		ProteusIII_BaudRateIndex_1000000,
+		ProteusIII_BaudRateIndex_921600,
+		ProteusIII_BaudRateIndex_460800,
+		ProteusIII_BaudRateIndex_250000,
+		ProteusIII_BaudRateIndex_230400,
+		ProteusIII_BaudRateIndex_115200,
+		ProteusIII_BaudRateIndex_76800,
+		ProteusIII_BaudRateIndex_57600,
+		ProteusIII_BaudRateIndex_56000,
+		ProteusIII_BaudRateIndex_38400,
+		ProteusIII_BaudRateIndex_28800,
+		ProteusIII_BaudRateIndex_19200,
+		ProteusIII_BaudRateIndex_14400,
+		ProteusIII_BaudRateIndex_9600,
+		ProteusIII_BaudRateIndex_4800,
+		ProteusIII_BaudRateIndex_2400,
+		ProteusIII_BaudRateIndex_1200 };
+
+/**
+ * @brief Returns the value of the user setting UART_CONFIG_INDEX for the supplied UART configuration.
+ */
+static uint8_t GetUartConfigIndex(ProteusIII_BaudRate_t baudrate, ProteusIII_UartParity_t parity, bool flowControlEnable)
+{
+	uint8_t baudrateIndex = (uint8_t) baudrate;
+
+	/* If flow control is to be enabled UART index has to be increased by one in regard to base value */
+	if (flowControlEnable)
+	{
+		baudrateIndex++;
+	}
+
+	/* If parity bit is even, UART index has to be increased by 64 in regard of base value*/
+	if (ProteusIII_UartParity_Even == parity)
+	{
+		baudrateIndex += 64;
+	}
+
+	return baudrateIndex;
+}
+
+/**
+ * @brief Requests the module to switch to the supplied baud rate (used for baud rate negotiation).
+ *
+ * The module restarts after having confirmed the request. This function returns when the module
+ * is ready for operation (using the new baud rate).
+ */
+static bool SetModuleBaudrate(uint32_t baudrate)
+{
+	for (uint8_t i = 0; i < sizeof(ProteusIII_baudrates) / sizeof(ProteusIII_baudrates[0]); i++)
+	{
+		if (ProteusIII_baudrates[i] == baudrate)
+		{
+			ProteusIII_UartParity_t parity = (ProteusIII_uartP->parity == WE_Parity_Even) ? ProteusIII_UartParity_Even : ProteusIII_UartParity_None;
+			bool flowControlEnable = (ProteusIII_uartP->flowControl != WE_FlowControl_NoFlowControl);
+			uint8_t baudrateIndex = GetUartConfigIndex(ProteusIII_baudrateIndices[i], parity, flowControlEnable);
+
+			txPacket.Cmd = PROTEUSIII_CMD_SET_REQ;
+			txPacket.Data[0] = ProteusIII_USERSETTING_UART_CONFIG_INDEX;
+			if (!TransmitRequestWithPayload(1, &baudrateIndex, 1) || !Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_SET_CNF, CMD_Status_Success, true))
+			{
+				return false;
+			}
+
+			/* The module restarts and then sends its ready message using the new baud rate */
+			WE_Delay(PROTEUSIII_BOOT_DURATION);
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Reinitializes the host's UART using the supplied baud rate (used for baud rate negotiation).
+ */
+static bool SetHostBaudrate(uint32_t baudrate)
+{
+	ProteusIII_uartP->uartDeinit();
+
+	/* make sure any bytes received at the previous baud rate are discarded */
+	ClearReceiveBuffers();
+
+	ProteusIII_uartP->baudrate = baudrate;
+	return ProteusIII_uartP->uartInit(ProteusIII_uartP->baudrate, ProteusIII_uartP->flowControl, ProteusIII_uartP->parity, &byteRxCallback);
+}
+
+/**
+ * @brief Checks if the module responds (used for baud rate negotiation).
+ */
+static bool PingModule()
+{
+	ProteusIII_ModuleState_t moduleState;
+	return ProteusIII_GetState(&moduleState);
+}
+
 /**************************************
  *         Global functions           *
  **************************************/
@@ -754,7 +985,33 @@ bool ProteusIII_Transparent_Transmit(const uint8_t *data, uint16_t dataLength)
 	{
 		return false;
 	}
-	return ProteusIII_uartP->uartTransmit((uint8_t*) data, dataLength);
+
+	firstByteReceived = false;
+	requestStartTimeUsec = WE_GetTickMicroseconds();
+	bool ret = ProteusIII_uartP->uartTransmit((uint8_t*) data, dataLength);
+	requestSentTimeUsec = WE_GetTickMicroseconds();
+	return ret;
+}
+
+/**
+ * @brief Returns the timing of the last request (i.e. of the last evaluated confirmation).
+ *
+ * Entries that could not be determined (e.g. confirmation not received) are set to WE_REQUEST_TIMING_INVALID.
+ * Note that the first byte received after a request might also belong to an indication sent by the module.
+ *
+ * @param[out] timingP Timing of the last request
+ *
+ * @return true if request succeeded,
+ *         false otherwise
+ */
+bool ProteusIII_GetLastRequestTiming(WE_RequestTiming_t *timingP)
+{
+	if (timingP == NULL)
+	{
+		return false;
+	}
+	*timingP = lastRequestTiming;
+	return true;
 }
 
 /**
@@ -1056,12 +1313,7 @@ bool ProteusIII_Transmit(uint8_t *payloadP, uint16_t length)
 	}
 
 	txPacket.Cmd = PROTEUSIII_CMD_DATA_REQ;
-	txPacket.Length = length;
-
-	memcpy(&txPacket.Data[0], payloadP, length);
-
-	FillChecksum(&txPacket);
-	if (!ProteusIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(0, payloadP, length))
 	{
 		return false;
 	}
@@ -1091,12 +1343,7 @@ bool ProteusIII_SetBeacon(uint8_t *beaconDataP, uint16_t length)
 	}
 
 	txPacket.Cmd = PROTEUSIII_CMD_SETBEACON_REQ;
-	txPacket.Length = length;
-
-	memcpy(&txPacket.Data[0], beaconDataP, length);
-
-	FillChecksum(&txPacket);
-	if (!ProteusIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(0, beaconDataP, length))
 	{
 		return false;
 	}
@@ -1188,12 +1435,9 @@ bool ProteusIII_Set(ProteusIII_UserSettings_t userSetting, uint8_t *valueP, uint
 	}
 
 	txPacket.Cmd = PROTEUSIII_CMD_SET_REQ;
-	txPacket.Length = 1 + length;
 	txPacket.Data[0] = userSetting;
-	memcpy(&txPacket.Data[1], valueP, length);
 
-	FillChecksum(&txPacket);
-	if (!ProteusIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(1, valueP, length))
 	{
 		return false;
 	}
@@ -1428,21 +1672,44 @@ bool ProteusIII_SetSecFlagsPeripheralOnly(ProteusIII_SecFlags_t secFlags)
  */
 bool ProteusIII_SetBaudrateIndex(ProteusIII_BaudRate_t baudrate, ProteusIII_UartParity_t parity, bool flowControlEnable)
 {
-	uint8_t baudrateIndex = (uint8_t) baudrate;
-
-	/* If flow control is to be enabled UART index has to be increased by one in regard to base value */
-	if (flowControlEnable)
-	{
-		baudrateIndex++;
-	}
+	uint8_t baudrateIndex = GetUartConfigIndex(baudrate, parity, flowControlEnable);
+	return ProteusIII_Set(ProteusIII_USERSETTING_UART_CONFIG_INDEX, (uint8_t*) &baudrateIndex, 1);
+}
 
-	/* If parity bit is even, UART index has to be increased by 64 in regard of base value*/
-	if (ProteusIII_UartParity_Even == parity)
+/**
+ * @brief Switches the module and the host's UART to the highest baud rate supported by both sides.
+ *
+ * The parity and flow control settings of the UART passed to ProteusIII_Init() are kept.
+ * If the module doesn't respond at a new baud rate, the previous baud rate is restored and
+ * the next lower one is tried (see WE_UART_NegotiateBaudrate()). On success, the baudrate
+ * field of the WE_UART_t struct passed to ProteusIII_Init() is updated.
+ *
+ * Is only available in command mode.
+ *
+ * Note: The baud rate is stored in flash. Use this function only in rare cases (e.g. on first
+ * start-up), since flash can be updated only a limited number of times. If the module already
+ * uses the highest possible baud rate, the flash is not written.
+ *
+ * @param[in] maxBaudrate: max. baud rate supported by the host's UART (0 = no limit)
+ * @param[out] baudrateP: baud rate used after negotiation (optional)
+ *
+ * @return true if request succeeded,
+ *         false otherwise
+ */
+bool ProteusIII_NegotiateBaudrate(uint32_t maxBaudrate, uint32_t *baudrateP)
+{
+	if ((ProteusIII_uartP == NULL) || (operationMode != ProteusIII_OperationMode_CommandMode))
 	{
-		baudrateIndex += 64;
+		return false;
 	}
 
-	return ProteusIII_Set(ProteusIII_USERSETTING_UART_CONFIG_INDEX, (uint8_t*) &baudrateIndex, 1);
+	WE_BaudrateAdapter_t adapter = {
+			.baudrates = ProteusIII_baudrates,
+			.baudrateCount = sizeof(ProteusIII_baudrates) / sizeof(ProteusIII_baudrates[0]),
+			.setModuleBaudrate = SetModuleBaudrate,
+			.setHostBaudrate = SetHostBaudrate,
+			.ping = PingModule };
+	return WE_UART_NegotiateBaudrate(&adapter, ProteusIII_uartP->baudrate, maxBaudrate, baudrateP);
 }
 
 /**
@@ -2201,11 +2468,7 @@ bool ProteusIII_Connect(uint8_t *btMacP)
 	}
 
 	txPacket.Cmd = PROTEUSIII_CMD_CONNECT_REQ;
-	txPacket.Length = 6;
-	memcpy(&txPacket.Data[0], btMacP, 6);
-
-	FillChecksum(&txPacket);
-	if (!ProteusIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(0, btMacP, 6))
 	{
 		return false;
 	}
@@ -2230,11 +2493,7 @@ bool ProteusIII_Passkey(uint8_t *passkey)
 	}
 
 	txPacket.Cmd = PROTEUSIII_CMD_PASSKEY_REQ;
-	txPacket.Length = 6;
-	memcpy(&txPacket.Data[0], passkey, 6);
-
-	FillChecksum(&txPacket);
-	if (!ProteusIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(0, passkey, 6))
 	{
 		return false;
 	}
@@ -2570,12 +2829,9 @@ bool ProteusIII_GPIOLocalRead(uint8_t *gpioToReadP, uint8_t amountGPIOToRead, Pr
 	}
 
 	txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_READ_REQ;
-	txPacket.Length = amountGPIOToRead + 1;
 	txPacket.Data[0] = amountGPIOToRead;
-	memcpy(&txPacket.Data[1], gpioToReadP, amountGPIOToRead);
 
-	FillChecksum(&txPacket);
-	if (!ProteusIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(1, gpioToReadP, amountGPIOToRead))
 	{
 		return false;
 	}
@@ -2848,12 +3104,9 @@ bool ProteusIII_GPIORemoteRead(uint8_t *gpioToReadP, uint8_t amountGPIOToRead, P
 	}
 
 	txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_READ_REQ;
-	txPacket.Length = amountGPIOToRead + 1;
 	txPacket.Data[0] = amountGPIOToRead;
-	memcpy(&txPacket.Data[1], gpioToReadP, amountGPIOToRead);
 
-	FillChecksum(&txPacket);
-	if (!ProteusIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(1, gpioToReadP, amountGPIOToRead))
 	{
 		return false;
 	}
@@ -531,6 +531,7 @@ extern bool ProteusIII_GetDevices(ProteusIII_GetDevices_t *devicesP);
 
 extern bool ProteusIII_Transmit(uint8_t *payloadP, uint16_t length);
 extern bool ProteusIII_Transparent_Transmit(const uint8_t *data, uint16_t dataLength);
+extern bool ProteusIII_GetLastRequestTiming(WE_RequestTiming_t *timingP);
 
 extern bool ProteusIII_SetBeacon(uint8_t *beaconDataP, uint16_t length);
 
@@ -582,6 +583,7 @@ extern bool ProteusIII_SetTXPower(ProteusIII_TXPower_t txPower);
 extern bool ProteusIII_SetSecFlags(ProteusIII_SecFlags_t secFlags);
 extern bool ProteusIII_SetSecFlagsPeripheralOnly(ProteusIII_SecFlags_t secFlags);
 extern bool ProteusIII_SetBaudrateIndex(ProteusIII_BaudRate_t baudrate, ProteusIII_UartParity_t parity, bool flowControlEnable);
+extern bool ProteusIII_NegotiateBaudrate(uint32_t maxBaudrate, uint32_t *baudrateP);
 extern bool ProteusIII_SetStaticPasskey(uint8_t *staticPasskeyP);
 extern bool ProteusIII_SetAppearance(uint16_t appearance);
 extern bool ProteusIII_SetSppBaseUuid(uint8_t *uuidP);
@@ -95,6 +95,7 @@ void ProteusIII_Examples(void)
 	ProteusIII_uart.uartInit = WE_UART1_Init;
 	ProteusIII_uart.uartDeinit = WE_UART1_DeInit;
 	ProteusIII_uart.uartTransmit = WE_UART1_Transmit;
+	ProteusIII_uart.uartTransmitV = WE_UART1_TransmitV;
 
 	CommandModeExample();
 //    PeripheralOnlyModeExample();
@@ -41,15 +41,16 @@
  */
 bool StephanoI_ATBluetoothLE_Init(StephanoI_ATBluetoothLE_InitType_t type)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEINIT=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEINIT=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -70,16 +71,17 @@ bool StephanoI_ATBluetoothLE_Init(StephanoI_ATBluetoothLE_InitType_t type)
  */
 bool StephanoI_ATBluetoothLE_SetDeviceName(StephanoI_ATBluetoothLE_DeviceName_t dev_name)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLENAME=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLENAME=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, dev_name, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, dev_name, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -123,30 +125,31 @@ bool StephanoI_ATBluetoothLE_GetDeviceName(StephanoI_ATBluetoothLE_DeviceName_t
  */
 bool StephanoI_ATBluetoothLE_SetDeviceID(StephanoI_ATBluetoothLE_Address_t type, StephanoI_ATBluetoothLE_DeviceID_t ID)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEADDR=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEADDR=");
 
 	if ((ID == NULL) || (type == StephanoI_ATBluetoothLE_Address_Public))
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, ID, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, ID, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -189,27 +192,28 @@ bool StephanoI_ATBluetoothLE_GetDeviceID(StephanoI_ATBluetoothLE_DeviceID_t *ID)
  */
 bool StephanoI_ATBluetoothLE_SetAdvertisingData(StephanoI_ATBluetoothLE_AdvertisingData_t data)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEADVDATAEX=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEADVDATAEX=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, data.devname, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, data.devname, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, data.uuid, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, data.uuid, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, data.manufacturerdata, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, data.manufacturerdata, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, data.include_power ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, data.include_power ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -252,35 +256,36 @@ bool StephanoI_ATBluetoothLE_GetAdvertisingData(StephanoI_ATBluetoothLE_Advertis
  */
 bool StephanoI_ATBluetoothLE_SetAdvertisingParameters(StephanoI_ATBluetoothLE_AdvertisingParameters_t params)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEADVPARAM=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEADVPARAM=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, params.min_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, params.min_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, params.max_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, params.max_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.addr_type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.addr_type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.filter, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.filter, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -323,14 +328,15 @@ bool StephanoI_ATBluetoothLE_GetAdvertisingParameters(StephanoI_ATBluetoothLE_Ad
  */
 bool StephanoI_ATBluetoothLE_SetScanResponseRawData(StephanoI_ATBluetoothLE_AdvertisingRawData_t data)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+BLESCANRSPDATA=");
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLESCANRSPDATA=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, data, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, data, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -351,14 +357,15 @@ bool StephanoI_ATBluetoothLE_SetScanResponseRawData(StephanoI_ATBluetoothLE_Adve
  */
 bool StephanoI_ATBluetoothLE_SetAdvertisingRawData(StephanoI_ATBluetoothLE_AdvertisingRawData_t data)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+BLEADVDATA=");
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEADVDATA=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, data, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, data, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -407,31 +414,32 @@ bool StephanoI_ATBluetoothLE_StopAdvertising()
  */
 bool StephanoI_ATBluetoothLE_SetScanParameters(StephanoI_ATBluetoothLE_ScanParameters_t params)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLESCANPARAM=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLESCANPARAM=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.addr_type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.addr_type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.filter, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.filter, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.scan_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.scan_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.scan_window, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.scan_window, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -474,35 +482,36 @@ bool StephanoI_ATBluetoothLE_GetScanParameters(StephanoI_ATBluetoothLE_ScanParam
  */
 bool StephanoI_ATBluetoothLE_SetSecurityParameters(StephanoI_ATBluetoothLE_SecurityParameters_t params)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLESECPARAM=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLESECPARAM=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.auth, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.auth, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.io, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.io, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.key_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.key_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.init_key, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.init_key, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) params.rsp_key, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) params.rsp_key, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) (params.auth_option ? 1 : 0), (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) (params.auth_option ? 1 : 0), (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -545,15 +554,16 @@ bool StephanoI_ATBluetoothLE_GetSecurityParameters(StephanoI_ATBluetoothLE_Secur
  */
 bool StephanoI_ATBluetoothLE_SetStaticKey(StephanoI_ATBluetoothLE_Key_t key)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLESETKEY=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLESETKEY=");
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, (char*) key, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, (char*) key, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -597,19 +607,20 @@ bool StephanoI_ATBluetoothLE_GetStaticKey(StephanoI_ATBluetoothLE_Key_t *keyP)
  */
 bool StephanoI_ATBluetoothLE_RespondPairingRequest(int8_t conn_index, bool accept)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEENCRSP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEENCRSP=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) (accept ? 1 : 0), (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) (accept ? 1 : 0), (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -631,19 +642,20 @@ bool StephanoI_ATBluetoothLE_RespondPairingRequest(int8_t conn_index, bool accep
  */
 bool StephanoI_ATBluetoothLE_InitiateEncryption(int8_t conn_index, StephanoI_ATBluetoothLE_InitiateEncryption_t sec_act)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEENC=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEENC=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, sec_act, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, sec_act, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -665,19 +677,20 @@ bool StephanoI_ATBluetoothLE_InitiateEncryption(int8_t conn_index, StephanoI_ATB
  */
 bool StephanoI_ATBluetoothLE_ReplyKey(int8_t conn_index, char *key)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEKEYREPLY=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEKEYREPLY=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, key, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, key, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -699,19 +712,20 @@ bool StephanoI_ATBluetoothLE_ReplyKey(int8_t conn_index, char *key)
  */
 bool StephanoI_ATBluetoothLE_ConfirmValue(int8_t conn_index, bool confirm)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLECONFREPLY=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLECONFREPLY=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) (confirm ? 1 : 0), (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) (confirm ? 1 : 0), (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -746,23 +760,24 @@ bool StephanoI_ATBluetoothLE_BondsGet()
  */
 bool StephanoI_ATBluetoothLE_BondsDelete(int8_t bonding_index)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEENCCLEAR");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEENCCLEAR");
 
 	if (bonding_index >= 0)
 	{
-		if (!ATCommand_AppendArgumentString(pRequestCommand, "=", ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, "=", ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, bonding_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, bonding_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -784,19 +799,20 @@ bool StephanoI_ATBluetoothLE_BondsDelete(int8_t bonding_index)
  */
 bool StephanoI_ATBluetoothLE_SetDatalen(int8_t conn_index, uint16_t length)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEDATALEN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEDATALEN=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -817,19 +833,20 @@ bool StephanoI_ATBluetoothLE_SetDatalen(int8_t conn_index, uint16_t length)
  */
 bool StephanoI_ATBluetoothLE_CentralSetMTU(StephanoI_ATBluetoothLE_MTU_t data)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLECFGMTU=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLECFGMTU=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, data.conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, data.conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, data.MTU, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, data.MTU, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -872,31 +889,32 @@ bool StephanoI_ATBluetoothLE_CentralGetMTU(StephanoI_ATBluetoothLE_MTU_t *data)
  */
 bool StephanoI_ATBluetoothLE_CentralSetConnectionParameters(StephanoI_ATBluetoothLE_Central_ConnectionParameters_t param)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLECONNPARAM=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLECONNPARAM=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, param.conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, param.conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, param.min_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, param.min_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, param.max_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, param.max_interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, param.latency, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, param.latency, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, param.timeout, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, param.timeout, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -941,19 +959,20 @@ bool StephanoI_ATBluetoothLE_CentralGetConnectionParameters(StephanoI_ATBluetoot
  */
 bool StephanoI_ATBluetoothLE_SetConnectionPhy(int8_t conn_index, StephanoI_ATBluetoothLE_Phy_t tx_rx_phy)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLESETPHY=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLESETPHY=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, tx_rx_phy, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, tx_rx_phy, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -976,15 +995,16 @@ bool StephanoI_ATBluetoothLE_SetConnectionPhy(int8_t conn_index, StephanoI_ATBlu
 bool StephanoI_ATBluetoothLE_GetConnectionPhy(int8_t conn_index, StephanoI_ATBluetoothLE_ReadPhy_t *tx_rx_phy)
 {
 	char responsebuffer[sizeof(StephanoI_ATBluetoothLE_ReadPhy_t) + 1];
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEREADPHY=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEREADPHY=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1023,17 +1043,18 @@ bool StephanoI_ATBluetoothLE_Peripheral_ServiceCreate()
  */
 bool StephanoI_ATBluetoothLE_Peripheral_ServiceStart(int8_t srv_index)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
 	if (srv_index >= 0)
 	{
-		strcpy(pRequestCommand, "AT+BLEGATTSSRVSTART=");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTSSRVSTART=");
 
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -1041,7 +1062,7 @@ bool StephanoI_ATBluetoothLE_Peripheral_ServiceStart(int8_t srv_index)
 	else
 	{
 		/* start all */
-		strcpy(pRequestCommand, "AT+BLEGATTSSRVSTART\r\n");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTSSRVSTART\r\n");
 	}
 
 	if (!StephanoI_SendRequest(pRequestCommand))
@@ -1060,17 +1081,18 @@ bool StephanoI_ATBluetoothLE_Peripheral_ServiceStart(int8_t srv_index)
  */
 bool StephanoI_ATBluetoothLE_Peripheral_ServiceStop(int8_t srv_index)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
 	if (srv_index >= 0)
 	{
-		strcpy(pRequestCommand, "AT+BLEGATTSSRVSTOP=");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTSSRVSTOP=");
 
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -1078,7 +1100,7 @@ bool StephanoI_ATBluetoothLE_Peripheral_ServiceStop(int8_t srv_index)
 	else
 	{
 		/* stop all */
-		strcpy(pRequestCommand, "AT+BLEGATTSSRVSTOP\r\n");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTSSRVSTOP\r\n");
 	}
 
 	if (!StephanoI_SendRequest(pRequestCommand))
@@ -1130,27 +1152,28 @@ bool StephanoI_ATBluetoothLE_Peripheral_DiscoverCharacteristics()
  */
 bool StephanoI_ATBluetoothLE_PeripheralNotifyClient(int8_t conn_index, uint8_t srv_index, uint8_t char_index, uint8_t *data, uint32_t length)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEGATTSNTFY=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTSNTFY=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, char_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, char_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1184,27 +1207,28 @@ bool StephanoI_ATBluetoothLE_PeripheralNotifyClient(int8_t conn_index, uint8_t s
  */
 bool StephanoI_ATBluetoothLE_PeripheralIndicateClient(int8_t conn_index, uint8_t srv_index, uint8_t char_index, uint8_t *data, uint32_t length)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEGATTSIND=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTSIND=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, char_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, char_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1239,34 +1263,35 @@ bool StephanoI_ATBluetoothLE_PeripheralIndicateClient(int8_t conn_index, uint8_t
  */
 bool StephanoI_ATBluetoothLE_CentralScan(bool enable, int8_t interval, StephanoI_ATBluetoothLE_ScanFilter_t filter_type, char *filter_param)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLESCAN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLESCAN=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (true == enable) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (true == enable) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 	if (true == enable)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (filter_type != StephanoI_ATBluetoothLE_ScanFilter_Invalid) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, interval, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (filter_type != StephanoI_ATBluetoothLE_ScanFilter_Invalid) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		if (filter_type != StephanoI_ATBluetoothLE_ScanFilter_Invalid)
 		{
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, filter_type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, filter_type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, filter_param, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, filter_param, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1290,28 +1315,29 @@ bool StephanoI_ATBluetoothLE_CentralScan(bool enable, int8_t interval, StephanoI
  */
 bool StephanoI_ATBluetoothLE_CentralConnect(int8_t conn_index, char *remote_address, bool public_address, uint8_t timeout)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLECONN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLECONN=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_address, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, remote_address, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, public_address ? (uint32_t) 0 : (uint32_t) 1, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, public_address ? (uint32_t) 0 : (uint32_t) 1, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, timeout, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, timeout, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1332,16 +1358,17 @@ bool StephanoI_ATBluetoothLE_CentralConnect(int8_t conn_index, char *remote_addr
  */
 bool StephanoI_ATBluetoothLE_Disconnect(int8_t conn_index)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEDISCONN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEDISCONN=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1362,16 +1389,17 @@ bool StephanoI_ATBluetoothLE_Disconnect(int8_t conn_index)
  */
 bool StephanoI_ATBluetoothLE_CentralDiscoverPrimaryService(int8_t conn_index)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEGATTCPRIMSRV=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTCPRIMSRV=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1393,21 +1421,22 @@ bool StephanoI_ATBluetoothLE_CentralDiscoverPrimaryService(int8_t conn_index)
  */
 bool StephanoI_ATBluetoothLE_CentralDiscoverIncludedServices(int8_t conn_index, uint8_t srv_index)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEGATTCINCLSRV=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTCINCLSRV=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1429,21 +1458,22 @@ bool StephanoI_ATBluetoothLE_CentralDiscoverIncludedServices(int8_t conn_index,
  */
 bool StephanoI_ATBluetoothLE_CentralDiscoverCharacteristics(int8_t conn_index, uint8_t srv_index)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEGATTCCHAR=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTCCHAR=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1469,34 +1499,35 @@ bool StephanoI_ATBluetoothLE_CentralDiscoverCharacteristics(int8_t conn_index, u
  */
 bool StephanoI_ATBluetoothLE_CentralWrite(int8_t conn_index, uint8_t srv_index, uint8_t char_index, int8_t desc_index, uint8_t *data, uint32_t length)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEGATTCWR=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTCWR=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, char_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, char_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 	if (desc_index >= 0)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, desc_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, desc_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1531,31 +1562,32 @@ bool StephanoI_ATBluetoothLE_CentralWrite(int8_t conn_index, uint8_t srv_index,
 bool StephanoI_ATBluetoothLE_CentralRead(int8_t conn_index, uint8_t srv_index, uint8_t char_index, int8_t desc_index, StephanoI_ATBluetoothLE_Read_t *t)
 {
 	char responsebuffer[sizeof(StephanoI_ATBluetoothLE_Read_t) + 1];
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+BLEGATTCRD=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+BLEGATTCRD=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, conn_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, srv_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, char_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (desc_index >= 0) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, char_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (desc_index >= 0) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 	if (desc_index >= 0)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, desc_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, desc_index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
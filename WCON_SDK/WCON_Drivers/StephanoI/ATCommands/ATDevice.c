@@ -97,16 +97,17 @@ bool StephanoI_ATDevice_Restore()
  */
 bool StephanoI_ATDevice_SetSleep(StephanoI_ATDevice_SleepMode_t mode)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+SLEEP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+SLEEP=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -149,16 +150,17 @@ bool StephanoI_ATDevice_GetSleep(StephanoI_ATDevice_SleepMode_t *modeP)
  */
 bool StephanoI_ATDevice_SetDeepSleep(uint32_t time_ms)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+GSLP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+GSLP=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, time_ms, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, time_ms, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -180,24 +182,25 @@ bool StephanoI_ATDevice_SetDeepSleep(uint32_t time_ms)
  */
 bool StephanoI_ATDevice_SetWakeUpSource(StephanoI_ATDevice_WakeupPin_t pin_number, bool active_high)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+SLEEPWKCFG=");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) StephanoI_ATDevice_WakeupSource_GPIO, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+SLEEPWKCFG=");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) StephanoI_ATDevice_WakeupSource_GPIO, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) pin_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) pin_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) active_high ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) active_high ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -219,26 +222,27 @@ bool StephanoI_ATDevice_SetWakeUpSource(StephanoI_ATDevice_WakeupPin_t pin_numbe
  */
 bool StephanoI_ATDevice_SetTXPower(StephanoI_ATDevice_WifiPower_t wifi_power, StephanoI_ATDevice_BluetoothLEPower_t ble_power)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+RFPOWER=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+RFPOWER=");
 
 	if (ble_power != StephanoI_ATDevice_BluetoothLEPower_None)
 	{
 		/* set wifi and Bluetooth LE tx power */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) wifi_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) wifi_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) ble_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) ble_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) ble_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) ble_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) ble_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) ble_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -246,13 +250,13 @@ bool StephanoI_ATDevice_SetTXPower(StephanoI_ATDevice_WifiPower_t wifi_power, St
 	else
 	{
 		/* set wifi tx power only */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) wifi_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) wifi_power, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -347,33 +351,34 @@ bool StephanoI_ATDevice_EchoOn(bool on)
  */
 bool StephanoI_ATDevice_SetCurrentUART(StephanoI_ATDevice_UART_t t)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+UART_CUR=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+UART_CUR=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, t.baudrate, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, t.baudrate, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, 8, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, 8, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, 1, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, 1, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, t.parity, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, t.parity, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, t.flow_control, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, t.flow_control, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -394,33 +399,34 @@ bool StephanoI_ATDevice_SetCurrentUART(StephanoI_ATDevice_UART_t t)
  */
 bool StephanoI_ATDevice_SetDefaultUART(StephanoI_ATDevice_UART_t t)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+UART_DEF=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+UART_DEF=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, t.baudrate, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, t.baudrate, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, 8, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, 8, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, 1, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, 1, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, t.parity, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, t.parity, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, t.flow_control, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, t.flow_control, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -510,24 +516,25 @@ bool StephanoI_ATDevice_GetManufacturingUserPartitions()
  */
 bool StephanoI_ATDevice_EraseManufacturingUserPartitions(char *namespace, char *key)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+SYSMFG=0,");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+SYSMFG=0,");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, namespace, (key != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, namespace, (key != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
 	if (key != NULL)
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, key, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, key, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -552,36 +559,37 @@ bool StephanoI_ATDevice_EraseManufacturingUserPartitions(char *namespace, char *
  */
 bool StephanoI_ATDevice_ReadManufacturingUserPartitions(char *namespace, char *key, uint16_t offset, uint16_t length, StephanoI_ATDevice_SYSMFG_t *t)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+SYSMFG=1,");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+SYSMFG=1,");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, namespace, (key != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, namespace, (key != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
 	if (key != NULL)
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, key, (length != 0) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, key, (length != 0) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 
 		if (length != 0)
 		{
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
-			if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -623,8 +631,9 @@ bool StephanoI_ATDevice_ReadManufacturingUserPartitions(char *namespace, char *k
  */
 bool StephanoI_ATDevice_WriteManufacturingUserPartitions(char *namespace, char *key, StephanoI_ATDevice_SYSMFG_data_t type, uint16_t length, uint8_t *dataP)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+SYSMFG=2,");
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+SYSMFG=2,");
 
 	switch (type)
 	{
@@ -647,27 +656,27 @@ bool StephanoI_ATDevice_WriteManufacturingUserPartitions(char *namespace, char *
 	}
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, namespace, (key != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, namespace, (key != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, key, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, key, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) type, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -784,16 +793,17 @@ bool StephanoI_ATDevice_ParseSystemTimestamp(char *EventArgumentsP, uint32_t *t)
  */
 bool StephanoI_ATDevice_SetSystemTimestamp(uint32_t time)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+SYSTIMESTAMP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+SYSTIMESTAMP=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -837,16 +847,17 @@ bool StephanoI_ATDevice_GetSystemTimestamp(uint32_t *timeP)
  */
 bool StephanoI_ATDevice_SetSystemStoremode(bool enable)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+SYSSTORE=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+SYSSTORE=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -913,16 +924,17 @@ bool StephanoI_ATDevice_GetSystemTemp(float *tempP)
  */
 bool StephanoI_ATDevice_FileSystemSetMount(bool enable)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+FSMOUNT=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+FSMOUNT=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -957,16 +969,17 @@ bool StephanoI_ATDevice_FileSystemGetFiles()
  */
 bool StephanoI_ATDevice_FileSystemDelete(char *filename)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+FS=0,0,");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+FS=0,0,");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, filename, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, filename, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -988,17 +1001,18 @@ bool StephanoI_ATDevice_FileSystemDelete(char *filename)
  */
 bool StephanoI_ATDevice_FileSystemGetFileSize(char *filename, uint16_t *sizeP)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 	char responsebuffer[32];
 
-	strcpy(pRequestCommand, "AT+FS=0,3,");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+FS=0,3,");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, filename, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, filename, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1027,25 +1041,26 @@ bool StephanoI_ATDevice_FileSystemGetFileSize(char *filename, uint16_t *sizeP)
  */
 bool StephanoI_ATDevice_FileSystemRead(char *filename, uint16_t offset, uint16_t length, StephanoI_ATDevice_FileSystemRead_t *t)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+FS=0,2,");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+FS=0,2,");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, filename, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, filename, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1086,25 +1101,26 @@ bool StephanoI_ATDevice_FileSystemRead(char *filename, uint16_t offset, uint16_t
  */
 bool StephanoI_ATDevice_FileSystemWrite(char *filename, uint16_t offset, uint16_t length, uint8_t *dataP)
 {
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+FS=0,1,");
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+FS=0,1,");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, filename, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, filename, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -33,83 +33,83 @@
 #include <StephanoI/StephanoI.h>
 
 const static ATCommand_Event_t MQTTSubEvents[] = {
+				EVENTENTRY("FAIL", StephanoI_ATEvent_MQTT_PublishFailed)
 				EVENTENTRY("OK", StephanoI_ATEvent_MQTT_PublishOK)
-				LASTEVENTENTRY("FAIL", StephanoI_ATEvent_MQTT_PublishFailed)
 		};
 
 const static ATCommand_Event_t WildCardSubEvents[] = {
+				EVENTENTRY("CLOSED", StephanoI_ATEvent_Socket_Closed)
 				EVENTENTRY("CONNECT",StephanoI_ATEvent_Socket_Connected)
-				LASTEVENTENTRY("CLOSED", StephanoI_ATEvent_Socket_Closed)
 		};
 
 const static ATCommand_Event_t moduleMainEvents[] = {
-				EVENTENTRY("ready", StephanoI_ATEvent_Startup)
-				EVENTENTRY("busy p...", StephanoI_ATEvent_Busy)
-				EVENTENTRY("+BLEGATTSSRV", StephanoI_ATEvent_BLE_Peripheral_DiscoverService)
-				EVENTENTRY("+BLEGATTSCHAR", StephanoI_ATEvent_BLE_Peripheral_DiscoverCharacteristics)
+				EVENTENTRY("+BLEAUTHCMPL", StephanoI_ATEvent_BLE_AuthenticationComplete)
+				EVENTENTRY("+BLECFGMTU", StephanoI_ATEvent_BLE_MTU)
 				EVENTENTRY("+BLECONN", StephanoI_ATEvent_BLE_Connection)
 				EVENTENTRY("+BLEDISCONN", StephanoI_ATEvent_BLE_Disconnection)
-				EVENTENTRY("+BLECFGMTU", StephanoI_ATEvent_BLE_MTU)
-				EVENTENTRY("+WRITE", StephanoI_ATEvent_BLE_Write)
+				EVENTENTRY("+BLEENCDEV", StephanoI_ATEvent_BLE_BondingInformation)
+				EVENTENTRY("+BLEGATTCCHAR", StephanoI_ATEvent_BLE_Central_DiscoverCharacteristics)
+				EVENTENTRY("+BLEGATTCINCLSRV", StephanoI_ATEvent_BLE_Central_DiscoverIncludedServices)
+				EVENTENTRY("+BLEGATTCPRIMSRV", StephanoI_ATEvent_BLE_Central_DiscoverPrimaryService)
 				EVENTENTRY("+BLEGATTCRD", StephanoI_ATEvent_BLE_Read)
-				EVENTENTRY("+NOTIFY", StephanoI_ATEvent_BLE_Notify)
-				EVENTENTRY("+INDICATE", StephanoI_ATEvent_BLE_Indicate)
+				EVENTENTRY("+BLEGATTSCHAR", StephanoI_ATEvent_BLE_Peripheral_DiscoverCharacteristics)
+				EVENTENTRY("+BLEGATTSSRV", StephanoI_ATEvent_BLE_Peripheral_DiscoverService)
 				EVENTENTRY("+BLESCAN", StephanoI_ATEvent_BLE_Central_Scan)
-				EVENTENTRY("+BLEGATTCPRIMSRV", StephanoI_ATEvent_BLE_Central_DiscoverPrimaryService)
-				EVENTENTRY("+BLEGATTCINCLSRV", StephanoI_ATEvent_BLE_Central_DiscoverIncludedServices)
-				EVENTENTRY("+BLEGATTCCHAR", StephanoI_ATEvent_BLE_Central_DiscoverCharacteristics)
-				EVENTENTRY("+BLESETPHY", StephanoI_ATEvent_BLE_SetPhy)
-				EVENTENTRY("+BLESECREQ", StephanoI_ATEvent_BLE_ReceivedEncryptionRequest)
-				EVENTENTRY("+BLEAUTHCMPL", StephanoI_ATEvent_BLE_AuthenticationComplete)
-				EVENTENTRY("+BLESECNTFYKEY", StephanoI_ATEvent_BLE_NotifySecurityKey)
 				EVENTENTRY("+BLESECKEYREQ", StephanoI_ATEvent_BLE_SecurityKeyRequest)
 				EVENTENTRY("+BLESECNCREQ", StephanoI_ATEvent_BLE_SecurityConfirmKeyRequest)
-				EVENTENTRY("+BLEENCDEV", StephanoI_ATEvent_BLE_BondingInformation)
-				EVENTENTRY("+CWMODE", StephanoI_ATEvent_Wifi_Mode)
-				EVENTENTRY("+CWLAP", StephanoI_ATEvent_Wifi_Scan)
-				EVENTENTRY("+CWSTATE", StephanoI_ATEvent_Wifi_State)
-				EVENTENTRY("+CWLIF", StephanoI_ATEvent_Wifi_GetConnectedIPs)
-				EVENTENTRY("+CIPSTA", StephanoI_ATEvent_Wifi_GetStationIP)
+				EVENTENTRY("+BLESECNTFYKEY", StephanoI_ATEvent_BLE_NotifySecurityKey)
+				EVENTENTRY("+BLESECREQ", StephanoI_ATEvent_BLE_ReceivedEncryptionRequest)
+				EVENTENTRY("+BLESETPHY", StephanoI_ATEvent_BLE_SetPhy)
 				EVENTENTRY("+CIPAP", StephanoI_ATEvent_Wifi_GetAPIP)
-				EVENTENTRY("+CIPSTAMAC", StephanoI_ATEvent_Wifi_GetStationMAC)
 				EVENTENTRY("+CIPAPMAC", StephanoI_ATEvent_Wifi_GetAPMAC)
-				EVENTENTRY("+DIST_STA_IP", StephanoI_ATEvent_Wifi_APAssignIP)
-				EVENTENTRY("+STA_CONNECTED", StephanoI_ATEvent_Wifi_StationhasConnected)
-				EVENTENTRY("+STA_DISCONNECTED", StephanoI_ATEvent_Wifi_StationhasDisconnected)
-				EVENTENTRY("+CIPSTATE", StephanoI_ATEvent_Socket_State)
-				EVENTENTRY("+LINK_CONN", StephanoI_ATEvent_Socket_ConnectionInformation)
-				EVENTENTRY("+PING", StephanoI_ATEvent_Socket_Ping)
 				EVENTENTRY("+CIPDOMAIN", StephanoI_ATEvent_Socket_DomainResolved)
-				EVENTENTRY("+CIPSENDL", StephanoI_ATEvent_Socket_SendState)
-				EVENTENTRY("+CIPSNTPTIME", StephanoI_ATEvent_SNTP_Time)
+				EVENTENTRY("+CIPMUX", StephanoI_ATEvent_Socket_GetMultiple)
 				EVENTENTRY("+CIPRECVDATA", StephanoI_ATEvent_Socket_ReceiveData)
 				EVENTENTRY("+CIPRECVLEN", StephanoI_ATEvent_Socket_ReceiveLen)
-				EVENTENTRY("+CIPMUX", StephanoI_ATEvent_Socket_GetMultiple)
+				EVENTENTRY("+CIPSENDL", StephanoI_ATEvent_Socket_SendState)
+				EVENTENTRY("+CIPSNTPTIME", StephanoI_ATEvent_SNTP_Time)
+				EVENTENTRY("+CIPSTA", StephanoI_ATEvent_Wifi_GetStationIP)
+				EVENTENTRY("+CIPSTAMAC", StephanoI_ATEvent_Wifi_GetStationMAC)
+				EVENTENTRY("+CIPSTATE", StephanoI_ATEvent_Socket_State)
+				EVENTENTRY("+CWLAP", StephanoI_ATEvent_Wifi_Scan)
+				EVENTENTRY("+CWLIF", StephanoI_ATEvent_Wifi_GetConnectedIPs)
+				EVENTENTRY("+CWMODE", StephanoI_ATEvent_Wifi_Mode)
+				EVENTENTRY("+CWSTATE", StephanoI_ATEvent_Wifi_State)
+				EVENTENTRY("+DIST_STA_IP", StephanoI_ATEvent_Wifi_APAssignIP)
+				EVENTENTRY("+HTTPCGET", StephanoI_ATEvent_HTTP_Get)
+				EVENTENTRY("+HTTPCLIENT", StephanoI_ATEvent_HTTP_Client)
+				EVENTENTRY("+HTTPGETSIZE", StephanoI_ATEvent_HTTP_GetSize)
+				EVENTENTRY("+INDICATE", StephanoI_ATEvent_BLE_Indicate)
+				EVENTENTRY("+IPD", StephanoI_ATEvent_Socket_Receive) // +IPD,<link ID>,<len> or +IPD,<len>
+				EVENTENTRY("+LINK_CONN", StephanoI_ATEvent_Socket_ConnectionInformation)
+				EVENTENTRY("+MQTTCONN", StephanoI_ATEvent_MQTT_ConnectionInfo)
 				EVENTENTRY("+MQTTCONNECTED", StephanoI_ATEvent_MQTT_Connected)
 				EVENTENTRY("+MQTTDISCONNECTED", StephanoI_ATEvent_MQTT_Disconnected)
-				EVENTENTRY("+MQTTCONN", StephanoI_ATEvent_MQTT_ConnectionInfo)
-				EVENTENTRY("+MQTTSUBRECV", StephanoI_ATEvent_MQTT_SubscriptionReceive)
+				PARENTEVENTENTRY("+MQTTPUB", MQTTSubEvents, ATCOMMAND_STRING_TERMINATE)
 				EVENTENTRY("+MQTTSUB", StephanoI_ATEvent_MQTT_Subscriptions)
-				EVENTENTRY("+HTTPCLIENT", StephanoI_ATEvent_HTTP_Client)
-				EVENTENTRY("+HTTPGETSIZE", StephanoI_ATEvent_HTTP_GetSize)
-				EVENTENTRY("+HTTPCGET", StephanoI_ATEvent_HTTP_Get)
-				EVENTENTRY("+WEBSERVERRSP", StephanoI_ATEvent_Webserver_Response)
+				EVENTENTRY("+MQTTSUBRECV", StephanoI_ATEvent_MQTT_SubscriptionReceive)
+				EVENTENTRY("+NOTIFY", StephanoI_ATEvent_BLE_Notify)
+				EVENTENTRY("+PING", StephanoI_ATEvent_Socket_Ping)
+				EVENTENTRY("+STA_CONNECTED", StephanoI_ATEvent_Wifi_StationhasConnected)
+				EVENTENTRY("+STA_DISCONNECTED", StephanoI_ATEvent_Wifi_StationhasDisconnected)
 				EVENTENTRY("+SYSMFG", StephanoI_ATEvent_Device_SYSMFG)
-				EVENTENTRY("+SYSTIMESTAMP", StephanoI_ATEvent_Device_SYSTimeStamp)
 				EVENTENTRY("+SYSSTORE", StephanoI_ATEvent_Device_SYSStore)
 				EVENTENTRY("+SYSTEMP", StephanoI_ATEvent_Device_SYSTemp)
+				EVENTENTRY("+SYSTIMESTAMP", StephanoI_ATEvent_Device_SYSTimeStamp)
+				EVENTENTRY("+WEBSERVERRSP", StephanoI_ATEvent_Webserver_Response)
+				EVENTENTRY("+WRITE", StephanoI_ATEvent_BLE_Write)
+				EVENTENTRY("CLOSED", StephanoI_ATEvent_Socket_Closed)
+				EVENTENTRY("CONNECT", StephanoI_ATEvent_Socket_Connected)
 				EVENTENTRY("ERR CODE", StephanoI_ATEvent_ErrorCode)
-				EVENTENTRY("WIFI DISCONNECT", StephanoI_ATEvent_Wifi_Disconnected)
 				EVENTENTRY("WIFI CONNECTED", StephanoI_ATEvent_Wifi_Connected)
+				EVENTENTRY("WIFI DISCONNECT", StephanoI_ATEvent_Wifi_Disconnected)
 				EVENTENTRY("WIFI GOT IP", StephanoI_ATEvent_Wifi_IPAquired)
-				EVENTENTRY("WIFI GOT IPv6 LL", StephanoI_ATEvent_Wifi_IPv6LLAquired)
 				EVENTENTRY("WIFI GOT IPv6 GL", StephanoI_ATEvent_Wifi_IPv6GLAquired)
+				EVENTENTRY("WIFI GOT IPv6 LL", StephanoI_ATEvent_Wifi_IPv6LLAquired)
 				EVENTENTRY("Will force to restart!!!", StephanoI_ATEvent_RestartForced)
-				EVENTENTRY("CONNECT", StephanoI_ATEvent_Socket_Connected)
-				EVENTENTRY("CLOSED", StephanoI_ATEvent_Socket_Closed)
-				EVENTENTRY("+IPD", StephanoI_ATEvent_Socket_Receive) // +IPD,<link ID>,<len> or +IPD,<len>
-				PARENTEVENTENTRY("+MQTTPUB", MQTTSubEvents, ATCOMMAND_STRING_TERMINATE)
-				LASTPARENTEVENTENTRY(NULL, WildCardSubEvents, ATCOMMAND_STRING_TERMINATE) // <link ID>,CONNECT or <link ID>,CLOSED
+				EVENTENTRY("busy p...", StephanoI_ATEvent_Busy)
+				EVENTENTRY("ready", StephanoI_ATEvent_Startup)
+				PARENTEVENTENTRY(NULL, WildCardSubEvents, ATCOMMAND_STRING_TERMINATE) // <link ID>,CONNECT or <link ID>,CLOSED
 		};
 
 /**
@@ -128,7 +128,7 @@ bool StephanoI_ATEvent_ParseEventType(char **pAtCommand, StephanoI_ATEvent_t *pE
 			ATCOMMAND_ARGUMENT_DELIM,
 			'\r' };
 
-	if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, delimiters, sizeof(delimiters), (uint16_t*) pEvent))
+	if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, ATCOMMAND_EVENT_COUNT(moduleMainEvents), delimiters, sizeof(delimiters), (uint16_t*) pEvent))
 	{
 		*pEvent = StephanoI_ATEvent_Invalid;
 		return false;
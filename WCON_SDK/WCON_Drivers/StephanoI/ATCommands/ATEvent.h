@@ -38,7 +38,7 @@
 #include <StephanoI/ATCommands/ATSocket.h>
 #include <StephanoI/ATCommands/ATMQTT.h>
 #include <StephanoI/ATCommands/ATHTTP.h>
-#include <StephanoI/ATCommands/ATWebServer.h>
+#include <StephanoI/ATCommands/ATWebserver.h>
 
 #ifdef __cplusplus
 extern "C" {
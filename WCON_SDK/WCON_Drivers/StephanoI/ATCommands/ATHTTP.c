@@ -48,50 +48,51 @@
  */
 bool StephanoI_ATHTTP_Client(StephanoI_ATHTTP_Opt_t opt, StephanoI_ATHTTP_Content_t content, char *url, char *host, char *path, bool transport_via_SSL, char *data, char *header)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+HTTPCLIENT=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+HTTPCLIENT=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) opt, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) opt, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) content, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) content, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, url, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, url, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, host, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, host, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, path, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, path, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, transport_via_SSL ? (uint8_t) 2 : (uint8_t) 1, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (opt == StephanoI_ATHTTP_Opt_Post) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, transport_via_SSL ? (uint8_t) 2 : (uint8_t) 1, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (opt == StephanoI_ATHTTP_Opt_Post) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 	if (opt == StephanoI_ATHTTP_Opt_Post)
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, data, (header != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, data, (header != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 		if (header != NULL)
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, header, ATCOMMAND_STRING_TERMINATE))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, header, ATCOMMAND_STRING_TERMINATE))
 			{
 				return false;
 			}
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -115,14 +116,15 @@ bool StephanoI_ATHTTP_Client(StephanoI_ATHTTP_Opt_t opt, StephanoI_ATHTTP_Conten
 bool StephanoI_ATHTTP_GetSize(char *url, StephanoI_ATHTTP_Size_t *t)
 {
 	char responsebuffer[16];
-	char *pRequestCommand = AT_commandBuffer;
-	strcpy(pRequestCommand, "AT+HTTPGETSIZE=");
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+HTTPGETSIZE=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, url, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, url, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -151,15 +153,16 @@ bool StephanoI_ATHTTP_GetSize(char *url, StephanoI_ATHTTP_Size_t *t)
 bool StephanoI_ATHTTP_Get(char *url, StephanoI_ATHTTP_Get_t *t)
 {
 	char responsebuffer[7 + t->length];
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+HTTPCGET=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+HTTPCGET=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, url, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, url, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -190,37 +193,38 @@ bool StephanoI_ATHTTP_Get(char *url, StephanoI_ATHTTP_Get_t *t)
  */
 bool StephanoI_ATHTTP_Post(char *url, uint8_t *data, uint32_t length, uint8_t number_of_headers, char **headers)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+HTTPCPOST=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+HTTPCPOST=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, url, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, url, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (number_of_headers > 0) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (number_of_headers > 0) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 	if (number_of_headers > 0)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, number_of_headers, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, number_of_headers, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 		for (uint8_t i = 0; i < number_of_headers - 1; i++)
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, *(headers + i), ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, *(headers + i), ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
 		}
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, *(headers + number_of_headers - 1), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, *(headers + number_of_headers - 1), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
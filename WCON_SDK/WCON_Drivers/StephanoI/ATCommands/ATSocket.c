@@ -32,6 +32,9 @@
 #include <StephanoI/ATCommands/ATSocket.h>
 #include <StephanoI/StephanoI.h>
 
+static const ATCommand_CommandName_t StephanoI_ATSocket_SendCommandName = ATCOMMAND_COMMAND_NAME("CIPSEND");
+static const ATCommand_CommandName_t StephanoI_ATSocket_SendLongCommandName = ATCOMMAND_COMMAND_NAME("CIPSENDL");
+
 /**
  * @brief Enable IPv6 network
  *
@@ -41,15 +44,16 @@
  */
 bool StephanoI_ATSocket_SetEnableIPv6(bool enable)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPV6=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPV6=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -92,15 +96,16 @@ bool StephanoI_ATSocket_GetEnableIPv6(bool *enable)
  */
 bool StephanoI_ATSocket_SetMultiple(bool multiple)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPMUX=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPMUX=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, multiple ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, multiple ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -147,14 +152,15 @@ bool StephanoI_ATSocket_GetMultiple(bool *multipleP)
  */
 bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID, StephanoI_ATSocket_Type_t type, char *remote_IP, uint32_t remote_port)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSTART=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSTART=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -163,7 +169,7 @@ bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID
 	{
 	case StephanoI_ATSocket_Type_TCP:
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -171,7 +177,7 @@ bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID
 		break;
 	case StephanoI_ATSocket_Type_TCPv6:
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -184,15 +190,15 @@ bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID
 		return false;
 	}
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -217,14 +223,15 @@ bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID
  */
 bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID, StephanoI_ATSocket_Type_t type, char *remote_IP, uint32_t remote_port, uint32_t local_port)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSTART=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSTART=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -233,7 +240,7 @@ bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID
 	{
 	case StephanoI_ATSocket_Type_UDP:
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "UDP", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "UDP", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -241,7 +248,7 @@ bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID
 		break;
 	case StephanoI_ATSocket_Type_UDPv6:
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "UDPv6", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "UDPv6", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -254,19 +261,19 @@ bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID
 		return false;
 	}
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, local_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, local_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -289,15 +296,16 @@ bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID
  */
 bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char *remote_IP, uint32_t remote_port)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSTARTEX=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSTARTEX=");
 
 	switch (type)
 	{
 	case StephanoI_ATSocket_Type_TCP:
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -305,7 +313,7 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char *remot
 		break;
 	case StephanoI_ATSocket_Type_TCPv6:
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -313,7 +321,7 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char *remot
 		break;
 	case StephanoI_ATSocket_Type_UDP:
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "UDP", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "UDP", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -321,7 +329,7 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char *remot
 		break;
 	case StephanoI_ATSocket_Type_UDPv6:
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "UDPv6", ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "UDPv6", ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
@@ -332,15 +340,15 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char *remot
 		return false;
 	}
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -362,26 +370,27 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char *remot
  */
 bool StephanoI_ATSocket_CloseSocket(bool multiple_connections, uint8_t link_ID)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPCLOSE=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPCLOSE=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		strcpy(pRequestCommand, "AT+CIPCLOSE=");
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPCLOSE=");
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 	else
 	{
-		strcpy(pRequestCommand, "AT+CIPCLOSE\r\n");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPCLOSE\r\n");
 	}
 
 	if (!StephanoI_SendRequest(pRequestCommand))
@@ -424,15 +433,16 @@ bool StephanoI_ATSocket_GetState(StephanoI_ATSocket_State_t *t)
 bool StephanoI_ATSocket_Ping(char *host, StephanoI_ATSocket_Ping_t *t)
 {
 	char responsebuffer[16];
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+PING=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+PING=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, host, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, host, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -461,15 +471,16 @@ bool StephanoI_ATSocket_Ping(char *host, StephanoI_ATSocket_Ping_t *t)
 bool StephanoI_ATSocket_ResolveDomain(char *domain_name, StephanoI_ATSocket_DomainResolved_t *domainP)
 {
 	char responsebuffer[64];
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPDOMAIN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPDOMAIN=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, domain_name, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, domain_name, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -500,47 +511,51 @@ bool StephanoI_ATSocket_ResolveDomain(char *domain_name, StephanoI_ATSocket_Doma
  */
 bool StephanoI_ATSocket_Send(bool multiple_connections, uint8_t link_id, char *remote_host, uint32_t remote_port, uint8_t *data, uint32_t length)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
+	const ATCommand_CommandName_t *commandName;
 
 	if (length > 8192)
 	{
-		strcpy(pRequestCommand, "AT+CIPSENDL=");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSENDL=");
+		commandName = &StephanoI_ATSocket_SendLongCommandName;
 	}
 	else
 	{
-		strcpy(pRequestCommand, "AT+CIPSEND=");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSEND=");
+		commandName = &StephanoI_ATSocket_SendCommandName;
 	}
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, link_id, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, link_id, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (remote_host != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), (remote_host != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 	if (remote_host != NULL)
 	{
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_host, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, remote_host, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
 
-	if (!StephanoI_SendRequest(pRequestCommand))
+	if (!StephanoI_SendRequestWithCommandName(pRequestCommand, commandName))
 	{
 		return false;
 	}
@@ -566,19 +581,20 @@ bool StephanoI_ATSocket_Send(bool multiple_connections, uint8_t link_id, char *r
  */
 bool StephanoI_ATSocket_SendConfiguration(uint32_t report_size, uint32_t transmit_size)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSENDLCFG=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSENDLCFG=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, report_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, report_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, transmit_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, transmit_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -609,15 +625,16 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
 		return false;
 	}
 
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSERVER=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSERVER=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, mode ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, mode ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, param2, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), mode ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, param2, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), mode ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -627,7 +644,7 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
 		{
 		case StephanoI_ATSocket_Type_TCP:
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -635,7 +652,7 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
 			break;
 		case StephanoI_ATSocket_Type_TCPv6:
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -643,7 +660,7 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
 			break;
 		case StephanoI_ATSocket_Type_SSL:
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "SSL", ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "SSL", ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -651,7 +668,7 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
 			break;
 		case StephanoI_ATSocket_Type_SSLv6:
 		{
-			if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "SSLv6", ATCOMMAND_ARGUMENT_DELIM))
+			if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, "SSLv6", ATCOMMAND_ARGUMENT_DELIM))
 			{
 				return false;
 			}
@@ -662,12 +679,12 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
 			return false;
 		}
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, CA_enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, CA_enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -688,15 +705,16 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
  */
 bool StephanoI_ATSocket_SetTCPSSLServerMaxConnections(uint8_t max_num)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSERVERMAXCONN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSERVERMAXCONN=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, max_num, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, max_num, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -740,15 +758,16 @@ bool StephanoI_ATSocket_GetTCPSSLServerMaxConnections(uint8_t *max_num)
  */
 bool StephanoI_ATSocket_SetTCPSSLServerTimeout(uint16_t time)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSTO=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSTO=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -794,23 +813,24 @@ bool StephanoI_ATSocket_GetTCPSSLServerTimeout(uint16_t *time)
  */
 bool StephanoI_ATSocket_EnableSNTPServer(bool enable, StephanoI_ATSocket_TimeZone_t timezone, char *server1)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSNTPCFG=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSNTPCFG=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t) timezone, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (int32_t) timezone, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, server1, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, server1, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -854,15 +874,16 @@ bool StephanoI_ATSocket_ReadSNTPTime(StephanoI_ATSocket_SNTP_Time_t *t)
  */
 bool StephanoI_ATSocket_SetSNTPTimeInterval(uint32_t time)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSNTPINTV=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSNTPINTV=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -906,42 +927,43 @@ bool StephanoI_ATSocket_GetSNTPTimeInterval(uint32_t *time)
  */
 bool StephanoI_ATSocket_SetSSLClient(bool multiple_connections, StephanoI_ATSocket_SSLClient_t client)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSSLCCONF=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSSLCCONF=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, client.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, client.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
 	if (client.auth_mode == StephanoI_ATSocket_SSLAuthMode_NoAuth)
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) client.auth_mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) client.auth_mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 	else
 	{
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) client.auth_mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) client.auth_mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, client.pki_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, client.pki_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, client.ca_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, client.ca_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -977,23 +999,24 @@ bool StephanoI_ATSocket_GetSSLClient()
  */
 bool StephanoI_ATSocket_SetSSLClientName(bool multiple_connections, StephanoI_ATSocket_SSLClientName_t name)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSSLCCN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSSLCCN=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, name.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, name.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, name.common_name, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, name.common_name, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1037,23 +1060,24 @@ bool StephanoI_ATSocket_GetSSLClientName(StephanoI_ATSocket_SSLClientName_t *nam
  */
 bool StephanoI_ATSocket_SetSSLClientServerNameIndication(bool multiple_connections, StephanoI_ATSocket_SSLClientServerNameIndication_t name)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSSLCSNI=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSSLCSNI=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, name.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, name.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, name.sni, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, name.sni, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1097,27 +1121,28 @@ bool StephanoI_ATSocket_GetSSLClientServerNameIndication(StephanoI_ATSocket_SSLC
  */
 bool StephanoI_ATSocket_SetSSLClientALPN(bool multiple_connections, StephanoI_ATSocket_SSLClientALPN_t alpn)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSSLCALPN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSSLCALPN=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, alpn.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, alpn.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, alpn.counts, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, alpn.counts, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, alpn.alpn, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, alpn.alpn, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1161,27 +1186,28 @@ bool StephanoI_ATSocket_GetSSLClientALPN(StephanoI_ATSocket_SSLClientALPN_t *alp
  */
 bool StephanoI_ATSocket_SetSSLClientPSK(bool multiple_connections, StephanoI_ATSocket_SSLClientPSK_t psk)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSSLCPSK=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSSLCPSK=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, psk.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, psk.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, psk.psk, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, psk.psk, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, psk.hint, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, psk.hint, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1225,27 +1251,28 @@ bool StephanoI_ATSocket_GetSSLClientPSK(StephanoI_ATSocket_SSLClientPSK_t *psk)
  */
 bool StephanoI_ATSocket_SetDNSServerInformation(bool manual, char *DNS_server)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
 	if (manual)
 	{
-		strcpy(pRequestCommand, "AT+CIPDNS=");
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, manual ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPDNS=");
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, manual ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, DNS_server, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, DNS_server, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 	else
 	{
-		strcpy(pRequestCommand, "AT+CIPDNS=0\r\n");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPDNS=0\r\n");
 	}
 
 	if (!StephanoI_SendRequest(pRequestCommand))
@@ -1264,15 +1291,16 @@ bool StephanoI_ATSocket_SetDNSServerInformation(bool manual, char *DNS_server)
  */
 bool StephanoI_ATSocket_SetReceiveMode(StephanoI_ATSocket_ReceiveMode_t mode)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPRECVMODE=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPRECVMODE=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -1342,24 +1370,25 @@ bool StephanoI_ATSocket_GetReceiveLength(StephanoI_ATSocket_ReceiveLen_t *t)
 bool StephanoI_ATSocket_GetReceivedData(bool multiple_connections, uint8_t link_ID, uint16_t len, StephanoI_ATSocket_ReceiveData_t *dataP)
 {
 	char responsebuffer[len + 32];
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPRECVDATA=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPRECVDATA=");
 
 	if (multiple_connections)
 	{
 		/* AT+CIPMUX=1 */
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
 	}
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, len, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, len, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -32,6 +32,71 @@
 #include <StephanoI/ATCommands/ATWifi.h>
 #include <StephanoI/StephanoI.h>
 
+/**
+ * @brief Arguments of AT+CWCOUNTRY (set request and response).
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_CountryCodeFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWifiCountryCode_t, policy, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWifiCountryCode_t, country_code, ATCommand_FieldType_QuotedString, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWifiCountryCode_t, start_channel, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWifiCountryCode_t, total_channel_count, ATCommand_FieldType_Unsigned, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of AT+CWSAP (set request and response).
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_APConfigurationFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, ssid, ATCommand_FieldType_QuotedString, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, pwd, ATCommand_FieldType_QuotedString, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, channel, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, ecn, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, max_connections, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, ssid_hidden, ATCommand_FieldType_Boolean, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of AT+CWDHCPS (set request following the enable flag and response).
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_IPRangeFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_IPRange_t, lease_time, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_IPRange_t, start_ip, ATCommand_FieldType_QuotedString, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_IPRange_t, end_ip, ATCommand_FieldType_QuotedString, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of +CWLAP event (following the opening bracket).
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_ScanFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, enc, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, ssid, ATCommand_FieldType_String, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, rssi, ATCommand_FieldType_Signed, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, MAC, ATCommand_FieldType_String, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, channel, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, freq_offset, ATCommand_FieldType_Signed, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, freqcal_val, ATCommand_FieldType_Signed, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, pairwise_cipher, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, group_cipher, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, bgn, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, wps_flags, ATCommand_FieldType_Unsigned, ')') };
+
+/**
+ * @brief Arguments of +CWSTATE event.
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_StateFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_State_t, state, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_State_t, ssid, ATCommand_FieldType_String, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of +CWLIF event.
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_GetConnectedIPsFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_GetConnectedIPs_t, IP, ATCommand_FieldType_String, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_GetConnectedIPs_t, MAC, ATCommand_FieldType_String, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of +DIST_STA_IP event.
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_APAssignIPFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APAssignIP_t, MAC, ATCommand_FieldType_String, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APAssignIP_t, ip, ATCommand_FieldType_String, ATCOMMAND_STRING_TERMINATE) };
+
 /**
  * @brief Enable/disable the Wifi
  *
@@ -41,15 +106,16 @@
  */
 bool StephanoI_ATWifi_Init(bool enable)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWINIT=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWINIT=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -93,19 +159,20 @@ bool StephanoI_ATWifi_GetInit(bool *enableP)
  */
 bool StephanoI_ATWifi_SetMode(StephanoI_ATWifiMode_t mode, bool autoconnect)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWMODE=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWMODE=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, autoconnect ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, autoconnect ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -170,27 +237,16 @@ bool StephanoI_ATWifi_GetState(StephanoI_ATWiFi_State_t *stateP)
  */
 bool StephanoI_ATWifi_SetCountryCode(StephanoI_ATWifiCountryCode_t t)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWCOUNTRY=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWCOUNTRY=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) t.policy, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendFields(&requestCommand, &t, StephanoI_ATWifi_CountryCodeFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_CountryCodeFields)))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, t.country_code, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) t.start_channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) t.total_channel_count, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -233,15 +289,16 @@ bool StephanoI_ATWifi_GetCountryCode(StephanoI_ATWifiCountryCode_t *t)
  */
 bool StephanoI_ATWifi_SetHostname(StephanoI_ATWiFi_Hostname_t name)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWHOSTNAME=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWHOSTNAME=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, name, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, name, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -284,22 +341,23 @@ bool StephanoI_ATWifi_GetHostname(StephanoI_ATWiFi_Hostname_t *nameP)
  */
 bool StephanoI_ATWifi_Station_ScanAPOptions(uint16_t printmask, int8_t rssi, uint16_t authmode_mask)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWLAPOPT=1,");
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, printmask, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWLAPOPT=1,");
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, printmask, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, rssi, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, rssi, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, authmode_mask, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, authmode_mask, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -320,20 +378,21 @@ bool StephanoI_ATWifi_Station_ScanAPOptions(uint16_t printmask, int8_t rssi, uin
  */
 bool StephanoI_ATWifi_Station_ScanAPs(char *ssid)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
 	if (ssid == NULL)
 	{
-		strcpy(pRequestCommand, "AT+CWLAP\r\n");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWLAP\r\n");
 	}
 	else
 	{
-		strcpy(pRequestCommand, "AT+CWLAP=");
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, ssid, ATCOMMAND_STRING_TERMINATE))
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWLAP=");
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, ssid, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -356,19 +415,20 @@ bool StephanoI_ATWifi_Station_ScanAPs(char *ssid)
  */
 bool StephanoI_ATWifi_Station_Connect(char *ssid, char *password)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWJAP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWJAP=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, ssid, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, ssid, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, password, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, password, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -390,19 +450,20 @@ bool StephanoI_ATWifi_Station_Connect(char *ssid, char *password)
  */
 bool StephanoI_ATWifi_Station_ReConnectConfiguration(uint16_t interval_s, uint16_t repeat_count)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWRECONNCFG=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWRECONNCFG=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, interval_s, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, interval_s, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, repeat_count, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, repeat_count, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -428,35 +489,36 @@ bool StephanoI_ATWifi_Station_ReConnectConfiguration(uint16_t interval_s, uint16
  */
 bool StephanoI_ATWifi_Station_ConnectWPA2Enterprise(char *ssid, StephanoI_ATWifiWPA2Method_t method, char *identity, char *username, char *password, StephanoI_ATWPA2SecurityFlags_t security)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWJEAP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWJEAP=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, ssid, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, ssid, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) method, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) method, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, identity, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, identity, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, password, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, password, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) security, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) security, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -475,9 +537,10 @@ bool StephanoI_ATWifi_Station_ConnectWPA2Enterprise(char *ssid, StephanoI_ATWifi
  */
 bool StephanoI_ATWifi_Station_Disconnect()
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWQAP\r\n");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWQAP\r\n");
 
 	if (!StephanoI_SendRequest(pRequestCommand))
 	{
@@ -495,15 +558,16 @@ bool StephanoI_ATWifi_Station_Disconnect()
  */
 bool StephanoI_ATWifi_Station_AutoConnect(bool autoconnect)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWAUTOCONN=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWAUTOCONN=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, autoconnect ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, autoconnect ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -522,9 +586,10 @@ bool StephanoI_ATWifi_Station_AutoConnect(bool autoconnect)
  */
 bool StephanoI_ATWifi_Station_GetIP()
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSTA?\r\n");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSTA?\r\n");
 
 	if (!StephanoI_SendRequest(pRequestCommand))
 	{
@@ -542,15 +607,16 @@ bool StephanoI_ATWifi_Station_GetIP()
  */
 bool StephanoI_ATWifi_Station_SetMAC(StephanoI_ATWiFi_MAC_t mac)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPSTAMAC=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPSTAMAC=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, mac, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, mac, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -594,15 +660,16 @@ bool StephanoI_ATWifi_Station_GetMAC(StephanoI_ATWiFi_MAC_t *t)
  */
 bool StephanoI_ATWifi_Station_SetProtocol(StephanoI_ATWifiProtocolFlags_t prot)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWSTAPROTO=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWSTAPROTO=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) prot, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) prot, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -645,15 +712,16 @@ bool StephanoI_ATWifi_Station_GetProtocol(StephanoI_ATWifiProtocolFlags_t *protP
  */
 bool StephanoI_ATWifi_AP_SetMAC(StephanoI_ATWiFi_MAC_t mac)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPAPMAC=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPAPMAC=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, mac, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, mac, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -697,35 +765,16 @@ bool StephanoI_ATWifi_AP_GetMAC(StephanoI_ATWiFi_MAC_t *t)
  */
 bool StephanoI_ATWifi_AP_SetConfiguration(StephanoI_ATWiFi_APConfiguration_t config)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWSAP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWSAP=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, config.ssid, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, config.pwd, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, config.channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, config.ecn, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, config.max_connections, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendFields(&requestCommand, &config, StephanoI_ATWifi_APConfigurationFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_APConfigurationFields)))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, config.ssid_hidden ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -766,9 +815,10 @@ bool StephanoI_ATWifi_AP_GetConfiguration(StephanoI_ATWiFi_APConfiguration_t *co
  */
 bool StephanoI_ATWifi_AP_GetConnectedStations()
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWLIF\r\n");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWLIF\r\n");
 
 	if (!StephanoI_SendRequest(pRequestCommand))
 	{
@@ -786,21 +836,22 @@ bool StephanoI_ATWifi_AP_GetConnectedStations()
  */
 bool StephanoI_ATWifi_AP_DisconnectStation(StephanoI_ATWiFi_MAC_t mac)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
 	if (mac == NULL)
 	{
-		strcpy(pRequestCommand, "AT+CWQIF\r\n");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWQIF\r\n");
 	}
 	else
 	{
-		strcpy(pRequestCommand, "AT+CWQIF=");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWQIF=");
 
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, mac, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, mac, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
@@ -822,15 +873,16 @@ bool StephanoI_ATWifi_AP_DisconnectStation(StephanoI_ATWiFi_MAC_t mac)
  */
 bool StephanoI_ATWifi_AP_SetProtocol(StephanoI_ATWifiProtocolFlags_t prot)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWAPPROTO=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWAPPROTO=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) prot, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) prot, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -874,19 +926,20 @@ bool StephanoI_ATWifi_AP_GetProtocol(StephanoI_ATWifiProtocolFlags_t *protP)
  */
 bool StephanoI_ATWifi_EnableDHCP(bool enable, StephanoI_ATWifiDHCPFlags_t mode)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWDHCP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWDHCP=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t) mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, (uint32_t) mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -930,27 +983,20 @@ bool StephanoI_ATWifi_GetDHCPState(uint8_t *stateP)
  */
 bool StephanoI_ATWifi_AP_SetIPrangeConfiguration(bool enable, StephanoI_ATWiFi_IPRange_t range)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CWDHCPS=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CWDHCPS=");
 
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentInt(pRequestCommand, range.lease_time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, range.start_ip, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendFields(&requestCommand, &range, StephanoI_ATWifi_IPRangeFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_IPRangeFields)))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, range.end_ip, ATCOMMAND_STRING_TERMINATE))
-	{
-		return false;
-	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
@@ -991,9 +1037,10 @@ bool StephanoI_ATWifi_AP_GetIPrangeConfiguration(StephanoI_ATWiFi_IPRange_t *ran
  */
 bool StephanoI_ATWifi_AP_GetIP()
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPAP?\r\n");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPAP?\r\n");
 
 	if (!StephanoI_SendRequest(pRequestCommand))
 	{
@@ -1009,23 +1056,28 @@ bool StephanoI_ATWifi_AP_GetIP()
  */
 bool StephanoI_ATWifi_AP_SetIP(char *ip, char *gateway, char *netmask)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
-	strcpy(pRequestCommand, "AT+CIPAP=");
+	ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+CIPAP=");
 
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, ip, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, ip, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, gateway, ATCOMMAND_ARGUMENT_DELIM))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, gateway, ATCOMMAND_ARGUMENT_DELIM))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, netmask, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, netmask, ATCOMMAND_STRING_TERMINATE))
 	{
 		return false;
 	}
-	if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+	{
+		return false;
+	}
+	if (!StephanoI_SendRequest(pRequestCommand))
 	{
 		return false;
 	}
@@ -1044,36 +1096,37 @@ bool StephanoI_ATWifi_AP_SetIP(char *ip, char *gateway, char *netmask)
  */
 bool StephanoI_ATWifi_EnableMDNS(bool enable, char *host_name, char *service_name, uint16_t port)
 {
-	char *pRequestCommand = AT_commandBuffer;
+	char *pRequestCommand = StephanoI_commandBuffer;
+	ATCommand_Builder_t requestCommand;
 
 	if (enable)
 	{
-		strcpy(pRequestCommand, "AT+MDNS=");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+MDNS=");
 
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, enable ? (uint32_t) 1 : (uint32_t) 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, host_name, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, host_name, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, service_name, ATCOMMAND_ARGUMENT_DELIM))
+		if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(&requestCommand, service_name, ATCOMMAND_ARGUMENT_DELIM))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentInt(pRequestCommand, port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentInt(&requestCommand, port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
-		if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+		if (!ATCommand_BuilderAppendArgumentString(&requestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
 		{
 			return false;
 		}
 	}
 	else
 	{
-		strcpy(pRequestCommand, "AT+MDNS=0\r\n");
+		ATCommand_BuilderInit(&requestCommand, StephanoI_commandBuffer, sizeof(StephanoI_commandBuffer), "AT+MDNS=0\r\n");
 	}
 	if (!StephanoI_SendRequest(pRequestCommand))
 	{
@@ -1110,60 +1163,7 @@ bool StephanoI_ATWiFi_ParseScan(char *EventArgumentsP, StephanoI_ATWiFi_Scan_t *
 	/*ignore first '(' */
 	char *argumentsP = EventArgumentsP + 1;
 
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->enc), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->ssid, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->ssid)))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->rssi), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_SIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->MAC, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->MAC)))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->channel), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->freq_offset), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_SIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->freqcal_val), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_SIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->pairwise_cipher), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->group_cipher), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->bgn), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->wps_flags), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ')'))
-	{
-		return false;
-	}
-
-	return true;
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_ScanFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_ScanFields));
 }
 
 /**
@@ -1178,16 +1178,7 @@ bool StephanoI_ATWiFi_ParseState(char *EventArgumentsP, StephanoI_ATWiFi_State_t
 {
 	char *argumentsP = EventArgumentsP;
 
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->state), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->ssid, ATCOMMAND_STRING_TERMINATE, sizeof(t->ssid)))
-	{
-		return false;
-	}
-
-	return true;
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_StateFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_StateFields));
 }
 
 /**
@@ -1202,17 +1193,7 @@ bool StephanoI_ATWiFi_ParseGetConnectedIPs(char *EventArgumentsP, StephanoI_ATWi
 {
 	char *argumentsP = EventArgumentsP;
 
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->IP, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->IP)))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->MAC, ATCOMMAND_STRING_TERMINATE, sizeof(t->MAC)))
-	{
-		return false;
-	}
-
-	return true;
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_GetConnectedIPsFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_GetConnectedIPsFields));
 }
 
 /**
@@ -1314,16 +1295,7 @@ bool StephanoI_ATWiFi_ParseAPAssignIP(char *EventArgumentsP, StephanoI_ATWiFi_AP
 {
 	char *argumentsP = EventArgumentsP;
 
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->MAC, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->MAC)))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->ip, ATCOMMAND_STRING_TERMINATE, sizeof(t->MAC)))
-	{
-		return false;
-	}
-
-	return true;
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_APAssignIPFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_APAssignIPFields));
 }
 
 /**
@@ -1338,25 +1310,7 @@ bool StephanoI_ATWiFi_ParseCountryCode(char *EventArgumentsP, StephanoI_ATWifiCo
 {
 	char *argumentsP = EventArgumentsP;
 
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->policy), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->country_code, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->country_code)))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->start_channel), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->total_channel_count), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-	{
-		return false;
-	}
-	return true;
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_CountryCodeFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_CountryCodeFields));
 }
 
 /**
@@ -1419,33 +1373,7 @@ bool StephanoI_ATWiFi_ParseAPConfiguration(char *EventArgumentsP, StephanoI_ATWi
 {
 	char *argumentsP = EventArgumentsP;
 
-	if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, t->ssid, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->ssid)))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, t->pwd, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->pwd)))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->channel), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->ecn), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->max_connections), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	uint8_t dummy;
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &dummy, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-	{
-		return false;
-	}
-	t->ssid_hidden = (dummy == 0x01);
-	return true;
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_APConfigurationFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_APConfigurationFields));
 }
 
 /**
@@ -1479,18 +1407,6 @@ bool StephanoI_ATWiFi_ParseGetIPrangeConfiguration(char *EventArgumentsP, Stepha
 {
 	char *argumentsP = EventArgumentsP;
 
-	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->lease_time), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->start_ip, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->start_ip)))
-	{
-		return false;
-	}
-	if (!ATCommand_GetNextArgumentString(&argumentsP, t->end_ip, ATCOMMAND_STRING_TERMINATE, sizeof(t->end_ip)))
-	{
-		return false;
-	}
-	return true;
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_IPRangeFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_IPRangeFields));
 }
 
@@ -36,6 +36,9 @@
 
 static void StephanoI_HandleRxByte(uint8_t *dataP, size_t size);
 static void StephanoI_HandleRxLine(char *rxPacket, uint16_t rxLength);
+static void StephanoI_CompleteRxLine();
+static void StephanoI_HandleRxBufferFull();
+static bool StephanoI_TransmitRequest(uint8_t *data, size_t dataLength, const ATCommand_CommandName_t *commandName);
 static WE_UART_HandleRxByte_t byteRxCallback = StephanoI_HandleRxByte;
 
 /**
@@ -56,9 +59,17 @@ static char StephanoI_pendingCommandName[64] = {
 		0 };
 
 /**
- * @brief Length of StephanoI_pendingCommandName.
+ * @brief Name of the pending command (points to StephanoI_pendingCommandName or to a
+ * name supplied to StephanoI_SendRequestWithCommandName()).
  */
-static size_t StephanoI_pendingCommandNameLength = 0;
+static ATCommand_CommandName_t StephanoI_pendingCommand = {
+		NULL,
+		0 };
+
+/**
+ * @brief Buffer used for assembling commands and storing responses.
+ */
+char StephanoI_commandBuffer[STEPHANOI_COMMAND_BUFFER_SIZE];
 
 /**
  * @brief Buffer used for current response text.
@@ -89,6 +100,24 @@ static uint16_t StephanoI_rxByteCounter = 0;
  */
 static bool StephanoI_eolChar1Found = false;
 
+/**
+ * @brief Is set if the current line didn't fit into the receive buffer and is
+ * passed to StephanoI_lineFragmentRxCallback in fragments.
+ */
+static bool StephanoI_rxLineFragmented = false;
+
+/**
+ * @brief Is set if the current line didn't fit into the receive buffer and is
+ * discarded (because no line fragment callback has been set).
+ */
+static bool StephanoI_rxLineDiscarded = false;
+
+/**
+ * @brief Optional callback function which receives lines that don't fit into the receive buffer.
+ * @see StephanoI_SetLineFragmentRxCallback()
+ */
+static StephanoI_LineFragmentRxCallback_t StephanoI_lineFragmentRxCallback = NULL;
+
 /**
  * @brief First EOL character expected for responses received from StephanoI.
  * @see StephanoI_eolChar2, StephanoI_twoEolCharacters, StephanoI_SetEolCharacters()
@@ -119,14 +148,20 @@ static StephanoI_Pins_t *StephanoI_pinsP = NULL;
 static WE_UART_t *StephanoI_uartP = NULL;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from StephanoI.
+ * @brief Max. time (microseconds) to sleep between checks when waiting for responses from StephanoI.
  *
- * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+ * Waiting ends as soon as a line has been received (see StephanoI_lineReceived). If set to 0, the
+ * driver polls for responses without sleeping.
  *
  * @see StephanoI_SetTimingParameters
  */
 static uint32_t StephanoI_waitTimeStepUsec = 5 * 1000;
 
+/**
+ * @brief Is set when a line has been received from StephanoI (used to wake up StephanoI_WaitForConfirm()).
+ */
+static volatile bool StephanoI_lineReceived = false;
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to StephanoI
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -298,7 +333,7 @@ bool StephanoI_Transparent_Transmit(const uint8_t *data, uint16_t dataLength)
  */
 bool StephanoI_SendRequest(char *data)
 {
-	return StephanoI_SendRequest_ex((uint8_t*) data, strlen(data));
+	return StephanoI_TransmitRequest((uint8_t*) data, strlen(data), NULL);
 }
 
 /**
@@ -310,6 +345,38 @@ bool StephanoI_SendRequest(char *data)
  * @return true if successful, false otherwise
  */
 bool StephanoI_SendRequest_ex(uint8_t *data, size_t dataLength)
+{
+	return StephanoI_TransmitRequest(data, dataLength, NULL);
+}
+
+/**
+ * @brief Sends the supplied AT command to the module
+ *
+ * Same as StephanoI_SendRequest(), but the name of the command (which is used for
+ * assigning responses to the request) is supplied by the caller instead of being
+ * extracted from the command.
+ *
+ * @param[in] data AT command to send. Note that the command has to end with "\r\n\0".
+ * @param[in] commandName Name of the command (see ATCOMMAND_COMMAND_NAME()). Must stay valid
+ *            until the next request is sent. If NULL, the name is extracted from the command.
+ *
+ * @return true if successful, false otherwise
+ */
+bool StephanoI_SendRequestWithCommandName(char *data, const ATCommand_CommandName_t *commandName)
+{
+	return StephanoI_TransmitRequest((uint8_t*) data, strlen(data), commandName);
+}
+
+/**
+ * @brief Sends the supplied AT command to the module
+ *
+ * @param[in] data AT command to send. Note that the command has to end with "\r\n\0".
+ * @param[in] dataLength Length of the command
+ * @param[in] commandName Name of the command (NULL to extract the name from the command)
+ *
+ * @return true if successful, false otherwise
+ */
+static bool StephanoI_TransmitRequest(uint8_t *data, size_t dataLength, const ATCommand_CommandName_t *commandName)
 {
 	if (StephanoI_executingEventCallback)
 	{
@@ -329,27 +396,35 @@ bool StephanoI_SendRequest_ex(uint8_t *data, size_t dataLength)
 		WE_DelayMicroseconds(StephanoI_minCommandIntervalUsec - t);
 	}
 
-	/* Get command name from request string (remove prefix "AT+" and parameters) */
-	StephanoI_pendingCommandName[0] = '\0';
-	StephanoI_pendingCommandNameLength = 0;
-	if (dataLength > 3 && (data[0] == 'a' || data[0] == 'A') && (data[1] == 't' || data[1] == 'T') && data[2] == '+')
+	if (NULL != commandName)
 	{
-		char *pData = (char*) (data + 3);
-		char delimiters[] = {
-				ATCOMMAND_COMMAND_DELIM,
-				'?',
-				'\r' };
-		if (ATCommand_GetCmdName(&pData, StephanoI_pendingCommandName, sizeof(StephanoI_pendingCommandName), delimiters, sizeof(delimiters)))
+		StephanoI_pendingCommand = *commandName;
+	}
+	else
+	{
+		/* Get command name from request string (remove prefix "AT+" and parameters) */
+		StephanoI_pendingCommandName[0] = '\0';
+		StephanoI_pendingCommand.name = StephanoI_pendingCommandName;
+		StephanoI_pendingCommand.length = 0;
+		if (dataLength > 3 && (data[0] == 'a' || data[0] == 'A') && (data[1] == 't' || data[1] == 'T') && data[2] == '+')
 		{
-			StephanoI_pendingCommandNameLength = strlen(StephanoI_pendingCommandName);
+			char *pData = (char*) (data + 3);
+			char delimiters[] = {
+					ATCOMMAND_COMMAND_DELIM,
+					'?',
+					'\r' };
+			if (ATCommand_GetCmdName(&pData, StephanoI_pendingCommandName, sizeof(StephanoI_pendingCommandName), delimiters, sizeof(delimiters)))
+			{
+				StephanoI_pendingCommand.length = (uint8_t) strlen(StephanoI_pendingCommandName);
+			}
 		}
 	}
 
 #ifdef WE_DEBUG
-	printf("> %.*s", dataLength, data);
+	WE_LOG("> %.*s", (int) dataLength, data);
 	if ((data[dataLength - 2] != '\r') && (data[dataLength - 1] != '\n'))
 	{
-		printf("\r\n");
+		WE_LOG("\r\n");
 	}
 #endif
 
@@ -389,6 +464,9 @@ bool StephanoI_WaitForConfirm_ex(uint32_t maxTimeMs, StephanoI_CNFStatus_t expec
 
 	while (1)
 	{
+		/* Reset flag before checking, so that a line received in the meantime is not missed */
+		StephanoI_lineReceived = false;
+
 		if (StephanoI_CNFStatus_Invalid != StephanoI_cmdConfirmStatus)
 		{
 			/* Store current time to enable check for min. time between received confirm and next command. */
@@ -413,8 +491,8 @@ bool StephanoI_WaitForConfirm_ex(uint32_t maxTimeMs, StephanoI_CNFStatus_t expec
 
 		}
 
-		uint32_t now = WE_GetTick();
-		if (now - t0 > maxTimeMs)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= maxTimeMs)
 		{
 			/* Timeout */
 			break;
@@ -422,7 +500,9 @@ bool StephanoI_WaitForConfirm_ex(uint32_t maxTimeMs, StephanoI_CNFStatus_t expec
 
 		if (StephanoI_waitTimeStepUsec > 0)
 		{
-			WE_DelayMicroseconds(StephanoI_waitTimeStepUsec);
+			/* Sleep until the next line has been received (but not longer than one time step) */
+			uint32_t timeStepMs = (StephanoI_waitTimeStepUsec + 999) / 1000;
+			WE_WaitForEvent(&StephanoI_lineReceived, (maxTimeMs - elapsed < timeStepMs) ? maxTimeMs - elapsed : timeStepMs);
 		}
 	}
 
@@ -452,7 +532,7 @@ inline bool StephanoI_WaitForConfirm(uint32_t maxTimeMs, StephanoI_CNFStatus_t e
  *
  * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
  *
- * @param[in] waitTimeStepUsec Time step (microseconds) when waiting for responses from StephanoI.
+ * @param[in] waitTimeStepUsec Max. time (microseconds) to sleep between checks when waiting for responses from StephanoI (0 = poll without sleeping).
  * @param[in] minCommandIntervalUsec Minimum interval (microseconds) between subsequent commands sent to StephanoI.
  *
  * @return true if successful, false otherwise
@@ -502,7 +582,7 @@ static void StephanoI_HandleRxByte(uint8_t *dataP, size_t size)
 		receivedByte = *dataP;
 
 		/* Interpret received byte */
-		if (StephanoI_rxByteCounter == 0)
+		if ((StephanoI_rxByteCounter == 0) && !StephanoI_rxLineFragmented && !StephanoI_rxLineDiscarded)
 		{
 			if (STEPHANOI_READY4DATA_CHAR == receivedByte)
 			{
@@ -511,6 +591,7 @@ static void StephanoI_HandleRxByte(uint8_t *dataP, size_t size)
 				StephanoI_rxBuffer[StephanoI_rxByteCounter] = '\0';
 				StephanoI_rxByteCounter++;
 				StephanoI_HandleRxLine(StephanoI_rxBuffer, StephanoI_rxByteCounter);
+				StephanoI_lineReceived = true;
 				StephanoI_eolChar1Found = false;
 				StephanoI_rxByteCounter = 0;
 
@@ -523,13 +604,6 @@ static void StephanoI_HandleRxByte(uint8_t *dataP, size_t size)
 		}
 		else
 		{
-			if (StephanoI_rxByteCounter >= STEPHANOI_LINE_MAX_SIZE)
-			{
-				StephanoI_rxByteCounter = 0;
-				StephanoI_eolChar1Found = false;
-				return;
-			}
-
 			if (receivedByte == StephanoI_eolChar1)
 			{
 				StephanoI_eolChar1Found = true;
@@ -537,11 +611,7 @@ static void StephanoI_HandleRxByte(uint8_t *dataP, size_t size)
 				if (!StephanoI_twoEolCharacters)
 				{
 					/* Interpret it now */
-					StephanoI_rxBuffer[StephanoI_rxByteCounter] = '\0';
-					StephanoI_rxByteCounter++;
-					StephanoI_HandleRxLine(StephanoI_rxBuffer, StephanoI_rxByteCounter);
-					StephanoI_eolChar1Found = false;
-					StephanoI_rxByteCounter = 0;
+					StephanoI_CompleteRxLine();
 				}
 			}
 			else if (StephanoI_eolChar1Found)
@@ -549,21 +619,73 @@ static void StephanoI_HandleRxByte(uint8_t *dataP, size_t size)
 				if (receivedByte == StephanoI_eolChar2)
 				{
 					/* Interpret it now */
-					StephanoI_rxBuffer[StephanoI_rxByteCounter] = '\0';
-					StephanoI_rxByteCounter++;
-					StephanoI_HandleRxLine(StephanoI_rxBuffer, StephanoI_rxByteCounter);
-					StephanoI_eolChar1Found = false;
-					StephanoI_rxByteCounter = 0;
+					StephanoI_CompleteRxLine();
 				}
 			}
 			else
 			{
-				StephanoI_rxBuffer[StephanoI_rxByteCounter++] = receivedByte;
+				if (StephanoI_rxByteCounter >= STEPHANOI_LINE_MAX_SIZE - 1)
+				{
+					/* Line doesn't fit into the receive buffer (last byte is reserved for termination character) */
+					StephanoI_HandleRxBufferFull();
+				}
+				if (!StephanoI_rxLineDiscarded)
+				{
+					StephanoI_rxBuffer[StephanoI_rxByteCounter++] = receivedByte;
+				}
 			}
 		}
 	}
 }
 
+/**
+ * @brief Is called when the end of a line has been received.
+ *
+ * Passes the line to StephanoI_HandleRxLine() or, if the line didn't fit into the receive
+ * buffer, passes its last fragment to the line fragment callback. Resets the receive buffer.
+ */
+static void StephanoI_CompleteRxLine()
+{
+	if (StephanoI_rxLineFragmented)
+	{
+		if (NULL != StephanoI_lineFragmentRxCallback)
+		{
+			StephanoI_lineFragmentRxCallback(StephanoI_rxBuffer, StephanoI_rxByteCounter, false, true);
+		}
+	}
+	else if (!StephanoI_rxLineDiscarded)
+	{
+		StephanoI_rxBuffer[StephanoI_rxByteCounter] = '\0';
+		StephanoI_rxByteCounter++;
+		StephanoI_HandleRxLine(StephanoI_rxBuffer, StephanoI_rxByteCounter);
+	}
+	StephanoI_lineReceived = true;
+	StephanoI_eolChar1Found = false;
+	StephanoI_rxLineFragmented = false;
+	StephanoI_rxLineDiscarded = false;
+	StephanoI_rxByteCounter = 0;
+}
+
+/**
+ * @brief Is called when the receive buffer is full before the end of the current line has been received.
+ *
+ * Passes the buffered data to the line fragment callback (if set), otherwise the
+ * rest of the line is discarded.
+ */
+static void StephanoI_HandleRxBufferFull()
+{
+	if (NULL != StephanoI_lineFragmentRxCallback)
+	{
+		StephanoI_lineFragmentRxCallback(StephanoI_rxBuffer, StephanoI_rxByteCounter, !StephanoI_rxLineFragmented, false);
+		StephanoI_rxLineFragmented = true;
+	}
+	else
+	{
+		StephanoI_rxLineDiscarded = true;
+	}
+	StephanoI_rxByteCounter = 0;
+}
+
 /**
  * @brief Is called when a complete line has been received.
  *
@@ -573,7 +695,7 @@ static void StephanoI_HandleRxByte(uint8_t *dataP, size_t size)
 static void StephanoI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 {
 #ifdef WE_DEBUG
-	printf("< %s\r\n", rxPacket);
+	WE_LOG("< %s\r\n", rxPacket);
 #endif
 
 	/* confirmations */
@@ -616,8 +738,7 @@ static void StephanoI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 			if ((StephanoI_currentResponseText != NULL) &&
 				(rxLength > 1) &&
 				(StephanoI_rxBuffer[0] == '+') &&
-				(StephanoI_pendingCommandName[0] != '\0') &&
-				(0 == strncmp(StephanoI_pendingCommandName, StephanoI_rxBuffer + 1, StephanoI_pendingCommandNameLength)))
+				ATCommand_MatchCommandName(&StephanoI_pendingCommand, StephanoI_rxBuffer + 1, rxLength - 1, false))
 															// @formatter:on
 {			/* Copy to response text buffer, taking care not to exceed buffer size */
 			uint16_t chunkLength = rxLength;
@@ -626,9 +747,9 @@ static void StephanoI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 			if(StephanoI_currentResponseLength == 0)
 			{
 				/* cut off command, '+', and ':' */
-				if(chunkLength > (StephanoI_pendingCommandNameLength + 2))
+				if(chunkLength > (StephanoI_pendingCommand.length + 2))
 				{
-					chunkLength -= (StephanoI_pendingCommandNameLength + 2);
+					chunkLength -= (StephanoI_pendingCommand.length + 2);
 				}
 			}
 
@@ -641,7 +762,7 @@ static void StephanoI_HandleRxLine(char *rxPacket, uint16_t rxLength)
 			if(StephanoI_currentResponseLength == 0)
 			{
 				/* cut off command, '+', and ':' */
-				memcpy(&StephanoI_currentResponseText[StephanoI_currentResponseLength], &StephanoI_rxBuffer[1 /*+*/+ StephanoI_pendingCommandNameLength /* command name */+ 1 /*:*/], chunkLength);
+				memcpy(&StephanoI_currentResponseText[StephanoI_currentResponseLength], &StephanoI_rxBuffer[1 /*+*/+ StephanoI_pendingCommand.length /* command name */+ 1 /*:*/], chunkLength);
 			}
 			else
 			{
@@ -690,3 +811,17 @@ void StephanoI_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacter
 	StephanoI_eolChar2 = eol2;
 	StephanoI_twoEolCharacters = twoEolCharacters;
 }
+
+/**
+ * @brief Sets an optional callback function which receives lines that don't fit into the receive buffer.
+ *
+ * Lines exceeding STEPHANOI_LINE_MAX_SIZE (e.g. responses containing large amounts of data) are
+ * passed to this callback in fragments instead of being processed by the driver. The callback
+ * is executed in the context of the rx byte handler. If no callback is set, such lines are discarded.
+ *
+ * @param[in] callback Pointer to line fragment received callback function (may be NULL)
+ */
+void StephanoI_SetLineFragmentRxCallback(StephanoI_LineFragmentRxCallback_t callback)
+{
+	StephanoI_lineFragmentRxCallback = callback;
+}
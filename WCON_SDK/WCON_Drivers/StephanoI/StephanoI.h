@@ -36,6 +36,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <global/global_types.h>
+#include <global/ATCommands.h>
 #include <utils/base64.h>
 
 /**
@@ -56,6 +57,20 @@
  */
 #define STEPHANOI_MAX_RESPONSE_TEXT_LENGTH STEPHANOI_LINE_MAX_SIZE
 
+/**
+ * @brief Size of the buffer used for assembling the commands sent to StephanoI and for
+ * storing the responses to these commands (see StephanoI_commandBuffer).
+ *
+ * May be defined by the application, must not be smaller than STEPHANOI_MAX_RESPONSE_TEXT_LENGTH.
+ */
+#ifndef STEPHANOI_COMMAND_BUFFER_SIZE
+#define STEPHANOI_COMMAND_BUFFER_SIZE STEPHANOI_LINE_MAX_SIZE
+#endif
+
+#if STEPHANOI_COMMAND_BUFFER_SIZE < STEPHANOI_MAX_RESPONSE_TEXT_LENGTH
+#error "STEPHANOI_COMMAND_BUFFER_SIZE must not be smaller than STEPHANOI_MAX_RESPONSE_TEXT_LENGTH"
+#endif
+
 #define STEPHANOI_RESPONSE_ERROR  "ERROR"                     /**< String sent by module if AT command failed */
 #define STEPHANOI_SEND_OK         "SEND OK"                   /**< String sent by module if Socket transmission was OK */
 #define STEPHANOI_SEND_CANCELLED  "SEND CANCELLED"            /**< String sent by module if Socket transmission has been cancelled */
@@ -132,6 +147,29 @@ typedef enum StephanoI_BooleanValue_t
  */
 typedef void (*StephanoI_EventCallback_t)(char*);
 
+/**
+ * @brief StephanoI line fragment received callback.
+ *
+ * Receives lines that don't fit into the receive buffer of the driver (STEPHANOI_LINE_MAX_SIZE),
+ * e.g. responses containing large amounts of data. Such lines are not processed by the
+ * driver, but are passed to this callback in fragments as they are received.
+ *
+ * Arguments: Fragment text (not null-terminated), length of fragment,
+ *            true if first fragment of line, true if last fragment of line
+ *
+ * @see StephanoI_SetLineFragmentRxCallback()
+ */
+typedef void (*StephanoI_LineFragmentRxCallback_t)(const char*, uint16_t, bool, bool);
+
+/**
+ * @brief Buffer used by the StephanoI driver for assembling commands and storing responses.
+ *
+ * Is owned by the StephanoI driver, so commands for other modules can be assembled at the
+ * same time. Commands may also be assembled in a buffer supplied by the caller
+ * (see ATCommand_BuilderInit()) and sent using StephanoI_SendRequest().
+ */
+extern char StephanoI_commandBuffer[STEPHANOI_COMMAND_BUFFER_SIZE];
+
 extern bool StephanoI_Init(WE_UART_t *uartP, StephanoI_Pins_t *pinoutP, StephanoI_EventCallback_t eventCallback);
 extern bool StephanoI_Deinit(void);
 
@@ -141,6 +179,7 @@ extern bool StephanoI_SetWakeUpPin(bool high);
 extern bool StephanoI_Transparent_Transmit(const uint8_t *data, uint16_t dataLength);
 extern bool StephanoI_SendRequest(char *data);
 extern bool StephanoI_SendRequest_ex(uint8_t *data, size_t dataLength);
+extern bool StephanoI_SendRequestWithCommandName(char *data, const ATCommand_CommandName_t *commandName);
 extern bool StephanoI_WaitForConfirm(uint32_t maxTimeMs, StephanoI_CNFStatus_t expectedStatus);
 extern bool StephanoI_WaitForConfirm_ex(uint32_t maxTimeMs, StephanoI_CNFStatus_t expectedStatus, char *pOutResponse, uint16_t responseSize);
 
@@ -149,6 +188,7 @@ extern void StephanoI_SetTimeout(StephanoI_Timeout_t type, uint32_t timeout);
 extern uint32_t StephanoI_GetTimeout(StephanoI_Timeout_t type);
 
 extern void StephanoI_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacters);
+extern void StephanoI_SetLineFragmentRxCallback(StephanoI_LineFragmentRxCallback_t callback);
 
 #ifdef __cplusplus
 }
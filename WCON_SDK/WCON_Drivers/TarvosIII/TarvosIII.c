@@ -156,6 +156,7 @@ static TarvosIII_CMD_Frame_t txPacket = {
 
 #define CMDCONFIRMATIONARRAY_LENGTH 2
 static TarvosIII_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static volatile bool rxPacketReceived = false; /* set when a valid packet has been received, used to wake up Wait4CNF() */
 static uint8_t channelVolatile = CHANNELINVALID; /* variable used to check if setting the channel was successful */
 static uint8_t powerVolatile = TXPOWERINVALID; /* variable used to check if setting the TXPower was successful */
 static TarvosIII_AddressMode_t addressmode = TarvosIII_AddressMode_0; /* initial address mode */
@@ -295,9 +296,7 @@ static void HandleRxPacket(uint8_t *rxBuffer)
  */
 static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, TarvosIII_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-	int count = 0;
-	int time_step_ms = 5; /* 5ms */
-	int max_count = max_time_ms / time_step_ms;
+	uint32_t t0 = WE_GetTick();
 
 	if (reset_confirmstate)
 	{
@@ -306,8 +305,12 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, TarvosIII
 			cmdConfirmation_array[i].cmd = CNFINVALID;
 		}
 	}
+
 	while (1)
 	{
+		/* reset flag before checking, so that a packet received in the meantime is not missed */
+		rxPacketReceived = false;
+
 		for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
 		{
 			if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
@@ -316,17 +319,16 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, TarvosIII
 			}
 		}
 
-		if (count >= max_count)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= (uint32_t) max_time_ms)
 		{
 			/* received no correct response within timeout */
 			return false;
 		}
 
-		/* wait */
-		count++;
-		WE_Delay(time_step_ms);
+		/* sleep until the next packet has been received */
+		WE_WaitForEvent(&rxPacketReceived, (uint32_t) max_time_ms - elapsed);
 	}
-	return true;
 }
 
 /**
@@ -345,6 +347,57 @@ static void FillChecksum(TarvosIII_CMD_Frame_t *cmd)
 	cmd->Data[cmd->Length] = checksum;
 }
 
+/**
+ * @brief Sends the request prepared in txPacket, followed by the user payload.
+ *
+ * txPacket.Cmd and the first paramLength bytes of txPacket.Data (e.g. destination
+ * address) must have been set by the caller. If the UART supports gather transmit
+ * (uartTransmitV), the payload is sent directly from the caller's buffer, otherwise
+ * it is copied to txPacket.
+ *
+ * @param[in] paramLength    Number of parameter bytes in txPacket.Data preceding the payload
+ * @param[in] payloadP       Pointer to the payload
+ * @param[in] payloadLength  Length of the payload
+ *
+ * @return true if transmission succeeded,
+ *         false otherwise
+ */
+static bool TransmitRequestWithPayload(uint8_t paramLength, const uint8_t *payloadP, uint8_t payloadLength)
+{
+	txPacket.Length = paramLength + payloadLength;
+
+	if (TarvosIII_uartP->uartTransmitV == NULL)
+	{
+		memcpy(&txPacket.Data[paramLength], payloadP, payloadLength);
+		FillChecksum(&txPacket);
+		return TarvosIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD);
+	}
+
+	/* Checksum covers header, parameters and payload */
+	uint8_t checksum = (uint8_t) txPacket.Stx;
+	uint8_t *pArray = (uint8_t*) &txPacket;
+	for (uint16_t i = 1; i < (paramLength + LENGTH_CMD_OVERHEAD_WITHOUT_CRC ); i++)
+	{
+		checksum ^= pArray[i];
+	}
+	for (uint16_t i = 0; i < payloadLength; i++)
+	{
+		checksum ^= payloadP[i];
+	}
+
+	WE_UART_Segment_t segments[] = {
+			{
+					.data = pArray,
+					.length = paramLength + LENGTH_CMD_OVERHEAD_WITHOUT_CRC },
+			{
+					.data = payloadP,
+					.length = payloadLength },
+			{
+					.data = &checksum,
+					.length = 1 } };
+	return TarvosIII_uartP->uartTransmitV(segments, sizeof(segments) / sizeof(segments[0]));
+}
+
 void TarvosIII_HandleRxByte(uint8_t *dataP, size_t size)
 {
 	for (; size > 0; size--, dataP++)
@@ -392,6 +445,7 @@ void TarvosIII_HandleRxByte(uint8_t *dataP, size_t size)
 				{
 					/* received frame ok, interpret it now */
 					HandleRxPacket(rxBuffer);
+					rxPacketReceived = true;
 				}
 
 				rxByteCounter = 0;
@@ -763,13 +817,9 @@ bool TarvosIII_Set(TarvosIII_UserSettings_t us, uint8_t *value, uint8_t length)
 	}
 
 	txPacket.Cmd = TARVOSIII_CMD_SET_REQ;
-	txPacket.Length = (1 + length);
 	txPacket.Data[0] = us;
-	memcpy(&txPacket.Data[1], value, length);
-
-	FillChecksum(&txPacket);
 
-	if (!TarvosIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(1, value, length))
 	{
 		return false;
 	}
@@ -1411,12 +1461,7 @@ bool TarvosIII_Transmit(uint8_t *payload, uint8_t length)
 	}
 
 	txPacket.Cmd = TARVOSIII_CMD_DATA_REQ;
-	txPacket.Length = length;
-	memcpy(&txPacket.Data[0], payload, length);
-
-	FillChecksum(&txPacket);
-
-	if (!TarvosIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(0, payload, length))
 	{
 		return false;
 	}
@@ -1451,45 +1496,43 @@ bool TarvosIII_Transmit_Extended(uint8_t *payload, uint8_t length, uint8_t chann
 		return false;
 	}
 
+	uint8_t paramLength;
+
 	txPacket.Cmd = TARVOSIII_CMD_DATAEX_REQ;
 
 	switch (addressmode)
 	{
 	case TarvosIII_AddressMode_0:
 	{
-		txPacket.Length = (length + 1);
+		paramLength = 1;
 		txPacket.Data[0] = channel;
-		memcpy(&txPacket.Data[1], payload, length);
 	}
 		break;
 
 	case TarvosIII_AddressMode_1:
 	{
-		txPacket.Length = (length + 2);
+		paramLength = 2;
 		txPacket.Data[0] = channel;
 		txPacket.Data[1] = dest_address_lsb;
-		memcpy(&txPacket.Data[2], payload, length);
 	}
 		break;
 
 	case TarvosIII_AddressMode_2:
 	{
-		txPacket.Length = (length + 3);
+		paramLength = 3;
 		txPacket.Data[0] = channel;
 		txPacket.Data[1] = dest_network_id;
 		txPacket.Data[2] = dest_address_lsb;
-		memcpy(&txPacket.Data[3], payload, length);
 	}
 		break;
 
 	case TarvosIII_AddressMode_3:
 	{
-		txPacket.Length = (length + 4);
+		paramLength = 4;
 		txPacket.Data[0] = channel;
 		txPacket.Data[1] = dest_network_id;
 		txPacket.Data[2] = dest_address_lsb;
 		txPacket.Data[3] = dest_address_msb;
-		memcpy(&txPacket.Data[4], payload, length);
 	}
 		break;
 
@@ -1498,9 +1541,7 @@ bool TarvosIII_Transmit_Extended(uint8_t *payload, uint8_t length, uint8_t chann
 		return false;
 	}
 
-	FillChecksum(&txPacket);
-
-	if (!TarvosIII_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(paramLength, payload, length))
 	{
 		return false;
 	}
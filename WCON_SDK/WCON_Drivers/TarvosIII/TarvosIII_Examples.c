@@ -95,6 +95,7 @@ void TarvosIII_Examples(void)
 	TarvosIII_uart.uartInit = WE_UART1_Init;
 	TarvosIII_uart.uartDeinit = WE_UART1_DeInit;
 	TarvosIII_uart.uartTransmit = WE_UART1_Transmit;
+	TarvosIII_uart.uartTransmitV = WE_UART1_TransmitV;
 
 	CommandModeExample();
 }
@@ -156,6 +156,7 @@ static TelestoIII_CMD_Frame_t txPacket = {
 
 #define CMDCONFIRMATIONARRAY_LENGTH 2
 static TelestoIII_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static volatile bool rxPacketReceived = false; /* set when a valid packet has been received, used to wake up Wait4CNF() */
 static uint8_t channelVolatile = CHANNELINVALID; /* variable used to check if setting the channel was successful */
 static uint8_t powerVolatile = TXPOWERINVALID; /* variable used to check if setting the TXPower was successful */
 static TelestoIII_AddressMode_t addressmode = TelestoIII_AddressMode_0; /* initial address mode */
@@ -295,9 +296,7 @@ static void HandleRxPacket(uint8_t *rxBuffer)
  */
 static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, TelestoIII_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-	int count = 0;
-	int time_step_ms = 5; /* 5ms */
-	int max_count = max_time_ms / time_step_ms;
+	uint32_t t0 = WE_GetTick();
 
 	if (reset_confirmstate)
 	{
@@ -306,8 +305,12 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, TelestoII
 			cmdConfirmation_array[i].cmd = CNFINVALID;
 		}
 	}
+
 	while (1)
 	{
+		/* reset flag before checking, so that a packet received in the meantime is not missed */
+		rxPacketReceived = false;
+
 		for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
 		{
 			if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
@@ -316,17 +319,16 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, TelestoII
 			}
 		}
 
-		if (count >= max_count)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= (uint32_t) max_time_ms)
 		{
 			/* received no correct response within timeout */
 			return false;
 		}
 
-		/* wait */
-		count++;
-		WE_Delay(time_step_ms);
+		/* sleep until the next packet has been received */
+		WE_WaitForEvent(&rxPacketReceived, (uint32_t) max_time_ms - elapsed);
 	}
-	return true;
 }
 
 /**
@@ -392,6 +394,7 @@ void TelestoIII_HandleRxByte(uint8_t *dataP, size_t size)
 				{
 					/* received frame ok, interpret it now */
 					HandleRxPacket(rxBuffer);
+					rxPacketReceived = true;
 				}
 
 				rxByteCounter = 0;
@@ -34,7 +34,6 @@
 #include <stdio.h>
 
 #define CMD_WAIT_TIME 1500
-#define CMD_WAIT_TIME_STEP_MS 0
 #define CNFINVALID 255
 
 /* Normal overhead: Start signal + Command + Length + CS = 1+1+2+1=5 bytes */
@@ -182,6 +181,7 @@ static ThyoneE_CMD_Frame_t rxPacket = {
 
 #define CMDCONFIRMATIONARRAY_LENGTH 3
 static ThyoneE_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static volatile bool rxPacketReceived = false; /* set when a valid packet has been received, used to wake up Wait4CNF() */
 /**
  * @brief Pin configuration struct pointer.
  */
@@ -306,8 +306,12 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, ThyoneE_C
 			cmdConfirmation_array[i].cmd = CNFINVALID;
 		}
 	}
+
 	while (1)
 	{
+		/* reset flag before checking, so that a packet received in the meantime is not missed */
+		rxPacketReceived = false;
+
 		for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
 		{
 			if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
@@ -316,20 +320,16 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, ThyoneE_C
 			}
 		}
 
-		uint32_t now = WE_GetTick();
-		if (now - t0 > max_time_ms)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= (uint32_t) max_time_ms)
 		{
 			/* received no correct response within timeout */
 			return false;
 		}
 
-		if (CMD_WAIT_TIME_STEP_MS > 0)
-		{
-			/* wait */
-			WE_Delay(CMD_WAIT_TIME_STEP_MS);
-		}
+		/* sleep until the next packet has been received */
+		WE_WaitForEvent(&rxPacketReceived, (uint32_t) max_time_ms - elapsed);
 	}
-	return true;
 }
 
 /**
@@ -399,6 +399,7 @@ void ThyoneE_HandleRxByte(uint8_t *dataP, size_t size)
 				{
 					/* received frame ok, interpret it now */
 					HandleRxPacket(rxBuffer);
+					rxPacketReceived = true;
 				}
 
 				rxByteCounter = 0;
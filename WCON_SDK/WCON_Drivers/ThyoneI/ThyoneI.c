@@ -34,7 +34,6 @@
 #include <stdio.h>
 
 #define CMD_WAIT_TIME 1500
-#define CMD_WAIT_TIME_STEP_MS 0
 #define CNFINVALID 255
 
 /* Normal overhead: Start signal + Command + Length + CS = 1+1+2+1=5 bytes */
@@ -182,6 +181,7 @@ static ThyoneI_CMD_Frame_t rxPacket = {
 
 #define CMDCONFIRMATIONARRAY_LENGTH 3
 static ThyoneI_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static volatile bool rxPacketReceived = false; /* set when a valid packet has been received, used to wake up Wait4CNF() */
 /**
  * @brief Pin configuration struct pointer.
  */
@@ -306,8 +306,12 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, ThyoneI_C
 			cmdConfirmation_array[i].cmd = CNFINVALID;
 		}
 	}
+
 	while (1)
 	{
+		/* reset flag before checking, so that a packet received in the meantime is not missed */
+		rxPacketReceived = false;
+
 		for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
 		{
 			if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
@@ -316,20 +320,16 @@ static bool Wait4CNF(int max_time_ms, uint8_t expectedCmdConfirmation, ThyoneI_C
 			}
 		}
 
-		uint32_t now = WE_GetTick();
-		if (now - t0 > max_time_ms)
+		uint32_t elapsed = WE_GetTick() - t0;
+		if (elapsed >= (uint32_t) max_time_ms)
 		{
 			/* received no correct response within timeout */
 			return false;
 		}
 
-		if (CMD_WAIT_TIME_STEP_MS > 0)
-		{
-			/* wait */
-			WE_Delay(CMD_WAIT_TIME_STEP_MS);
-		}
+		/* sleep until the next packet has been received */
+		WE_WaitForEvent(&rxPacketReceived, (uint32_t) max_time_ms - elapsed);
 	}
-	return true;
 }
 
 /**
@@ -346,6 +346,57 @@ static void FillChecksum(ThyoneI_CMD_Frame_t *cmd)
 	cmd->Data[cmd->Length] = checksum;
 }
 
+/**
+ * @brief Sends the request prepared in txPacket, followed by the user payload.
+ *
+ * txPacket.Cmd and the first paramLength bytes of txPacket.Data (e.g. destination
+ * address) must have been set by the caller. If the UART supports gather transmit
+ * (uartTransmitV), the payload is sent directly from the caller's buffer, otherwise
+ * it is copied to txPacket.
+ *
+ * @param[in] paramLength    Number of parameter bytes in txPacket.Data preceding the payload
+ * @param[in] payloadP       Pointer to the payload
+ * @param[in] payloadLength  Length of the payload
+ *
+ * @return true if transmission succeeded,
+ *         false otherwise
+ */
+static bool TransmitRequestWithPayload(uint16_t paramLength, const uint8_t *payloadP, uint16_t payloadLength)
+{
+	txPacket.Length = paramLength + payloadLength;
+
+	if (ThyoneI_uartP->uartTransmitV == NULL)
+	{
+		memcpy(&txPacket.Data[paramLength], payloadP, payloadLength);
+		FillChecksum(&txPacket);
+		return ThyoneI_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD);
+	}
+
+	/* Checksum covers header, parameters and payload */
+	uint8_t checksum = (uint8_t) txPacket.Stx;
+	uint8_t *pArray = (uint8_t*) &txPacket;
+	for (uint16_t i = 1; i < (paramLength + LENGTH_CMD_OVERHEAD_WITHOUT_CRC ); i++)
+	{
+		checksum ^= pArray[i];
+	}
+	for (uint16_t i = 0; i < payloadLength; i++)
+	{
+		checksum ^= payloadP[i];
+	}
+
+	WE_UART_Segment_t segments[] = {
+			{
+					.data = pArray,
+					.length = paramLength + LENGTH_CMD_OVERHEAD_WITHOUT_CRC },
+			{
+					.data = payloadP,
+					.length = payloadLength },
+			{
+					.data = &checksum,
+					.length = 1 } };
+	return ThyoneI_uartP->uartTransmitV(segments, sizeof(segments) / sizeof(segments[0]));
+}
+
 void ThyoneI_HandleRxByte(uint8_t *dataP, size_t size)
 {
 	for (; size > 0; size--, dataP++)
@@ -399,6 +450,7 @@ void ThyoneI_HandleRxByte(uint8_t *dataP, size_t size)
 				{
 					/* received frame ok, interpret it now */
 					HandleRxPacket(rxBuffer);
+					rxPacketReceived = true;
 				}
 
 				rxByteCounter = 0;
@@ -649,13 +701,7 @@ bool ThyoneI_TransmitBroadcast(uint8_t *payloadP, uint16_t length)
 	}
 
 	txPacket.Cmd = THYONEI_CMD_BROADCAST_DATA_REQ;
-	txPacket.Length = length;
-
-	memcpy(&txPacket.Data[0], payloadP, length);
-
-	FillChecksum(&txPacket);
-
-	if (!ThyoneI_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(0, payloadP, length))
 	{
 		return false;
 	}
@@ -685,13 +731,7 @@ bool ThyoneI_TransmitMulticast(uint8_t *payloadP, uint16_t length)
 	}
 
 	txPacket.Cmd = THYONEI_CMD_MULTICAST_DATA_REQ;
-	txPacket.Length = length;
-
-	memcpy(&txPacket.Data[0], payloadP, length);
-
-	FillChecksum(&txPacket);
-
-	if (!ThyoneI_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(0, payloadP, length))
 	{
 		return false;
 	}
@@ -721,13 +761,7 @@ bool ThyoneI_TransmitUnicast(uint8_t *payloadP, uint16_t length)
 	}
 
 	txPacket.Cmd = THYONEI_CMD_UNICAST_DATA_REQ;
-	txPacket.Length = length;
-
-	memcpy(&txPacket.Data[0], payloadP, length);
-
-	FillChecksum(&txPacket);
-
-	if (!ThyoneI_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(0, payloadP, length))
 	{
 		return false;
 	}
@@ -758,14 +792,9 @@ bool ThyoneI_TransmitMulticastExtended(uint8_t groupID, uint8_t *payloadP, uint1
 	}
 
 	txPacket.Cmd = THYONEI_CMD_MULTICAST_DATA_EX_REQ;
-	txPacket.Length = length + 1;
 	txPacket.Data[0] = groupID;
 
-	memcpy(&txPacket.Data[1], payloadP, length);
-
-	FillChecksum(&txPacket);
-
-	if (!ThyoneI_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(1, payloadP, length))
 	{
 		return false;
 	}
@@ -796,14 +825,10 @@ bool ThyoneI_TransmitUnicastExtended(uint32_t address, uint8_t *payloadP, uint16
 	}
 
 	txPacket.Cmd = THYONEI_CMD_UNICAST_DATA_EX_REQ;
-	txPacket.Length = length + 4;
 
 	memcpy(&txPacket.Data[0], &address, 4);
-	memcpy(&txPacket.Data[4], payloadP, length);
-
-	FillChecksum(&txPacket);
 
-	if (!ThyoneI_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(4, payloadP, length))
 	{
 		return false;
 	}
@@ -897,13 +922,9 @@ bool ThyoneI_Set(ThyoneI_UserSettings_t userSetting, uint8_t *ValueP, uint8_t le
 	}
 
 	txPacket.Cmd = THYONEI_CMD_SET_REQ;
-	txPacket.Length = 1 + length;
 	txPacket.Data[0] = userSetting;
-	memcpy(&txPacket.Data[1], ValueP, length);
-
-	FillChecksum(&txPacket);
 
-	if (!ThyoneI_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(1, ValueP, length))
 	{
 		return false;
 	}
@@ -1783,13 +1804,9 @@ bool ThyoneI_GPIOLocalRead(uint8_t *GPIOToReadP, uint8_t amountGPIOToRead, Thyon
 	}
 
 	txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_READ_REQ;
-	txPacket.Length = amountGPIOToRead + 1;
 	txPacket.Data[0] = amountGPIOToRead;
-	memcpy(&txPacket.Data[1], GPIOToReadP, amountGPIOToRead);
 
-	FillChecksum(&txPacket);
-
-	if (!ThyoneI_Transparent_Transmit((uint8_t*) &txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+	if (!TransmitRequestWithPayload(1, GPIOToReadP, amountGPIOToRead))
 	{
 		return false;
 	}
@@ -200,6 +200,7 @@ void ThyoneI_Examples(void)
 	ThyoneI_uart.uartInit = WE_UART1_Init;
 	ThyoneI_uart.uartDeinit = WE_UART1_DeInit;
 	ThyoneI_uart.uartTransmit = WE_UART1_Transmit;
+	ThyoneI_uart.uartTransmitV = WE_UART1_TransmitV;
 
 	Example_CommandMode_DataTransmission();
 	//Example_TransparentMode_DataTransmission();
@@ -29,15 +29,107 @@
  */
 
 #include <global/ATCommands.h>
-#include <stdio.h>
-#include <stdlib.h>
-
-char AT_commandBuffer[AT_MAX_COMMAND_BUFFER_SIZE];
+#include <ctype.h>
 
 static const char *ATCommand_BooleanValueStrings[ATCommand_BooleanValue_NumberOfValues] = {
 		"false",
 		"true" };
 
+static const char ATCommand_HexDigits[] = "0123456789abcdef";
+
+static const char ATCommand_HexDigitsUpperCase[] = "0123456789ABCDEF";
+
+/* Values of hex digit characters, 0xFF for characters that are no hex digits */
+static const uint8_t ATCommand_HexDigitValues[256] = {
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+/* Pairs of decimal digits 00..99, used for converting two digits at a time */
+static const char ATCommand_DecimalDigitPairs[] =
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899";
+
+/* Powers of ten that are exactly representable as double */
+static const double ATCommand_PowersOf10[] = {
+		1e0,
+		1e1,
+		1e2,
+		1e3,
+		1e4,
+		1e5,
+		1e6,
+		1e7,
+		1e8,
+		1e9,
+		1e10,
+		1e11,
+		1e12,
+		1e13,
+		1e14,
+		1e15,
+		1e16,
+		1e17,
+		1e18,
+		1e19,
+		1e20,
+		1e21,
+		1e22 };
+
+#define ATCOMMAND_MAX_EXACT_POWER_OF_10 ((int32_t) (sizeof(ATCommand_PowersOf10) / sizeof(ATCommand_PowersOf10[0])) - 1)
+
+/**
+ * @brief Writes the decimal digits of a 32 bit value right-aligned into a buffer.
+ *
+ * @param[in] pEnd End of buffer (first character after the digits)
+ * @param[in] number Value to convert
+ *
+ * @return Pointer to the first digit
+ */
+static char* ATCommand_FormatDecimal32(char *pEnd, uint32_t number)
+{
+	while (number >= 100)
+	{
+		uint32_t pair = number % 100;
+		number /= 100;
+		pEnd -= 2;
+		memcpy(pEnd, &ATCommand_DecimalDigitPairs[2 * pair], 2);
+	}
+
+	if (number >= 10)
+	{
+		pEnd -= 2;
+		memcpy(pEnd, &ATCommand_DecimalDigitPairs[2 * number], 2);
+	}
+	else
+	{
+		*(--pEnd) = (char) ('0' + number);
+	}
+
+	return pEnd;
+}
+
 /**
  * @brief Converts an integer to string.
  *
@@ -49,32 +141,237 @@ static const char *ATCommand_BooleanValueStrings[ATCommand_BooleanValue_NumberOf
  */
 bool ATCommand_IntToString(char *outString, uint32_t number, uint16_t intFlags)
 {
-	if ((0 == (intFlags & ATCOMMAND_INTFLAGS_SIGN )) || (0 == (intFlags & ATCOMMAND_INTFLAGS_NOTATION )))
+	if ((ATCOMMAND_INTFLAGS_SIGNED == (intFlags & ATCOMMAND_INTFLAGS_SIGN )) && (ATCOMMAND_INTFLAGS_NOTATION_DEC == (intFlags & ATCOMMAND_INTFLAGS_NOTATION )))
+	{
+		/* sign extend, so that negative values are converted correctly (hex numbers are
+		 * formatted as 32 bit two's complement) */
+		return ATCommand_Int64ToString(outString, (uint64_t) (int64_t) (int32_t) number, intFlags);
+	}
+
+	return ATCommand_Int64ToString(outString, number, intFlags);
+}
+
+/**
+ * @brief Converts a 64 bit integer to string.
+ *
+ * Hexadecimal numbers are prefixed with "0x". The output buffer needs to have
+ * room for at least 21 characters (including termination character).
+ *
+ * @param[out] outString Number converted to string
+ * @param[in] number Integer value to convert to string
+ * @param[in] intFlags Formatting flags
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_Int64ToString(char *outString, uint64_t number, uint16_t intFlags)
+{
+	if ((NULL == outString) || (0 == (intFlags & ATCOMMAND_INTFLAGS_SIGN )) || (0 == (intFlags & ATCOMMAND_INTFLAGS_NOTATION )))
 	{
 		return false;
 	}
 
+	/* digits are written right-aligned into a temporary buffer */
+	char digits[20];
+	char *pEnd = &digits[sizeof(digits)];
+	char *pStart = pEnd;
+
 	if (ATCOMMAND_INTFLAGS_NOTATION_HEX == (intFlags & ATCOMMAND_INTFLAGS_NOTATION ))
 	{
 		/* HEX */
-		sprintf(outString, "0x%lx", number);
+		*outString++ = '0';
+		*outString++ = 'x';
+		do
+		{
+			*(--pStart) = ATCommand_HexDigits[number & 0x0F];
+			number >>= 4;
+		} while (number != 0);
 	}
 	else
 	{
 		/* DEC */
+		if ((ATCOMMAND_INTFLAGS_SIGNED == (intFlags & ATCOMMAND_INTFLAGS_SIGN )) && ((int64_t) number < 0))
+		{
+			*outString++ = '-';
+			number = 0 - number;
+		}
+
+		if (number > UINT32_MAX)
+		{
+			/* split off the lower 9 digits, so that only the upper part requires 64 bit division */
+			while (number > UINT32_MAX)
+			{
+				uint32_t lower = (uint32_t) (number % 1000000000);
+				number /= 1000000000;
+				char *pLower = ATCommand_FormatDecimal32(pStart, lower);
+				while (pLower > pStart - 9)
+				{
+					*(--pLower) = '0';
+				}
+				pStart = pLower;
+			}
+		}
+		pStart = ATCommand_FormatDecimal32(pStart, (uint32_t) number);
+	}
+
+	size_t length = pEnd - pStart;
+	memcpy(outString, pStart, length);
+	outString[length] = ATCOMMAND_STRING_TERMINATE;
+
+	return true;
+}
+
+/**
+ * @brief Parses an argument span containing a decimal floating point number.
+ *
+ * Accepts optional leading white space, an optional sign, digits with an optional
+ * decimal point and an optional exponent ("e" or "E"). The first 19 significant digits
+ * are accumulated as integer, which is then scaled using exactly representable powers
+ * of ten. The result is correctly rounded (i.e. equal to the result of strtod()) for up
+ * to 15 significant digits, if the power of ten to be applied to these digits is within
+ * +-22. This covers the values reported by the radio modules. With up to 19 significant
+ * digits, the result may be off by one unit in the last place, further digits are
+ * truncated and may add another unit in the last place. Larger powers of ten are
+ * applied in steps of 10^22, each of which may add another half unit in the last place
+ * (up to about 6 units near the limits of the double range). Subnormal results may be
+ * less accurate.
+ *
+ * @param[out] pOut Parsed value
+ * @param[in] span Argument to be parsed
+ *
+ * @return true if successful, false otherwise
+ */
+static bool ATCommand_SpanToDecimal(double *pOut, ATCommand_Span_t span)
+{
+	if (NULL == span.data)
+	{
+		return false;
+	}
+
+	const char *pIn = span.data;
+	const char *pEnd = span.data + span.length;
+
+	while ((pIn < pEnd) && isspace((unsigned char ) *pIn))
+	{
+		pIn++;
+	}
+
+	bool negative = false;
+	if ((pIn < pEnd) && ((*pIn == '-') || (*pIn == '+')))
+	{
+		negative = (*pIn == '-');
+		pIn++;
+	}
+
+	uint64_t mantissa = 0;
+	uint8_t significantDigits = 0;
+	int32_t exponent = 0;
+	bool hasDigits = false;
+	bool fraction = false;
+
+	for (; pIn < pEnd; pIn++)
+	{
+		if ((*pIn == '.') && !fraction)
+		{
+			fraction = true;
+			continue;
+		}
+		if ((*pIn < '0') || (*pIn > '9'))
+		{
+			break;
+		}
 
-		if (ATCOMMAND_INTFLAGS_UNSIGNED == (intFlags & ATCOMMAND_INTFLAGS_SIGN ))
+		hasDigits = true;
+		if (significantDigits < 19)
 		{
-			/* UNSIGNED */
-			sprintf(outString, "%lu", number);
+			mantissa = mantissa * 10 + (uint8_t) (*pIn - '0');
+			if (mantissa != 0)
+			{
+				significantDigits++;
+			}
+			if (fraction)
+			{
+				exponent--;
+			}
 		}
 		else
 		{
-			/* SIGNED */
-			sprintf(outString, "%ld", *(int32_t*) &number);
+			if ((significantDigits == 19) && (*pIn >= '5'))
+			{
+				/* round using the first dropped digit */
+				mantissa++;
+				significantDigits++;
+			}
+			if (!fraction)
+			{
+				/* digit is dropped, but its magnitude counts */
+				exponent++;
+			}
 		}
 	}
 
+	if (!hasDigits)
+	{
+		return false;
+	}
+
+	if ((pIn < pEnd) && ((*pIn == 'e') || (*pIn == 'E')))
+	{
+		pIn++;
+
+		bool negativeExponent = false;
+		if ((pIn < pEnd) && ((*pIn == '-') || (*pIn == '+')))
+		{
+			negativeExponent = (*pIn == '-');
+			pIn++;
+		}
+
+		if ((pIn == pEnd) || (*pIn < '0') || (*pIn > '9'))
+		{
+			return false;
+		}
+
+		int32_t exponentValue = 0;
+		for (; (pIn < pEnd) && (*pIn >= '0') && (*pIn <= '9'); pIn++)
+		{
+			/* values beyond this limit over-/underflow anyway */
+			if (exponentValue < 10000)
+			{
+				exponentValue = exponentValue * 10 + (*pIn - '0');
+			}
+		}
+		exponent += negativeExponent ? -exponentValue : exponentValue;
+	}
+
+	if (pIn != pEnd)
+	{
+		return false;
+	}
+
+	double value = (double) mantissa;
+	if (mantissa != 0)
+	{
+		while (exponent > ATCOMMAND_MAX_EXACT_POWER_OF_10)
+		{
+			value *= ATCommand_PowersOf10[ATCOMMAND_MAX_EXACT_POWER_OF_10];
+			exponent -= ATCOMMAND_MAX_EXACT_POWER_OF_10;
+		}
+		while (exponent < -ATCOMMAND_MAX_EXACT_POWER_OF_10)
+		{
+			value /= ATCommand_PowersOf10[ATCOMMAND_MAX_EXACT_POWER_OF_10];
+			exponent += ATCOMMAND_MAX_EXACT_POWER_OF_10;
+		}
+		if (exponent >= 0)
+		{
+			value *= ATCommand_PowersOf10[exponent];
+		}
+		else
+		{
+			value /= ATCommand_PowersOf10[-exponent];
+		}
+	}
+
+	*pOut = negative ? -value : value;
+
 	return true;
 }
 
@@ -94,222 +391,799 @@ bool ATCommand_StringToInt(void *number, const char *inString, uint16_t intFlags
 		return false;
 	}
 
-	bool hex = (0 == strncmp(inString, "0x", 2)) || ((intFlags & ATCOMMAND_INTFLAGS_NOTATION_HEX ) != 0);
-	bool signedDataType = (intFlags & ATCOMMAND_INTFLAGS_SIGNED ) != 0;
+	ATCommand_Span_t span = {
+			.data = inString,
+			.length = strlen(inString) };
+	return ATCommand_SpanToInt(number, span, intFlags);
+}
+
+/**
+ * @brief Parses an argument span to integer
+ *
+ * Accepts the same input as ATCommand_StringToInt() (optional leading white space and sign,
+ * hexadecimal numbers with or without "0x" prefix), but doesn't require the argument to
+ * be null-terminated.
+ *
+ * @param[out] pOutInt Parsed integer value
+ * @param[in] span Argument to be parsed
+ * @param[in] intFlags Flags to determine how to parse
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_SpanToInt(void *pOutInt, ATCommand_Span_t span, uint16_t intFlags)
+{
+	if ((NULL == span.data) || (NULL == pOutInt))
+	{
+		return false;
+	}
+
+	const char *pIn = span.data;
+	const char *pEnd = span.data + span.length;
+
+	bool hex = ((span.length >= 2) && (0 == strncmp(pIn, "0x", 2))) || ((intFlags & ATCOMMAND_INTFLAGS_NOTATION_HEX ) != 0);
+
+	while ((pIn < pEnd) && isspace((unsigned char ) *pIn))
+	{
+		pIn++;
+	}
+
+	bool negative = false;
+	if ((pIn < pEnd) && ((*pIn == '-') || (*pIn == '+')))
+	{
+		negative = (*pIn == '-');
+		pIn++;
+	}
 
-	if (signedDataType)
+	if (hex && (pEnd - pIn >= 2) && (pIn[0] == '0') && ((pIn[1] == 'x') || (pIn[1] == 'X')))
 	{
-		char *endptr;
+		pIn += 2;
+	}
 
-		long long longNr = strtoll(inString, &endptr, (hex == true) ? 16 : 10);
+	if (pIn == pEnd)
+	{
+		/* No digits */
+		return false;
+	}
 
-		if (endptr == inString || *endptr != ATCOMMAND_STRING_TERMINATE)
+	uint64_t value = 0;
+	for (; pIn < pEnd; pIn++)
+	{
+		uint8_t digit;
+		if ((*pIn >= '0') && (*pIn <= '9'))
 		{
-			/* endptr did not move to end, thus conversion failed */
-			return false;
+			digit = *pIn - '0';
 		}
-
-		if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8 ) != 0)
+		else if (hex && (*pIn >= 'a') && (*pIn <= 'f'))
+		{
+			digit = *pIn - 'a' + 10;
+		}
+		else if (hex && (*pIn >= 'A') && (*pIn <= 'F'))
 		{
-			*((int8_t*) number) = longNr;
+			digit = *pIn - 'A' + 10;
 		}
-		else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE16 ) != 0)
+		else
 		{
-			*((int16_t*) number) = longNr;
+			return false;
 		}
-		else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE32 ) != 0)
+		value = value * (hex ? 16 : 10) + digit;
+	}
+
+	if (negative)
+	{
+		value = 0 - value;
+	}
+
+	if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8 ) != 0)
+	{
+		*((uint8_t*) pOutInt) = (uint8_t) value;
+	}
+	else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE16 ) != 0)
+	{
+		*((uint16_t*) pOutInt) = (uint16_t) value;
+	}
+	else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE32 ) != 0)
+	{
+		*((uint32_t*) pOutInt) = (uint32_t) value;
+	}
+	else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE64 ) != 0)
+	{
+		*((uint64_t*) pOutInt) = value;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Appends an argument to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pInArgument Argument to be added (may be NULL)
+ * @param[in] argumentLength Number of bytes to add
+ * @param[in] quotationMarks Embed argument into quotation marks (ignored if pInArgument is NULL)
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+static bool ATCommand_BuilderAppend(ATCommand_Builder_t *pBuilder, const char *pInArgument, size_t argumentLength, bool quotationMarks, char delimiter)
+{
+	if ((NULL == pBuilder) || pBuilder->overflow)
+	{
+		return false;
+	}
+
+	if (NULL == pInArgument)
+	{
+		argumentLength = 0;
+		quotationMarks = false;
+	}
+
+	size_t requiredLength = argumentLength + (quotationMarks ? 2 : 0) + ((delimiter != ATCOMMAND_STRING_TERMINATE) ? 1 : 0);
+	if (requiredLength >= (size_t) (pBuilder->capacity - pBuilder->length))
+	{
+		/* Argument and termination character don't fit into the buffer */
+		pBuilder->overflow = true;
+		return false;
+	}
+
+	char *pOut = &pBuilder->buffer[pBuilder->length];
+	if (quotationMarks)
+	{
+		*pOut++ = '\"';
+	}
+	if (argumentLength > 0)
+	{
+		memcpy(pOut, pInArgument, argumentLength);
+		pOut += argumentLength;
+	}
+	if (quotationMarks)
+	{
+		*pOut++ = '\"';
+	}
+	if (delimiter != ATCOMMAND_STRING_TERMINATE)
+	{
+		*pOut++ = delimiter;
+	}
+	*pOut = ATCOMMAND_STRING_TERMINATE;
+
+	pBuilder->length = (uint16_t) (pOut - pBuilder->buffer);
+	return true;
+}
+
+/**
+ * @brief Attaches a temporary builder to an existing (null-terminated) command.
+ *
+ * Used by the ATCommand_AppendArgument*() functions, which don't know the size of
+ * the command buffer.
+ *
+ * @param[out] pBuilder Builder to initialize
+ * @param[in] pOutString Command to append arguments to
+ *
+ * @return true if successful, false otherwise
+ */
+static bool ATCommand_BuilderAttach(ATCommand_Builder_t *pBuilder, char *pOutString)
+{
+	if (NULL == pOutString)
+	{
+		return false;
+	}
+
+	pBuilder->buffer = pOutString;
+	pBuilder->length = (uint16_t) strlen(pOutString);
+	pBuilder->capacity = UINT16_MAX;
+	pBuilder->overflow = false;
+	return true;
+}
+
+/**
+ * @brief Initializes a builder for assembling an AT command.
+ *
+ * @param[out] pBuilder Builder to initialize
+ * @param[in] pBuffer Buffer to assemble the command in (e.g. the driver's command buffer or a buffer supplied by the caller)
+ * @param[in] capacity Size of buffer (including termination character)
+ * @param[in] pCommand Initial content of the command, e.g. "AT+socket=". Optional (may be NULL).
+ */
+void ATCommand_BuilderInit(ATCommand_Builder_t *pBuilder, char *pBuffer, uint16_t capacity, const char *pCommand)
+{
+	pBuilder->buffer = pBuffer;
+	pBuilder->length = 0;
+	pBuilder->capacity = capacity;
+	pBuilder->overflow = (0 == capacity);
+
+	if (!pBuilder->overflow)
+	{
+		pBuffer[0] = ATCOMMAND_STRING_TERMINATE;
+		if (NULL != pCommand)
 		{
-			*((int32_t*) number) = longNr;
+			ATCommand_BuilderAppend(pBuilder, pCommand, strlen(pCommand), false, ATCOMMAND_STRING_TERMINATE);
 		}
-		else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE64 ) != 0)
+	}
+}
+
+/**
+ * @brief Converts a string of hex digits to bytes.
+ *
+ * Upper and lower case digits are accepted. The output may point to the input string,
+ * i.e. the conversion may be done in place.
+ *
+ * @param[out] pOutBytes Converted bytes
+ * @param[in] pInHex Hex string (two digits per byte, without prefix)
+ * @param[in] numBytes Number of bytes to convert
+ *
+ * @return true if successful, false if the input contains characters that are no hex digits
+ */
+bool ATCommand_HexToBytes(uint8_t *pOutBytes, const char *pInHex, uint16_t numBytes)
+{
+	if ((NULL == pOutBytes) || (NULL == pInHex))
+	{
+		return false;
+	}
+
+	for (uint16_t i = 0; i < numBytes; i++)
+	{
+		uint8_t high = ATCommand_HexDigitValues[(uint8_t) pInHex[2 * i]];
+		uint8_t low = ATCommand_HexDigitValues[(uint8_t) pInHex[2 * i + 1]];
+		if ((high | low) & 0xF0)
 		{
-			*((int64_t*) number) = longNr;
+			return false;
 		}
+		pOutBytes[i] = (uint8_t) ((high << 4) | low);
 	}
-	else
+	return true;
+}
+
+/**
+ * @brief Converts bytes to a string of (upper case) hex digits.
+ *
+ * Two digits are written per byte, no termination character is appended.
+ *
+ * @param[out] pOutHex Hex string (must provide space for 2 * numBytes characters)
+ * @param[in] pInBytes Bytes to convert
+ * @param[in] numBytes Number of bytes to convert
+ */
+void ATCommand_BytesToHex(char *pOutHex, const uint8_t *pInBytes, uint16_t numBytes)
+{
+	for (uint16_t i = 0; i < numBytes; i++)
+	{
+		uint8_t value = pInBytes[i];
+		*pOutHex++ = ATCommand_HexDigitsUpperCase[value >> 4];
+		*pOutHex++ = ATCommand_HexDigitsUpperCase[value & 0x0F];
+	}
+}
+
+/**
+ * @brief Appends a byte array argument to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pInArgument Pointer to byte array to be added
+ * @param[in] numBytes Number of bytes to add
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentBytes(ATCommand_Builder_t *pBuilder, const char *pInArgument, uint16_t numBytes, char delimiter)
+{
+	return ATCommand_BuilderAppend(pBuilder, pInArgument, numBytes, false, delimiter);
+}
+
+/**
+ * @brief Appends a byte array argument in hex representation (two upper case digits per byte) to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pInBytes Pointer to byte array to be added
+ * @param[in] numBytes Number of bytes to add
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentHex(ATCommand_Builder_t *pBuilder, const uint8_t *pInBytes, uint16_t numBytes, char delimiter)
+{
+	if ((NULL == pBuilder) || pBuilder->overflow || ((NULL == pInBytes) && (numBytes > 0)))
+	{
+		return false;
+	}
+
+	size_t requiredLength = (2 * (size_t) numBytes) + ((delimiter != ATCOMMAND_STRING_TERMINATE) ? 1 : 0);
+	if (requiredLength >= (size_t) (pBuilder->capacity - pBuilder->length))
+	{
+		/* Argument and termination character don't fit into the buffer */
+		pBuilder->overflow = true;
+		return false;
+	}
+
+	char *pOut = &pBuilder->buffer[pBuilder->length];
+	ATCommand_BytesToHex(pOut, pInBytes, numBytes);
+	pOut += 2 * numBytes;
+	if (delimiter != ATCOMMAND_STRING_TERMINATE)
+	{
+		*pOut++ = delimiter;
+	}
+	*pOut = ATCOMMAND_STRING_TERMINATE;
+
+	pBuilder->length = (uint16_t) (pOut - pBuilder->buffer);
+	return true;
+}
+
+/**
+ * @brief Appends a string argument to the command assembled by a builder.
+ *
+ * The supplied delimiter is appended after the argument (unless it is a null byte).
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pInArgument Argument to be added
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentString(ATCommand_Builder_t *pBuilder, const char *pInArgument, char delimiter)
+{
+	return ATCommand_BuilderAppend(pBuilder, pInArgument, (NULL != pInArgument) ? strlen(pInArgument) : 0, false, delimiter);
+}
+
+/**
+ * @brief Appends a string argument, which is embedded into quotation marks, to the command assembled by a builder.
+ *
+ * The supplied delimiter is appended after the argument (unless it is a null byte).
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pInArgument Argument to be added
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentStringQuotationMarks(ATCommand_Builder_t *pBuilder, const char *pInArgument, char delimiter)
+{
+	return ATCommand_BuilderAppend(pBuilder, pInArgument, (NULL != pInArgument) ? strlen(pInArgument) : 0, true, delimiter);
+}
+
+/**
+ * @brief Appends bitmask strings to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] stringList List of strings containing the string representations of the bits in the input bitmask
+ * @param[in] numStrings Number of elements in stringList (max. number of bits in input bitmask)
+ * @param[in] bitmask Input bitmask
+ * @param[in] delimiter Delimiter to append after argument
+ * @param[in] maxStringLength Max. length of output string
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentBitmask(ATCommand_Builder_t *pBuilder, const char *stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter, uint16_t maxStringLength)
+{
+	if (NULL == pBuilder)
+	{
+		return false;
+	}
+
+	uint16_t startLength = pBuilder->length;
+	bool empty = true;
+	for (uint8_t i = 0; i < numStrings; i++)
+	{
+		if (0 != (bitmask & (1 << i)))
+		{
+			if (!ATCommand_BuilderAppendArgumentString(pBuilder, stringList[i], ATCOMMAND_BITMASK_DELIM) || (pBuilder->length + 1 > maxStringLength))
+			{
+				/* Discard partially appended bitmask */
+				pBuilder->length = startLength;
+				pBuilder->buffer[startLength] = ATCOMMAND_STRING_TERMINATE;
+				return false;
+			}
+			empty = false;
+		}
+	}
+
+	if (!empty)
+	{
+		/* Remove trailing bitmask delimiter */
+		pBuilder->length--;
+	}
+	return ATCommand_BuilderAppend(pBuilder, NULL, 0, false, delimiter);
+}
+
+/**
+ * @brief Appends a boolean string (true, false) to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] inBool Value to append
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentBoolean(ATCommand_Builder_t *pBuilder, bool inBool, char delimiter)
+{
+	return ATCommand_BuilderAppendArgumentString(pBuilder, ATCommand_BooleanValueStrings[(inBool == true) ? 1 : 0], delimiter);
+}
+
+/**
+ * @brief Appends a bits argument, which is embedded into quotation marks, to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags (only ATCOMMAND_INTFLAGS_SIZE8 is supported)
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentBitsQuotationMarks(ATCommand_Builder_t *pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+	char tempString[12];
+
+	if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8 ) == 0)
+	{
+		return false;
+	}
+
+	for (int i = 7; i >= 0; i--)
+	{
+		tempString[i] = pInValue & (1 << (7 - i)) ? '1' : '0';
+	}
+
+	return ATCommand_BuilderAppend(pBuilder, tempString, 8, true, delimiter);
+}
+
+/**
+ * @brief Appends an integer argument to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentInt(ATCommand_Builder_t *pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+	char tempString[12];
+
+	if (!ATCommand_IntToString(tempString, pInValue, intFlags))
+	{
+		return false;
+	}
+
+	return ATCommand_BuilderAppendArgumentString(pBuilder, tempString, delimiter);
+}
+
+/**
+ * @brief Appends an integer argument, which is embedded into quotation marks, to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendArgumentIntQuotationMarks(ATCommand_Builder_t *pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+	char tempString[12];
+
+	if (!ATCommand_IntToString(tempString, pInValue, intFlags))
+	{
+		return false;
+	}
+
+	return ATCommand_BuilderAppendArgumentStringQuotationMarks(pBuilder, tempString, delimiter);
+}
+
+/**
+ * @brief Removes characters from the end of the command assembled by a builder.
+ *
+ * Is used to strip delimiters of trailing optional arguments that have been omitted.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] count Number of characters to remove
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderRemoveTrailing(ATCommand_Builder_t *pBuilder, uint16_t count)
+{
+	if ((NULL == pBuilder) || (count > pBuilder->length))
+	{
+		return false;
+	}
+
+	pBuilder->length -= count;
+	pBuilder->buffer[pBuilder->length] = ATCOMMAND_STRING_TERMINATE;
+	return true;
+}
+
+/**
+ * @brief Appends a byte array argument to the end of an AT command.
+ *
+ * Determines the end of the command using strlen(). When assembling commands
+ * from multiple arguments, use ATCommand_BuilderAppendArgumentBytes() instead.
+ *
+ * @param[out] pOutString  AT command after appending argument
+ * @param[in] pInArgument Pointer to byte array to be added
+ * @param[in] numBytes    Number of bytes to add
+ * @param[in] delimiter   Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentBytes(char *pOutString, const char *pInArgument, uint16_t numBytes, char delimiter)
+{
+	ATCommand_Builder_t builder;
+	if (!ATCommand_BuilderAttach(&builder, pOutString))
+	{
+		return false;
+	}
+	return ATCommand_BuilderAppendArgumentBytes(&builder, pInArgument, numBytes, delimiter);
+}
+
+/**
+ * @brief Appends a string argument to the end of an AT command.
+ *
+ * The supplied delimiter is appended after the argument. A null byte ('\0')
+ * is appended after the delimiter, if the delimiter itself is not a null byte.
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] pInArgument Argument to be added
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentString(char *pOutString, const char *pInArgument, char delimiter)
+{
+	ATCommand_Builder_t builder;
+	if (!ATCommand_BuilderAttach(&builder, pOutString))
+	{
+		return false;
+	}
+	return ATCommand_BuilderAppendArgumentString(&builder, pInArgument, delimiter);
+}
+
+/**
+ * @brief Appends a string argument to the end of an AT command, which is embedded into quotation marks
+ *
+ * The supplied delimiter is appended after the argument. A null byte ('\0')
+ * is appended after the delimiter, if the delimiter itself is not a null byte.
+ * The string will be embedded into quotation marks
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] pInArgument Argument to be added
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentStringQuotationMarks(char *pOutString, const char *pInArgument, char delimiter)
+{
+	ATCommand_Builder_t builder;
+	if (!ATCommand_BuilderAttach(&builder, pOutString))
+	{
+		return false;
+	}
+	return ATCommand_BuilderAppendArgumentStringQuotationMarks(&builder, pInArgument, delimiter);
+}
+
+/**
+ * @brief Appends bitmask strings to the supplied string.
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] stringList List of strings containing the string representations of the bits in the input bitmask
+ * @param[in] numStrings Number of elements in stringList (max. number of bits in input bitmask)
+ * @param[in] bitmask Input bitmask
+ * @param[in] delimiter Delimiter to append after argument
+ * @param[in] maxStringLength Max. length of output string
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentBitmask(char *pOutString, const char *stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter, uint16_t maxStringLength)
+{
+	ATCommand_Builder_t builder;
+	if (!ATCommand_BuilderAttach(&builder, pOutString))
+	{
+		return false;
+	}
+	return ATCommand_BuilderAppendArgumentBitmask(&builder, stringList, numStrings, bitmask, delimiter, maxStringLength);
+}
+
+/**
+ * @brief Appends a boolean string (true, false) to the supplied string.
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] inBool Value to append
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentBoolean(char *pOutString, bool inBool, char delimiter)
+{
+	ATCommand_Builder_t builder;
+	if (!ATCommand_BuilderAttach(&builder, pOutString))
+	{
+		return false;
+	}
+	return ATCommand_BuilderAppendArgumentBoolean(&builder, inBool, delimiter);
+}
+
+/**
+ * @brief Gets the next argument from the supplied AT command without copying it.
+ *
+ * Delimiters enclosed in quotation marks are not treated as end of the argument.
+ * The returned span points into the supplied AT command.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument View of the argument (excluding the delimiter)
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentSpan(char **pInArguments, ATCommand_Span_t *pOutArgument, char delimiter)
+{
+	if ((NULL == pInArguments) || (NULL == *pInArguments) || (NULL == pOutArgument))
 	{
-		char *endptr;
-
-		unsigned long long longNr = strtoull(inString, &endptr, (hex == true) ? 16 : 10);
+		return false;
+	}
 
-		if (endptr == inString || *endptr != ATCOMMAND_STRING_TERMINATE)
-		{
-			/* endptr did not move to end, thus conversion failed */
-			return false;
-		}
+	char *pArgument = *pInArguments;
+	size_t argumentLength = 0;
+	bool quoted = false;
 
-		if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8 ) != 0)
-		{
-			*((uint8_t*) number) = longNr;
-		}
-		else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE16 ) != 0)
+	while (true)
+	{
+		char c = pArgument[argumentLength];
+		if ((c == delimiter) && !quoted)
 		{
-			*((uint16_t*) number) = longNr;
+			break;
 		}
-		else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE32 ) != 0)
+		if ((c == ATCOMMAND_STRING_TERMINATE) || (argumentLength == UINT16_MAX))
 		{
-			*((uint32_t*) number) = longNr;
+			/* Delimiter not found (or end of string reached within quotation marks) */
+			return false;
 		}
-		else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE64 ) != 0)
+		if (c == '"')
 		{
-			*((uint64_t*) number) = longNr;
+			quoted = !quoted;
 		}
+		argumentLength++;
 	}
 
+	pOutArgument->data = pArgument;
+	pOutArgument->length = (uint16_t) argumentLength;
+
+	/* Skip delimiter, but never move beyond the end of the string */
+	if (pArgument[argumentLength] != ATCOMMAND_STRING_TERMINATE)
+	{
+		argumentLength++;
+	}
+	*pInArguments = &pArgument[argumentLength];
+
 	return true;
 }
 
 /**
- * @brief Appends a byte array argument to the end of an AT command.
+ * @brief Removes the quotation marks enclosing an argument span.
  *
- * @param[out] pOutString  AT command after appending argument
- * @param[in] pInArgument Pointer to byte array to be added
- * @param[in] numBytes    Number of bytes to add
- * @param[in] delimiter   Delimiter to append after argument
+ * @param[in,out] pSpan Argument span
  *
- * @return true if successful, false otherwise
+ * @return true if successful, false if the argument is not enclosed in quotation marks
  */
-bool ATCommand_AppendArgumentBytes(char *pOutString, const char *pInArgument, uint16_t numBytes, char delimiter)
+bool ATCommand_SpanRemoveQuotationMarks(ATCommand_Span_t *pSpan)
 {
-	if (NULL == pOutString)
+	if ((NULL == pSpan) || (pSpan->length < 2) || (pSpan->data[0] != '"') || (pSpan->data[pSpan->length - 1] != '"'))
 	{
 		return false;
 	}
 
-	size_t strLength = strlen(pOutString);
-	if (NULL != pInArgument)
-	{
-		memcpy(&pOutString[strLength], pInArgument, numBytes);
-		strLength += numBytes;
-	}
-
-	pOutString[strLength] = delimiter;
-
+	pSpan->data++;
+	pSpan->length -= 2;
 	return true;
 }
 
 /**
- * @brief Appends a string argument to the end of an AT command.
- *
- * The supplied delimiter is appended after the argument. A null byte ('\0')
- * is appended after the delimiter, if the delimiter itself is not a null byte.
+ * @brief Copies an argument span to a (null-terminated) string.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] pInArgument Argument to be added
- * @param[in] delimiter Delimiter to append after argument
+ * @param[out] pOutString Argument as string
+ * @param[in] span Argument span
+ * @param[in] maxLength Max. length of string (including termination character)
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentString(char *pOutString, const char *pInArgument, char delimiter)
+bool ATCommand_SpanToString(char *pOutString, ATCommand_Span_t span, uint16_t maxLength)
 {
-	if (NULL == pOutString)
+	if ((NULL == pOutString) || (span.length >= maxLength))
 	{
 		return false;
 	}
 
-	size_t outStrLength = strlen(pOutString);
-	if (NULL != pInArgument)
-	{
-		size_t inStrLength = strlen(pInArgument);
-		strcpy(&pOutString[outStrLength], pInArgument);
-		outStrLength += inStrLength;
-	}
-	pOutString[outStrLength] = delimiter;
-	if (delimiter != '\0')
-	{
-		pOutString[outStrLength + 1] = '\0';
-	}
-
+	memcpy(pOutString, span.data, span.length);
+	pOutString[span.length] = ATCOMMAND_STRING_TERMINATE;
 	return true;
 }
 
 /**
- * @brief Appends a string argument to the end of an AT command, which is embedded into quotation marks
+ * @brief Parses an argument span to double
  *
- * The supplied delimiter is appended after the argument. A null byte ('\0')
- * is appended after the delimiter, if the delimiter itself is not a null byte.
- * The string will be embedded into quotation marks
- *
- * @param[out] pOutString AT command after appending argument
- * @param[in] pInArgument Argument to be added
- * @param[in] delimiter Delimiter to append after argument
+ * @param[out] number Parsed double value
+ * @param[in] span Argument to be parsed
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentStringQuotationMarks(char *pOutString, const char *pInArgument, char delimiter)
+bool ATCommand_SpanToDouble(void *number, ATCommand_Span_t span)
 {
-	if (NULL == pOutString)
+	if (NULL == number)
 	{
 		return false;
 	}
 
-	size_t outStrLength = strlen(pOutString);
-	if (NULL != pInArgument)
+	return ATCommand_SpanToDecimal((double*) number, span);
+}
+
+/**
+ * @brief Parses an argument span to float
+ *
+ * @param[out] number Parsed float value
+ * @param[in] span Argument to be parsed
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_SpanToFloat(void *number, ATCommand_Span_t span)
+{
+	if (NULL == number)
 	{
-		pOutString[outStrLength++] = '\"';
-		size_t inStrLength = strlen(pInArgument);
-		strcpy(&pOutString[outStrLength], pInArgument);
-		outStrLength += inStrLength;
-		pOutString[outStrLength++] = '\"';
+		return false;
 	}
-	pOutString[outStrLength] = delimiter;
-	if (delimiter != '\0')
+
+	double value;
+	if (!ATCommand_SpanToDecimal(&value, span))
 	{
-		pOutString[outStrLength + 1] = '\0';
+		return false;
 	}
 
+	*((float*) number) = (float) value;
+
 	return true;
 }
 
 /**
- * @brief Appends bitmask strings to the supplied string.
+ * @brief Parses an argument span to boolean (true, false)
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] stringList List of strings containing the string representations of the bits in the input bitmask
- * @param[in] numStrings Number of elements in stringList (max. number of bits in input bitmask)
- * @param[in] bitmask Input bitmask
- * @param[in] delimiter Delimiter to append after argument
- * @param[in] maxStringLength Max. length of output string
+ * @param[out] outBool Parsed boolean value
+ * @param[in] span Argument to be parsed
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentBitmask(char *pOutString, const char *stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter, uint16_t maxStringLength)
+bool ATCommand_SpanToBoolean(bool *outBool, ATCommand_Span_t span)
 {
-	size_t outStrLength = strlen(pOutString) + 1;
-	bool empty = true;
-	for (uint8_t i = 0; i < numStrings; i++)
+	bool ok;
+	uint8_t enumValue = ATCommand_FindSpan(ATCommand_BooleanValueStrings, ATCommand_BooleanValue_NumberOfValues, span, 0, &ok);
+	if (ok)
 	{
-		if (0 != (bitmask & (1 << i)))
-		{
-			outStrLength += strlen(stringList[i]) + 1;
-			if (outStrLength > maxStringLength)
-			{
-				return false;
-			}
-			if (!ATCommand_AppendArgumentString(pOutString, stringList[i], ATCOMMAND_BITMASK_DELIM))
-			{
-				return false;
-			}
-			empty = false;
-		}
+		*outBool = (enumValue == 1) ? true : false;
 	}
-	pOutString[outStrLength - (empty ? 1 : 2)] = delimiter;
-	pOutString[outStrLength - (empty ? 0 : 1)] = '\0';
-	return true;
+	return ok;
 }
 
 /**
- * @brief Appends a boolean string (true, false) to the supplied string.
+ * @brief Looks up an argument span in a list of strings (case insensitive) and returns the
+ * index of the string or the supplied default value, if the string is not found.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] inBool Value to append
- * @param[in] delimiter Delimiter to append after argument
+ * @param[in] stringList List of strings to search in
+ * @param[in] numStrings Number of strings in stringList
+ * @param[in] span Argument to look for
+ * @param[in] defaultValue Value to return if the string is not found
+ * @param[out] ok Is set to true if the string is found. Optional.
  *
- * @return true if successful, false otherwise
+ * @return Index of the first occurrence of span in stringList or defaultValue, if string is not found
  */
-bool ATCommand_AppendArgumentBoolean(char *pOutString, bool inBool, char delimiter)
+uint8_t ATCommand_FindSpan(const char *stringList[], uint8_t numStrings, ATCommand_Span_t span, uint8_t defaultValue, bool *ok)
 {
-	return ATCommand_AppendArgumentString(pOutString, ATCommand_BooleanValueStrings[(inBool == true) ? 1 : 0], delimiter);
+	for (uint8_t i = 0; i < numStrings; i++)
+	{
+		if ((0 == strncasecmp(stringList[i], span.data, span.length)) && (stringList[i][span.length] == ATCOMMAND_STRING_TERMINATE))
+		{
+			if (ok)
+			{
+				*ok = true;
+			}
+			return i;
+		}
+	}
+
+	if (ok)
+	{
+		*ok = false;
+	}
+	return defaultValue;
 }
 
 /**
@@ -329,40 +1203,21 @@ bool ATCommand_GetNextArgumentString(char **pInArguments, char *pOutArgument, ch
 		return false;
 	}
 
-	size_t argumentLength = 0;
-	size_t inputStringLength = strlen(*pInArguments);
-	size_t quotationCharCount = 0;
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	while (true)
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
 	{
-		if (argumentLength > maxLength - 1)
-		{
-			return false;
-		}
-		else if (((*pInArguments)[argumentLength] == delimiter) && (quotationCharCount % 2 == 0))
-		{
-			/* If argument list is not empty, copy string to output arguments */
-			memcpy(pOutArgument, *pInArguments, argumentLength);
-
-			pOutArgument[argumentLength] = '\0';
-
-			if (argumentLength > 0 || **pInArguments != '\0')
-			{
-				*pInArguments = &((*pInArguments)[argumentLength + 1]);
-			}
+		return false;
+	}
 
-			return true;
-		}
-		else if (((*pInArguments)[argumentLength] == '"'))
-		{
-			quotationCharCount++;
-		}
-		else if (argumentLength > inputStringLength)
-		{
-			return false;
-		}
-		argumentLength++;
+	if (!ATCommand_SpanToString(pOutArgument, argument, maxLength))
+	{
+		*pInArguments = pStart;
+		return false;
 	}
+
+	return true;
 }
 
 /**
@@ -382,46 +1237,21 @@ bool ATCommand_GetNextArgumentStringWithoutQuotationMarks(char **pInArguments, c
 		return false;
 	}
 
-	size_t argumentLength = 0;
-	size_t inputStringLength = strlen(*pInArguments);
-	size_t quotationCharCount = 0;
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	while (true)
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
 	{
-		if (argumentLength > maxLength + 1)
-		{
-			return false;
-		}
-		else if (((*pInArguments)[argumentLength] == delimiter) && (quotationCharCount % 2 == 0))
-		{
-			if (((*pInArguments)[0] == '"') && ((*pInArguments)[argumentLength - 1] == '"') && (argumentLength >= 2))
-			{
-				memcpy(pOutArgument, *pInArguments + 1, argumentLength - 2);
-				pOutArgument[argumentLength - 2] = '\0';
-
-				if (argumentLength > 0 || **pInArguments != '\0')
-				{
-					*pInArguments = &((*pInArguments)[argumentLength + 1]);
-				}
-
-				return true;
-			}
-			else
-			{
-				return false;
-			}
+		return false;
+	}
 
-		}
-		else if (((*pInArguments)[argumentLength] == '"'))
-		{
-			quotationCharCount++;
-		}
-		else if (argumentLength > inputStringLength)
-		{
-			return false;
-		}
-		argumentLength++;
+	if (!ATCommand_SpanRemoveQuotationMarks(&argument) || !ATCommand_SpanToString(pOutArgument, argument, maxLength))
+	{
+		*pInArguments = pStart;
+		return false;
 	}
+
+	return true;
 }
 
 /**
@@ -436,19 +1266,12 @@ bool ATCommand_GetNextArgumentStringWithoutQuotationMarks(char **pInArguments, c
  */
 bool ATCommand_AppendArgumentInt(char *pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
 {
-	if (NULL == pOutString)
+	ATCommand_Builder_t builder;
+	if (!ATCommand_BuilderAttach(&builder, pOutString))
 	{
 		return false;
 	}
-
-	char tempString[12];
-
-	if (ATCommand_IntToString(tempString, pInValue, intFlags))
-	{
-		return ATCommand_AppendArgumentString(pOutString, tempString, delimiter);
-	}
-
-	return false;
+	return ATCommand_BuilderAppendArgumentInt(&builder, pInValue, intFlags, delimiter);
 }
 
 /**
@@ -463,19 +1286,12 @@ bool ATCommand_AppendArgumentInt(char *pOutString, uint32_t pInValue, uint16_t i
  */
 bool ATCommand_AppendArgumentIntQuotationMarks(char *pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
 {
-	if (NULL == pOutString)
+	ATCommand_Builder_t builder;
+	if (!ATCommand_BuilderAttach(&builder, pOutString))
 	{
 		return false;
 	}
-
-	char tempString[12];
-
-	if (ATCommand_IntToString(tempString, pInValue, intFlags))
-	{
-		return ATCommand_AppendArgumentStringQuotationMarks(pOutString, tempString, delimiter);
-	}
-
-	return false;
+	return ATCommand_BuilderAppendArgumentIntQuotationMarks(&builder, pInValue, intFlags, delimiter);
 }
 
 /**
@@ -492,21 +1308,36 @@ bool ATCommand_AppendArgumentIntQuotationMarks(char *pOutString, uint32_t pInVal
  */
 bool ATCommand_GetNextArgumentEnum(char **pInArguments, uint8_t *pOutArgument, const char *stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter)
 {
-	char tempString[maxStringLength];
+	if ((NULL == pInArguments) || (NULL == pOutArgument))
+	{
+		return false;
+	}
+
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
+
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
 
-	if (!ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString)))
+	if (argument.length >= maxStringLength)
 	{
+		*pInArguments = pStart;
 		return false;
 	}
 
 	bool ok;
-	*pOutArgument = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
+	*pOutArgument = ATCommand_FindSpan(stringList, numStrings, argument, 0, &ok);
 	return ok;
 }
 
 /**
  * @brief Gets the next string argument from the supplied AT command.
  *
+ * The argument is copied as is (it may contain null characters), so the caller
+ * needs to make sure that at least length bytes are available in the input.
+ *
  * @param[in,out]  pInArguments AT command to get argument from
  * @param[in]  length Length of the argument to copy
  * @param[out] pOutArgument Argument as byte array
@@ -531,6 +1362,46 @@ bool ATCommand_GetNextArgumentByteArray(char **pInArguments, uint16_t length, ui
 	return true;
 }
 
+/**
+ * @brief Gets the next byte array argument, which is transferred in hex representation, from the supplied AT command.
+ *
+ * The output may point to the start of the argument in the input string, i.e. the
+ * argument may be converted in place.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument Argument as byte array
+ * @param[out] pOutLength Number of bytes written to pOutArgument
+ * @param[in] maxLength Max. length of byte array
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentHex(char **pInArguments, uint8_t *pOutArgument, uint16_t *pOutLength, uint16_t maxLength, char delimiter)
+{
+	if ((NULL == pOutArgument) || (NULL == pOutLength))
+	{
+		return false;
+	}
+
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
+
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
+
+	uint16_t numBytes = argument.length / 2;
+	if (((argument.length % 2) != 0) || (numBytes > maxLength) || !ATCommand_HexToBytes(pOutArgument, argument.data, numBytes))
+	{
+		*pInArguments = pStart;
+		return false;
+	}
+
+	*pOutLength = numBytes;
+	return true;
+}
+
 /**
  * @brief Gets the next bitmask argument from the supplied AT command.
  *
@@ -545,18 +1416,34 @@ bool ATCommand_GetNextArgumentByteArray(char **pInArguments, uint16_t length, ui
  */
 bool ATCommand_GetNextArgumentBitmask(char **pInArguments, const char *stringList[], uint8_t numStrings, uint16_t maxStringLength, uint32_t *bitmask, char delimiter)
 {
-	bool ret = false;
-	char tempString[maxStringLength];
+	ATCommand_Span_t argument;
 
 	*bitmask = 0;
 
-	while (**pInArguments != '\0' && ((ret = ATCommand_GetNextArgumentString(pInArguments, tempString, ATCOMMAND_BITMASK_DELIM, sizeof(tempString))) || (ret = ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString)))))
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
 	{
-		bool ok;
-		uint8_t flag = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
-		if (ok)
+		return false;
+	}
+
+	/* Split argument at bitmask delimiters */
+	ATCommand_Span_t flagString = {
+			.data = argument.data,
+			.length = 0 };
+	for (uint16_t i = 0; i <= argument.length; i++)
+	{
+		if ((i == argument.length) || (argument.data[i] == ATCOMMAND_BITMASK_DELIM))
 		{
-			*bitmask |= (1 << flag);
+			flagString.length = (uint16_t) (&argument.data[i] - flagString.data);
+			if (flagString.length < maxStringLength)
+			{
+				bool ok;
+				uint8_t flag = ATCommand_FindSpan(stringList, numStrings, flagString, 0, &ok);
+				if (ok)
+				{
+					*bitmask |= (1 << flag);
+				}
+			}
+			flagString.data = &argument.data[i + 1];
 		}
 	}
 	return true;
@@ -573,13 +1460,20 @@ bool ATCommand_GetNextArgumentBitmask(char **pInArguments, const char *stringLis
  */
 bool ATCommand_GetNextArgumentBoolean(char **pInArguments, bool *outBool, char delimiter)
 {
-	uint8_t enumValue;
-	bool ok = ATCommand_GetNextArgumentEnum(pInArguments, &enumValue, ATCommand_BooleanValueStrings, ATCommand_BooleanValue_NumberOfValues, 6, delimiter);
-	if (ok)
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
+
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
 	{
-		*outBool = (enumValue == 1) ? true : false;
+		return false;
 	}
-	return ok;
+
+	if (!ATCommand_SpanToBoolean(outBool, argument))
+	{
+		*pInArguments = pStart;
+		return false;
+	}
+	return true;
 }
 
 /**
@@ -599,15 +1493,17 @@ bool ATCommand_GetNextArgumentInt(char **pInArguments, void *pOutArgument, uint1
 		return false;
 	}
 
-	char tempString[40];
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	char *tempstartlocation = *pInArguments;
-
-	ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString));
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
 
-	if (!ATCommand_StringToInt(pOutArgument, tempString, intFlags))
+	if (!ATCommand_SpanToInt(pOutArgument, argument, intFlags))
 	{
-		*pInArguments = tempstartlocation;
+		*pInArguments = pStart;
 		return false;
 	}
 
@@ -631,15 +1527,17 @@ bool ATCommand_GetNextArgumentIntWithoutQuotationMarks(char **pInArguments, void
 		return false;
 	}
 
-	char tempString[40];
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	char *tempstartlocation = *pInArguments;
-
-	ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString));
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
 
-	if (!ATCommand_StringToInt(pOutArgument, tempString, intFlags))
+	if (!ATCommand_SpanRemoveQuotationMarks(&argument) || !ATCommand_SpanToInt(pOutArgument, argument, intFlags))
 	{
-		*pInArguments = tempstartlocation;
+		*pInArguments = pStart;
 		return false;
 	}
 
@@ -703,6 +1601,40 @@ bool ATCommand_GetCmdName(char **pInAtCmd, char *pCmdName, size_t CmdNameLen, ch
 	}
 }
 
+/**
+ * @brief Checks if a string starts with the supplied command name.
+ *
+ * @param[in] pCommandName Command name to look for
+ * @param[in] pIn String to check (e.g. a response line without the leading '+')
+ * @param[in] inLength Length of string
+ * @param[in] ignoreCase Compare case-insensitively
+ *
+ * @return true if the string starts with the command name, false otherwise (or if the command name is empty)
+ */
+bool ATCommand_MatchCommandName(const ATCommand_CommandName_t *pCommandName, const char *pIn, size_t inLength, bool ignoreCase)
+{
+	if ((NULL == pCommandName) || (NULL == pCommandName->name) || (NULL == pIn) || (pCommandName->length == 0) || (inLength < pCommandName->length))
+	{
+		return false;
+	}
+
+	if (!ignoreCase)
+	{
+		return (0 == memcmp(pCommandName->name, pIn, pCommandName->length));
+	}
+
+	for (uint8_t i = 0; i < pCommandName->length; i++)
+	{
+		char a = pCommandName->name[i];
+		char b = pIn[i];
+		if ((a != b) && (tolower((unsigned char) a) != tolower((unsigned char) b)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 /**
  * @brief Looks up a string in a list of strings (case insensitive) and returns the
  * index of the string or the supplied default value, if the string is not found.
@@ -753,29 +1685,12 @@ bool *ok)
  */
 bool ATCommand_AppendArgumentBitsQuotationMarks(char *pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
 {
-	if (NULL == pOutString)
-	{
-		return false;
-	}
-
-	char tempString[12];
-
-	if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8 ) != 0)
-	{
-		for (int i = 7; i >= 0; i--)
-		{
-			tempString[i] = pInValue & (1 << (7 - i)) ? '1' : '0';
-		}
-
-		tempString[8] = ATCOMMAND_STRING_TERMINATE;
-	}
-	else
+	ATCommand_Builder_t builder;
+	if (!ATCommand_BuilderAttach(&builder, pOutString))
 	{
 		return false;
 	}
-
-	return ATCommand_AppendArgumentStringQuotationMarks(pOutString, tempString, delimiter);
-
+	return ATCommand_BuilderAppendArgumentBitsQuotationMarks(&builder, pInValue, intFlags, delimiter);
 }
 
 /**
@@ -795,27 +1710,39 @@ bool ATCommand_GetNextArgumentBitsWithoutQuotationMarks(char **pInArguments, voi
 		return false;
 	}
 
-	char tempString[40];
-
-	ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString));
+	if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8 ) == 0)
+	{
+		return false;
+	}
 
-	long longNr = 0;
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8 ) != 0)
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
 	{
-		for (int i = 7; i >= 0; i--)
-		{
-			longNr |= ((tempString[i] - '0') << (7 - i));
-		}
-		*((uint8_t*) pOutArgument) = longNr;
+		return false;
 	}
-	else
+
+	if (!ATCommand_SpanRemoveQuotationMarks(&argument) || (argument.length < 8))
 	{
+		*pInArguments = pStart;
 		return false;
 	}
 
-	return true;
+	uint8_t bits = 0;
+	for (int i = 7; i >= 0; i--)
+	{
+		char c = argument.data[i];
+		if ((c != '0') && (c != '1'))
+		{
+			*pInArguments = pStart;
+			return false;
+		}
+		bits |= (uint8_t) ((c - '0') << (7 - i));
+	}
+	*((uint8_t*) pOutArgument) = bits;
 
+	return true;
 }
 
 /**
@@ -832,15 +1759,27 @@ bool ATCommand_GetNextArgumentBitsWithoutQuotationMarks(char **pInArguments, voi
  */
 bool ATCommand_GetNextArgumentEnumWithoutQuotationMarks(char **pInArguments, uint8_t *pOutArgument, const char *stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter)
 {
-	char tempString[maxStringLength];
+	if ((NULL == pInArguments) || (NULL == pOutArgument))
+	{
+		return false;
+	}
+
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
+
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
 
-	if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString)))
+	if (!ATCommand_SpanRemoveQuotationMarks(&argument) || argument.length >= maxStringLength)
 	{
+		*pInArguments = pStart;
 		return false;
 	}
 
 	bool ok;
-	*pOutArgument = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
+	*pOutArgument = ATCommand_FindSpan(stringList, numStrings, argument, 0, &ok);
 	return ok;
 }
 
@@ -859,19 +1798,10 @@ bool ATCommand_StringToDouble(void *number, const char *inString)
 		return false;
 	}
 
-	char *endptr;
-
-	double doubleNr = strtod(inString, &endptr);
-
-	if (endptr == inString || *endptr != ATCOMMAND_STRING_TERMINATE)
-	{
-		/* endptr did not move to end, thus conversion failed */
-		return false;
-	}
-
-	*((double*) number) = doubleNr;
-
-	return true;
+	ATCommand_Span_t span = {
+			.data = inString,
+			.length = strlen(inString) };
+	return ATCommand_SpanToDouble(number, span);
 }
 
 /**
@@ -889,19 +1819,10 @@ bool ATCommand_StringToFloat(void *number, const char *inString)
 		return false;
 	}
 
-	char *endptr;
-
-	float floatNr = strtof(inString, &endptr);
-
-	if (endptr == inString || *endptr != ATCOMMAND_STRING_TERMINATE)
-	{
-		/* endptr did not move to end, thus conversion failed */
-		return false;
-	}
-
-	*((float*) number) = floatNr;
-
-	return true;
+	ATCommand_Span_t span = {
+			.data = inString,
+			.length = strlen(inString) };
+	return ATCommand_SpanToFloat(number, span);
 }
 
 /**
@@ -920,15 +1841,17 @@ bool ATCommand_GetNextArgumentDouble(char **pInArguments, void *pOutArgument, ch
 		return false;
 	}
 
-	char tempString[40];
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	char *tempstartlocation = *pInArguments;
-
-	ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString));
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
 
-	if (!ATCommand_StringToDouble(pOutArgument, tempString))
+	if (!ATCommand_SpanToDouble(pOutArgument, argument))
 	{
-		*pInArguments = tempstartlocation;
+		*pInArguments = pStart;
 		return false;
 	}
 
@@ -951,15 +1874,17 @@ bool ATCommand_GetNextArgumentFloat(char **pInArguments, void *pOutArgument, cha
 		return false;
 	}
 
-	char tempString[40];
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	char *tempstartlocation = *pInArguments;
-
-	ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString));
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
 
-	if (!ATCommand_StringToFloat(pOutArgument, tempString))
+	if (!ATCommand_SpanToFloat(pOutArgument, argument))
 	{
-		*pInArguments = tempstartlocation;
+		*pInArguments = pStart;
 		return false;
 	}
 
@@ -982,15 +1907,17 @@ bool ATCommand_GetNextArgumentDoubleWithoutQuotationMarks(char **pInArguments, v
 		return false;
 	}
 
-	char tempString[40];
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	char *tempstartlocation = *pInArguments;
-
-	ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString));
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
 
-	if (!ATCommand_StringToDouble(pOutArgument, tempString))
+	if (!ATCommand_SpanRemoveQuotationMarks(&argument) || !ATCommand_SpanToDouble(pOutArgument, argument))
 	{
-		*pInArguments = tempstartlocation;
+		*pInArguments = pStart;
 		return false;
 	}
 
@@ -1013,15 +1940,17 @@ bool ATCommand_GetNextArgumentFloatWithoutQuotationMarks(char **pInArguments, vo
 		return false;
 	}
 
-	char tempString[40];
+	char *pStart = *pInArguments;
+	ATCommand_Span_t argument;
 
-	char *tempstartlocation = *pInArguments;
-
-	ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString));
+	if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, delimiter))
+	{
+		return false;
+	}
 
-	if (!ATCommand_StringToFloat(pOutArgument, tempString))
+	if (!ATCommand_SpanRemoveQuotationMarks(&argument) || !ATCommand_SpanToFloat(pOutArgument, argument))
 	{
-		*pInArguments = tempstartlocation;
+		*pInArguments = pStart;
 		return false;
 	}
 
@@ -1067,49 +1996,338 @@ int ATCommand_CountArgs(char *stringP)
 	return argscount;
 }
 
-bool ATCommand_ParseEventType(char **pAtCommand, const ATCommand_Event_t *pmoduleEvents, char *delimiters, uint8_t number_of_delimiters, uint16_t *pEvent)
+/**
+ * @brief Gets the command name from an AT command without copying it.
+ *
+ * Same as ATCommand_GetCmdName(), but returns a span pointing to the name.
+ *
+ * @param[in,out] pInAtCmd AT command to get command name from
+ * @param[out] pCmdName Span referencing the command name
+ * @param[in] delimiters Delimiters which occurs after command name
+ * @param[in] number_of_delimiters Number of delimiters
+ *
+ * @return true if successful, false otherwise
+ */
+static bool ATCommand_GetCmdNameSpan(char **pInAtCmd, ATCommand_Span_t *pCmdName, char *delimiters, uint8_t number_of_delimiters)
+{
+	for (uint16_t argumentLength = 0; argumentLength < UINT16_MAX; argumentLength++)
+	{
+		char c = (*pInAtCmd)[argumentLength];
+		for (uint8_t i = 0; i < number_of_delimiters; i++)
+		{
+			if (c == delimiters[i])
+			{
+				pCmdName->data = *pInAtCmd;
+				pCmdName->length = argumentLength;
+				*pInAtCmd = &((*pInAtCmd)[(c == ATCOMMAND_STRING_TERMINATE) ? argumentLength : argumentLength + 1]);
+				return true;
+			}
+		}
+		if (c == '\0')
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Looks up an event name in a (sorted) event table using binary search.
+ *
+ * @param[in] pEvents Event table
+ * @param[in] numberOfEvents Number of entries in event table
+ * @param[in] name Name to look up
+ *
+ * @return Matching entry, wildcard entry (no name) or NULL if no entry matches
+ */
+static const ATCommand_Event_t* ATCommand_FindEvent(const ATCommand_Event_t *pEvents, uint16_t numberOfEvents, ATCommand_Span_t name)
+{
+	if (numberOfEvents == 0)
+	{
+		return NULL;
+	}
+
+	const ATCommand_Event_t *wildcardP = NULL;
+	if (pEvents[numberOfEvents - 1].eventName == NULL)
+	{
+		wildcardP = &pEvents[numberOfEvents - 1];
+		numberOfEvents--;
+	}
+
+	uint16_t low = 0;
+	uint16_t high = numberOfEvents;
+	while (low < high)
+	{
+		uint16_t mid = low + (high - low) / 2;
+		const char *eventName = pEvents[mid].eventName;
+
+		/* compare name with event name as strcmp() would do if name was null-terminated */
+		int cmp = strncmp(eventName, name.data, name.length);
+		if ((cmp == 0) && (eventName[name.length] != '\0'))
+		{
+			/* event name is longer than name */
+			cmp = 1;
+		}
+
+		if (cmp == 0)
+		{
+			return &pEvents[mid];
+		}
+		if (cmp < 0)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return wildcardP;
+}
+
+/**
+ * @brief Determines the event contained in an AT command.
+ *
+ * The event tables are searched using binary search, so the entries of each table
+ * must be sorted by name (see ATCommand_Event_t). A wildcard entry (no name) is
+ * only taken into account if it is the last entry of its table.
+ *
+ * @param[in,out] pAtCommand AT command to parse
+ * @param[in] pmoduleEvents Main event table
+ * @param[in] numberOfEvents Number of entries in main event table
+ * @param[in] delimiters Delimiters which may occur after the event name
+ * @param[in] number_of_delimiters Number of delimiters
+ * @param[out] pEvent Event ID of matching entry
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_ParseEventType(char **pAtCommand, const ATCommand_Event_t *pmoduleEvents, uint16_t numberOfEvents, char *delimiters, uint8_t number_of_delimiters, uint16_t *pEvent)
 {
-	const ATCommand_Event_t *eventP = &pmoduleEvents[0];
+	if ((NULL == pAtCommand) || (NULL == pmoduleEvents) || (NULL == pEvent))
+	{
+		return false;
+	}
 
-	char cmdName[32];
+	ATCommand_Span_t cmdName;
 
-	if (!ATCommand_GetCmdName(pAtCommand, cmdName, sizeof(cmdName), delimiters, number_of_delimiters))
+	if (!ATCommand_GetCmdNameSpan(pAtCommand, &cmdName, delimiters, number_of_delimiters))
 	{
 		return false;
 	}
 
+	const ATCommand_Event_t *eventP = ATCommand_FindEvent(pmoduleEvents, numberOfEvents, cmdName);
+
 	while (eventP != NULL)
 	{
-		if ((eventP->eventName == NULL) || (strcmp(eventP->eventName, cmdName) == 0))
+		if (eventP->subEventsP == NULL)
 		{
-			if (eventP->subEventsP != NULL)
-			{
-				if (!ATCommand_GetNextArgumentString(pAtCommand, cmdName, eventP->subDelimiter, sizeof(cmdName)))
-				{
-					return false;
-				}
-				eventP = eventP->subEventsP;
-			}
-			else
-			{
-				*pEvent = eventP->eventID;
-				return true;
-			}
+			*pEvent = eventP->eventID;
+			return true;
 		}
-		else
+
+		if (!ATCommand_GetNextArgumentSpan(pAtCommand, &cmdName, eventP->subDelimiter))
 		{
-			if (eventP->last)
-			{
-				/* no next entry */
-				return false;
-			}
-			else
+			return false;
+		}
+		eventP = ATCommand_FindEvent(eventP->subEventsP, eventP->subEventsCount, cmdName);
+	}
+
+	return false;
+}
+
+/**
+ * @brief Reads an integer struct member.
+ *
+ * @param[in] pField Pointer to member
+ * @param[in] size Size of member in bytes
+ * @param[in] signExtend Controls whether the value is sign extended
+ * @param[out] pValue Value of member
+ *
+ * @return true if successful, false if the size is not supported
+ */
+static bool ATCommand_LoadField(const void *pField, uint16_t size, bool signExtend, uint64_t *pValue)
+{
+	switch (size)
+	{
+	case 1:
+		*pValue = signExtend ? (uint64_t) (int64_t) *(const int8_t*) pField : *(const uint8_t*) pField;
+		return true;
+	case 2:
+		*pValue = signExtend ? (uint64_t) (int64_t) *(const int16_t*) pField : *(const uint16_t*) pField;
+		return true;
+	case 4:
+		*pValue = signExtend ? (uint64_t) (int64_t) *(const int32_t*) pField : *(const uint32_t*) pField;
+		return true;
+	case 8:
+		*pValue = *(const uint64_t*) pField;
+		return true;
+	default:
+		return false;
+	}
+}
+
+/**
+ * @brief Writes an integer struct member.
+ *
+ * @param[out] pField Pointer to member
+ * @param[in] size Size of member in bytes
+ * @param[in] value Value to write (is truncated to the size of the member)
+ *
+ * @return true if successful, false if the size is not supported
+ */
+static bool ATCommand_StoreField(void *pField, uint16_t size, uint64_t value)
+{
+	switch (size)
+	{
+	case 1:
+		*(uint8_t*) pField = (uint8_t) value;
+		return true;
+	case 2:
+		*(uint16_t*) pField = (uint16_t) value;
+		return true;
+	case 4:
+		*(uint32_t*) pField = (uint32_t) value;
+		return true;
+	case 8:
+		*(uint64_t*) pField = value;
+		return true;
+	default:
+		return false;
+	}
+}
+
+/**
+ * @brief Appends the members of a struct as arguments to the command assembled by a builder.
+ *
+ * @param[in,out] pBuilder Builder containing the command
+ * @param[in] pIn Struct containing the values to append
+ * @param[in] pFields Field descriptors defining the arguments
+ * @param[in] numberOfFields Number of field descriptors
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_BuilderAppendFields(ATCommand_Builder_t *pBuilder, const void *pIn, const ATCommand_FieldDescriptor_t *pFields, uint8_t numberOfFields)
+{
+	if ((NULL == pBuilder) || (NULL == pIn) || (NULL == pFields))
+	{
+		return false;
+	}
+
+	for (uint8_t i = 0; i < numberOfFields; i++)
+	{
+		const ATCommand_FieldDescriptor_t *fieldP = &pFields[i];
+		const void *pField = (const uint8_t*) pIn + fieldP->offset;
+		char tempString[24];
+		uint64_t value;
+		bool ok;
+
+		switch (fieldP->type)
+		{
+		case ATCommand_FieldType_Unsigned:
+		case ATCommand_FieldType_Signed:
+		{
+			uint16_t intFlags = ATCOMMAND_INTFLAGS_NOTATION_DEC | ((fieldP->type == ATCommand_FieldType_Signed) ? ATCOMMAND_INTFLAGS_SIGNED : ATCOMMAND_INTFLAGS_UNSIGNED);
+			ok = ATCommand_LoadField(pField, fieldP->size, (fieldP->type == ATCommand_FieldType_Signed), &value) && ATCommand_Int64ToString(tempString, value, intFlags) && ATCommand_BuilderAppendArgumentString(pBuilder, tempString, fieldP->delimiter);
+			break;
+		}
+
+		case ATCommand_FieldType_Boolean:
+			ok = ATCommand_BuilderAppendArgumentString(pBuilder, *(const bool*) pField ? "1" : "0", fieldP->delimiter);
+			break;
+
+		case ATCommand_FieldType_String:
+		case ATCommand_FieldType_QuotedString:
+			/* string members are not required to be null-terminated if they use the whole array */
+			ok = ATCommand_BuilderAppend(pBuilder, (const char*) pField, strnlen((const char*) pField, fieldP->size), (fieldP->type == ATCommand_FieldType_QuotedString), fieldP->delimiter);
+			break;
+
+		default:
+			ok = false;
+			break;
+		}
+
+		if (!ok)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Parses the arguments of an AT command or response into the members of a struct.
+ *
+ * If an argument cannot be parsed, the argument pointer is left unchanged. Members
+ * that have been parsed before the failing argument keep their new values.
+ *
+ * @param[in,out] pInArguments AT command to get arguments from
+ * @param[out] pOut Struct receiving the parsed values
+ * @param[in] pFields Field descriptors defining the arguments
+ * @param[in] numberOfFields Number of field descriptors
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_ParseFields(char **pInArguments, void *pOut, const ATCommand_FieldDescriptor_t *pFields, uint8_t numberOfFields)
+{
+	if ((NULL == pInArguments) || (NULL == pOut) || (NULL == pFields))
+	{
+		return false;
+	}
+
+	char *pStart = *pInArguments;
+
+	for (uint8_t i = 0; i < numberOfFields; i++)
+	{
+		const ATCommand_FieldDescriptor_t *fieldP = &pFields[i];
+		void *pField = (uint8_t*) pOut + fieldP->offset;
+		ATCommand_Span_t argument;
+		uint64_t value;
+		bool ok;
+
+		if (!ATCommand_GetNextArgumentSpan(pInArguments, &argument, fieldP->delimiter))
+		{
+			*pInArguments = pStart;
+			return false;
+		}
+
+		switch (fieldP->type)
+		{
+		case ATCommand_FieldType_Unsigned:
+		case ATCommand_FieldType_Signed:
+			ok = ATCommand_SpanToInt(&value, argument, ATCOMMAND_INTFLAGS_SIZE64 | ((fieldP->type == ATCommand_FieldType_Signed) ? ATCOMMAND_INTFLAGS_SIGNED : ATCOMMAND_INTFLAGS_UNSIGNED)) && ATCommand_StoreField(pField, fieldP->size, value);
+			break;
+
+		case ATCommand_FieldType_Boolean:
+			ok = ATCommand_SpanToInt(&value, argument, ATCOMMAND_INTFLAGS_SIZE64 | ATCOMMAND_INTFLAGS_UNSIGNED);
+			if (ok)
 			{
-				/* go to next entry */
-				eventP += 1;
+				*(bool*) pField = (value == 1);
 			}
+			break;
+
+		case ATCommand_FieldType_String:
+			ok = ATCommand_SpanToString((char*) pField, argument, fieldP->size);
+			break;
+
+		case ATCommand_FieldType_QuotedString:
+			/* Quotation marks are optional when parsing */
+			(void) ATCommand_SpanRemoveQuotationMarks(&argument);
+			ok = ATCommand_SpanToString((char*) pField, argument, fieldP->size);
+			break;
+
+		default:
+			ok = false;
+			break;
+		}
+
+		if (!ok)
+		{
+			*pInArguments = pStart;
+			return false;
 		}
 	}
 
-	return false;
+	return true;
 }
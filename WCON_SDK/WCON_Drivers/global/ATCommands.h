@@ -32,18 +32,11 @@
 #define GLOBAL_AT_COMMMANDS_H_INCLUDED
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-/**
- * @brief Size of buffer used for commands sent to the wireless module and the responses
- * received from the module.
- *
- * May be adopted to required file/data sizes.
- */
-#define AT_MAX_COMMAND_BUFFER_SIZE 2048
-
 #define ATCOMMAND_COMMAND_PREFIX  "AT+"                       /**< Prefix for AT commands */
 #define ATCOMMAND_COMMAND_DELIM   (char)'='                   /**< Character delimiting AT command and parameters */
 #define ATCOMMAND_CONFIRM_PREFIX  (char)'+'                   /**< Prefix for received confirmations */
@@ -74,13 +67,12 @@
 #define ATCOMMAND_INTFLAGS_NOTATION_HEX    (uint16_t)(0x40)   /**< Hexadecimal notation */
 #define ATCOMMAND_INTFLAGS_NOTATION_DEC    (uint16_t)(0x80)   /**< Decimal notation */
 
-#define FULLEVENTENTRY(name, id, subevent, subdelimiter, l) {.eventName = name, .eventID = id, .subEventsP = subevent, .subDelimiter = subdelimiter, .last = l},
+#define ATCOMMAND_EVENT_COUNT(events) (uint16_t)(sizeof(events) / sizeof((events)[0]))  /**< Number of entries in an event table */
 
-#define EVENTENTRY(name, id)     FULLEVENTENTRY(name, id, NULL, ATCOMMAND_STRING_TERMINATE, false)
-#define LASTEVENTENTRY(name, id) FULLEVENTENTRY(name, id, NULL, ATCOMMAND_STRING_TERMINATE, true)
+#define FULLEVENTENTRY(name, id, subevent, subeventcount, subdelimiter) {.eventName = name, .eventID = id, .subEventsP = subevent, .subEventsCount = subeventcount, .subDelimiter = subdelimiter},
 
-#define PARENTEVENTENTRY(name, subevent, subdelimiter)     FULLEVENTENTRY(name, 0, subevent, subdelimiter, false)
-#define LASTPARENTEVENTENTRY(name, subevent, subdelimiter) FULLEVENTENTRY(name, 0, subevent, subdelimiter, true)
+#define EVENTENTRY(name, id)                       FULLEVENTENTRY(name, id, NULL, 0, ATCOMMAND_STRING_TERMINATE)
+#define PARENTEVENTENTRY(name, subevent, subdelimiter) FULLEVENTENTRY(name, 0, subevent, ATCOMMAND_EVENT_COUNT(subevent), subdelimiter)
 
 /**
  * @brief Boolean value (true, false).
@@ -92,28 +84,143 @@ typedef enum ATCommand_BooleanValue_t
 	ATCommand_BooleanValue_NumberOfValues
 } ATCommand_BooleanValue_t;
 
+/**
+ * @brief Builder used for assembling AT commands.
+ *
+ * Keeps track of the current length of the command, so that arguments can be
+ * appended without scanning the already assembled command. The command is always
+ * kept null-terminated. If an argument doesn't fit into the buffer, the command
+ * is left unchanged, the overflow flag is set and all further append operations fail.
+ */
+typedef struct ATCommand_Builder_t
+{
+	char *buffer; /**< Buffer containing the command */
+	uint16_t length; /**< Current length of the command (excluding termination character) */
+	uint16_t capacity; /**< Size of buffer (including termination character) */
+	bool overflow; /**< Set if an argument didn't fit into the buffer */
+} ATCommand_Builder_t;
+
+/**
+ * @brief View of an argument contained in an AT command or response.
+ *
+ * Points directly into the command/response string, i.e. the referenced
+ * characters are not copied and are not null-terminated. A span is only valid as
+ * long as the string it has been taken from isn't modified.
+ */
+typedef struct ATCommand_Span_t
+{
+	const char *data; /**< First character of the argument */
+	uint16_t length; /**< Number of characters */
+} ATCommand_Span_t;
+
+/**
+ * @brief Name of an AT command (without prefix "AT+" and arguments).
+ *
+ * Is used by the drivers for assigning responses to the pending request. Use
+ * ATCOMMAND_COMMAND_NAME() to define the name of a command at compile time, so the
+ * request doesn't need to be parsed when it is sent.
+ */
+typedef struct ATCommand_CommandName_t
+{
+	const char *name; /**< Command name (not necessarily null-terminated) */
+	uint8_t length; /**< Length of command name */
+} ATCommand_CommandName_t;
+
+/**
+ * @brief Initializer for an ATCommand_CommandName_t from a string literal, e.g. ATCOMMAND_COMMAND_NAME("send").
+ */
+#define ATCOMMAND_COMMAND_NAME(literal) { (literal), (uint8_t) (sizeof(literal) - 1) }
+
+/**
+ * @brief Type of a field described by an ATCommand_FieldDescriptor_t.
+ */
+typedef enum ATCommand_FieldType_t
+{
+	ATCommand_FieldType_Unsigned, /**< Unsigned decimal integer (field size 1, 2, 4 or 8 bytes) */
+	ATCommand_FieldType_Signed, /**< Signed decimal integer (field size 1, 2, 4 or 8 bytes) */
+	ATCommand_FieldType_Boolean, /**< Boolean (bool field) transferred as integer 0 or 1 */
+	ATCommand_FieldType_String, /**< String (char array field) transferred as is */
+	ATCommand_FieldType_QuotedString, /**< String (char array field) embedded into quotation marks (optional when parsing) */
+	ATCommand_FieldType_NumberOfValues
+} ATCommand_FieldType_t;
+
+/**
+ * @brief Describes how a struct member is transferred as argument of an AT command or response.
+ *
+ * A table of field descriptors defines the argument list of a command or response, so that
+ * the arguments can be assembled (ATCommand_BuilderAppendFields()) and parsed
+ * (ATCommand_ParseFields()) without hand-written code for every argument.
+ * Use ATCOMMAND_FIELD() to define entries, so that offset and size are determined at
+ * compile time.
+ */
+typedef struct ATCommand_FieldDescriptor_t
+{
+	uint16_t offset; /**< Offset of the member in the struct */
+	uint16_t size; /**< Size of the member in bytes */
+	uint8_t type; /**< Field type (ATCommand_FieldType_t) */
+	char delimiter; /**< Delimiter following the argument */
+} ATCommand_FieldDescriptor_t;
+
+#define ATCOMMAND_FIELD(structType, member, fieldType, delim) {.offset = (uint16_t) offsetof(structType, member), .size = (uint16_t) sizeof(((structType*) 0)->member), .type = fieldType, .delimiter = delim}
+#define ATCOMMAND_FIELD_COUNT(fields) (uint8_t)(sizeof(fields) / sizeof((fields)[0]))  /**< Number of entries in a field descriptor table */
+
+/**
+ * @brief Entry of an event table as used by ATCommand_ParseEventType().
+ *
+ * The entries of an event table must be sorted by name in ascending order (as
+ * defined by strcmp()), as the table is searched using binary search. The size of
+ * a table is passed to ATCommand_ParseEventType() (main table) or stored in the
+ * parent entry (sub event tables, see ATCOMMAND_EVENT_COUNT()).
+ *
+ * An entry without name (NULL) matches any name for which the table contains no
+ * other entry. Such a wildcard entry is only honoured as the last entry of a table
+ * (a wildcard at any other position is not found by the binary search).
+ */
 typedef struct ATCommand_Event_t
 {
-	uint16_t eventID;
-	const struct ATCommand_Event_t *subEventsP;
-	char *eventName;
-	char subDelimiter;
-	bool last;
+	uint16_t eventID; /**< Event ID (if entry has no sub events) */
+	const struct ATCommand_Event_t *subEventsP; /**< Sub event table (NULL if entry has no sub events) */
+	uint16_t subEventsCount; /**< Number of entries in sub event table */
+	char *eventName; /**< Event name (NULL to match any name) */
+	char subDelimiter; /**< Delimiter following the sub event name */
 } ATCommand_Event_t;
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/**
- * @brief Buffer used for commands sent to the wireless module and the responses
- * received from the module.
- */
-extern char AT_commandBuffer[AT_MAX_COMMAND_BUFFER_SIZE];
-
 extern bool ATCommand_IntToString(char *outString, uint32_t number, uint16_t intFlags);
+
+extern bool ATCommand_Int64ToString(char *outString, uint64_t number, uint16_t intFlags);
+
 extern bool ATCommand_StringToInt(void *pOutInt, const char *pInString, uint16_t intFlags);
 
+extern bool ATCommand_HexToBytes(uint8_t *pOutBytes, const char *pInHex, uint16_t numBytes);
+
+extern void ATCommand_BytesToHex(char *pOutHex, const uint8_t *pInBytes, uint16_t numBytes);
+
+extern void ATCommand_BuilderInit(ATCommand_Builder_t *pBuilder, char *pBuffer, uint16_t capacity, const char *pCommand);
+
+extern bool ATCommand_BuilderAppendArgumentBytes(ATCommand_Builder_t *pBuilder, const char *pInArgument, uint16_t numBytes, char delimiter);
+
+extern bool ATCommand_BuilderAppendArgumentHex(ATCommand_Builder_t *pBuilder, const uint8_t *pInBytes, uint16_t numBytes, char delimiter);
+
+extern bool ATCommand_BuilderAppendArgumentString(ATCommand_Builder_t *pBuilder, const char *pInArgument, char delimiter);
+
+extern bool ATCommand_BuilderAppendArgumentStringQuotationMarks(ATCommand_Builder_t *pBuilder, const char *pInArgument, char delimiter);
+
+extern bool ATCommand_BuilderAppendArgumentBitmask(ATCommand_Builder_t *pBuilder, const char *stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter, uint16_t maxStringLength);
+
+extern bool ATCommand_BuilderAppendArgumentBoolean(ATCommand_Builder_t *pBuilder, bool inBool, char delimiter);
+
+extern bool ATCommand_BuilderAppendArgumentBitsQuotationMarks(ATCommand_Builder_t *pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter);
+
+extern bool ATCommand_BuilderAppendArgumentInt(ATCommand_Builder_t *pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter);
+
+extern bool ATCommand_BuilderAppendArgumentIntQuotationMarks(ATCommand_Builder_t *pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter);
+
+extern bool ATCommand_BuilderRemoveTrailing(ATCommand_Builder_t *pBuilder, uint16_t count);
+
 extern bool ATCommand_AppendArgumentBytes(char *pOutString, const char *pInArgument, uint16_t numBytes, char delimiter);
 
 extern bool ATCommand_AppendArgumentString(char *pOutString, const char *pInArgument, char delimiter);
@@ -127,12 +234,30 @@ bool inBool, char delimiter);
 
 extern bool ATCommand_AppendArgumentBitsQuotationMarks(char *pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter);
 
+extern bool ATCommand_GetNextArgumentSpan(char **pInArguments, ATCommand_Span_t *pOutArgument, char delimiter);
+
+extern bool ATCommand_SpanRemoveQuotationMarks(ATCommand_Span_t *pSpan);
+
+extern bool ATCommand_SpanToString(char *pOutString, ATCommand_Span_t span, uint16_t maxLength);
+
+extern bool ATCommand_SpanToInt(void *pOutInt, ATCommand_Span_t span, uint16_t intFlags);
+
+extern bool ATCommand_SpanToDouble(void *number, ATCommand_Span_t span);
+
+extern bool ATCommand_SpanToFloat(void *number, ATCommand_Span_t span);
+
+extern bool ATCommand_SpanToBoolean(bool *outBool, ATCommand_Span_t span);
+
+extern uint8_t ATCommand_FindSpan(const char *stringList[], uint8_t numStrings, ATCommand_Span_t span, uint8_t defaultValue, bool *ok);
+
 extern bool ATCommand_GetNextArgumentString(char **pInArguments, char *pOutArgument, char delimiter, uint16_t maxLength);
 
 extern bool ATCommand_GetNextArgumentStringWithoutQuotationMarks(char **pInArguments, char *pOutArgument, char delimiter, uint16_t maxLength);
 
 extern bool ATCommand_GetNextArgumentByteArray(char **pInArguments, uint16_t length, uint8_t *pOutArgument, uint16_t maxLength);
 
+extern bool ATCommand_GetNextArgumentHex(char **pInArguments, uint8_t *pOutArgument, uint16_t *pOutLength, uint16_t maxLength, char delimiter);
+
 extern bool ATCommand_AppendArgumentInt(char *pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter);
 
 extern bool ATCommand_AppendArgumentIntQuotationMarks(char *pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter);
@@ -150,6 +275,8 @@ bool *outBool, char delimiter);
 
 extern bool ATCommand_GetCmdName(char **pInAtCmd, char *pCmdName, size_t CmdNameLen, char *delimiters, uint8_t number_of_delimiters);
 
+extern bool ATCommand_MatchCommandName(const ATCommand_CommandName_t *pCommandName, const char *pIn, size_t inLength, bool ignoreCase);
+
 extern uint8_t ATCommand_FindString(const char *stringList[], uint8_t numStrings, const char *str, uint8_t defaultValue,
 bool *ok);
 
@@ -169,7 +296,11 @@ extern bool ATCommand_GetNextArgumentFloatWithoutQuotationMarks(char **pInArgume
 
 extern int ATCommand_CountArgs(char *stringP);
 
-extern bool ATCommand_ParseEventType(char **pAtCommand, const ATCommand_Event_t *pmoduleEvents, char *delimiters, uint8_t number_of_delimiters, uint16_t *pEvent);
+extern bool ATCommand_ParseEventType(char **pAtCommand, const ATCommand_Event_t *pmoduleEvents, uint16_t numberOfEvents, char *delimiters, uint8_t number_of_delimiters, uint16_t *pEvent);
+
+extern bool ATCommand_BuilderAppendFields(ATCommand_Builder_t *pBuilder, const void *pIn, const ATCommand_FieldDescriptor_t *pFields, uint8_t numberOfFields);
+
+extern bool ATCommand_ParseFields(char **pInArguments, void *pOut, const ATCommand_FieldDescriptor_t *pFields, uint8_t numberOfFields);
 
 #ifdef __cplusplus
 }
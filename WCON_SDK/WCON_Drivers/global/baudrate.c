@@ -0,0 +1,137 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Helper for switching the UART connection to a radio module to the highest baud rate supported by both sides.
+ */
+
+#include "baudrate.h"
+
+#include "global.h"
+
+/**
+ * @brief Number of attempts to verify the communication after switching the baud rate.
+ */
+#define WE_BAUDRATE_PING_ATTEMPTS 3
+
+/**
+ * @brief Checks if the module responds at the current baud rate.
+ *
+ * @param[in] adapter Module specific functions
+ *
+ * @return true if the module has responded, false otherwise
+ */
+static bool BaudratePing(const WE_BaudrateAdapter_t *adapter)
+{
+	for (uint8_t i = 0; i < WE_BAUDRATE_PING_ATTEMPTS; i++)
+	{
+		if (adapter->ping())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Switches the module and the host's UART to the highest baud rate supported by both sides.
+ *
+ * The communication at the current baud rate is verified first. Then, starting with the
+ * highest baud rate supported by the module (and not exceeding maxHostBaudrate), the module
+ * and the host are switched to each baud rate that is higher than the current one, until the
+ * module responds at the new baud rate. If the module doesn't respond, the module and the
+ * host are switched back to the previous baud rate and the next lower baud rate is tried.
+ *
+ * Note that the baud rate is stored in the module's flash by most modules, so the negotiation
+ * should be done once (e.g. on first start-up) rather than after each reset. If the current
+ * baud rate already is the highest supported one, nothing is written to the module.
+ *
+ * @param[in] adapter Module specific functions
+ * @param[in] currentBaudrate Baud rate currently used by module and host
+ * @param[in] maxHostBaudrate Max. baud rate supported by the host's UART (0 = no limit)
+ * @param[out] baudrateP Baud rate used after negotiation (optional, valid if true has been returned)
+ *
+ * @return true if the module responds at the (possibly unchanged) resulting baud rate,
+ *         false if communication with the module has failed
+ */
+bool WE_UART_NegotiateBaudrate(const WE_BaudrateAdapter_t *adapter, uint32_t currentBaudrate, uint32_t maxHostBaudrate, uint32_t *baudrateP)
+{
+	if ((adapter == NULL) || (adapter->baudrates == NULL) || (adapter->setModuleBaudrate == NULL) || (adapter->setHostBaudrate == NULL) || (adapter->ping == NULL))
+	{
+		return false;
+	}
+
+	if (!BaudratePing(adapter))
+	{
+		/* No communication at current baud rate */
+		return false;
+	}
+
+	for (uint8_t i = 0; i < adapter->baudrateCount; i++)
+	{
+		uint32_t baudrate = adapter->baudrates[i];
+		if (baudrate <= currentBaudrate)
+		{
+			/* Remaining baud rates are not faster than the current one */
+			break;
+		}
+		if ((maxHostBaudrate != 0) && (baudrate > maxHostBaudrate))
+		{
+			continue;
+		}
+
+		if (!adapter->setModuleBaudrate(baudrate))
+		{
+			/* Rejected by module - module still uses current baud rate */
+			continue;
+		}
+
+		if (adapter->setHostBaudrate(baudrate) && BaudratePing(adapter))
+		{
+			currentBaudrate = baudrate;
+			break;
+		}
+
+#ifdef WE_DEBUG
+		WE_LOG("Communication at %lu baud failed, falling back to %lu baud\r\n", (unsigned long) baudrate, (unsigned long) currentBaudrate);
+#endif
+
+		/* Fall back to previous baud rate. The request to the module is sent at the new baud
+		 * rate (the module might not be able to send, but still be able to receive). */
+		adapter->setModuleBaudrate(currentBaudrate);
+		if (!adapter->setHostBaudrate(currentBaudrate) || !BaudratePing(adapter))
+		{
+			/* Module doesn't respond at any of the two baud rates */
+			return false;
+		}
+	}
+
+	if (baudrateP != NULL)
+	{
+		*baudrateP = currentBaudrate;
+	}
+	return true;
+}
@@ -0,0 +1,87 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Helper for switching the UART connection to a radio module to the highest baud rate supported by both sides.
+ */
+
+#ifndef GLOBAL_BAUDRATE_H_INCLUDED
+#define GLOBAL_BAUDRATE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "global_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Module specific functions used by WE_UART_NegotiateBaudrate().
+ *
+ * Is provided by the radio module drivers (e.g. ProteusIII_NegotiateBaudrate()).
+ */
+typedef struct WE_BaudrateAdapter_t
+{
+	/**
+	 * @brief Baud rates supported by the module, sorted in descending order.
+	 */
+	const uint32_t *baudrates;
+
+	/**
+	 * @brief Number of entries in baudrates.
+	 */
+	uint8_t baudrateCount;
+
+	/**
+	 * @brief Requests the module to switch to the supplied baud rate (using the current baud rate).
+	 *
+	 * Must return as soon as the module uses the new baud rate (e.g. after the module has restarted).
+	 * Returns false if the module has rejected the request.
+	 */
+	bool (*setModuleBaudrate)(uint32_t baudrate);
+
+	/**
+	 * @brief Reinitializes the host's UART with the supplied baud rate.
+	 */
+	bool (*setHostBaudrate)(uint32_t baudrate);
+
+	/**
+	 * @brief Sends a request to the module, returns true if a valid response has been received.
+	 *
+	 * Is used to verify the communication after switching the baud rate.
+	 */
+	bool (*ping)(void);
+} WE_BaudrateAdapter_t;
+
+extern bool WE_UART_NegotiateBaudrate(const WE_BaudrateAdapter_t *adapter, uint32_t currentBaudrate, uint32_t maxHostBaudrate, uint32_t *baudrateP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_BAUDRATE_H_INCLUDED */
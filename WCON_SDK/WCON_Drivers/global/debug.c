@@ -31,6 +31,7 @@
 #include "debug.h"
 
 #include <errno.h>
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
@@ -41,53 +42,70 @@
 
 #if defined(WE_DEBUG) || defined(WE_DEBUG_INIT)
 
+
+#if defined(WE_PLATFORM_LINUX)
 /**
- * @brief Debug ring buffer size.
+ * @brief Initializes debug output (on the Linux host platform, printf() output is written to stdout).
  */
-#define WE_DEBUG_BUFFER_SIZE 2048
+void WE_Debug_Init()
+{
+	/* Line buffering for STDOUT stream */
+	setvbuf(stdout, NULL, _IOLBF, 0);
+}
 
 /**
- * @brief UART used for debug output.
+ * @brief Wait until any pending debug output has been written.
  */
-static USART_TypeDef *uartDebug = NULL;
+void WE_Debug_Flush()
+{
+	fflush(stdout);
+}
 
+#if defined(WE_DEBUG_BINARY)
 /**
- * @brief Ring buffer for debug output (output is transmitted asynchronously).
+ * @brief Writes a log message (on the Linux host platform, the message is formatted immediately).
+ *
+ * @param[in] format printf() format string
  */
-static uint8_t debugBuffer[WE_DEBUG_BUFFER_SIZE];
+void WE_Debug_Log(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	vprintf(format, args);
+	va_end(args);
+}
 
 /**
- * @brief Current write position in ring buffer used for debug output
- * (next character to be queued).
+ * @brief Returns the number of log records that have been dropped (always 0 on the Linux host platform).
+ *
+ * @return Number of dropped log records
  */
-static uint16_t debugBufferWritePos = 0;
+uint32_t WE_Debug_GetDroppedRecords()
+{
+	return 0;
+}
+#endif /* WE_DEBUG_BINARY */
+#else
 
 /**
- * @brief Current read position in ring buffer used for debug output
- * (next character to be transferred).
+ * @brief Debug ring buffer size.
  */
-static uint16_t debugBufferReadPos = 0;
+#define WE_DEBUG_BUFFER_SIZE 2048
 
-static bool transferRunning = false;
+/**
+ * @brief UART used for debug output.
+ */
+static USART_TypeDef *uartDebug = NULL;
 
 /**
- * @brief Initializes UART2 and connects this interface to printf().
- *
- * Note that for redirection of printf() output to work, there must not be other
- * definitions of system file functions such as _write() (e.g. it might be necessary
- * to exclude the STM32CubeIDE-generated syscalls.c from compilation).
- *
- * Also note that it is not safe to call printf() from different contexts (e.g.
- * inside main and inside ISRs) - there is no guarantee, that the debug output is
- * forwarded correctly in all circumstances.
- *
- * There are two preprocessor defines controlling debug behavior:
- * - WE_DEBUG: Initialize debug UART and enable printing of debug messages in drivers.
- * - WE_DEBUG_INIT: Initialize debug UART but disable printing of debug messages in drivers
- *   (adds support for debugging using printf in user/example code, but drivers don't print
- *   diagnostic/debug info).
+ * @brief Ring buffer for debug output (output is transmitted asynchronously).
  */
-void WE_Debug_Init()
+static uint8_t debugBuffer[WE_DEBUG_BUFFER_SIZE];
+
+/**
+ * @brief Initializes the pins and the peripheral of the debug UART (USART2, 115200 baud).
+ */
+static void DebugUartInit()
 {
 	uartDebug = USART2;
 
@@ -153,6 +171,638 @@ void WE_Debug_Init()
 
 	LL_USART_ConfigAsyncMode(uartDebug);
 	LL_USART_Enable(uartDebug);
+}
+
+#if defined(WE_DEBUG_BINARY)
+
+/*
+ * Binary log mode: Instead of formatted text, each log message is stored as a record
+ * containing a timestamp, the address of the format string and the raw arguments.
+ * Formatting is done on the host by tools/we_log_decode.py, which looks up the format
+ * strings in the application's ELF file.
+ *
+ * Record layout (little endian, before framing):
+ * - uint32_t timestamp in microseconds (see WE_GetTickMicroseconds())
+ * - uint32_t address of format string (0 for plain text written via printf())
+ * - arguments in the order of the format string's conversion specifications:
+ *   - integer types, characters and pointers: 4 bytes (8 bytes for "ll" and "j")
+ *   - floating point types: 8 bytes (double)
+ *   - strings: 1 byte length followed by the (truncated) string without terminating zero
+ *   - '*' width or precision: 4 bytes
+ *   For plain text records, the text follows the header instead of the arguments.
+ *
+ * Records are COBS encoded and terminated by a zero byte, so that the host can
+ * resynchronize after lost or corrupted data.
+ *
+ * The records are stored in a ring buffer and transmitted via DMA. Writers only
+ * disable interrupts while reserving space and while committing the record, so that
+ * WE_Debug_Log() may be called from any context (including ISRs).
+ */
+
+/**
+ * @brief Max. size of a log record (before COBS encoding). Longer records are truncated.
+ */
+#ifndef WE_DEBUG_LOG_MAX_RECORD_SIZE
+#define WE_DEBUG_LOG_MAX_RECORD_SIZE 128
+#endif
+
+/**
+ * @brief Size of the log record header (timestamp and format string address).
+ */
+#define WE_DEBUG_LOG_HEADER_SIZE 8
+
+/**
+ * @brief Max. size of a COBS encoded log record including the trailing delimiter.
+ */
+#define WE_DEBUG_LOG_MAX_FRAME_SIZE (WE_DEBUG_LOG_MAX_RECORD_SIZE + WE_DEBUG_LOG_MAX_RECORD_SIZE / 254 + 2)
+
+/**
+ * @brief Offset at which a record is built in the frame buffer, so that it can be COBS encoded in place.
+ *
+ * The encoded data is ahead of the unencoded data by at most one byte per block of 254 bytes,
+ * so it never overwrites bytes that haven't been encoded yet.
+ */
+#define WE_DEBUG_LOG_RECORD_OFFSET (WE_DEBUG_LOG_MAX_FRAME_SIZE - WE_DEBUG_LOG_MAX_RECORD_SIZE)
+
+#if defined(STM32F401xE)
+/* USART2_TX: DMA1, stream 6, channel 4 */
+#define WE_DEBUG_DMA_STREAM LL_DMA_STREAM_6
+#define WE_DEBUG_DMA_CHANNEL LL_DMA_CHANNEL_4
+#elif defined(STM32L073xx)
+/* USART2_TX: DMA1, channel 4, request 4 */
+#define WE_DEBUG_DMA_CHANNEL LL_DMA_CHANNEL_4
+#define WE_DEBUG_DMA_REQUEST LL_DMA_REQUEST_4
+#elif defined(STM32L432xx)
+/* USART2_TX: DMA1, channel 7, request 2 */
+#define WE_DEBUG_DMA_CHANNEL LL_DMA_CHANNEL_7
+#define WE_DEBUG_DMA_REQUEST LL_DMA_REQUEST_2
+#endif
+
+/**
+ * @brief Position up to which space in the ring buffer has been reserved by writers.
+ */
+static volatile uint16_t debugBufferReservePos = 0;
+
+/**
+ * @brief Position up to which the ring buffer contains completely written records
+ * (end of data that may be transferred).
+ */
+static volatile uint16_t debugBufferCommitPos = 0;
+
+/**
+ * @brief Current read position in ring buffer (next byte to be transferred).
+ */
+static volatile uint16_t debugBufferReadPos = 0;
+
+/**
+ * @brief Number of writers that have reserved space but not yet committed their record.
+ */
+static volatile uint8_t debugActiveWriters = 0;
+
+/**
+ * @brief Number of bytes of the currently running DMA transfer (0 if no transfer is running).
+ */
+static volatile uint16_t debugTransferLength = 0;
+
+/**
+ * @brief Number of records that have been dropped because the ring buffer was full.
+ */
+static volatile uint32_t debugDroppedRecords = 0;
+
+/**
+ * @brief Configures the DMA used for transmitting the debug output.
+ */
+static void DebugDmaInit()
+{
+	LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+
+#if defined(STM32F401xE)
+	LL_DMA_SetChannelSelection(DMA1, WE_DEBUG_DMA_STREAM, WE_DEBUG_DMA_CHANNEL);
+	LL_DMA_SetDataTransferDirection(DMA1, WE_DEBUG_DMA_STREAM, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+	LL_DMA_SetStreamPriorityLevel(DMA1, WE_DEBUG_DMA_STREAM, LL_DMA_PRIORITY_LOW);
+	LL_DMA_SetMode(DMA1, WE_DEBUG_DMA_STREAM, LL_DMA_MODE_NORMAL);
+	LL_DMA_SetPeriphIncMode(DMA1, WE_DEBUG_DMA_STREAM, LL_DMA_PERIPH_NOINCREMENT);
+	LL_DMA_SetMemoryIncMode(DMA1, WE_DEBUG_DMA_STREAM, LL_DMA_MEMORY_INCREMENT);
+	LL_DMA_SetPeriphSize(DMA1, WE_DEBUG_DMA_STREAM, LL_DMA_PDATAALIGN_BYTE);
+	LL_DMA_SetMemorySize(DMA1, WE_DEBUG_DMA_STREAM, LL_DMA_MDATAALIGN_BYTE);
+	LL_DMA_DisableFifoMode(DMA1, WE_DEBUG_DMA_STREAM);
+	LL_DMA_SetPeriphAddress(DMA1, WE_DEBUG_DMA_STREAM, (uint32_t) &uartDebug->DR);
+#else
+	LL_DMA_SetPeriphRequest(DMA1, WE_DEBUG_DMA_CHANNEL, WE_DEBUG_DMA_REQUEST);
+	LL_DMA_SetDataTransferDirection(DMA1, WE_DEBUG_DMA_CHANNEL, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+	LL_DMA_SetChannelPriorityLevel(DMA1, WE_DEBUG_DMA_CHANNEL, LL_DMA_PRIORITY_LOW);
+	LL_DMA_SetMode(DMA1, WE_DEBUG_DMA_CHANNEL, LL_DMA_MODE_NORMAL);
+	LL_DMA_SetPeriphIncMode(DMA1, WE_DEBUG_DMA_CHANNEL, LL_DMA_PERIPH_NOINCREMENT);
+	LL_DMA_SetMemoryIncMode(DMA1, WE_DEBUG_DMA_CHANNEL, LL_DMA_MEMORY_INCREMENT);
+	LL_DMA_SetPeriphSize(DMA1, WE_DEBUG_DMA_CHANNEL, LL_DMA_PDATAALIGN_BYTE);
+	LL_DMA_SetMemorySize(DMA1, WE_DEBUG_DMA_CHANNEL, LL_DMA_MDATAALIGN_BYTE);
+	LL_DMA_SetPeriphAddress(DMA1, WE_DEBUG_DMA_CHANNEL, (uint32_t) &uartDebug->TDR);
+#endif
+
+	/* Enable DMA requests (the DMA is enabled for each transfer, completion is
+	 * detected using the UART's TC interrupt, so no DMA interrupt is required) */
+	LL_USART_EnableDMAReq_TX(uartDebug);
+}
+
+/**
+ * @brief Returns the number of bytes the DMA still has to transfer.
+ *
+ * @return Remaining number of bytes of the current DMA transfer
+ */
+static uint32_t DebugDmaGetRemaining()
+{
+#if defined(STM32F401xE)
+	return LL_DMA_GetDataLength(DMA1, WE_DEBUG_DMA_STREAM);
+#else
+	return LL_DMA_GetDataLength(DMA1, WE_DEBUG_DMA_CHANNEL);
+#endif
+}
+
+/**
+ * @brief Starts a DMA transfer of the next contiguous block of committed records, if no
+ * transfer is running. Must be called with interrupts disabled.
+ */
+static void DebugStartTransfer()
+{
+	uint16_t readPos = debugBufferReadPos;
+	uint16_t commitPos = debugBufferCommitPos;
+
+	if (debugTransferLength != 0 || readPos == commitPos)
+	{
+		return;
+	}
+
+	/* Transfer data up to commit position or end of buffer (the rest is transferred next time) */
+	uint16_t length = commitPos > readPos ? commitPos - readPos : WE_DEBUG_BUFFER_SIZE - readPos;
+	debugTransferLength = length;
+
+#if defined(STM32F401xE)
+	LL_DMA_DisableStream(DMA1, WE_DEBUG_DMA_STREAM);
+	while (LL_DMA_IsEnabledStream(DMA1, WE_DEBUG_DMA_STREAM))
+	{
+	}
+	LL_DMA_ClearFlag_TC6(DMA1);
+	LL_DMA_ClearFlag_HT6(DMA1);
+	LL_DMA_ClearFlag_TE6(DMA1);
+	LL_DMA_ClearFlag_DME6(DMA1);
+	LL_DMA_ClearFlag_FE6(DMA1);
+	LL_DMA_SetMemoryAddress(DMA1, WE_DEBUG_DMA_STREAM, (uint32_t) (debugBuffer + readPos));
+	LL_DMA_SetDataLength(DMA1, WE_DEBUG_DMA_STREAM, length);
+	LL_USART_ClearFlag_TC(uartDebug);
+	LL_DMA_EnableStream(DMA1, WE_DEBUG_DMA_STREAM);
+#else
+	LL_DMA_DisableChannel(DMA1, WE_DEBUG_DMA_CHANNEL);
+	LL_DMA_SetMemoryAddress(DMA1, WE_DEBUG_DMA_CHANNEL, (uint32_t) (debugBuffer + readPos));
+	LL_DMA_SetDataLength(DMA1, WE_DEBUG_DMA_CHANNEL, length);
+	LL_USART_ClearFlag_TC(uartDebug);
+	LL_DMA_EnableChannel(DMA1, WE_DEBUG_DMA_CHANNEL);
+#endif
+}
+
+/**
+ * @brief Initializes UART2 (transmission via DMA) for binary log output and connects this interface to printf().
+ *
+ * Output of printf() is transmitted as plain text records, so that it can be displayed
+ * by the host decoder together with the messages written using WE_LOG().
+ */
+void WE_Debug_Init()
+{
+	DebugUartInit();
+	DebugDmaInit();
+
+	/* Transfer complete interrupt is used to detect the end of DMA transfers */
+	LL_USART_ClearFlag_TC(uartDebug);
+	LL_USART_EnableIT_TC(uartDebug);
+	NVIC_SetPriority(USART2_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_UART_DEBUG, 0));
+	NVIC_EnableIRQ(USART2_IRQn);
+
+	/* No I/O buffering for STDOUT stream - transmit characters as soon as they are printed */
+	setvbuf(stdout, NULL, _IONBF, 0);
+}
+
+/**
+ * @brief Wait until any debug output pending to be written to UART has been transferred.
+ */
+void WE_Debug_Flush()
+{
+	while (debugTransferLength != 0 || debugBufferReadPos != debugBufferCommitPos)
+	{
+	}
+}
+
+/**
+ * @brief Returns the number of log records that have been dropped because the ring buffer was full.
+ *
+ * @return Number of dropped log records
+ */
+uint32_t WE_Debug_GetDroppedRecords()
+{
+	return debugDroppedRecords;
+}
+
+void USART2_IRQHandler(void)
+{
+	if (LL_USART_IsEnabledIT_TC(USART2) && LL_USART_IsActiveFlag_TC(USART2))
+	{
+		/* Clear flag */
+		LL_USART_ClearFlag_TC(USART2);
+
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+
+		/* The TC flag might also be set between two bytes of a DMA transfer,
+		 * so the transfer is only complete if the DMA has nothing left to transfer */
+		if (debugTransferLength != 0 && DebugDmaGetRemaining() == 0)
+		{
+			debugBufferReadPos = (debugBufferReadPos + debugTransferLength) % WE_DEBUG_BUFFER_SIZE;
+			debugTransferLength = 0;
+			DebugStartTransfer();
+		}
+
+		__set_PRIMASK(primask);
+	}
+}
+
+/**
+ * @brief COBS encodes a record in place and appends the frame delimiter (zero byte).
+ *
+ * Each byte is stored at its encoded position right away. The code byte of the current
+ * block is updated for every byte, so that there is no branch depending on the data
+ * (except for the rare blocks of 254 non-zero bytes).
+ *
+ * @param[in,out] frame Frame buffer (WE_DEBUG_LOG_MAX_FRAME_SIZE bytes) containing the record at
+ *                WE_DEBUG_LOG_RECORD_OFFSET, receives the encoded record
+ * @param[in] length Length of record
+ *
+ * @return Length of the encoded record including delimiter
+ */
+static uint16_t DebugCobsEncode(uint8_t *frame, uint16_t length)
+{
+	const uint8_t *record = &frame[WE_DEBUG_LOG_RECORD_OFFSET];
+	uint16_t codePos = 0;
+	uint16_t framePos = 1;
+	uint8_t code = 1;
+
+	for (uint16_t i = 0; i < length; i++)
+	{
+		uint8_t byte = record[i];
+		frame[framePos] = byte;
+
+		/* A zero byte ends the block, its position becomes the code position of the next block */
+		frame[codePos] = code;
+		codePos = (byte != 0) ? codePos : framePos;
+		code = (byte != 0) ? code + 1 : 1;
+		framePos++;
+
+		if (code == 0xFF)
+		{
+			frame[codePos] = code;
+			codePos = framePos++;
+			code = 1;
+		}
+	}
+	frame[codePos] = code;
+	frame[framePos++] = 0;
+
+	return framePos;
+}
+
+/**
+ * @brief Stores a frame in the ring buffer and starts the transfer.
+ *
+ * @param[in] frame Frame to be stored
+ * @param[in] length Length of frame
+ *
+ * @return true if the frame has been stored, false if it has been dropped (buffer full)
+ */
+static bool DebugWriteFrame(const uint8_t *frame, uint16_t length)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	/* Reserve space */
+	uint16_t readPos = debugBufferReadPos;
+	uint16_t writePos = debugBufferReservePos;
+	uint16_t spaceRemaining = readPos > writePos ? readPos - writePos - 1 :
+	WE_DEBUG_BUFFER_SIZE - writePos + readPos - 1;
+	if (length > spaceRemaining)
+	{
+		debugDroppedRecords++;
+		__set_PRIMASK(primask);
+		return false;
+	}
+	debugBufferReservePos = (writePos + length) % WE_DEBUG_BUFFER_SIZE;
+	debugActiveWriters++;
+
+	__set_PRIMASK(primask);
+
+	/* Copy frame (interrupts enabled, other writers may reserve space in the meantime) */
+	uint16_t chunkSize = length;
+	if (chunkSize > WE_DEBUG_BUFFER_SIZE - writePos)
+	{
+		chunkSize = WE_DEBUG_BUFFER_SIZE - writePos;
+	}
+	memcpy(debugBuffer + writePos, frame, chunkSize);
+	memcpy(debugBuffer, frame + chunkSize, length - chunkSize);
+
+	/* Commit - the data becomes available for transfer as soon as the last active writer is done */
+	__disable_irq();
+	debugActiveWriters--;
+	if (debugActiveWriters == 0)
+	{
+		debugBufferCommitPos = debugBufferReservePos;
+		DebugStartTransfer();
+	}
+	__set_PRIMASK(primask);
+
+	return true;
+}
+
+/**
+ * @brief Appends data to a record, truncating it if the record is full.
+ *
+ * @param[in,out] record Record
+ * @param[in] length Current length of record
+ * @param[in] data Data to be appended
+ * @param[in] size Size of data
+ *
+ * @return New length of record
+ */
+static uint16_t DebugRecordAppend(uint8_t *record, uint16_t length, const void *data, uint16_t size)
+{
+	if (size > WE_DEBUG_LOG_MAX_RECORD_SIZE - length)
+	{
+		size = WE_DEBUG_LOG_MAX_RECORD_SIZE - length;
+	}
+	memcpy(record + length, data, size);
+	return length + size;
+}
+
+/**
+ * @brief Writes the record header (timestamp and format string address).
+ *
+ * @param[out] record Record
+ * @param[in] format Format string (NULL for plain text records)
+ *
+ * @return Length of record
+ */
+static uint16_t DebugRecordStart(uint8_t *record, const char *format)
+{
+	uint32_t timestamp = WE_GetTickMicroseconds();
+	uint32_t formatAddress = (uint32_t) format;
+	uint16_t length = DebugRecordAppend(record, 0, &timestamp, sizeof(timestamp));
+	return DebugRecordAppend(record, length, &formatAddress, sizeof(formatAddress));
+}
+
+/**
+ * @brief Writes a log message as binary record (see WE_LOG()).
+ *
+ * The format string is not evaluated on the target - it is only scanned for the types
+ * of the arguments, which are then copied to the record. Note that the format string
+ * must be a string literal (located in flash), as only its address is transmitted.
+ *
+ * @param[in] format printf() format string
+ */
+void WE_Debug_Log(const char *format, ...)
+{
+	/* The record is built in the frame buffer and encoded in place */
+	uint8_t frame[WE_DEBUG_LOG_MAX_FRAME_SIZE];
+	uint8_t *record = &frame[WE_DEBUG_LOG_RECORD_OFFSET];
+
+	uint16_t length = DebugRecordStart(record, format);
+
+	va_list args;
+	va_start(args, format);
+
+	const char *pos = format;
+	while ((pos = strchr(pos, '%')) != NULL)
+	{
+		pos++;
+		if (*pos == '%')
+		{
+			pos++;
+			continue;
+		}
+
+		/* Flags */
+		while (*pos == '-' || *pos == '+' || *pos == ' ' || *pos == '#' || *pos == '0')
+		{
+			pos++;
+		}
+
+		/* Width */
+		if (*pos == '*')
+		{
+			int32_t width = va_arg(args, int);
+			length = DebugRecordAppend(record, length, &width, sizeof(width));
+			pos++;
+		}
+		while (*pos >= '0' && *pos <= '9')
+		{
+			pos++;
+		}
+
+		/* Precision (limits the length of strings) */
+		int32_t precision = -1;
+		if (*pos == '.')
+		{
+			pos++;
+			if (*pos == '*')
+			{
+				precision = va_arg(args, int);
+				length = DebugRecordAppend(record, length, &precision, sizeof(precision));
+				pos++;
+			}
+			else
+			{
+				precision = 0;
+				while (*pos >= '0' && *pos <= '9')
+				{
+					precision = precision * 10 + (*pos - '0');
+					pos++;
+				}
+			}
+		}
+
+		/* Length modifier */
+		bool isLong = false;
+		bool isLongLong = false;
+		bool isLongDouble = false;
+		while (*pos == 'h' || *pos == 'l' || *pos == 'j' || *pos == 'z' || *pos == 't' || *pos == 'L')
+		{
+			isLongLong = isLongLong || *pos == 'j' || (*pos == 'l' && isLong);
+			isLong = isLong || *pos == 'l' || *pos == 'z' || *pos == 't';
+			isLongDouble = isLongDouble || *pos == 'L';
+			pos++;
+		}
+
+		switch (*pos)
+		{
+		case 'd':
+		case 'i':
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+		case 'c':
+			if (isLongLong)
+			{
+				uint64_t value = va_arg(args, unsigned long long);
+				length = DebugRecordAppend(record, length, &value, sizeof(value));
+			}
+			else
+			{
+				uint32_t value = isLong ? va_arg(args, unsigned long) : va_arg(args, unsigned int);
+				length = DebugRecordAppend(record, length, &value, sizeof(value));
+			}
+			break;
+
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+		case 'a':
+		case 'A':
+		{
+			double value = isLongDouble ? (double) va_arg(args, long double) : va_arg(args, double);
+			length = DebugRecordAppend(record, length, &value, sizeof(value));
+			break;
+		}
+
+		case 's':
+		{
+			const char *string = va_arg(args, const char*);
+			if (string == NULL)
+			{
+				string = "(null)";
+			}
+			if (length == WE_DEBUG_LOG_MAX_RECORD_SIZE)
+			{
+				break;
+			}
+
+			/* Length byte followed by string (truncated to precision and remaining space) */
+			uint16_t maxLength = WE_DEBUG_LOG_MAX_RECORD_SIZE - length - 1;
+			if (precision >= 0 && precision < maxLength)
+			{
+				maxLength = precision;
+			}
+			if (maxLength > UINT8_MAX)
+			{
+				maxLength = UINT8_MAX;
+			}
+
+			/* The string is copied while determining its length (single pass) */
+			uint8_t *stringRecord = &record[length + 1];
+			uint8_t stringLength = 0;
+			while (stringLength < maxLength && string[stringLength] != '\0')
+			{
+				stringRecord[stringLength] = string[stringLength];
+				stringLength++;
+			}
+			record[length] = stringLength;
+			length += 1 + stringLength;
+			break;
+		}
+
+		case 'p':
+		{
+			uint32_t value = (uint32_t) va_arg(args, void*);
+			length = DebugRecordAppend(record, length, &value, sizeof(value));
+			break;
+		}
+
+		case 'n':
+			(void) va_arg(args, void*);
+			break;
+
+		case '\0':
+			/* Incomplete conversion specification at end of format string */
+			pos--;
+			break;
+
+		default:
+			break;
+		}
+		pos++;
+	}
+
+	va_end(args);
+
+	DebugWriteFrame(frame, DebugCobsEncode(frame, length));
+}
+
+int _write(int fd, char *ptr, int len)
+{
+	if (fd == STDOUT_FILENO || fd == STDERR_FILENO)
+	{
+		uint8_t frame[WE_DEBUG_LOG_MAX_FRAME_SIZE];
+		uint8_t *record = &frame[WE_DEBUG_LOG_RECORD_OFFSET];
+
+		/* Split text into plain text records */
+		int bytesWritten = 0;
+		while (bytesWritten < len)
+		{
+			uint16_t length = DebugRecordStart(record, NULL);
+			uint16_t chunkSize = WE_DEBUG_LOG_MAX_RECORD_SIZE - length;
+			if (chunkSize > len - bytesWritten)
+			{
+				chunkSize = len - bytesWritten;
+			}
+			length = DebugRecordAppend(record, length, ptr + bytesWritten, chunkSize);
+			DebugWriteFrame(frame, DebugCobsEncode(frame, length));
+			bytesWritten += chunkSize;
+		}
+
+		/* Text that didn't fit into the ring buffer is dropped (see WE_Debug_GetDroppedRecords()) */
+		return bytesWritten;
+	}
+
+	errno = EBADF;
+	return -1;
+}
+
+#else
+
+/**
+ * @brief Current write position in ring buffer used for debug output
+ * (next character to be queued).
+ */
+static uint16_t debugBufferWritePos = 0;
+
+/**
+ * @brief Current read position in ring buffer used for debug output
+ * (next character to be transferred).
+ */
+static uint16_t debugBufferReadPos = 0;
+
+static bool transferRunning = false;
+
+/**
+ * @brief Initializes UART2 and connects this interface to printf().
+ *
+ * Note that for redirection of printf() output to work, there must not be other
+ * definitions of system file functions such as _write() (e.g. it might be necessary
+ * to exclude the STM32CubeIDE-generated syscalls.c from compilation).
+ *
+ * Also note that it is not safe to call printf() from different contexts (e.g.
+ * inside main and inside ISRs) - there is no guarantee, that the debug output is
+ * forwarded correctly in all circumstances.
+ *
+ * There are three preprocessor defines controlling debug behavior:
+ * - WE_DEBUG: Initialize debug UART and enable printing of debug messages in drivers.
+ * - WE_DEBUG_INIT: Initialize debug UART but disable printing of debug messages in drivers
+ *   (adds support for debugging using printf in user/example code, but drivers don't print
+ *   diagnostic/debug info).
+ * - WE_DEBUG_BINARY (in addition to one of the above): Transmit messages written using
+ *   WE_LOG() as binary records via DMA instead of formatting them on the target (see
+ *   tools/we_log_decode.py for decoding the output on the host).
+ */
+void WE_Debug_Init()
+{
+	DebugUartInit();
 
 	/* Enable transfer complete interrupt */
 	LL_USART_EnableIT_TC(uartDebug);
@@ -274,4 +924,6 @@ int _write(int fd, char *ptr, int len)
 	errno = EBADF;
 	return -1;
 }
+#endif /* WE_DEBUG_BINARY */
+#endif /* WE_PLATFORM_LINUX */
 #endif // WE_DEBUG
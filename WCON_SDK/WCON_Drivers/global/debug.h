@@ -33,6 +33,9 @@
 
 #if defined(WE_DEBUG) || defined(WE_DEBUG_INIT)
 
+#include <stdint.h>
+#include <stdio.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -40,6 +43,34 @@ extern "C" {
 void WE_Debug_Init();
 void WE_Debug_Flush();
 
+#if defined(WE_DEBUG_BINARY)
+/**
+ * @brief Writes a log message in binary format.
+ *
+ * Only the address of the format string, a timestamp and the arguments are transmitted,
+ * the message is formatted on the host (see tools/we_log_decode.py). The format string
+ * must therefore be a string literal. On the Linux host platform, the message is
+ * formatted and printed immediately.
+ *
+ * @param[in] format printf() format string
+ */
+void WE_Debug_Log(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+/**
+ * @brief Returns the number of log records that have been dropped because the debug buffer was full.
+ *
+ * @return Number of dropped log records
+ */
+uint32_t WE_Debug_GetDroppedRecords();
+
+/**
+ * @brief Writes a log message (binary log record if WE_DEBUG_BINARY is defined, printf() otherwise).
+ */
+#define WE_LOG(...) WE_Debug_Log(__VA_ARGS__)
+#else
+#define WE_LOG(...) printf(__VA_ARGS__)
+#endif /* WE_DEBUG_BINARY */
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,6 +36,9 @@
 extern "C" {
 #endif
 
+#if defined(STM32L073xx) || defined(STM32F401xE)
+/* STM32 platforms (see global_Linux.c for the Linux host platform) */
+
 static GPIO_TypeDef *gpioPorts[] = {
 #ifdef 	GPIOA
 		GPIOA,
@@ -335,15 +338,91 @@ WE_Pin_Level_t WE_GetPinLevel(WE_Pin_t pin)
 /**
  * @brief Delays the microcontoller for the specified time.
  *
+ * If WE_UART_DMA is defined, data received by UARTs in pull mode is
+ * processed while waiting.
+ *
  * @param[in] sleepForMs: time in milliseconds.
  *         
  */
 void WE_Delay(uint16_t sleepForMs)
 {
+#if defined(WE_UART_DMA)
+	uint32_t tickStart = HAL_GetTick();
+	do
+	{
+		WE_UART_ProcessPendingRx();
+	} while ((HAL_GetTick() - tickStart) < sleepForMs);
+#else
 	if (sleepForMs > 0)
 	{
 		HAL_Delay((uint32_t) sleepForMs);
 	}
+#endif
+}
+
+/**
+ * @brief Sleeps until an event flag has been set or the timeout has expired.
+ *
+ * The core is put to sleep using WFI and is woken up by any interrupt, so the flag
+ * is checked again immediately after it has been set by an interrupt handler.
+ * Interrupts are disabled while checking the flag, so an interrupt occurring
+ * between the check and WFI still wakes up the core.
+ *
+ * If WE_UART_DMA is defined, data received by UARTs in pull mode is
+ * processed while waiting.
+ *
+ * @param[in] flag Flag to wait for
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ * @return true if the flag has been set, false if the timeout has expired
+ */
+bool WE_WaitForEvent(volatile bool *flag, uint32_t timeoutMs)
+{
+	uint32_t tickStart = HAL_GetTick();
+	while (true)
+	{
+#if defined(WE_UART_DMA)
+		WE_UART_ProcessPendingRx();
+#endif
+		if (*flag)
+		{
+			return true;
+		}
+
+		if ((HAL_GetTick() - tickStart) >= timeoutMs)
+		{
+			return false;
+		}
+
+		/* The SysTick interrupt wakes up the core at least once per millisecond */
+		__disable_irq();
+		if (!*flag)
+		{
+			__WFI();
+		}
+		__enable_irq();
+	}
+}
+
+/**
+ * @brief Disables interrupts (see WE_ExitCriticalSection())
+ *
+ * @return Previous interrupt mask (PRIMASK)
+ */
+uint32_t WE_EnterCriticalSection()
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	return primask;
+}
+
+/**
+ * @brief Restores the interrupt mask saved by WE_EnterCriticalSection()
+ *
+ * @param[in] state Interrupt mask returned by WE_EnterCriticalSection()
+ */
+void WE_ExitCriticalSection(uint32_t state)
+{
+	__set_PRIMASK(state);
 }
 
 /**
@@ -381,6 +460,8 @@ __weak uint32_t WE_GetTickMicroseconds()
 	return WE_GetTick() * 1000;
 }
 
+#endif /* defined(STM32L073xx) || defined(STM32F401xE) */
+
 /**
  * @brief Gets the Driver version
  *
@@ -40,6 +40,8 @@
 #include "global_L0xx.h"
 #elif defined(STM32F401xE)
 #include "global_F4xx.h"
+#elif defined(__linux__)
+#include "global_Linux.h"
 #endif
 
 #ifdef __cplusplus
@@ -59,6 +61,7 @@ extern "C" {
 #define fprintf(...)
 #define printf(...)
 #define fflush(...)
+#define WE_LOG(...)
 #endif /* WE_DEBUG */
 
 /**
@@ -128,6 +131,54 @@ extern bool WE_SetPin(WE_Pin_t pin, WE_Pin_Level_t out);
  */
 extern WE_Pin_Level_t WE_GetPinLevel(WE_Pin_t pin);
 
+/**
+ * @brief Get the error and receive buffer statistics of a UART.
+ *
+ * The counters are accumulated since the UART has been initialized or since the last
+ * call of WE_UART_ResetStatistics(). The DMA receive buffer values (dmaRxOverflows,
+ * dmaRxPeakFill) are only updated if WE_UART_DMA is defined.
+ *
+ * @param[in] instance UART instance
+ * @param[out] statistics Receives the current statistics
+ * @return true if request succeeded, false otherwise
+ */
+extern bool WE_UART_GetStatistics(WE_UART_Instance_t instance, WE_UART_Statistics_t *statistics);
+
+/**
+ * @brief Reset the error and receive buffer statistics of a UART.
+ *
+ * @param[in] instance UART instance
+ * @return true if request succeeded, false otherwise
+ */
+extern bool WE_UART_ResetStatistics(WE_UART_Instance_t instance);
+
+/**
+ * @brief Returns the time at which the data currently being processed by an rx byte handler has been received.
+ *
+ * Is intended to be called from within an rx byte handler (WE_UART_HandleRxByte_t), e.g. for
+ * measuring the latency of responses from the radio module. If data is received byte by byte,
+ * the timestamp is captured in the receive interrupt. If DMA is used, the timestamp is captured
+ * when the DMA receive event (idle line, half-transfer, transfer complete) is detected, i.e. it
+ * refers to the end of the received chunk rather than to its first byte.
+ *
+ * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+ *
+ * @return Receive time (in microseconds, see WE_GetTickMicroseconds())
+ */
+extern uint32_t WE_UART_GetRxTimestamp();
+
+/**
+ * @brief Returns the time at which the data currently being processed by an rx byte handler has
+ * been received in milliseconds (see WE_GetTick()).
+ *
+ * Same as WE_UART_GetRxTimestamp(), but uses the millisecond tick, which wraps around at 2^32.
+ * Is to be used for timeouts, as the microsecond timestamp (e.g. derived from the cycle counter)
+ * may wrap around at a lower value.
+ *
+ * @return Receive time (in milliseconds, see WE_GetTick())
+ */
+extern uint32_t WE_UART_GetRxTick();
+
 /**
  * @brief Sleep function.
  *
@@ -144,6 +195,43 @@ extern void WE_Delay(uint16_t sleepForMs);
  */
 extern void WE_DelayMicroseconds(uint32_t sleepForUsec);
 
+/**
+ * @brief Sleep until an event flag has been set or the timeout has expired.
+ *
+ * Is used by the drivers to wait for responses from the radio module: The flag is
+ * set by the driver's rx byte handler (e.g. when a complete frame or line has been
+ * received), which immediately wakes up the waiting thread. The caller should reset
+ * the flag before checking the condition it is waiting for.
+ *
+ * On STM32, the core sleeps (WFI) while waiting. On Linux, the calling thread blocks
+ * on a condition variable that is signaled by the UART receive thread.
+ *
+ * @param[in] flag Flag to wait for
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ * @return true if the flag has been set, false if the timeout has expired
+ */
+extern bool WE_WaitForEvent(volatile bool *flag, uint32_t timeoutMs);
+
+/**
+ * @brief Enters a critical section, i.e. prevents rx byte handlers from being executed.
+ *
+ * Is used by the drivers to protect data that is shared between the application and
+ * the rx byte handler. Critical sections may be nested and should be kept short.
+ *
+ * On STM32, interrupts are disabled. On Linux, a (recursive) mutex is locked, which the
+ * UART receive threads also hold while executing the rx byte handlers.
+ *
+ * @return State to be passed to WE_ExitCriticalSection()
+ */
+extern uint32_t WE_EnterCriticalSection();
+
+/**
+ * @brief Leaves a critical section entered using WE_EnterCriticalSection().
+ *
+ * @param[in] state State returned by the corresponding call of WE_EnterCriticalSection()
+ */
+extern void WE_ExitCriticalSection(uint32_t state);
+
 /**
  * @brief Returns current tick value (in milliseconds).
  *
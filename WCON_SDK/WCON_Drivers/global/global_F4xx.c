@@ -48,30 +48,159 @@ static uint32_t dwtTicksPerMicrosecond = 1;
 #define WE_PRIORITY_DMA_RX 0
 
 /**
- * @brief Size of DMA receive buffer.
+ * @brief Priority for DMA interrupts (used for transmitting data to radio module)
  */
+#define WE_PRIORITY_DMA_TX 0
+
+/**
+ * @brief Size of the default DMA receive buffer of each UART instance.
+ *
+ * Is used if no buffer has been supplied using WE_UARTx_SetRxBuffer(). May be set to 0 to
+ * omit the default buffers, in which case UARTs without a supplied buffer receive data
+ * using the character received interrupt.
+ */
+#ifndef WE_DMA_RX_BUFFER_SIZE
 #define WE_DMA_RX_BUFFER_SIZE 512
+#endif
+
+/**
+ * @brief DMA stream interrupt flags of stream 0 (shifted by WE_DMA_StreamFlagOffset[stream] for other streams).
+ */
+#define WE_DMA_FLAG_TC DMA_LISR_TCIF0
+#define WE_DMA_FLAG_HT DMA_LISR_HTIF0
+#define WE_DMA_FLAG_ALL (DMA_LISR_TCIF0 | DMA_LISR_HTIF0 | DMA_LISR_TEIF0 | DMA_LISR_DMEIF0 | DMA_LISR_FEIF0)
+
+/**
+ * @brief Bit offset of each DMA stream's flags in the LISR/LIFCR (streams 0-3) or HISR/HIFCR (streams 4-7) register.
+ */
+static const uint8_t WE_DMA_StreamFlagOffset[8] = {
+		0,
+		6,
+		16,
+		22,
+		0,
+		6,
+		16,
+		22 };
+#endif
+
+/**
+ * @brief Configuration of a pin used by a UART instance.
+ */
+typedef struct
+{
+	/**
+	 * @brief GPIO port (NULL if the pin is not available).
+	 */
+	GPIO_TypeDef *port;
+
+	/**
+	 * @brief GPIO pin (LL_GPIO_PIN_x).
+	 */
+	uint32_t pin;
+
+	/**
+	 * @brief Clock of the GPIO port (LL_AHB1_GRP1_PERIPH_GPIOx).
+	 */
+	uint32_t portClock;
+
+	/**
+	 * @brief Alternate function (LL_GPIO_AF_x).
+	 */
+	uint32_t alternate;
+
+	/**
+	 * @brief Pull-up / pull-down configuration (LL_GPIO_PULL_x).
+	 */
+	uint32_t pull;
+} WE_UART_PinConfig_t;
+
+#if defined(WE_UART_DMA)
+/**
+ * @brief Configuration of a DMA stream used by a UART instance.
+ */
+typedef struct
+{
+	/**
+	 * @brief DMA controller (NULL if DMA is not used for this direction).
+	 */
+	DMA_TypeDef *dma;
+
+	/**
+	 * @brief Clock of the DMA controller (LL_AHB1_GRP1_PERIPH_DMAx).
+	 */
+	uint32_t dmaClock;
 
-static void WE_DMA_for_UART1_OnDataReceived(uint8_t *data, size_t size);
-static void WE_DMA_for_UART1_Init();
-static void WE_DMA_for_UART1_DeInit();
-static void WE_UART1_CheckIfDmaDataAvailable();
-static void WE_UART1_CheckIfDmaDataAvailableAsync();
+	/**
+	 * @brief DMA stream (LL_DMA_STREAM_x).
+	 */
+	uint32_t stream;
 
-static void WE_DMA_for_UART6_OnDataReceived(uint8_t *data, size_t size);
-static void WE_DMA_for_UART6_Init();
-static void WE_DMA_for_UART6_DeInit();
-static void WE_UART6_CheckIfDmaDataAvailable();
-static void WE_UART6_CheckIfDmaDataAvailableAsync();
+	/**
+	 * @brief DMA channel selection (LL_DMA_CHANNEL_x).
+	 */
+	uint32_t channel;
 
+	/**
+	 * @brief Interrupt of the DMA stream.
+	 */
+	IRQn_Type irq;
+} WE_UART_DmaConfig_t;
 #endif
 
-static HAL_StatusTypeDef UartTransmitInternal(USART_TypeDef *hUart, const uint8_t *data, uint16_t size);
+/**
+ * @brief Hardware configuration of a UART instance.
+ */
+typedef struct
+{
+	/**
+	 * @brief UART peripheral.
+	 */
+	USART_TypeDef *uart;
+
+	/**
+	 * @brief UART interrupt.
+	 */
+	IRQn_Type irq;
+
+	/**
+	 * @brief Functions used to enable/disable the UART's bus clock (LL_APBx_GRP1_Enable/DisableClock).
+	 */
+	void (*clockEnable)(uint32_t periphs);
+	void (*clockDisable)(uint32_t periphs);
+
+	/**
+	 * @brief Bus clock of the UART (LL_APBx_GRP1_PERIPH_USARTx).
+	 */
+	uint32_t clock;
+
+	WE_UART_PinConfig_t txPin;
+	WE_UART_PinConfig_t rxPin;
+	WE_UART_PinConfig_t rtsPin;
+	WE_UART_PinConfig_t ctsPin;
+
+#if defined(WE_UART_DMA)
+	/**
+	 * @brief DMA used for receiving data from radio module (used only if DMA is enabled).
+	 */
+	WE_UART_DmaConfig_t dmaRx;
+
+	/**
+	 * @brief DMA used for transmitting data to radio module (used only if DMA is enabled).
+	 */
+	WE_UART_DmaConfig_t dmaTx;
+#endif
+} WE_UART_Config_t;
 
 typedef struct
 {
 	/**
-	 * @brief UART interface used for communicating with radio module.
+	 * @brief Hardware configuration of this UART instance.
+	 */
+	const WE_UART_Config_t *config;
+
+	/**
+	 * @brief UART interface used for communicating with radio module (NULL if not initialized).
 	 */
 	USART_TypeDef *uart;
 
@@ -86,60 +215,302 @@ typedef struct
 	WE_UART_HandleRxByte_t *rxByteHandlerP;
 
 #if defined(WE_UART_DMA)
+#if WE_DMA_RX_BUFFER_SIZE > 0
 	/**
-	 * @brief DMA used for receiving data from radio module (used only if DMA is enabled).
+	 * @brief Default buffer used for dmaRx.
+	 */
+	uint8_t WE_dmaRxBuffer[WE_DMA_RX_BUFFER_SIZE];
+#endif
+
+	/**
+	 * @brief Buffer used for dmaRx (used only if DMA is enabled).
+	 * @see UartSetRxBuffer()
 	 */
-	DMA_TypeDef *dmaRx;
+	uint8_t *dmaRxBuffer;
 
 	/**
-	 * @brief DMA stream used for receiving data from radio module (used only if DMA is enabled).
+	 * @brief Size of dmaRxBuffer (used only if DMA is enabled).
 	 */
-	uint32_t dmaRxStream;
+	uint16_t dmaRxBufferSize;
 
 	/**
-	 * @brief Buffer used for dmaRx.
+	 * @brief Defines how dmaRxBuffer is filled by the DMA (used only if DMA is enabled).
 	 */
-	uint8_t WE_dmaRxBuffer[WE_DMA_RX_BUFFER_SIZE];
+	WE_UART_RxBufferMode_t dmaRxBufferMode;
 
 	/**
 	 * @brief Last read position in DMA receive buffer (used only if DMA is enabled).
-	 * @see WE_UART1_CheckIfDmaDataAvailable()
+	 * @see UartCheckIfDmaDataAvailable()
 	 */
 	size_t dmaLastReadPos;
 
-	bool triggered;
+	/**
+	 * @brief DMA write position in receive buffer at the last receive event (used only if DMA is enabled).
+	 * @see UartUpdateDmaRxStatistics()
+	 */
+	size_t dmaLastWritePos;
+
+	/**
+	 * @brief Total number of bytes written to the DMA receive buffer (used only if DMA is enabled).
+	 */
+	uint32_t dmaRxWritten;
+
+	/**
+	 * @brief Total number of bytes read from the DMA receive buffer (used only if DMA is enabled).
+	 */
+	volatile uint32_t dmaRxRead;
+
+	/**
+	 * @brief Total number of bytes overwritten before being read (used only if DMA is enabled).
+	 */
+	uint32_t dmaRxDropped;
+
+	/**
+	 * @brief Is set if new data is to be processed by the PendSV handler (used only if DMA is enabled).
+	 */
+	volatile bool triggered;
+
+	/**
+	 * @brief Is true while UartDispatchRx() is passing data to the rx byte handler (used only if DMA is enabled).
+	 */
+	bool rxDispatching;
+
+	/**
+	 * @brief Defines how received data is delivered (used only if DMA is enabled).
+	 */
+	WE_UART_RxMode_t rxMode;
+
+	/**
+	 * @brief Segments still to be transmitted after the current DMA transfer (used only if DMA is enabled).
+	 * @see UartTransmitVInternal()
+	 */
+	const WE_UART_Segment_t *txSegments;
+
+	/**
+	 * @brief Number of entries in txSegments (used only if DMA is enabled).
+	 */
+	uint8_t txSegmentCount;
 #endif
 
+	/**
+	 * @brief Is true while an (asynchronous) transmission is in progress.
+	 */
+	volatile bool txBusy;
+
+	/**
+	 * @brief Optional function to be called when an asynchronous transmission has been completed.
+	 */
+	WE_UART_TxCompleteCallback_t txCompleteCallback;
+
 	/**
 	 * @brief Last received byte
 	 */
 	uint8_t receivedByte;
 
+	/**
+	 * @brief Error and receive buffer statistics (see WE_UART_GetStatistics()).
+	 */
+	WE_UART_Statistics_t statistics;
+
+	/**
+	 * @brief Time (microseconds) at which the data to be passed to the rx byte handler has
+	 * been received (see WE_UART_GetRxTimestamp()).
+	 */
+	volatile uint32_t rxTimestamp;
+
+	/**
+	 * @brief Time (milliseconds, see WE_GetTick()) at which the data to be passed to the rx byte
+	 * handler has been received (see WE_UART_GetRxTick()).
+	 */
+	volatile uint32_t rxTick;
+
 } WE_UART_Internal_t;
 
-WE_UART_Internal_t WE_UART1_Internal = {
-		.uart = NULL,
-		.flowControl = WE_FlowControl_NoFlowControl,
-		.rxByteHandlerP = NULL,
+/**
+ * @brief Hardware configuration of all UART instances.
+ *
+ * To add a UART instance, add an entry to WE_UART_Instance_t and to this table,
+ * add the wrapper functions (WE_UARTx_*) and forward the UART's interrupt
+ * (and DMA interrupts, if not yet handled) to UartIrqHandler() / UartDmaIrqHandler().
+ */
+static const WE_UART_Config_t WE_UART_Configs[WE_UART_Instance_Count] = {
+		[WE_UART_Instance_1] = {
+				/* USART1 GPIO Configuration
+				 PA11   ------> USART1_CTS
+				 PA12   ------> USART1_RTS
+				 PB6    ------> USART1_TX
+				 PB7    ------> USART1_RX
+				 */
+				.uart = USART1,
+				.irq = USART1_IRQn,
+				.clockEnable = LL_APB2_GRP1_EnableClock,
+				.clockDisable = LL_APB2_GRP1_DisableClock,
+				.clock = LL_APB2_GRP1_PERIPH_USART1,
+				.txPin = {
+						.port = GPIOB,
+						.pin = LL_GPIO_PIN_6,
+						.portClock = LL_AHB1_GRP1_PERIPH_GPIOB,
+						.alternate = LL_GPIO_AF_7,
+						.pull = LL_GPIO_PULL_NO },
+				.rxPin = {
+						.port = GPIOB,
+						.pin = LL_GPIO_PIN_7,
+						.portClock = LL_AHB1_GRP1_PERIPH_GPIOB,
+						.alternate = LL_GPIO_AF_7,
+						.pull = LL_GPIO_PULL_UP },
+				.rtsPin = {
+						.port = GPIOA,
+						.pin = LL_GPIO_PIN_12,
+						.portClock = LL_AHB1_GRP1_PERIPH_GPIOA,
+						.alternate = LL_GPIO_AF_7,
+						.pull = LL_GPIO_PULL_NO },
+				.ctsPin = {
+						.port = GPIOA,
+						.pin = LL_GPIO_PIN_11,
+						.portClock = LL_AHB1_GRP1_PERIPH_GPIOA,
+						.alternate = LL_GPIO_AF_7,
+						.pull = LL_GPIO_PULL_NO },
+#if defined(WE_UART_DMA)
+				/* USART1_RX: DMA2, stream 2, channel 4 */
+				.dmaRx = {
+						.dma = DMA2,
+						.dmaClock = LL_AHB1_GRP1_PERIPH_DMA2,
+						.stream = LL_DMA_STREAM_2,
+						.channel = LL_DMA_CHANNEL_4,
+						.irq = DMA2_Stream2_IRQn },
+				/* USART1_TX: DMA2, stream 7, channel 4 */
+				.dmaTx = {
+						.dma = DMA2,
+						.dmaClock = LL_AHB1_GRP1_PERIPH_DMA2,
+						.stream = LL_DMA_STREAM_7,
+						.channel = LL_DMA_CHANNEL_4,
+						.irq = DMA2_Stream7_IRQn },
+#endif
+		},
+		[WE_UART_Instance_6] = {
+				/* USART6 GPIO Configuration
+				 PC6    ------> USART6_TX
+				 PC7    ------> USART6_RX
+				 (flow control is not supported)
+				 */
+				.uart = USART6,
+				.irq = USART6_IRQn,
+				.clockEnable = LL_APB2_GRP1_EnableClock,
+				.clockDisable = LL_APB2_GRP1_DisableClock,
+				.clock = LL_APB2_GRP1_PERIPH_USART6,
+				.txPin = {
+						.port = GPIOC,
+						.pin = LL_GPIO_PIN_6,
+						.portClock = LL_AHB1_GRP1_PERIPH_GPIOC,
+						.alternate = LL_GPIO_AF_8,
+						.pull = LL_GPIO_PULL_NO },
+				.rxPin = {
+						.port = GPIOC,
+						.pin = LL_GPIO_PIN_7,
+						.portClock = LL_AHB1_GRP1_PERIPH_GPIOC,
+						.alternate = LL_GPIO_AF_8,
+						.pull = LL_GPIO_PULL_UP },
+				.rtsPin = {
+						.port = NULL },
+				.ctsPin = {
+						.port = NULL },
 #if defined(WE_UART_DMA)
-		.dmaRx = NULL,
-		.dmaRxStream = 0,
-		.dmaLastReadPos = 0,
-		.triggered = false,
+				/* USART6_RX: DMA2, stream 1, channel 5 */
+				.dmaRx = {
+						.dma = DMA2,
+						.dmaClock = LL_AHB1_GRP1_PERIPH_DMA2,
+						.stream = LL_DMA_STREAM_1,
+						.channel = LL_DMA_CHANNEL_5,
+						.irq = DMA2_Stream1_IRQn },
+				/* USART6_TX: DMA2, stream 6, channel 5 */
+				.dmaTx = {
+						.dma = DMA2,
+						.dmaClock = LL_AHB1_GRP1_PERIPH_DMA2,
+						.stream = LL_DMA_STREAM_6,
+						.channel = LL_DMA_CHANNEL_5,
+						.irq = DMA2_Stream6_IRQn },
 #endif
-		};
+		}, };
+
+/**
+ * @brief Runtime state of all UART instances.
+ */
+static WE_UART_Internal_t WE_UART_Instances[WE_UART_Instance_Count] = {
+		[WE_UART_Instance_1] = {
+				.config = &WE_UART_Configs[WE_UART_Instance_1] },
+		[WE_UART_Instance_6] = {
+				.config = &WE_UART_Configs[WE_UART_Instance_6] }, };
+
+/**
+ * @brief Receive timestamp of the data currently being passed to an rx byte handler (see WE_UART_GetRxTimestamp()).
+ */
+static volatile uint32_t WE_UART_currentRxTimestamp = 0;
+
+/**
+ * @brief Receive time (milliseconds) of the data currently being passed to an rx byte handler (see WE_UART_GetRxTick()).
+ */
+static volatile uint32_t WE_UART_currentRxTick = 0;
+
+static bool UartInit(WE_UART_Internal_t *uartInternal, uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP);
+static bool UartDeInit(WE_UART_Internal_t *uartInternal);
+static void UartInitPin(const WE_UART_PinConfig_t *pinConfig);
+static void UartIrqHandler(WE_UART_Internal_t *uartInternal);
+static void UartDeliverRx(WE_UART_Internal_t *uartInternal, uint8_t *data, size_t length);
+/**
+ * @brief Passes received data to the rx byte handler.
+ *
+ * While the handler is executed, WE_UART_GetRxTimestamp() and WE_UART_GetRxTick() return the time at which
+ * the data has been received (the previous value is restored afterwards, as this
+ * function may be interrupted by the receive interrupt of another UART).
+ *
+ * @param[in] uartInternal UART that has received the data
+ * @param[in] data Received data
+ * @param[in] length Number of bytes received
+ */
+static void UartDeliverRx(WE_UART_Internal_t *uartInternal, uint8_t *data, size_t length)
+{
+	if ((uartInternal->rxByteHandlerP == NULL) || (*uartInternal->rxByteHandlerP == NULL))
+	{
+		return;
+	}
+
+	uint32_t previousTimestamp = WE_UART_currentRxTimestamp;
+	uint32_t previousTick = WE_UART_currentRxTick;
+	WE_UART_currentRxTimestamp = uartInternal->rxTimestamp;
+	WE_UART_currentRxTick = uartInternal->rxTick;
+	(*uartInternal->rxByteHandlerP)(data, length);
+	WE_UART_currentRxTimestamp = previousTimestamp;
+	WE_UART_currentRxTick = previousTick;
+}
 
-WE_UART_Internal_t WE_UART6_Internal = {
-		.uart = NULL,
-		.flowControl = WE_FlowControl_NoFlowControl,
-		.rxByteHandlerP = NULL,
+static HAL_StatusTypeDef UartTransmitInternal(USART_TypeDef *hUart, const uint8_t *data, uint16_t size);
+static bool UartTransmit(WE_UART_Internal_t *uartInternal, const uint8_t *data, uint16_t size);
+static bool UartTransmitAsyncInternal(WE_UART_Internal_t *uartInternal, const uint8_t *data, uint16_t size);
+static bool UartWaitForTxIdleInternal(WE_UART_Internal_t *uartInternal, uint32_t timeoutMs);
+static bool UartTransmitVInternal(WE_UART_Internal_t *uartInternal, const WE_UART_Segment_t *segments, uint8_t count);
+static void UartOnTxComplete(WE_UART_Internal_t *uartInternal);
 #if defined(WE_UART_DMA)
-		.dmaRx = NULL,
-		.dmaRxStream = 0,
-		.dmaLastReadPos = 0,
-		.triggered = false,
+static void UartDmaIrqHandler();
+static void UartDmaRxInit(WE_UART_Internal_t *uartInternal);
+static void UartDmaRxDeInit(WE_UART_Internal_t *uartInternal);
+static size_t UartDmaRxWritePos(WE_UART_Internal_t *uartInternal);
+static bool UartSetRxBuffer(WE_UART_Internal_t *uartInternal, uint8_t *buffer, uint16_t size, WE_UART_RxBufferMode_t mode);
+static void UartDmaTxInit(WE_UART_Internal_t *uartInternal);
+static void UartDmaTxDeInit(WE_UART_Internal_t *uartInternal);
+static bool DmaIsActiveFlag(const WE_UART_DmaConfig_t *dmaConfig, uint32_t flag);
+static void DmaClearFlags(const WE_UART_DmaConfig_t *dmaConfig, uint32_t flags);
+static void UartCheckIfDmaDataAvailable(WE_UART_Internal_t *uartInternal);
+static void UartCheckIfDmaDataAvailableAsync(WE_UART_Internal_t *uartInternal);
+static void UartUpdateDmaRxStatistics(WE_UART_Internal_t *uartInternal);
+static uint16_t UartRxPeekInternal(WE_UART_Internal_t *uartInternal, WE_UART_Segment_t spans[2]);
+static void UartRxConsumeInternal(WE_UART_Internal_t *uartInternal, uint16_t length);
+static void UartDispatchRx(WE_UART_Internal_t *uartInternal);
+static uint16_t UartRxPeek(WE_UART_Internal_t *uartInternal, WE_UART_Segment_t spans[2]);
+static void UartRxConsume(WE_UART_Internal_t *uartInternal, uint16_t length);
+static void UartProcessRx(WE_UART_Internal_t *uartInternal);
+static void UartStartDmaTransfer(WE_UART_Internal_t *uartInternal, const uint8_t *data, uint16_t size);
+static bool UartStartNextSegment(WE_UART_Internal_t *uartInternal);
 #endif
-		};
 
 void WE_SystemClock_Config()
 {
@@ -213,472 +584,265 @@ void WE_SystemClock_Config()
 #endif
 }
 
+bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP)
+{
+	return UartInit(&WE_UART_Instances[WE_UART_Instance_1], baudrate, flowControl, parity, rxByteHandlerP);
+}
+
+bool WE_UART1_DeInit()
+{
+	return UartDeInit(&WE_UART_Instances[WE_UART_Instance_1]);
+}
+
 bool WE_UART1_Transmit(const uint8_t *data, uint16_t length)
 {
-	return (HAL_OK == UartTransmitInternal(WE_UART1_Internal.uart, data, length));
+	return UartTransmit(&WE_UART_Instances[WE_UART_Instance_1], data, length);
 }
 
-bool WE_UART6_Transmit(const uint8_t *data, uint16_t length)
+bool WE_UART1_TransmitAsync(const uint8_t *data, uint16_t length)
 {
-	return (HAL_OK == UartTransmitInternal(WE_UART6_Internal.uart, data, length));
+	return UartTransmitAsyncInternal(&WE_UART_Instances[WE_UART_Instance_1], data, length);
 }
 
-bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP)
+bool WE_UART1_WaitForTxIdle(uint32_t timeoutMs)
 {
-	WE_UART1_Internal.flowControl = flowControl;
-	WE_UART1_Internal.rxByteHandlerP = rxByteHandlerP;
+	return UartWaitForTxIdleInternal(&WE_UART_Instances[WE_UART_Instance_1], timeoutMs);
+}
 
-#if defined(WE_UART_DMA)
-	/* Enable pendable service interrupt which is used for processing data received from radio module
-	 * (interrupt is triggered via WE_UART1_CheckIfDmaDataAvailableAsync() when bytes have been received) */
-	NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_RX_DATA_PROCESSING, 0));
-	NVIC_EnableIRQ(PendSV_IRQn);
-#endif
+void WE_UART1_SetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback)
+{
+	WE_UART_Instances[WE_UART_Instance_1].txCompleteCallback = callback;
+}
 
-	/* USART1 clock enable */
-	LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_USART1);
-	LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOB);
+bool WE_UART1_TransmitV(const WE_UART_Segment_t *segments, uint8_t count)
+{
+	return UartTransmitVInternal(&WE_UART_Instances[WE_UART_Instance_1], segments, count);
+}
 
-	/* USART 1 GPIO initialization */
-	LL_GPIO_InitTypeDef gpioInitStruct = {
-			0 };
+bool WE_UART6_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP)
+{
+	return UartInit(&WE_UART_Instances[WE_UART_Instance_6], baudrate, flowControl, parity, rxByteHandlerP);
+}
 
-	/* USART1 GPIO Configuration
-	 PA11   ------> USART1_CTS
-	 PA12   ------> USART1_RTS
-	 PB6    ------> USART1_TX
-	 PB7    ------> USART1_RX
-	 */
-	gpioInitStruct.Pin = LL_GPIO_PIN_6;
-	gpioInitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-	gpioInitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-	gpioInitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-	gpioInitStruct.Pull = LL_GPIO_PULL_NO;
-	gpioInitStruct.Alternate = LL_GPIO_AF_7;
-	LL_GPIO_Init(GPIOB, &gpioInitStruct);
+bool WE_UART6_DeInit()
+{
+	return UartDeInit(&WE_UART_Instances[WE_UART_Instance_6]);
+}
 
-	gpioInitStruct.Pin = LL_GPIO_PIN_7;
-	gpioInitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-	gpioInitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-	gpioInitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-	gpioInitStruct.Pull = LL_GPIO_PULL_UP;
-	gpioInitStruct.Alternate = LL_GPIO_AF_7;
-	LL_GPIO_Init(GPIOB, &gpioInitStruct);
+bool WE_UART6_Transmit(const uint8_t *data, uint16_t length)
+{
+	return UartTransmit(&WE_UART_Instances[WE_UART_Instance_6], data, length);
+}
 
-	/* Flow control pins */
-	if (WE_FlowControl_NoFlowControl != WE_UART1_Internal.flowControl)
-	{
-		/* enable port clock */
-		LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOA);
+bool WE_UART6_TransmitAsync(const uint8_t *data, uint16_t length)
+{
+	return UartTransmitAsyncInternal(&WE_UART_Instances[WE_UART_Instance_6], data, length);
+}
 
-		if (WE_FlowControl_RTSOnly == WE_UART1_Internal.flowControl || WE_FlowControl_RTSAndCTS == WE_UART1_Internal.flowControl)
-		{
-			gpioInitStruct.Pin = LL_GPIO_PIN_12;
-			gpioInitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-			gpioInitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-			gpioInitStruct.Pull = LL_GPIO_PULL_NO;
-			gpioInitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-			gpioInitStruct.Alternate = LL_GPIO_AF_7;
-			LL_GPIO_Init(GPIOA, &gpioInitStruct);
-		}
-		if (WE_FlowControl_CTSOnly == WE_UART1_Internal.flowControl || WE_FlowControl_RTSAndCTS == WE_UART1_Internal.flowControl)
-		{
-			gpioInitStruct.Pin = LL_GPIO_PIN_11;
-			gpioInitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-			gpioInitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-			gpioInitStruct.Pull = LL_GPIO_PULL_NO;
-			gpioInitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-			gpioInitStruct.Alternate = LL_GPIO_AF_7;
-			LL_GPIO_Init(GPIOA, &gpioInitStruct);
-		}
-	}
+bool WE_UART6_WaitForTxIdle(uint32_t timeoutMs)
+{
+	return UartWaitForTxIdleInternal(&WE_UART_Instances[WE_UART_Instance_6], timeoutMs);
+}
 
-	/* Initialize USART1 */
+void WE_UART6_SetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback)
+{
+	WE_UART_Instances[WE_UART_Instance_6].txCompleteCallback = callback;
+}
 
-	WE_UART1_Internal.uart = USART1;
+bool WE_UART6_TransmitV(const WE_UART_Segment_t *segments, uint8_t count)
+{
+	return UartTransmitVInternal(&WE_UART_Instances[WE_UART_Instance_6], segments, count);
+}
 
-	LL_USART_InitTypeDef uartInitStruct = {
-			0 };
-	uartInitStruct.BaudRate = baudrate;
-	/* Data width / word length is specified including parity bit - so if using
-	 * a parity bit, 9 bit data width has to be set */
-	if (parity == WE_Parity_None)
-	{
-		uartInitStruct.DataWidth = LL_USART_DATAWIDTH_8B;
-	}
-	else
+bool WE_UART_GetStatistics(WE_UART_Instance_t instance, WE_UART_Statistics_t *statistics)
+{
+	if ((instance >= WE_UART_Instance_Count) || (statistics == NULL))
 	{
-		uartInitStruct.DataWidth = LL_USART_DATAWIDTH_9B;
+		return false;
 	}
-	uartInitStruct.StopBits = LL_USART_STOPBITS_1;
-	switch (parity)
-	{
-	case WE_Parity_Odd:
-		uartInitStruct.Parity = LL_USART_PARITY_ODD;
-		break;
 
-	case WE_Parity_Even:
-		uartInitStruct.Parity = LL_USART_PARITY_EVEN;
-		break;
+	/* Counters are updated in interrupt context */
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	*statistics = WE_UART_Instances[instance].statistics;
+	__set_PRIMASK(primask);
+	return true;
+}
 
-	case WE_Parity_None:
-	default:
-		uartInitStruct.Parity = LL_USART_PARITY_NONE;
-		break;
-	}
-	uartInitStruct.TransferDirection = LL_USART_DIRECTION_TX_RX;
-	switch (WE_UART1_Internal.flowControl)
+bool WE_UART_ResetStatistics(WE_UART_Instance_t instance)
+{
+	if (instance >= WE_UART_Instance_Count)
 	{
-	case WE_FlowControl_RTSOnly:
-		uartInitStruct.HardwareFlowControl = LL_USART_HWCONTROL_RTS;
-		break;
+		return false;
+	}
 
-	case WE_FlowControl_CTSOnly:
-		uartInitStruct.HardwareFlowControl = LL_USART_HWCONTROL_CTS;
-		break;
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	WE_UART_Instances[instance].statistics = (WE_UART_Statistics_t) {
+			0 };
+	__set_PRIMASK(primask);
+	return true;
+}
 
-	case WE_FlowControl_RTSAndCTS:
-		uartInitStruct.HardwareFlowControl = LL_USART_HWCONTROL_RTS_CTS;
-		break;
+uint32_t WE_UART_GetRxTimestamp()
+{
+	return WE_UART_currentRxTimestamp;
+}
 
-	case WE_FlowControl_NoFlowControl:
-	default:
-		uartInitStruct.HardwareFlowControl = LL_USART_HWCONTROL_NONE;
-		break;
-	}
-
-	uartInitStruct.OverSampling = LL_USART_OVERSAMPLING_16;
-	LL_USART_Init(WE_UART1_Internal.uart, &uartInitStruct);
-
-	LL_USART_ConfigAsyncMode(WE_UART1_Internal.uart);
-	LL_USART_Enable(WE_UART1_Internal.uart);
-
-	/* USART1 interrupt Init */
-	NVIC_SetPriority(USART1_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_UART_RX, 0));
-	NVIC_EnableIRQ(USART1_IRQn);
+uint32_t WE_UART_GetRxTick()
+{
+	return WE_UART_currentRxTick;
+}
 
 #if defined(WE_UART_DMA)
-	WE_DMA_for_UART1_Init();
-#else
-	// Legacy mode using USART interrupt
-	LL_USART_EnableIT_RXNE(WE_UART1_Internal.uart);
-#endif
-
-	return true;
+void WE_UART1_SetRxMode(WE_UART_RxMode_t mode)
+{
+	WE_UART_Instances[WE_UART_Instance_1].rxMode = mode;
 }
 
-bool WE_UART1_DeInit()
+bool WE_UART1_SetRxBuffer(uint8_t *buffer, uint16_t size, WE_UART_RxBufferMode_t mode)
 {
-	if (WE_UART1_Internal.uart == NULL)
-	{
-		return true;
-	}
-
-#if defined(WE_UART_DMA)
-	WE_DMA_for_UART1_DeInit();
-#else
-	LL_USART_DisableIT_RXNE(WE_UART1_Internal.uart);
-#endif
+	return UartSetRxBuffer(&WE_UART_Instances[WE_UART_Instance_1], buffer, size, mode);
+}
 
-	WE_UART1_Internal.rxByteHandlerP = NULL;
+uint16_t WE_UART1_RxPeek(WE_UART_Segment_t spans[2])
+{
+	return UartRxPeek(&WE_UART_Instances[WE_UART_Instance_1], spans);
+}
 
-	NVIC_DisableIRQ(USART1_IRQn);
-	LL_USART_Disable(WE_UART1_Internal.uart);
-	LL_USART_DeInit(WE_UART1_Internal.uart);
-	LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_GPIOB);
-	LL_APB2_GRP1_DisableClock(LL_APB2_GRP1_PERIPH_USART1);
+void WE_UART1_RxConsume(uint16_t length)
+{
+	UartRxConsume(&WE_UART_Instances[WE_UART_Instance_1], length);
+}
 
-	if (WE_FlowControl_NoFlowControl != WE_UART1_Internal.flowControl)
-	{
-		LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_GPIOA);
-	}
+void WE_UART1_ProcessRx()
+{
+	UartProcessRx(&WE_UART_Instances[WE_UART_Instance_1]);
+}
 
-	WE_UART1_Internal.uart = NULL;
-	return true;
+void WE_UART6_SetRxMode(WE_UART_RxMode_t mode)
+{
+	WE_UART_Instances[WE_UART_Instance_6].rxMode = mode;
 }
 
-static HAL_StatusTypeDef UartTransmitInternal(USART_TypeDef *hUart, const uint8_t *data, uint16_t size)
+bool WE_UART6_SetRxBuffer(uint8_t *buffer, uint16_t size, WE_UART_RxBufferMode_t mode)
 {
-	for (; size > 0; --size, ++data)
-	{
-		LL_USART_TransmitData8(hUart, *data);
-		while (!LL_USART_IsActiveFlag_TXE(hUart))
-		{
-		}
-	}
-	while (!LL_USART_IsActiveFlag_TC(hUart))
-	{
-	}
-	return HAL_OK;
+	return UartSetRxBuffer(&WE_UART_Instances[WE_UART_Instance_6], buffer, size, mode);
 }
 
-/**
- * @brief Interrupt handler for data received from wireless module via UART.
- *
- * Handles the following interrupts, depending on whether DMA is enabled or not:
- * - If DMA is enabled: Idle line interrupt
- * - If DMA is disabled: Character received interrupt
- */
-void USART1_IRQHandler()
+uint16_t WE_UART6_RxPeek(WE_UART_Segment_t spans[2])
 {
-#if defined(WE_UART_DMA)
-	if (LL_USART_IsActiveFlag_IDLE(USART1))
-	{
-		/* USART idle line interrupt (used only if DMA is enabled) */
+	return UartRxPeek(&WE_UART_Instances[WE_UART_Instance_6], spans);
+}
 
-		LL_USART_ClearFlag_IDLE(USART1);
-		WE_UART1_CheckIfDmaDataAvailableAsync();
-	}
-#else
-    if (LL_USART_IsActiveFlag_RXNE(WE_UART1_Internal.uart))
-    {
-        /* Character has been received (used only if DMA is disabled) */
+void WE_UART6_RxConsume(uint16_t length)
+{
+	UartRxConsume(&WE_UART_Instances[WE_UART_Instance_6], length);
+}
 
-        /* RXNE flag will be cleared by reading of DR register */
-    	WE_UART1_Internal.receivedByte = LL_USART_ReceiveData8(WE_UART1_Internal.uart);
-    	(*WE_UART1_Internal.rxByteHandlerP)(&WE_UART1_Internal.receivedByte, 1);
-    }
-	if (LL_USART_IsActiveFlag_ORE(WE_UART1_Internal.uart)) {
-        LL_USART_ClearFlag_ORE(WE_UART1_Internal.uart);
-    }
-#endif
+void WE_UART6_ProcessRx()
+{
+	UartProcessRx(&WE_UART_Instances[WE_UART_Instance_6]);
 }
 
-#if defined(WE_UART_DMA)
+#endif /* defined(WE_UART_DMA) */
 
 /**
- * @brief Interrupt handler for data received from wireless module via DMA.
- *
- * Is only used if DMA is enabled.
+ * @brief UART interrupt handlers (see UartIrqHandler()).
  */
-void DMA2_Stream2_IRQHandler()
+void USART1_IRQHandler()
 {
-	if (LL_DMA_IsEnabledIT_HT(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream) && LL_DMA_IsActiveFlag_HT2(WE_UART1_Internal.dmaRx))
-	{
-		/* DMA receive half-transfer complete */
-		LL_DMA_ClearFlag_HT2(WE_UART1_Internal.dmaRx);
-		WE_UART1_CheckIfDmaDataAvailableAsync();
-	}
-
-	if (LL_DMA_IsEnabledIT_TC(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream) && LL_DMA_IsActiveFlag_TC2(WE_UART1_Internal.dmaRx))
-	{
-		/* DMA receive transfer complete */
-		LL_DMA_ClearFlag_TC2(WE_UART1_Internal.dmaRx);
-		WE_UART1_CheckIfDmaDataAvailableAsync();
-	}
-
-	/* Other events can be implemented if required. */
+	UartIrqHandler(&WE_UART_Instances[WE_UART_Instance_1]);
 }
 
-void DMA2_Stream1_IRQHandler()
+void USART6_IRQHandler()
 {
-	if (LL_DMA_IsEnabledIT_HT(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream) && LL_DMA_IsActiveFlag_HT1(WE_UART6_Internal.dmaRx))
-	{
-		/* DMA receive half-transfer complete */
-		LL_DMA_ClearFlag_HT1(WE_UART6_Internal.dmaRx);
-		WE_UART6_CheckIfDmaDataAvailableAsync();
-	}
-
-	if (LL_DMA_IsEnabledIT_TC(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream) && LL_DMA_IsActiveFlag_TC1(WE_UART6_Internal.dmaRx))
-	{
-		/* DMA receive transfer complete */
-		LL_DMA_ClearFlag_TC1(WE_UART6_Internal.dmaRx);
-		WE_UART6_CheckIfDmaDataAvailableAsync();
-	}
-
-	/* Other events can be implemented if required. */
+	UartIrqHandler(&WE_UART_Instances[WE_UART_Instance_6]);
 }
 
+#if defined(WE_UART_DMA)
 /**
- * @brief Pendable service interrupt handler.
- *
- * Is used for asynchronous processing of data received from radio module via DMA.
- * Calls WE_UART1_CheckIfDmaDataAvailable().
+ * @brief DMA interrupt handlers (see UartDmaIrqHandler()).
  *
- * @see WE_UART1_CheckIfDmaDataAvailableAsync()
+ * Are only used if DMA is enabled.
  */
-void PendSV_Handler()
+void DMA2_Stream1_IRQHandler()
 {
-	if (WE_UART1_Internal.triggered)
-	{
-		WE_UART1_Internal.triggered = false;
-		WE_UART1_CheckIfDmaDataAvailable();
-	}
-
-	if (WE_UART6_Internal.triggered)
-	{
-		WE_UART6_Internal.triggered = false;
-		WE_UART6_CheckIfDmaDataAvailable();
-	}
+	UartDmaIrqHandler();
 }
 
-static void WE_UART6_CheckIfDmaDataAvailableAsync()
+void DMA2_Stream2_IRQHandler()
 {
-	/* Trigger pendable service interrupt (PendSV) */
-	SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
-	WE_UART6_Internal.triggered = true;
+	UartDmaIrqHandler();
 }
 
-static void WE_UART1_CheckIfDmaDataAvailableAsync()
+void DMA2_Stream6_IRQHandler()
 {
-	/* Trigger pendable service interrupt (PendSV) */
-	SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
-	WE_UART1_Internal.triggered = true;
+	UartDmaIrqHandler();
 }
 
-static void WE_UART1_CheckIfDmaDataAvailable()
+void DMA2_Stream7_IRQHandler()
 {
-	/* Get current DMA write position (in ring buffer) */
-	size_t pos = WE_DMA_RX_BUFFER_SIZE - LL_DMA_GetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-
-	/* Check if new data is available (i.e. write position has changed) */
-	if (pos != WE_UART1_Internal.dmaLastReadPos)
-	{
-		if (pos > WE_UART1_Internal.dmaLastReadPos)
-		{
-			/* Data to be read from DMA ring buffer is continuous - between lastPos and pos */
-			WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[WE_UART1_Internal.dmaLastReadPos], pos - WE_UART1_Internal.dmaLastReadPos);
-		}
-		else /* pos < WE_UART1_Internal.dmaLastReadPos */
-		{
-			/* Ring buffer write position has reached the end of the buffer and restarted at the beginning.
-			 * Data is split:
-			 * - Bytes between lastPos and the end of the buffer
-			 * - Bytes between start of the buffer and pos
-			 */
-			WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[WE_UART1_Internal.dmaLastReadPos], WE_DMA_RX_BUFFER_SIZE - WE_UART1_Internal.dmaLastReadPos);
-			if (pos > 0)
-			{
-				WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[0], pos);
-			}
-		}
-
-		/* Store DMA write position for next interrupt */
-		WE_UART1_Internal.dmaLastReadPos = pos;
-	}
+	UartDmaIrqHandler();
 }
+#endif /* defined(WE_UART_DMA) */
 
 /**
- * @brief Is called when one or more bytes have been received from UART via DMA.
- * @param data Received data
- * @param size Number of bytes received
+ * @brief Initializes and starts a UART instance.
+ *
+ * @param[in] uartInternal UART to be initialized
+ * @param[in] baudrate Baud rate of the serial interface
+ * @param[in] flowControl Enable/disable flow control
+ * @param[in] parity Parity bit configuration
+ * @param[in] rxByteHandlerP Pointer to the handle rx byte function inside the driver
+ *
+ * @return true if successful, false otherwise
  */
-static void WE_DMA_for_UART1_OnDataReceived(uint8_t *data, size_t size)
-{
-	(*WE_UART1_Internal.rxByteHandlerP)(data, size);
-}
-
-static void WE_DMA_for_UART1_Init()
+static bool UartInit(WE_UART_Internal_t *uartInternal, uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP)
 {
-	/* USART1 DMA Init */
-	WE_UART1_Internal.dmaRx = DMA2;
-	WE_UART1_Internal.dmaRxStream = LL_DMA_STREAM_2;
-	WE_UART1_Internal.dmaLastReadPos = 0;
-
-	/* DMA controller clock enable */
-	LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA2);
-
-	/* DMA interrupt init */
-	/* DMA2_Stream2_IRQn interrupt configuration */
-	NVIC_SetPriority(DMA2_Stream2_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_DMA_RX, 0));
-	NVIC_EnableIRQ(DMA2_Stream2_IRQn);
-
-	LL_DMA_SetChannelSelection(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_CHANNEL_4);
-	LL_DMA_SetDataTransferDirection(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
-	LL_DMA_SetStreamPriorityLevel(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_PRIORITY_LOW);
-	LL_DMA_SetMode(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_MODE_CIRCULAR);
-	LL_DMA_SetPeriphIncMode(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_PERIPH_NOINCREMENT);
-	LL_DMA_SetMemoryIncMode(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_MEMORY_INCREMENT);
-	LL_DMA_SetPeriphSize(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_PDATAALIGN_BYTE);
-	LL_DMA_SetMemorySize(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_MDATAALIGN_BYTE);
-	LL_DMA_DisableFifoMode(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-
-	LL_DMA_SetPeriphAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t) &USART1->DR);
-	LL_DMA_SetMemoryAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t) WE_UART1_Internal.WE_dmaRxBuffer);
-	LL_DMA_SetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, WE_DMA_RX_BUFFER_SIZE);
-
-	/* Enable HT & TC interrupts */
-	LL_DMA_EnableIT_HT(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-	LL_DMA_EnableIT_TC(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
+	const WE_UART_Config_t *config = uartInternal->config;
 
-	/* Enable DMA */
-	LL_USART_EnableDMAReq_RX(WE_UART1_Internal.uart);
-	LL_USART_EnableIT_IDLE(WE_UART1_Internal.uart);
-	LL_DMA_EnableStream(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-}
-
-static void WE_DMA_for_UART1_DeInit()
-{
-	if (WE_UART1_Internal.dmaRx == NULL)
+	bool rts = (WE_FlowControl_RTSOnly == flowControl || WE_FlowControl_RTSAndCTS == flowControl);
+	bool cts = (WE_FlowControl_CTSOnly == flowControl || WE_FlowControl_RTSAndCTS == flowControl);
+	if ((rts && config->rtsPin.port == NULL) || (cts && config->ctsPin.port == NULL))
 	{
-		return;
+		/* Flow control is not supported by this UART */
+		return false;
 	}
 
-	LL_DMA_DisableStream(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-	LL_USART_DisableIT_IDLE(WE_UART1_Internal.uart);
-	LL_USART_DisableDMAReq_RX(WE_UART1_Internal.uart);
-	LL_DMA_DisableIT_TC(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-	LL_DMA_DisableIT_HT(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-	NVIC_DisableIRQ(DMA2_Stream2_IRQn);
-	LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_DMA2);
-
-	WE_UART1_Internal.dmaRxStream = 0;
-	WE_UART1_Internal.dmaRx = NULL;
-	WE_UART1_Internal.dmaLastReadPos = 0;
-}
-
-#endif /* defined(WE_UART_DMA) */
-
-bool WE_UART6_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP)
-{
-	WE_UART6_Internal.flowControl = flowControl;
-	WE_UART6_Internal.rxByteHandlerP = rxByteHandlerP;
+	uartInternal->flowControl = flowControl;
+	uartInternal->rxByteHandlerP = rxByteHandlerP;
+	uartInternal->txBusy = false;
+	uartInternal->statistics = (WE_UART_Statistics_t) {
+			0 };
 
 #if defined(WE_UART_DMA)
 	/* Enable pendable service interrupt which is used for processing data received from radio module
-	 * (interrupt is triggered via WE_UART1_CheckIfDmaDataAvailableAsync() when bytes have been received) */
+	 * (interrupt is triggered via UartCheckIfDmaDataAvailableAsync() when bytes have been received) */
 	NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_RX_DATA_PROCESSING, 0));
 	NVIC_EnableIRQ(PendSV_IRQn);
 #endif
 
-	/* USART6 clock enable */
-	LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_USART6);
-	LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOC);
-
-	/* USART 1 GPIO initialization */
-	LL_GPIO_InitTypeDef gpioInitStruct = {
-			0 };
-
-	/* USART6 GPIO Configuration
-	 PC6    ------> USART6_TX
-	 PC7    ------> USART6_RX
-	 */
-	gpioInitStruct.Pin = LL_GPIO_PIN_6;
-	gpioInitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-	gpioInitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-	gpioInitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-	gpioInitStruct.Pull = LL_GPIO_PULL_NO;
-	gpioInitStruct.Alternate = LL_GPIO_AF_8;
-	LL_GPIO_Init(GPIOC, &gpioInitStruct);
+	/* USART clock enable */
+	config->clockEnable(config->clock);
 
-	gpioInitStruct.Pin = LL_GPIO_PIN_7;
-	gpioInitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
-	gpioInitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
-	gpioInitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
-	gpioInitStruct.Pull = LL_GPIO_PULL_UP;
-	gpioInitStruct.Alternate = LL_GPIO_AF_8;
-	LL_GPIO_Init(GPIOC, &gpioInitStruct);
+	/* USART GPIO initialization */
+	UartInitPin(&config->txPin);
+	UartInitPin(&config->rxPin);
 
 	/* Flow control pins */
-	if (WE_FlowControl_NoFlowControl != WE_UART6_Internal.flowControl)
+	if (rts)
 	{
-		/* UART6 does not support flow control */
-		return false;
+		UartInitPin(&config->rtsPin);
+	}
+	if (cts)
+	{
+		UartInitPin(&config->ctsPin);
 	}
 
-	/* Initialize USART6 */
+	/* Initialize USART */
 
-	WE_UART6_Internal.uart = USART6;
+	uartInternal->uart = config->uart;
 
 	LL_USART_InitTypeDef uartInitStruct = {
 			0 };
@@ -710,7 +874,7 @@ bool WE_UART6_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t
 		break;
 	}
 	uartInitStruct.TransferDirection = LL_USART_DIRECTION_TX_RX;
-	switch (WE_UART6_Internal.flowControl)
+	switch (uartInternal->flowControl)
 	{
 	case WE_FlowControl_RTSOnly:
 		uartInitStruct.HardwareFlowControl = LL_USART_HWCONTROL_RTS;
@@ -731,192 +895,957 @@ bool WE_UART6_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t
 	}
 
 	uartInitStruct.OverSampling = LL_USART_OVERSAMPLING_16;
-	LL_USART_Init(WE_UART6_Internal.uart, &uartInitStruct);
+	LL_USART_Init(uartInternal->uart, &uartInitStruct);
 
-	LL_USART_ConfigAsyncMode(WE_UART6_Internal.uart);
-	LL_USART_Enable(WE_UART6_Internal.uart);
+	LL_USART_ConfigAsyncMode(uartInternal->uart);
+	LL_USART_Enable(uartInternal->uart);
 
-	/* USART6 interrupt Init */
-	NVIC_SetPriority(USART6_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_UART_RX, 0));
-	NVIC_EnableIRQ(USART6_IRQn);
+	/* USART interrupt Init */
+	NVIC_SetPriority(config->irq, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_UART_RX, 0));
+	NVIC_EnableIRQ(config->irq);
 
 #if defined(WE_UART_DMA)
-	WE_DMA_for_UART6_Init();
+#if WE_DMA_RX_BUFFER_SIZE > 0
+	if (uartInternal->dmaRxBuffer == NULL)
+	{
+		uartInternal->dmaRxBuffer = uartInternal->WE_dmaRxBuffer;
+		uartInternal->dmaRxBufferSize = WE_DMA_RX_BUFFER_SIZE;
+	}
+#endif
+	if ((config->dmaRx.dma != NULL) && (uartInternal->dmaRxBuffer != NULL))
+	{
+		UartDmaRxInit(uartInternal);
+	}
+	else
+	{
+		/* No DMA stream or no buffer available for receiving - use USART interrupt */
+		LL_USART_EnableIT_RXNE(uartInternal->uart);
+	}
+	if (config->dmaTx.dma != NULL)
+	{
+		UartDmaTxInit(uartInternal);
+	}
 #else
 	// Legacy mode using USART interrupt
-	LL_USART_EnableIT_RXNE(WE_UART6_Internal.uart);
+	LL_USART_EnableIT_RXNE(uartInternal->uart);
 #endif
 
+	/* Receive error interrupts (errors are counted, see WE_UART_GetStatistics()) */
+	LL_USART_EnableIT_ERROR(uartInternal->uart);
+	if (parity != WE_Parity_None)
+	{
+		LL_USART_EnableIT_PE(uartInternal->uart);
+	}
+
 	return true;
 }
 
-bool WE_UART6_DeInit()
+/**
+ * @brief Deinitializes and stops a UART instance.
+ *
+ * GPIO and DMA controller clocks are left enabled, as they may be shared with other peripherals.
+ *
+ * @param[in] uartInternal UART to be deinitialized
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartDeInit(WE_UART_Internal_t *uartInternal)
 {
-	if (WE_UART6_Internal.uart == NULL)
+	const WE_UART_Config_t *config = uartInternal->config;
+
+	if (uartInternal->uart == NULL)
 	{
 		return true;
 	}
 
+	/* Let pending transmissions complete before switching off the UART */
+	UartWaitForTxIdleInternal(uartInternal, 1000);
+
 #if defined(WE_UART_DMA)
-	WE_DMA_for_UART6_DeInit();
-#else
-	LL_USART_DisableIT_RXNE(WE_UART6_Internal.uart);
+	if (config->dmaTx.dma != NULL)
+	{
+		UartDmaTxDeInit(uartInternal);
+	}
+	if ((config->dmaRx.dma != NULL) && (uartInternal->dmaRxBuffer != NULL))
+	{
+		UartDmaRxDeInit(uartInternal);
+	}
 #endif
+	LL_USART_DisableIT_RXNE(uartInternal->uart);
+	LL_USART_DisableIT_TC(uartInternal->uart);
+	LL_USART_DisableIT_ERROR(uartInternal->uart);
+	LL_USART_DisableIT_PE(uartInternal->uart);
+	uartInternal->txBusy = false;
 
-	WE_UART6_Internal.rxByteHandlerP = NULL;
+	uartInternal->rxByteHandlerP = NULL;
 
-	NVIC_DisableIRQ(USART6_IRQn);
-	LL_USART_Disable(WE_UART6_Internal.uart);
-	LL_USART_DeInit(WE_UART6_Internal.uart);
-	LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_GPIOC);
-	LL_APB2_GRP1_DisableClock(LL_APB2_GRP1_PERIPH_USART6);
-
-	if (WE_FlowControl_NoFlowControl != WE_UART6_Internal.flowControl)
-	{
-		/* flow control for UART6 not implemented */
-	}
+	NVIC_DisableIRQ(config->irq);
+	LL_USART_Disable(uartInternal->uart);
+	LL_USART_DeInit(uartInternal->uart);
+	config->clockDisable(config->clock);
 
-	WE_UART6_Internal.uart = NULL;
+	uartInternal->uart = NULL;
 	return true;
 }
 
+/**
+ * @brief Configures a pin for use by a UART instance.
+ *
+ * @param[in] pinConfig Pin configuration
+ */
+static void UartInitPin(const WE_UART_PinConfig_t *pinConfig)
+{
+	LL_AHB1_GRP1_EnableClock(pinConfig->portClock);
+
+	LL_GPIO_InitTypeDef gpioInitStruct = {
+			0 };
+	gpioInitStruct.Pin = pinConfig->pin;
+	gpioInitStruct.Mode = LL_GPIO_MODE_ALTERNATE;
+	gpioInitStruct.Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH;
+	gpioInitStruct.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
+	gpioInitStruct.Pull = pinConfig->pull;
+	gpioInitStruct.Alternate = pinConfig->alternate;
+	LL_GPIO_Init(pinConfig->port, &gpioInitStruct);
+}
+
 /**
  * @brief Interrupt handler for data received from wireless module via UART.
  *
- * Handles the following interrupts, depending on whether DMA is enabled or not:
- * - If DMA is enabled: Idle line interrupt
- * - If DMA is disabled: Character received interrupt
+ * Handles the following interrupts, depending on whether DMA is used for receiving or not:
+ * - If DMA is used: Idle line interrupt
+ * - If DMA is not used: Character received interrupt
+ *
+ * Additionally handles the transmission complete interrupt (used only if DMA is enabled)
+ * and counts receive errors (overrun, framing, noise, parity).
+ *
+ * @param[in] uartInternal UART that has triggered the interrupt
  */
-void USART6_IRQHandler()
+static void UartIrqHandler(WE_UART_Internal_t *uartInternal)
 {
+	USART_TypeDef *uart = uartInternal->config->uart;
+
+	/* Receive errors - reading SR is the first step of clearing the error flags, the
+	 * second step is reading DR (done below if DMA is not used for receiving) */
+	uint32_t errors = READ_REG(uart->SR) & (USART_SR_ORE | USART_SR_FE | USART_SR_NE | USART_SR_PE);
+	if (errors != 0)
+	{
+		if (errors & USART_SR_ORE)
+		{
+			uartInternal->statistics.overrunErrors++;
+		}
+		if (errors & USART_SR_FE)
+		{
+			uartInternal->statistics.framingErrors++;
+		}
+		if (errors & USART_SR_NE)
+		{
+			uartInternal->statistics.noiseErrors++;
+		}
+		if (errors & USART_SR_PE)
+		{
+			uartInternal->statistics.parityErrors++;
+		}
+		if (!LL_USART_IsEnabledIT_RXNE(uart))
+		{
+			/* Receiving via DMA: complete the clearing sequence (the received byte has been read by the DMA) */
+			(void) LL_USART_ReceiveData8(uart);
+		}
+	}
+
 #if defined(WE_UART_DMA)
-	if (LL_USART_IsActiveFlag_IDLE(USART6))
+	if (LL_USART_IsEnabledIT_IDLE(uart) && LL_USART_IsActiveFlag_IDLE(uart))
 	{
 		/* USART idle line interrupt (used only if DMA is enabled) */
 
-		LL_USART_ClearFlag_IDLE(USART6);
-		WE_UART6_CheckIfDmaDataAvailableAsync();
+		LL_USART_ClearFlag_IDLE(uart);
+		UartCheckIfDmaDataAvailableAsync(uartInternal);
 	}
-#else
-    if (LL_USART_IsActiveFlag_RXNE(WE_UART6_Internal.uart))
-    {
-        /* Character has been received (used only if DMA is disabled) */
-
-        /* RXNE flag will be cleared by reading of DR register */
-    	WE_UART6_Internal.receivedByte = LL_USART_ReceiveData8(WE_UART6_Internal.uart);
-    	(*WE_UART6_Internal.rxByteHandlerP)(&WE_UART6_Internal.receivedByte, 1);
-    }
-	if (LL_USART_IsActiveFlag_ORE(WE_UART6_Internal.uart)) {
-        LL_USART_ClearFlag_ORE(WE_UART6_Internal.uart);
-    }
 #endif
+
+	if (LL_USART_IsEnabledIT_RXNE(uart) && LL_USART_IsActiveFlag_RXNE(uart))
+	{
+		/* Character has been received (used only if DMA is not used for receiving) */
+
+		/* RXNE flag will be cleared by reading of DR register */
+		uartInternal->receivedByte = LL_USART_ReceiveData8(uart);
+		uartInternal->rxTimestamp = WE_GetTickMicroseconds();
+		uartInternal->rxTick = WE_GetTick();
+		UartDeliverRx(uartInternal, &uartInternal->receivedByte, 1);
+	}
+
+	if (LL_USART_IsEnabledIT_TC(uart) && LL_USART_IsActiveFlag_TC(uart))
+	{
+		/* Last byte of DMA transmission has been shifted out (used only if DMA is enabled) */
+		LL_USART_DisableIT_TC(uart);
+		UartOnTxComplete(uartInternal);
+	}
 }
 
-#if defined(WE_UART_DMA)
-static void WE_UART6_CheckIfDmaDataAvailable()
+static HAL_StatusTypeDef UartTransmitInternal(USART_TypeDef *hUart, const uint8_t *data, uint16_t size)
 {
-	/* Get current DMA write position (in ring buffer) */
-	size_t pos = WE_DMA_RX_BUFFER_SIZE - LL_DMA_GetDataLength(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
-
-	/* Check if new data is available (i.e. write position has changed) */
-	if (pos != WE_UART6_Internal.dmaLastReadPos)
+	for (; size > 0; --size, ++data)
 	{
-		if (pos > WE_UART6_Internal.dmaLastReadPos)
-		{
-			/* Data to be read from DMA ring buffer is continuous - between lastPos and pos */
-			WE_DMA_for_UART6_OnDataReceived(&WE_UART6_Internal.WE_dmaRxBuffer[WE_UART6_Internal.dmaLastReadPos], pos - WE_UART6_Internal.dmaLastReadPos);
-		}
-		else /* pos < WE_UART6_Internal.dmaLastReadPos */
+		LL_USART_TransmitData8(hUart, *data);
+		while (!LL_USART_IsActiveFlag_TXE(hUart))
 		{
-			/* Ring buffer write position has reached the end of the buffer and restarted at the beginning.
-			 * Data is split:
-			 * - Bytes between lastPos and the end of the buffer
-			 * - Bytes between start of the buffer and pos
-			 */
-			WE_DMA_for_UART6_OnDataReceived(&WE_UART6_Internal.WE_dmaRxBuffer[WE_UART6_Internal.dmaLastReadPos], WE_DMA_RX_BUFFER_SIZE - WE_UART6_Internal.dmaLastReadPos);
-			if (pos > 0)
-			{
-				WE_DMA_for_UART6_OnDataReceived(&WE_UART6_Internal.WE_dmaRxBuffer[0], pos);
-			}
 		}
-
-		/* Store DMA write position for next interrupt */
-		WE_UART6_Internal.dmaLastReadPos = pos;
 	}
+	while (!LL_USART_IsActiveFlag_TC(hUart))
+	{
+	}
+	return HAL_OK;
 }
 
 /**
- * @brief Is called when one or more bytes have been received from UART via DMA.
- * @param data Received data
- * @param size Number of bytes received
+ * @brief Transmits data and waits for the transmission to complete.
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] size Number of bytes to be sent
+ *
+ * @return true if successful, false otherwise
  */
-static void WE_DMA_for_UART6_OnDataReceived(uint8_t *data, size_t size)
+static bool UartTransmit(WE_UART_Internal_t *uartInternal, const uint8_t *data, uint16_t size)
 {
-	for (; size > 0; size--, data++)
+#if defined(WE_UART_DMA)
+	if (!UartTransmitAsyncInternal(uartInternal, data, size))
+	{
+		return false;
+	}
+	while (uartInternal->txBusy)
 	{
-		(*WE_UART6_Internal.rxByteHandlerP)(data, size);
 	}
+	return true;
+#else
+	if (uartInternal->uart == NULL)
+	{
+		return false;
+	}
+	return (HAL_OK == UartTransmitInternal(uartInternal->uart, data, size));
+#endif
 }
 
-static void WE_DMA_for_UART6_Init() //USART6_RX DMA2, stream 1, channel 5
+/**
+ * @brief Starts an asynchronous transmission.
+ *
+ * Waits for a previous transmission (if any) to be completed. If DMA is enabled,
+ * the data is transferred via DMA and this function returns immediately. Otherwise
+ * the data is transmitted in blocking mode and the transmission complete callback
+ * is called before returning.
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] size Number of bytes to be sent
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartTransmitAsyncInternal(WE_UART_Internal_t *uartInternal, const uint8_t *data, uint16_t size)
 {
-	/* USART6 DMA Init */
-	WE_UART6_Internal.dmaRx = DMA2;
-	WE_UART6_Internal.dmaRxStream = LL_DMA_STREAM_1;
-	WE_UART6_Internal.dmaLastReadPos = 0;
-
-	/* DMA controller clock enable */
-	LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA2);
+	if ((uartInternal->uart == NULL) || (data == NULL && size > 0))
+	{
+		return false;
+	}
+
+	if (size == 0)
+	{
+		return true;
+	}
+
+	/* Transmissions are serialized - wait for the previous transmission to complete */
+	while (uartInternal->txBusy)
+	{
+	}
+
+#if defined(WE_UART_DMA)
+	if (uartInternal->config->dmaTx.dma != NULL)
+	{
+		uartInternal->txBusy = true;
+		uartInternal->txSegments = NULL;
+		uartInternal->txSegmentCount = 0;
+		UartStartDmaTransfer(uartInternal, data, size);
+		return true;
+	}
+#endif
+
+	uartInternal->txBusy = true;
+	UartTransmitInternal(uartInternal->uart, data, size);
+	UartOnTxComplete(uartInternal);
+
+	return true;
+}
+
+/**
+ * @brief Transmits several data segments as one contiguous stream.
+ *
+ * If DMA is enabled, the next segment's DMA transfer is started from the DMA
+ * transfer complete interrupt of the previous segment. Returns when all
+ * segments have been transmitted.
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] segments Array of segments to be sent
+ * @param[in] count Number of segments in array
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartTransmitVInternal(WE_UART_Internal_t *uartInternal, const WE_UART_Segment_t *segments, uint8_t count)
+{
+	if ((uartInternal->uart == NULL) || (segments == NULL && count > 0))
+	{
+		return false;
+	}
+
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if ((segments[i].data == NULL) && (segments[i].length > 0))
+		{
+			return false;
+		}
+	}
+
+	/* Transmissions are serialized - wait for the previous transmission to complete */
+	while (uartInternal->txBusy)
+	{
+	}
+
+#if defined(WE_UART_DMA)
+	if (uartInternal->config->dmaTx.dma != NULL)
+	{
+		uartInternal->txSegments = segments;
+		uartInternal->txSegmentCount = count;
+		uartInternal->txBusy = true;
+		if (!UartStartNextSegment(uartInternal))
+		{
+			/* Nothing to send (all segments are empty) */
+			uartInternal->txBusy = false;
+			return true;
+		}
+
+		/* Segments might be located on the caller's stack - wait for completion */
+		while (uartInternal->txBusy)
+		{
+		}
+		return true;
+	}
+#endif
+
+	uartInternal->txBusy = true;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if (segments[i].length > 0)
+		{
+			UartTransmitInternal(uartInternal->uart, segments[i].data, segments[i].length);
+		}
+	}
+	UartOnTxComplete(uartInternal);
+	return true;
+}
+
+/**
+ * @brief Waits until the current transmission (if any) has been completed.
+ *
+ * @param[in] uartInternal UART to be checked
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ *
+ * @return true if the UART is idle, false if the timeout has expired
+ */
+static bool UartWaitForTxIdleInternal(WE_UART_Internal_t *uartInternal, uint32_t timeoutMs)
+{
+	uint32_t t0 = WE_GetTick();
+	while (uartInternal->txBusy)
+	{
+		if (WE_GetTick() - t0 > timeoutMs)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Is called when a transmission has been completed (last byte has been shifted out).
+ *
+ * @param[in] uartInternal UART that has completed the transmission
+ */
+static void UartOnTxComplete(WE_UART_Internal_t *uartInternal)
+{
+	uartInternal->txBusy = false;
+	if (uartInternal->txCompleteCallback != NULL)
+	{
+		uartInternal->txCompleteCallback();
+	}
+}
+
+#if defined(WE_UART_DMA)
+/**
+ * @brief Checks if the supplied interrupt flags of a DMA stream are set.
+ *
+ * @param[in] dmaConfig DMA stream to be checked
+ * @param[in] flag Flags of stream 0 (WE_DMA_FLAG_x)
+ */
+static bool DmaIsActiveFlag(const WE_UART_DmaConfig_t *dmaConfig, uint32_t flag)
+{
+	uint32_t isr = (dmaConfig->stream < LL_DMA_STREAM_4) ? dmaConfig->dma->LISR : dmaConfig->dma->HISR;
+	flag <<= WE_DMA_StreamFlagOffset[dmaConfig->stream];
+	return (isr & flag) == flag;
+}
+
+/**
+ * @brief Clears interrupt flags of a DMA stream.
+ *
+ * @param[in] dmaConfig DMA stream
+ * @param[in] flags Flags of stream 0 (WE_DMA_FLAG_x)
+ */
+static void DmaClearFlags(const WE_UART_DmaConfig_t *dmaConfig, uint32_t flags)
+{
+	flags <<= WE_DMA_StreamFlagOffset[dmaConfig->stream];
+	if (dmaConfig->stream < LL_DMA_STREAM_4)
+	{
+		WRITE_REG(dmaConfig->dma->LIFCR, flags);
+	}
+	else
+	{
+		WRITE_REG(dmaConfig->dma->HIFCR, flags);
+	}
+}
+
+/**
+ * @brief Interrupt handler for the DMA streams used by the UART instances (used only if DMA is enabled).
+ *
+ * Handles data received from wireless module (half-transfer / transfer complete) and
+ * data transmitted to wireless module (transfer complete) for all UART instances.
+ */
+static void UartDmaIrqHandler()
+{
+	for (uint8_t i = 0; i < WE_UART_Instance_Count; i++)
+	{
+		WE_UART_Internal_t *uartInternal = &WE_UART_Instances[i];
+		const WE_UART_DmaConfig_t *dmaRx = &uartInternal->config->dmaRx;
+		const WE_UART_DmaConfig_t *dmaTx = &uartInternal->config->dmaTx;
+
+		if (dmaRx->dma != NULL)
+		{
+			if (LL_DMA_IsEnabledIT_HT(dmaRx->dma, dmaRx->stream) && DmaIsActiveFlag(dmaRx, WE_DMA_FLAG_HT))
+			{
+				/* DMA receive half-transfer complete */
+				DmaClearFlags(dmaRx, WE_DMA_FLAG_HT);
+				UartCheckIfDmaDataAvailableAsync(uartInternal);
+			}
+
+			if (LL_DMA_IsEnabledIT_TC(dmaRx->dma, dmaRx->stream) && DmaIsActiveFlag(dmaRx, WE_DMA_FLAG_TC))
+			{
+				/* DMA receive transfer complete */
+				DmaClearFlags(dmaRx, WE_DMA_FLAG_TC);
+				UartCheckIfDmaDataAvailableAsync(uartInternal);
+			}
+		}
+
+		if (dmaTx->dma != NULL)
+		{
+			if (LL_DMA_IsEnabledIT_TC(dmaTx->dma, dmaTx->stream) && DmaIsActiveFlag(dmaTx, WE_DMA_FLAG_TC))
+			{
+				/* DMA transfer complete - send next segment (if any) or wait for the last byte to be shifted out */
+				DmaClearFlags(dmaTx, WE_DMA_FLAG_TC);
+				if (!UartStartNextSegment(uartInternal))
+				{
+					LL_USART_EnableIT_TC(uartInternal->config->uart);
+				}
+			}
+		}
+
+		/* Other events can be implemented if required. */
+	}
+}
+
+/**
+ * @brief Configures and starts the DMA stream used for receiving data (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART to be used
+ */
+static void UartDmaRxInit(WE_UART_Internal_t *uartInternal)
+{
+	const WE_UART_DmaConfig_t *dmaRx = &uartInternal->config->dmaRx;
+
+	uartInternal->dmaLastReadPos = 0;
+	uartInternal->dmaLastWritePos = 0;
+	uartInternal->dmaRxWritten = 0;
+	uartInternal->dmaRxRead = 0;
+	uartInternal->dmaRxDropped = 0;
+	uartInternal->rxDispatching = false;
+
+	/* DMA controller clock enable */
+	LL_AHB1_GRP1_EnableClock(dmaRx->dmaClock);
 
 	/* DMA interrupt init */
-	/* DMA2_Stream1_IRQn interrupt configuration */
-	NVIC_SetPriority(DMA2_Stream1_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_DMA_RX, 0));
-	NVIC_EnableIRQ(DMA2_Stream1_IRQn);
-
-	LL_DMA_SetChannelSelection(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_CHANNEL_5);
-	LL_DMA_SetDataTransferDirection(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
-	LL_DMA_SetStreamPriorityLevel(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_PRIORITY_LOW);
-	LL_DMA_SetMode(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_MODE_CIRCULAR);
-	LL_DMA_SetPeriphIncMode(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_PERIPH_NOINCREMENT);
-	LL_DMA_SetMemoryIncMode(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_MEMORY_INCREMENT);
-	LL_DMA_SetPeriphSize(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_PDATAALIGN_BYTE);
-	LL_DMA_SetMemorySize(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_MDATAALIGN_BYTE);
-	LL_DMA_DisableFifoMode(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
-
-	LL_DMA_SetPeriphAddress(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, (uint32_t) &USART6->DR);
-	LL_DMA_SetMemoryAddress(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, (uint32_t) WE_UART6_Internal.WE_dmaRxBuffer);
-	LL_DMA_SetDataLength(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, WE_DMA_RX_BUFFER_SIZE);
+	NVIC_SetPriority(dmaRx->irq, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_DMA_RX, 0));
+	NVIC_EnableIRQ(dmaRx->irq);
+
+	LL_DMA_SetChannelSelection(dmaRx->dma, dmaRx->stream, dmaRx->channel);
+	LL_DMA_SetDataTransferDirection(dmaRx->dma, dmaRx->stream, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
+	LL_DMA_SetStreamPriorityLevel(dmaRx->dma, dmaRx->stream, LL_DMA_PRIORITY_LOW);
+	LL_DMA_SetMode(dmaRx->dma, dmaRx->stream, LL_DMA_MODE_CIRCULAR);
+	LL_DMA_SetPeriphIncMode(dmaRx->dma, dmaRx->stream, LL_DMA_PERIPH_NOINCREMENT);
+	LL_DMA_SetMemoryIncMode(dmaRx->dma, dmaRx->stream, LL_DMA_MEMORY_INCREMENT);
+	LL_DMA_SetPeriphSize(dmaRx->dma, dmaRx->stream, LL_DMA_PDATAALIGN_BYTE);
+	LL_DMA_SetMemorySize(dmaRx->dma, dmaRx->stream, LL_DMA_MDATAALIGN_BYTE);
+	LL_DMA_DisableFifoMode(dmaRx->dma, dmaRx->stream);
+
+	LL_DMA_SetPeriphAddress(dmaRx->dma, dmaRx->stream, (uint32_t) &uartInternal->uart->DR);
+	if (uartInternal->dmaRxBufferMode == WE_UART_RxBufferMode_DoubleBuffer)
+	{
+		/* Memory 0 is the first half, memory 1 the second half of the buffer */
+		uint16_t halfSize = uartInternal->dmaRxBufferSize / 2;
+		LL_DMA_SetMemoryAddress(dmaRx->dma, dmaRx->stream, (uint32_t) uartInternal->dmaRxBuffer);
+		LL_DMA_SetMemory1Address(dmaRx->dma, dmaRx->stream, (uint32_t) &uartInternal->dmaRxBuffer[halfSize]);
+		LL_DMA_SetCurrentTargetMem(dmaRx->dma, dmaRx->stream, LL_DMA_CURRENTTARGETMEM0);
+		LL_DMA_EnableDoubleBufferMode(dmaRx->dma, dmaRx->stream);
+		LL_DMA_SetDataLength(dmaRx->dma, dmaRx->stream, halfSize);
+	}
+	else
+	{
+		LL_DMA_DisableDoubleBufferMode(dmaRx->dma, dmaRx->stream);
+		LL_DMA_SetMemoryAddress(dmaRx->dma, dmaRx->stream, (uint32_t) uartInternal->dmaRxBuffer);
+		LL_DMA_SetDataLength(dmaRx->dma, dmaRx->stream, uartInternal->dmaRxBufferSize);
+	}
 
 	/* Enable HT & TC interrupts */
-	LL_DMA_EnableIT_HT(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
-	LL_DMA_EnableIT_TC(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
+	LL_DMA_EnableIT_HT(dmaRx->dma, dmaRx->stream);
+	LL_DMA_EnableIT_TC(dmaRx->dma, dmaRx->stream);
 
 	/* Enable DMA */
-	LL_USART_EnableDMAReq_RX(WE_UART6_Internal.uart);
-	LL_USART_EnableIT_IDLE(WE_UART6_Internal.uart);
-	LL_DMA_EnableStream(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
+	LL_USART_EnableDMAReq_RX(uartInternal->uart);
+	LL_USART_EnableIT_IDLE(uartInternal->uart);
+	LL_DMA_EnableStream(dmaRx->dma, dmaRx->stream);
+}
+
+/**
+ * @brief Stops the DMA stream used for receiving data (used only if DMA is enabled).
+ *
+ * The DMA stream's interrupt vector is left enabled, as it may be shared with other streams.
+ *
+ * @param[in] uartInternal UART to be used
+ */
+static void UartDmaRxDeInit(WE_UART_Internal_t *uartInternal)
+{
+	const WE_UART_DmaConfig_t *dmaRx = &uartInternal->config->dmaRx;
+
+	LL_DMA_DisableStream(dmaRx->dma, dmaRx->stream);
+	LL_USART_DisableIT_IDLE(uartInternal->uart);
+	LL_USART_DisableDMAReq_RX(uartInternal->uart);
+	LL_DMA_DisableIT_TC(dmaRx->dma, dmaRx->stream);
+	LL_DMA_DisableIT_HT(dmaRx->dma, dmaRx->stream);
+	DmaClearFlags(dmaRx, WE_DMA_FLAG_ALL);
+
+	uartInternal->dmaLastReadPos = 0;
+}
+
+/**
+ * @brief Returns the current DMA write position in the receive buffer (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART to be used
+ *
+ * @return Index of the next byte to be written by the DMA
+ */
+static size_t UartDmaRxWritePos(WE_UART_Internal_t *uartInternal)
+{
+	const WE_UART_DmaConfig_t *dmaRx = &uartInternal->config->dmaRx;
+
+	if (uartInternal->dmaRxBufferMode == WE_UART_RxBufferMode_DoubleBuffer)
+	{
+		/* The remaining length refers to the current target (memory 0 = first half, memory 1 = second half).
+		 * Read again if the target has been switched in the meantime. */
+		uint16_t halfSize = uartInternal->dmaRxBufferSize / 2;
+		uint32_t target;
+		uint32_t remaining;
+		do
+		{
+			target = LL_DMA_GetCurrentTargetMem(dmaRx->dma, dmaRx->stream);
+			remaining = LL_DMA_GetDataLength(dmaRx->dma, dmaRx->stream);
+		} while (target != LL_DMA_GetCurrentTargetMem(dmaRx->dma, dmaRx->stream));
+
+		return ((target == LL_DMA_CURRENTTARGETMEM1) ? halfSize : 0) + halfSize - remaining;
+	}
+
+	return uartInternal->dmaRxBufferSize - LL_DMA_GetDataLength(dmaRx->dma, dmaRx->stream);
+}
+
+/**
+ * @brief Sets the buffer used for receiving data via DMA (used only if DMA is enabled).
+ *
+ * Must be called before the UART is initialized.
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] buffer Receive buffer (NULL to use the default buffer)
+ * @param[in] size Size of receive buffer
+ * @param[in] mode Defines how the buffer is filled by the DMA
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartSetRxBuffer(WE_UART_Internal_t *uartInternal, uint8_t *buffer, uint16_t size, WE_UART_RxBufferMode_t mode)
+{
+	if (uartInternal->uart != NULL)
+	{
+		/* Already initialized */
+		return false;
+	}
+
+	if ((buffer != NULL) && (size < 2))
+	{
+		return false;
+	}
+
+	if ((mode == WE_UART_RxBufferMode_DoubleBuffer) && ((size % 2) != 0))
+	{
+		/* Buffer is split into two halves of equal size */
+		return false;
+	}
+
+	uartInternal->dmaRxBuffer = buffer;
+	uartInternal->dmaRxBufferSize = (buffer != NULL) ? size : 0;
+	uartInternal->dmaRxBufferMode = mode;
+	return true;
+}
+
+/**
+ * @brief Configures the DMA stream used for transmitting data (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART to be used
+ */
+static void UartDmaTxInit(WE_UART_Internal_t *uartInternal)
+{
+	const WE_UART_DmaConfig_t *dmaTx = &uartInternal->config->dmaTx;
+
+	/* DMA controller clock enable */
+	LL_AHB1_GRP1_EnableClock(dmaTx->dmaClock);
+
+	/* DMA interrupt init */
+	NVIC_SetPriority(dmaTx->irq, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_DMA_TX, 0));
+	NVIC_EnableIRQ(dmaTx->irq);
+
+	LL_DMA_SetChannelSelection(dmaTx->dma, dmaTx->stream, dmaTx->channel);
+	LL_DMA_SetDataTransferDirection(dmaTx->dma, dmaTx->stream, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+	LL_DMA_SetStreamPriorityLevel(dmaTx->dma, dmaTx->stream, LL_DMA_PRIORITY_LOW);
+	LL_DMA_SetMode(dmaTx->dma, dmaTx->stream, LL_DMA_MODE_NORMAL);
+	LL_DMA_SetPeriphIncMode(dmaTx->dma, dmaTx->stream, LL_DMA_PERIPH_NOINCREMENT);
+	LL_DMA_SetMemoryIncMode(dmaTx->dma, dmaTx->stream, LL_DMA_MEMORY_INCREMENT);
+	LL_DMA_SetPeriphSize(dmaTx->dma, dmaTx->stream, LL_DMA_PDATAALIGN_BYTE);
+	LL_DMA_SetMemorySize(dmaTx->dma, dmaTx->stream, LL_DMA_MDATAALIGN_BYTE);
+	LL_DMA_DisableFifoMode(dmaTx->dma, dmaTx->stream);
+
+	LL_DMA_SetPeriphAddress(dmaTx->dma, dmaTx->stream, (uint32_t) &uartInternal->uart->DR);
+
+	/* Enable TC interrupt */
+	LL_DMA_EnableIT_TC(dmaTx->dma, dmaTx->stream);
+
+	/* Enable DMA requests (stream is enabled for each transmission) */
+	LL_USART_EnableDMAReq_TX(uartInternal->uart);
+}
+
+/**
+ * @brief Stops the DMA stream used for transmitting data (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART to be used
+ */
+static void UartDmaTxDeInit(WE_UART_Internal_t *uartInternal)
+{
+	const WE_UART_DmaConfig_t *dmaTx = &uartInternal->config->dmaTx;
+
+	LL_DMA_DisableStream(dmaTx->dma, dmaTx->stream);
+	LL_USART_DisableDMAReq_TX(uartInternal->uart);
+	LL_DMA_DisableIT_TC(dmaTx->dma, dmaTx->stream);
+	DmaClearFlags(dmaTx, WE_DMA_FLAG_ALL);
+
+	uartInternal->txSegments = NULL;
+	uartInternal->txSegmentCount = 0;
+}
+
+/**
+ * @brief Starts a DMA transfer of the supplied data (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] size Number of bytes to be sent
+ */
+static void UartStartDmaTransfer(WE_UART_Internal_t *uartInternal, const uint8_t *data, uint16_t size)
+{
+	const WE_UART_DmaConfig_t *dmaTx = &uartInternal->config->dmaTx;
+
+	LL_DMA_DisableStream(dmaTx->dma, dmaTx->stream);
+	while (LL_DMA_IsEnabledStream(dmaTx->dma, dmaTx->stream))
+	{
+	}
+	DmaClearFlags(dmaTx, WE_DMA_FLAG_ALL);
+
+	LL_DMA_SetMemoryAddress(dmaTx->dma, dmaTx->stream, (uint32_t) data);
+	LL_DMA_SetDataLength(dmaTx->dma, dmaTx->stream, size);
+
+	/* TC flag is evaluated when the DMA transfer has been completed */
+	LL_USART_ClearFlag_TC(uartInternal->uart);
+	LL_DMA_EnableStream(dmaTx->dma, dmaTx->stream);
+}
+
+/**
+ * @brief Starts the DMA transfer of the next non-empty pending segment (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART to be used
+ *
+ * @return true if a transfer has been started, false if there are no more segments to be sent
+ */
+static bool UartStartNextSegment(WE_UART_Internal_t *uartInternal)
+{
+	while (uartInternal->txSegmentCount > 0)
+	{
+		const WE_UART_Segment_t *segment = uartInternal->txSegments;
+		uartInternal->txSegments++;
+		uartInternal->txSegmentCount--;
+		if (segment->length > 0)
+		{
+			UartStartDmaTransfer(uartInternal, segment->data, segment->length);
+			return true;
+		}
+	}
+	return false;
 }
 
-static void WE_DMA_for_UART6_DeInit()
+/**
+ * @brief Get the unconsumed data in the DMA receive ring buffer (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[out] spans Receives up to two spans of data (the second one is used if the data wraps around)
+ *
+ * @return Total number of bytes available
+ */
+static uint16_t UartRxPeekInternal(WE_UART_Internal_t *uartInternal, WE_UART_Segment_t spans[2])
 {
-	if (WE_UART6_Internal.dmaRx == NULL)
+	const WE_UART_DmaConfig_t *dmaRx = &uartInternal->config->dmaRx;
+
+	spans[0].data = NULL;
+	spans[0].length = 0;
+	spans[1].data = NULL;
+	spans[1].length = 0;
+
+	if ((uartInternal->uart == NULL) || (dmaRx->dma == NULL) || (uartInternal->dmaRxBuffer == NULL))
+	{
+		return 0;
+	}
+
+	/* Get current DMA write position (in ring buffer) */
+	size_t pos = UartDmaRxWritePos(uartInternal);
+	size_t lastPos = uartInternal->dmaLastReadPos;
+
+	if (pos > lastPos)
+	{
+		/* Data to be read from DMA ring buffer is continuous - between lastPos and pos */
+		spans[0].data = &uartInternal->dmaRxBuffer[lastPos];
+		spans[0].length = pos - lastPos;
+	}
+	else if (pos < lastPos)
+	{
+		/* Ring buffer write position has reached the end of the buffer and restarted at the beginning.
+		 * Data is split:
+		 * - Bytes between lastPos and the end of the buffer
+		 * - Bytes between start of the buffer and pos
+		 */
+		spans[0].data = &uartInternal->dmaRxBuffer[lastPos];
+		spans[0].length = uartInternal->dmaRxBufferSize - lastPos;
+		if (pos > 0)
+		{
+			spans[1].data = &uartInternal->dmaRxBuffer[0];
+			spans[1].length = pos;
+		}
+	}
+
+	return spans[0].length + spans[1].length;
+}
+
+/**
+ * @brief Releases data in the DMA receive ring buffer (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] length Number of bytes to be released
+ */
+static void UartRxConsumeInternal(WE_UART_Internal_t *uartInternal, uint16_t length)
+{
+	uartInternal->dmaLastReadPos = (uartInternal->dmaLastReadPos + length) % uartInternal->dmaRxBufferSize;
+	uartInternal->dmaRxRead += length;
+}
+
+/**
+ * @brief Passes all unconsumed data in the DMA receive ring buffer to the rx byte handler (used only if DMA is enabled).
+ *
+ * The data is consumed after the handler has returned. Calls made by the handler itself (e.g. in pull
+ * mode via WE_Delay() / WE_WaitForEvent() -> WE_UART_ProcessPendingRx()) return without delivering
+ * anything, as the data would otherwise be passed to the handler a second time. Data received in
+ * the meantime is delivered by the next call.
+ *
+ * @param[in] uartInternal UART to be used
+ */
+static void UartDispatchRx(WE_UART_Internal_t *uartInternal)
+{
+	if (uartInternal->rxDispatching)
 	{
 		return;
 	}
 
-	LL_DMA_DisableStream(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
-	LL_USART_DisableIT_IDLE(WE_UART6_Internal.uart);
-	LL_USART_DisableDMAReq_RX(WE_UART6_Internal.uart);
-	LL_DMA_DisableIT_TC(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
-	LL_DMA_DisableIT_HT(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
-	NVIC_DisableIRQ(DMA2_Stream1_IRQn);
-	LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_DMA2);
+	WE_UART_Segment_t spans[2];
+	uint16_t length = UartRxPeekInternal(uartInternal, spans);
+	if (length == 0)
+	{
+		return;
+	}
 
-	WE_UART6_Internal.dmaRxStream = 0;
-	WE_UART6_Internal.dmaRx = NULL;
-	WE_UART6_Internal.dmaLastReadPos = 0;
+	uartInternal->rxDispatching = true;
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		if (spans[i].length > 0)
+		{
+			UartDeliverRx(uartInternal, (uint8_t*) spans[i].data, spans[i].length);
+		}
+	}
+
+	UartRxConsumeInternal(uartInternal, length);
+	uartInternal->rxDispatching = false;
 }
 
+/**
+ * @brief Get the data received via UART that has not been consumed yet (pull mode only).
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[out] spans Receives up to two spans of data
+ *
+ * @return Total number of bytes available
+ */
+static uint16_t UartRxPeek(WE_UART_Internal_t *uartInternal, WE_UART_Segment_t spans[2])
+{
+	if (uartInternal->rxMode != WE_UART_RxMode_Pull)
+	{
+		spans[0].length = 0;
+		spans[1].length = 0;
+		return 0;
+	}
+	return UartRxPeekInternal(uartInternal, spans);
+}
+
+/**
+ * @brief Release data returned by UartRxPeek() (pull mode only).
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] length Number of bytes to be released
+ */
+static void UartRxConsume(WE_UART_Internal_t *uartInternal, uint16_t length)
+{
+	if (uartInternal->rxMode == WE_UART_RxMode_Pull)
+	{
+		UartRxConsumeInternal(uartInternal, length);
+	}
+}
+
+/**
+ * @brief Pass all pending received data to the rx byte handler (pull mode only).
+ *
+ * @param[in] uartInternal UART to be used
+ */
+static void UartProcessRx(WE_UART_Internal_t *uartInternal)
+{
+	if (uartInternal->rxMode == WE_UART_RxMode_Pull)
+	{
+		UartDispatchRx(uartInternal);
+	}
+}
+
+/**
+ * @brief Processes data received via DMA (used only if DMA is enabled).
+ *
+ * Is called by the PendSV handler.
+ *
+ * @param[in] uartInternal UART to be checked
+ */
+static void UartCheckIfDmaDataAvailable(WE_UART_Internal_t *uartInternal)
+{
+	if (uartInternal->rxMode == WE_UART_RxMode_Pull)
+	{
+		/* Data is fetched by the application (see WE_UARTx_ProcessRx(), WE_UARTx_RxPeek()) */
+		return;
+	}
+
+	UartDispatchRx(uartInternal);
+}
+
+/**
+ * @brief Triggers processing of data received via DMA in the PendSV handler (used only if DMA is enabled).
+ *
+ * @param[in] uartInternal UART that has received data
+ */
+static void UartCheckIfDmaDataAvailableAsync(WE_UART_Internal_t *uartInternal)
+{
+	/* Data is processed later (PendSV or pull mode) - capture the time of reception now */
+	uartInternal->rxTimestamp = WE_GetTickMicroseconds();
+	uartInternal->rxTick = WE_GetTick();
+
+	UartUpdateDmaRxStatistics(uartInternal);
+
+	uartInternal->triggered = true;
+
+	/* Trigger pendable service interrupt (PendSV) */
+	SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
+}
+
+/**
+ * @brief Updates the DMA receive buffer statistics (used only if DMA is enabled).
+ *
+ * Is called on each DMA receive event (idle line, half-transfer, transfer complete), so the
+ * DMA write position advances by less than the buffer size between two calls.
+ *
+ * @param[in] uartInternal UART that has received data
+ */
+static void UartUpdateDmaRxStatistics(WE_UART_Internal_t *uartInternal)
+{
+	uint16_t size = uartInternal->dmaRxBufferSize;
+
+	size_t pos = UartDmaRxWritePos(uartInternal);
+	uartInternal->dmaRxWritten += (pos + size - uartInternal->dmaLastWritePos) % size;
+	uartInternal->dmaLastWritePos = pos;
+
+	uint32_t fill = uartInternal->dmaRxWritten - uartInternal->dmaRxRead - uartInternal->dmaRxDropped;
+	if (fill >= size)
+	{
+		/* Unread data has been overwritten - only the bytes written since the
+		 * write position has passed the read position are still available */
+		uartInternal->statistics.dmaRxOverflows++;
+		uartInternal->statistics.dmaRxPeakFill = size;
+		uartInternal->dmaRxDropped += fill - (fill % size);
+	}
+	else if (fill > uartInternal->statistics.dmaRxPeakFill)
+	{
+		uartInternal->statistics.dmaRxPeakFill = fill;
+	}
+}
+
+void WE_UART_ProcessPendingRx()
+{
+	for (uint8_t i = 0; i < WE_UART_Instance_Count; i++)
+	{
+		UartProcessRx(&WE_UART_Instances[i]);
+	}
+}
+
+/**
+ * @brief Pendable service interrupt handler.
+ *
+ * Is used for asynchronous processing of data received from radio module via DMA.
+ *
+ * @see UartCheckIfDmaDataAvailableAsync()
+ */
+void PendSV_Handler()
+{
+	for (uint8_t i = 0; i < WE_UART_Instance_Count; i++)
+	{
+		if (WE_UART_Instances[i].triggered)
+		{
+			WE_UART_Instances[i].triggered = false;
+			UartCheckIfDmaDataAvailable(&WE_UART_Instances[i]);
+		}
+	}
+}
 #endif /* defined(WE_UART_DMA) */
 
 #ifdef WE_MICROSECOND_TICK
@@ -48,6 +48,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief UART instances available on this platform.
+ */
+typedef enum WE_UART_Instance_t
+{
+	WE_UART_Instance_1 = 0, /**< USART1 (TX: PB6, RX: PB7, CTS: PA11, RTS: PA12) */
+	WE_UART_Instance_6, /**< USART6 (TX: PC6, RX: PC7, no flow control) */
+	WE_UART_Instance_Count /**< Number of UART instances */
+} WE_UART_Instance_t;
+
 extern void WE_SystemClock_Config(void);
 
 /**
@@ -73,6 +83,45 @@ extern bool WE_UART1_DeInit();
  */
 extern bool WE_UART1_Transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * @brief Start transmitting data via UART without waiting for the transmission to complete.
+ *
+ * If WE_UART_DMA is defined, the data is transferred using DMA and this function
+ * returns immediately. Otherwise the data is transmitted in blocking mode.
+ *
+ * The data buffer must not be modified until the transmission has been completed.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+extern bool WE_UART1_TransmitAsync(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Wait until all data passed to the UART has been transmitted.
+ *
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ * @return true if the UART is idle, false if the timeout has expired
+ */
+extern bool WE_UART1_WaitForTxIdle(uint32_t timeoutMs);
+
+/**
+ * @brief Set the function to be called when an asynchronous transmission has been completed.
+ *
+ * @param[in] callback Transmission complete callback (may be NULL)
+ */
+extern void WE_UART1_SetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback);
+
+/**
+ * @brief Transmit several data segments via UART as one contiguous stream.
+ *
+ * If WE_UART_DMA is defined, the segments are transferred back to back using DMA.
+ * Returns when all segments have been transmitted.
+ *
+ * @param[in] segments Array of segments to be sent
+ * @param[in] count Number of segments in array
+ */
+extern bool WE_UART1_TransmitV(const WE_UART_Segment_t *segments, uint8_t count);
+
 /**
  * @brief Initialize and start the UART.
  *
@@ -96,6 +145,154 @@ extern bool WE_UART6_DeInit();
  */
 extern bool WE_UART6_Transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * @brief Start transmitting data via UART without waiting for the transmission to complete.
+ *
+ * If WE_UART_DMA is defined, the data is transferred using DMA and this function
+ * returns immediately. Otherwise the data is transmitted in blocking mode.
+ *
+ * The data buffer must not be modified until the transmission has been completed.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+extern bool WE_UART6_TransmitAsync(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Wait until all data passed to the UART has been transmitted.
+ *
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ * @return true if the UART is idle, false if the timeout has expired
+ */
+extern bool WE_UART6_WaitForTxIdle(uint32_t timeoutMs);
+
+/**
+ * @brief Set the function to be called when an asynchronous transmission has been completed.
+ *
+ * @param[in] callback Transmission complete callback (may be NULL)
+ */
+extern void WE_UART6_SetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback);
+
+/**
+ * @brief Transmit several data segments via UART as one contiguous stream.
+ *
+ * If WE_UART_DMA is defined, the segments are transferred back to back using DMA.
+ * Returns when all segments have been transmitted.
+ *
+ * @param[in] segments Array of segments to be sent
+ * @param[in] count Number of segments in array
+ */
+extern bool WE_UART6_TransmitV(const WE_UART_Segment_t *segments, uint8_t count);
+
+#if defined(WE_UART_DMA)
+/**
+ * @brief Pass pending received data of all UARTs in pull mode to their rx byte handlers.
+ *
+ * Is called by WE_Delay(), so drivers waiting for responses keep working in pull mode.
+ */
+extern void WE_UART_ProcessPendingRx();
+
+/**
+ * @brief Select how data received via UART is delivered (only available if WE_UART_DMA is defined).
+ *
+ * In pull mode, received data stays in the DMA ring buffer until it is fetched using
+ * WE_UART1_RxPeek() / WE_UART1_RxConsume() or passed to the rx byte handler by
+ * WE_UART1_ProcessRx(), so no parsing takes place in interrupt context.
+ * Must be called before WE_UART1_Init().
+ *
+ * @param[in] mode Receive mode
+ */
+extern void WE_UART1_SetRxMode(WE_UART_RxMode_t mode);
+
+/**
+ * @brief Set the buffer used for receiving data via DMA (only available if WE_UART_DMA is defined).
+ *
+ * Must be called before WE_UART1_Init(). If no buffer is set, a default buffer of
+ * WE_DMA_RX_BUFFER_SIZE bytes is used. The buffer must stay valid while the UART is initialized.
+ *
+ * @param[in] buffer Receive buffer (NULL to use the default buffer)
+ * @param[in] size Size of receive buffer in bytes (at least 2, must be even in double buffer mode)
+ * @param[in] mode Defines how the buffer is filled by the DMA
+ * @return true if request succeeded, false otherwise
+ */
+extern bool WE_UART1_SetRxBuffer(uint8_t *buffer, uint16_t size, WE_UART_RxBufferMode_t mode);
+
+/**
+ * @brief Get the data received via UART that has not been consumed yet (pull mode only).
+ *
+ * The data is not copied, the returned spans point to the DMA ring buffer. If the data
+ * wraps around the end of the ring buffer, it is returned as two spans.
+ *
+ * @param[out] spans Receives up to two spans of data (unused spans have length 0)
+ * @return Total number of bytes available
+ */
+extern uint16_t WE_UART1_RxPeek(WE_UART_Segment_t spans[2]);
+
+/**
+ * @brief Release data returned by WE_UART1_RxPeek() (pull mode only).
+ *
+ * @param[in] length Number of bytes to be released
+ */
+extern void WE_UART1_RxConsume(uint16_t length);
+
+/**
+ * @brief Pass all pending received data to the rx byte handler (pull mode only).
+ *
+ * Is to be called from the application's main loop (thread context).
+ */
+extern void WE_UART1_ProcessRx();
+
+/**
+ * @brief Select how data received via UART is delivered (only available if WE_UART_DMA is defined).
+ *
+ * In pull mode, received data stays in the DMA ring buffer until it is fetched using
+ * WE_UART6_RxPeek() / WE_UART6_RxConsume() or passed to the rx byte handler by
+ * WE_UART6_ProcessRx(), so no parsing takes place in interrupt context.
+ * Must be called before WE_UART6_Init().
+ *
+ * @param[in] mode Receive mode
+ */
+extern void WE_UART6_SetRxMode(WE_UART_RxMode_t mode);
+
+/**
+ * @brief Set the buffer used for receiving data via DMA (only available if WE_UART_DMA is defined).
+ *
+ * Must be called before WE_UART6_Init(). If no buffer is set, a default buffer of
+ * WE_DMA_RX_BUFFER_SIZE bytes is used. The buffer must stay valid while the UART is initialized.
+ *
+ * @param[in] buffer Receive buffer (NULL to use the default buffer)
+ * @param[in] size Size of receive buffer in bytes (at least 2, must be even in double buffer mode)
+ * @param[in] mode Defines how the buffer is filled by the DMA
+ * @return true if request succeeded, false otherwise
+ */
+extern bool WE_UART6_SetRxBuffer(uint8_t *buffer, uint16_t size, WE_UART_RxBufferMode_t mode);
+
+/**
+ * @brief Get the data received via UART that has not been consumed yet (pull mode only).
+ *
+ * The data is not copied, the returned spans point to the DMA ring buffer. If the data
+ * wraps around the end of the ring buffer, it is returned as two spans.
+ *
+ * @param[out] spans Receives up to two spans of data (unused spans have length 0)
+ * @return Total number of bytes available
+ */
+extern uint16_t WE_UART6_RxPeek(WE_UART_Segment_t spans[2]);
+
+/**
+ * @brief Release data returned by WE_UART6_RxPeek() (pull mode only).
+ *
+ * @param[in] length Number of bytes to be released
+ */
+extern void WE_UART6_RxConsume(uint16_t length);
+
+/**
+ * @brief Pass all pending received data to the rx byte handler (pull mode only).
+ *
+ * Is to be called from the application's main loop (thread context).
+ */
+extern void WE_UART6_ProcessRx();
+#endif /* WE_UART_DMA */
+
 #ifdef __cplusplus
 }
 #endif
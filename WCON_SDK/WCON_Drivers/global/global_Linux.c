@@ -0,0 +1,1011 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Linux platform driver.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "global_Linux.h"
+
+#ifdef WE_PLATFORM_LINUX
+
+#include "global.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+/**
+ * @brief Max. number of bytes passed to the rx byte handler at once.
+ */
+#define WE_UART_RX_CHUNK_SIZE 256
+
+/**
+ * @brief Max. number of segments written using a single writev() call.
+ */
+#define WE_UART_MAX_IOV 16
+
+/**
+ * @brief Interval (microseconds) at which the output queue is checked while waiting for the transmitter to become idle.
+ */
+#define WE_UART_TX_IDLE_POLL_USEC 1000
+
+typedef struct
+{
+	/**
+	 * @brief Path of serial device (NULL to use a socket pair).
+	 */
+	const char *device;
+
+	/**
+	 * @brief File descriptor used for communicating with radio module (-1 if not initialized).
+	 */
+	int fd;
+
+	/**
+	 * @brief File descriptor of the simulated module's end of the socket pair (-1 if not used).
+	 */
+	int peerFd;
+
+	/**
+	 * @brief Pipe used to wake up the receive thread on deinitialization.
+	 */
+	int wakeupPipe[2];
+
+	/**
+	 * @brief Thread reading data from fd and passing it to the rx byte handler.
+	 */
+	pthread_t rxThread;
+
+	/**
+	 * @brief Pointer to the function to be called when one or several bytes have been received via UART
+	 */
+	WE_UART_HandleRxByte_t *rxByteHandlerP;
+
+	/**
+	 * @brief Optional function to be called when an asynchronous transmission has been completed.
+	 */
+	WE_UART_TxCompleteCallback_t txCompleteCallback;
+
+	/**
+	 * @brief Error counters of the serial device at the last reset of the statistics.
+	 * @see WE_UART_GetStatistics()
+	 */
+	struct serial_icounter_struct icountBase;
+} WE_UART_Internal_t;
+
+/**
+ * @brief Runtime state of all UART instances.
+ */
+static WE_UART_Internal_t WE_UART_Instances[WE_UART_Instance_Count] = {
+		[WE_UART_Instance_1] = {
+				.fd = -1,
+				.peerFd = -1,
+				.wakeupPipe = {
+						-1,
+						-1 } },
+		[WE_UART_Instance_2] = {
+				.fd = -1,
+				.peerFd = -1,
+				.wakeupPipe = {
+						-1,
+						-1 } }, };
+
+WE_GPIO_Port_t WE_GPIO_Ports[WE_GPIO_PORT_COUNT];
+
+/**
+ * @brief Function to be called when a simulated output pin has been changed.
+ */
+static WE_PinChangedCallback_t pinChangedCallback = NULL;
+
+/**
+ * @brief Receive timestamp of the data currently being passed to an rx byte handler
+ * (see WE_UART_GetRxTimestamp()). Each receive thread calls its own rx byte handler.
+ */
+static __thread uint32_t currentRxTimestamp = 0;
+
+/**
+ * @brief Receive time (milliseconds) of the data currently being passed to an rx byte handler
+ * (see WE_UART_GetRxTick()).
+ */
+static __thread uint32_t currentRxTick = 0;
+
+/**
+ * @brief Start time of tick counters.
+ */
+static struct timespec tickStart;
+static bool tickStarted = false;
+
+/**
+ * @brief Used by WE_WaitForEvent() to wait for data received by the UART receive threads.
+ */
+static pthread_once_t eventOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t eventMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t eventCond;
+
+/**
+ * @brief Is held while an rx byte handler is executed and by WE_EnterCriticalSection().
+ */
+static pthread_mutex_t criticalSectionMutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+static bool UartInit(WE_UART_Internal_t *uartInternal, uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP);
+static bool UartDeInit(WE_UART_Internal_t *uartInternal);
+static bool UartConfigureDevice(int fd, uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity);
+static void* UartRxThread(void *arg);
+static bool UartWrite(WE_UART_Internal_t *uartInternal, const uint8_t *data, size_t size);
+static bool UartTransmitAsync(WE_UART_Internal_t *uartInternal, const uint8_t *data, uint16_t size);
+static bool UartWaitForTxIdle(WE_UART_Internal_t *uartInternal, uint32_t timeoutMs);
+static bool UartTransmitV(WE_UART_Internal_t *uartInternal, const WE_UART_Segment_t *segments, uint8_t count);
+static uint64_t GetElapsedMicroseconds();
+static bool UartGetErrorCounters(WE_UART_Internal_t *uartInternal, struct serial_icounter_struct *icount);
+static void EventInit();
+static void EventSignal();
+
+void WE_Platform_Init(void)
+{
+	clock_gettime(CLOCK_MONOTONIC, &tickStart);
+	tickStarted = true;
+}
+
+void WE_Error_Handler(void)
+{
+	abort();
+}
+
+bool WE_InitPins(WE_Pin_t pins[], uint8_t numPins)
+{
+	for (uint8_t i = 0; i < numPins; i++)
+	{
+		if (((uint32_t) 0 == pins[i].pin) || (NULL == pins[i].port))
+		{
+			/* Unused */
+			continue;
+		}
+
+		WE_GPIO_Port_t *port = (WE_GPIO_Port_t*) pins[i].port;
+		if (WE_Pin_Type_Output == pins[i].type)
+		{
+			port->outputPins |= pins[i].pin;
+			port->inputPins &= ~pins[i].pin;
+			port->levels &= ~pins[i].pin;
+		}
+		else
+		{
+			port->inputPins |= pins[i].pin;
+			port->outputPins &= ~pins[i].pin;
+		}
+	}
+	return true;
+}
+
+bool WE_DeinitPin(WE_Pin_t pin)
+{
+	if (NULL == pin.port)
+	{
+		return false;
+	}
+
+	WE_GPIO_Port_t *port = (WE_GPIO_Port_t*) pin.port;
+	port->outputPins &= ~pin.pin;
+	port->inputPins &= ~pin.pin;
+	port->levels &= ~pin.pin;
+	return true;
+}
+
+bool WE_SetPin(WE_Pin_t pin, WE_Pin_Level_t out)
+{
+	if (0 == pin.pin || NULL == pin.port || pin.type != WE_Pin_Type_Output)
+	{
+		return false;
+	}
+
+	WE_GPIO_Port_t *port = (WE_GPIO_Port_t*) pin.port;
+	switch (out)
+	{
+	case WE_Pin_Level_High:
+		port->levels |= pin.pin;
+		break;
+
+	case WE_Pin_Level_Low:
+		port->levels &= ~pin.pin;
+		break;
+
+	default:
+		return false;
+	}
+
+	if (pinChangedCallback != NULL)
+	{
+		pinChangedCallback(pin, out);
+	}
+
+	return true;
+}
+
+WE_Pin_Level_t WE_GetPinLevel(WE_Pin_t pin)
+{
+	if (0 == pin.pin || NULL == pin.port)
+	{
+		return WE_Pin_Level_Low;
+	}
+
+	WE_GPIO_Port_t *port = (WE_GPIO_Port_t*) pin.port;
+	return (port->levels & pin.pin) ? WE_Pin_Level_High : WE_Pin_Level_Low;
+}
+
+bool WE_SetSimulatedPinLevel(WE_Pin_t pin, WE_Pin_Level_t level)
+{
+	if (0 == pin.pin || NULL == pin.port)
+	{
+		return false;
+	}
+
+	WE_GPIO_Port_t *port = (WE_GPIO_Port_t*) pin.port;
+	if (WE_Pin_Level_High == level)
+	{
+		port->levels |= pin.pin;
+	}
+	else
+	{
+		port->levels &= ~pin.pin;
+	}
+	return true;
+}
+
+void WE_SetPinChangedCallback(WE_PinChangedCallback_t callback)
+{
+	pinChangedCallback = callback;
+}
+
+void WE_Delay(uint16_t sleepForMs)
+{
+	WE_DelayMicroseconds((uint32_t) sleepForMs * 1000);
+}
+
+void WE_DelayMicroseconds(uint32_t sleepForUsec)
+{
+	struct timespec t;
+	t.tv_sec = sleepForUsec / 1000000;
+	t.tv_nsec = (long) (sleepForUsec % 1000000) * 1000;
+	while (nanosleep(&t, &t) != 0 && errno == EINTR)
+	{
+	}
+}
+
+bool WE_WaitForEvent(volatile bool *flag, uint32_t timeoutMs)
+{
+	pthread_once(&eventOnce, EventInit);
+
+	struct timespec deadline;
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += timeoutMs / 1000;
+	deadline.tv_nsec += (long) (timeoutMs % 1000) * 1000000;
+	if (deadline.tv_nsec >= 1000000000)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000;
+	}
+
+	pthread_mutex_lock(&eventMutex);
+	while (!*flag)
+	{
+		if (pthread_cond_timedwait(&eventCond, &eventMutex, &deadline) == ETIMEDOUT)
+		{
+			break;
+		}
+	}
+	bool isSet = *flag;
+	pthread_mutex_unlock(&eventMutex);
+
+	return isSet;
+}
+
+/**
+ * @brief Initializes the condition variable used by WE_WaitForEvent() (using the monotonic clock).
+ */
+static void EventInit()
+{
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&eventCond, &attr);
+	pthread_condattr_destroy(&attr);
+}
+
+/**
+ * @brief Wakes up all threads blocked in WE_WaitForEvent(), so that they check their flags.
+ *
+ * Is called after received data has been passed to an rx byte handler (which may have set a flag).
+ * Taking the mutex ensures that a flag set before this call is not missed by a thread that is
+ * just about to start waiting.
+ */
+static void EventSignal()
+{
+	pthread_once(&eventOnce, EventInit);
+
+	pthread_mutex_lock(&eventMutex);
+	pthread_cond_broadcast(&eventCond);
+	pthread_mutex_unlock(&eventMutex);
+}
+
+uint32_t WE_EnterCriticalSection()
+{
+	pthread_mutex_lock(&criticalSectionMutex);
+	return 0;
+}
+
+void WE_ExitCriticalSection(uint32_t state)
+{
+	(void) state;
+	pthread_mutex_unlock(&criticalSectionMutex);
+}
+
+uint32_t WE_GetTick()
+{
+	return (uint32_t) (GetElapsedMicroseconds() / 1000);
+}
+
+uint32_t WE_GetTickMicroseconds()
+{
+	return (uint32_t) GetElapsedMicroseconds();
+}
+
+/**
+ * @brief Returns the time elapsed since WE_Platform_Init() (or since the first call, if not initialized).
+ */
+static uint64_t GetElapsedMicroseconds()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	if (!tickStarted)
+	{
+		tickStart = now;
+		tickStarted = true;
+	}
+	return (uint64_t) (now.tv_sec - tickStart.tv_sec) * 1000000 + (now.tv_nsec - tickStart.tv_nsec) / 1000;
+}
+
+bool WE_UART_SetDevice(WE_UART_Instance_t instance, const char *device)
+{
+	if ((instance >= WE_UART_Instance_Count) || (WE_UART_Instances[instance].fd >= 0))
+	{
+		return false;
+	}
+	WE_UART_Instances[instance].device = device;
+	return true;
+}
+
+int WE_UART_GetPeerFd(WE_UART_Instance_t instance)
+{
+	if (instance >= WE_UART_Instance_Count)
+	{
+		return -1;
+	}
+	return WE_UART_Instances[instance].peerFd;
+}
+
+bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP)
+{
+	return UartInit(&WE_UART_Instances[WE_UART_Instance_1], baudrate, flowControl, parity, rxByteHandlerP);
+}
+
+bool WE_UART1_DeInit()
+{
+	return UartDeInit(&WE_UART_Instances[WE_UART_Instance_1]);
+}
+
+bool WE_UART1_Transmit(const uint8_t *data, uint16_t length)
+{
+	return UartWrite(&WE_UART_Instances[WE_UART_Instance_1], data, length);
+}
+
+bool WE_UART1_TransmitAsync(const uint8_t *data, uint16_t length)
+{
+	return UartTransmitAsync(&WE_UART_Instances[WE_UART_Instance_1], data, length);
+}
+
+bool WE_UART1_WaitForTxIdle(uint32_t timeoutMs)
+{
+	return UartWaitForTxIdle(&WE_UART_Instances[WE_UART_Instance_1], timeoutMs);
+}
+
+void WE_UART1_SetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback)
+{
+	WE_UART_Instances[WE_UART_Instance_1].txCompleteCallback = callback;
+}
+
+bool WE_UART1_TransmitV(const WE_UART_Segment_t *segments, uint8_t count)
+{
+	return UartTransmitV(&WE_UART_Instances[WE_UART_Instance_1], segments, count);
+}
+
+bool WE_UART2_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP)
+{
+	return UartInit(&WE_UART_Instances[WE_UART_Instance_2], baudrate, flowControl, parity, rxByteHandlerP);
+}
+
+bool WE_UART2_DeInit()
+{
+	return UartDeInit(&WE_UART_Instances[WE_UART_Instance_2]);
+}
+
+bool WE_UART2_Transmit(const uint8_t *data, uint16_t length)
+{
+	return UartWrite(&WE_UART_Instances[WE_UART_Instance_2], data, length);
+}
+
+bool WE_UART2_TransmitAsync(const uint8_t *data, uint16_t length)
+{
+	return UartTransmitAsync(&WE_UART_Instances[WE_UART_Instance_2], data, length);
+}
+
+bool WE_UART2_WaitForTxIdle(uint32_t timeoutMs)
+{
+	return UartWaitForTxIdle(&WE_UART_Instances[WE_UART_Instance_2], timeoutMs);
+}
+
+void WE_UART2_SetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback)
+{
+	WE_UART_Instances[WE_UART_Instance_2].txCompleteCallback = callback;
+}
+
+bool WE_UART2_TransmitV(const WE_UART_Segment_t *segments, uint8_t count)
+{
+	return UartTransmitV(&WE_UART_Instances[WE_UART_Instance_2], segments, count);
+}
+
+bool WE_UART_GetStatistics(WE_UART_Instance_t instance, WE_UART_Statistics_t *statistics)
+{
+	if ((instance >= WE_UART_Instance_Count) || (statistics == NULL))
+	{
+		return false;
+	}
+
+	WE_UART_Internal_t *uartInternal = &WE_UART_Instances[instance];
+
+	memset(statistics, 0, sizeof(*statistics));
+
+	struct serial_icounter_struct icount;
+	if (UartGetErrorCounters(uartInternal, &icount))
+	{
+		statistics->overrunErrors = (uint32_t) (icount.overrun - uartInternal->icountBase.overrun);
+		statistics->framingErrors = (uint32_t) (icount.frame - uartInternal->icountBase.frame);
+		statistics->parityErrors = (uint32_t) (icount.parity - uartInternal->icountBase.parity);
+		/* Overflow of the kernel's receive buffer is the equivalent of the DMA ring buffer overflow */
+		statistics->dmaRxOverflows = (uint32_t) (icount.buf_overrun - uartInternal->icountBase.buf_overrun);
+	}
+	return true;
+}
+
+bool WE_UART_ResetStatistics(WE_UART_Instance_t instance)
+{
+	if (instance >= WE_UART_Instance_Count)
+	{
+		return false;
+	}
+
+	WE_UART_Internal_t *uartInternal = &WE_UART_Instances[instance];
+	if (!UartGetErrorCounters(uartInternal, &uartInternal->icountBase))
+	{
+		memset(&uartInternal->icountBase, 0, sizeof(uartInternal->icountBase));
+	}
+	return true;
+}
+
+uint32_t WE_UART_GetRxTimestamp()
+{
+	return currentRxTimestamp;
+}
+
+uint32_t WE_UART_GetRxTick()
+{
+	return currentRxTick;
+}
+
+/**
+ * @brief Reads the error counters of the serial device.
+ *
+ * Noise errors and the receive buffer fill level are not reported by Linux.
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[out] icount Receives the counters
+ *
+ * @return true if successful, false if not available (not initialized, socket pair or driver without support)
+ */
+static bool UartGetErrorCounters(WE_UART_Internal_t *uartInternal, struct serial_icounter_struct *icount)
+{
+	if ((uartInternal->fd < 0) || (uartInternal->device == NULL))
+	{
+		return false;
+	}
+	return ioctl(uartInternal->fd, TIOCGICOUNT, icount) == 0;
+}
+
+/**
+ * @brief Opens the serial device (or creates a socket pair) and starts the receive thread.
+ *
+ * @param[in] uartInternal UART to be initialized
+ * @param[in] baudrate Baud rate of the serial interface
+ * @param[in] flowControl Enable/disable flow control
+ * @param[in] parity Parity bit configuration
+ * @param[in] rxByteHandlerP Pointer to the handle rx byte function inside the driver
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartInit(WE_UART_Internal_t *uartInternal, uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP)
+{
+	if (uartInternal->fd >= 0)
+	{
+		/* Already initialized */
+		UartDeInit(uartInternal);
+	}
+
+	if (uartInternal->device != NULL)
+	{
+		uartInternal->fd = open(uartInternal->device, O_RDWR | O_NOCTTY | O_CLOEXEC);
+		if (uartInternal->fd < 0)
+		{
+			return false;
+		}
+		if (!UartConfigureDevice(uartInternal->fd, baudrate, flowControl, parity))
+		{
+			close(uartInternal->fd);
+			uartInternal->fd = -1;
+			return false;
+		}
+	}
+	else
+	{
+		int fds[2];
+		if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+		{
+			return false;
+		}
+		uartInternal->fd = fds[0];
+		uartInternal->peerFd = fds[1];
+	}
+
+	if (pipe2(uartInternal->wakeupPipe, O_CLOEXEC) != 0)
+	{
+		UartDeInit(uartInternal);
+		return false;
+	}
+
+	uartInternal->rxByteHandlerP = rxByteHandlerP;
+
+	if (!UartGetErrorCounters(uartInternal, &uartInternal->icountBase))
+	{
+		memset(&uartInternal->icountBase, 0, sizeof(uartInternal->icountBase));
+	}
+
+	if (pthread_create(&uartInternal->rxThread, NULL, UartRxThread, uartInternal) != 0)
+	{
+		close(uartInternal->wakeupPipe[0]);
+		close(uartInternal->wakeupPipe[1]);
+		uartInternal->wakeupPipe[0] = -1;
+		uartInternal->wakeupPipe[1] = -1;
+		UartDeInit(uartInternal);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Stops the receive thread and closes the serial device (or socket pair).
+ *
+ * @param[in] uartInternal UART to be deinitialized
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartDeInit(WE_UART_Internal_t *uartInternal)
+{
+	if (uartInternal->wakeupPipe[1] >= 0)
+	{
+		/* Wake up and stop receive thread */
+		uint8_t stop = 0;
+		(void) !write(uartInternal->wakeupPipe[1], &stop, 1);
+		pthread_join(uartInternal->rxThread, NULL);
+
+		close(uartInternal->wakeupPipe[0]);
+		close(uartInternal->wakeupPipe[1]);
+		uartInternal->wakeupPipe[0] = -1;
+		uartInternal->wakeupPipe[1] = -1;
+	}
+
+	if (uartInternal->peerFd >= 0)
+	{
+		close(uartInternal->peerFd);
+		uartInternal->peerFd = -1;
+	}
+	if (uartInternal->fd >= 0)
+	{
+		close(uartInternal->fd);
+		uartInternal->fd = -1;
+	}
+
+	uartInternal->rxByteHandlerP = NULL;
+	return true;
+}
+
+/**
+ * @brief Configures a serial device (raw mode, baud rate, flow control, parity).
+ *
+ * @param[in] fd File descriptor of serial device
+ * @param[in] baudrate Baud rate of the serial interface
+ * @param[in] flowControl Enable/disable flow control (RTS and CTS can't be enabled separately)
+ * @param[in] parity Parity bit configuration
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartConfigureDevice(int fd, uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity)
+{
+	static const struct
+	{
+		uint32_t baudrate;
+		speed_t speed;
+	} speeds[] = {
+			{
+					9600,
+					B9600 },
+			{
+					19200,
+					B19200 },
+			{
+					38400,
+					B38400 },
+			{
+					57600,
+					B57600 },
+			{
+					115200,
+					B115200 },
+			{
+					230400,
+					B230400 },
+			{
+					460800,
+					B460800 },
+			{
+					921600,
+					B921600 },
+			{
+					1000000,
+					B1000000 },
+			{
+					2000000,
+					B2000000 },
+			{
+					3000000,
+					B3000000 }, };
+
+	struct termios tty;
+	if (tcgetattr(fd, &tty) != 0)
+	{
+		return false;
+	}
+
+	cfmakeraw(&tty);
+
+	speed_t speed = 0;
+	for (size_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++)
+	{
+		if (speeds[i].baudrate == baudrate)
+		{
+			speed = speeds[i].speed;
+			break;
+		}
+	}
+	if (speed == 0)
+	{
+		/* Unsupported baud rate */
+		return false;
+	}
+	cfsetispeed(&tty, speed);
+	cfsetospeed(&tty, speed);
+
+	tty.c_cflag |= CLOCAL | CREAD;
+	tty.c_cflag &= ~(PARENB | PARODD | CSTOPB | CRTSCTS);
+	switch (parity)
+	{
+	case WE_Parity_Odd:
+		tty.c_cflag |= PARENB | PARODD;
+		break;
+
+	case WE_Parity_Even:
+		tty.c_cflag |= PARENB;
+		break;
+
+	case WE_Parity_None:
+	default:
+		break;
+	}
+	if (WE_FlowControl_NoFlowControl != flowControl)
+	{
+		tty.c_cflag |= CRTSCTS;
+	}
+
+	/* Reads return as soon as at least one byte is available */
+	tty.c_cc[VMIN] = 1;
+	tty.c_cc[VTIME] = 0;
+
+	if (tcsetattr(fd, TCSANOW, &tty) != 0)
+	{
+		return false;
+	}
+	tcflush(fd, TCIOFLUSH);
+	return true;
+}
+
+/**
+ * @brief Receive thread - passes data received via UART to the rx byte handler.
+ *
+ * The rx byte handler is called from this thread (the equivalent of the UART interrupt on STM32).
+ *
+ * @param[in] arg UART to be read (WE_UART_Internal_t*)
+ */
+static void* UartRxThread(void *arg)
+{
+	WE_UART_Internal_t *uartInternal = (WE_UART_Internal_t*) arg;
+	uint8_t buffer[WE_UART_RX_CHUNK_SIZE];
+
+	struct pollfd fds[2];
+	fds[0].fd = uartInternal->fd;
+	fds[0].events = POLLIN;
+	fds[1].fd = uartInternal->wakeupPipe[0];
+	fds[1].events = POLLIN;
+
+	while (true)
+	{
+		if (poll(fds, 2, -1) < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			break;
+		}
+
+		if (fds[1].revents != 0)
+		{
+			/* Deinitialization requested */
+			break;
+		}
+
+		if (fds[0].revents & (POLLIN | POLLHUP | POLLERR))
+		{
+			ssize_t n = read(uartInternal->fd, buffer, sizeof(buffer));
+			if (n > 0)
+			{
+				currentRxTimestamp = WE_GetTickMicroseconds();
+				currentRxTick = WE_GetTick();
+				if ((uartInternal->rxByteHandlerP != NULL) && (*uartInternal->rxByteHandlerP != NULL))
+				{
+					pthread_mutex_lock(&criticalSectionMutex);
+					(*uartInternal->rxByteHandlerP)(buffer, (size_t) n);
+					pthread_mutex_unlock(&criticalSectionMutex);
+				}
+				EventSignal();
+			}
+			else if (n == 0 || (errno != EINTR && errno != EAGAIN))
+			{
+				/* Peer has been closed or device has been removed */
+				break;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Writes data to the serial device (or socket pair).
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] size Number of bytes to be sent
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartWrite(WE_UART_Internal_t *uartInternal, const uint8_t *data, size_t size)
+{
+	if ((uartInternal->fd < 0) || (data == NULL && size > 0))
+	{
+		return false;
+	}
+
+	while (size > 0)
+	{
+		ssize_t n = write(uartInternal->fd, data, size);
+		if (n < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return false;
+		}
+		data += n;
+		size -= (size_t) n;
+	}
+	return true;
+}
+
+/**
+ * @brief Writes data and calls the transmission complete callback (data is always written synchronously).
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] size Number of bytes to be sent
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartTransmitAsync(WE_UART_Internal_t *uartInternal, const uint8_t *data, uint16_t size)
+{
+	if (!UartWrite(uartInternal, data, size))
+	{
+		return false;
+	}
+	if (uartInternal->txCompleteCallback != NULL)
+	{
+		uartInternal->txCompleteCallback();
+	}
+	return true;
+}
+
+/**
+ * @brief Waits until all data written to the serial device has been transmitted.
+ *
+ * Polls the output queue (and the transmitter's line status, if provided by the serial driver)
+ * instead of using tcdrain(), which blocks without a timeout (e.g. while the output is stopped
+ * by flow control).
+ *
+ * @param[in] uartInternal UART to be checked
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ *
+ * @return true if successful, false if the timeout has expired or the state could not be read
+ */
+static bool UartWaitForTxIdle(WE_UART_Internal_t *uartInternal, uint32_t timeoutMs)
+{
+	if ((uartInternal->fd < 0) || (uartInternal->device == NULL))
+	{
+		/* Socket pair: data has been passed to the peer on write */
+		return true;
+	}
+
+	uint64_t start = GetElapsedMicroseconds();
+	while (true)
+	{
+		int pending;
+		if (ioctl(uartInternal->fd, TIOCOUTQ, &pending) != 0)
+		{
+			return false;
+		}
+		if (pending == 0)
+		{
+			unsigned int lineStatus;
+			if ((ioctl(uartInternal->fd, TIOCSERGETLSR, &lineStatus) != 0) || (lineStatus & TIOCSER_TEMT))
+			{
+				/* Transmitter is empty (or its state is not provided, e.g. by pseudo terminals) */
+				return true;
+			}
+		}
+
+		if (GetElapsedMicroseconds() - start >= (uint64_t) timeoutMs * 1000)
+		{
+			return false;
+		}
+		WE_DelayMicroseconds(WE_UART_TX_IDLE_POLL_USEC);
+	}
+}
+
+/**
+ * @brief Writes several data segments to the serial device (or socket pair) using writev().
+ *
+ * @param[in] uartInternal UART to be used
+ * @param[in] segments Array of segments to be sent
+ * @param[in] count Number of segments in array
+ *
+ * @return true if successful, false otherwise
+ */
+static bool UartTransmitV(WE_UART_Internal_t *uartInternal, const WE_UART_Segment_t *segments, uint8_t count)
+{
+	if ((uartInternal->fd < 0) || (segments == NULL && count > 0))
+	{
+		return false;
+	}
+
+	struct iovec iov[WE_UART_MAX_IOV];
+	uint8_t i = 0;
+	while (i < count)
+	{
+		int iovCount = 0;
+		size_t total = 0;
+		for (; i < count && iovCount < WE_UART_MAX_IOV; i++)
+		{
+			if (segments[i].length == 0)
+			{
+				continue;
+			}
+			if (segments[i].data == NULL)
+			{
+				return false;
+			}
+			iov[iovCount].iov_base = (void*) segments[i].data;
+			iov[iovCount].iov_len = segments[i].length;
+			total += segments[i].length;
+			iovCount++;
+		}
+		if (iovCount == 0)
+		{
+			break;
+		}
+
+		ssize_t n = writev(uartInternal->fd, iov, iovCount);
+		if (n < 0 && errno != EINTR)
+		{
+			return false;
+		}
+		if (n < 0)
+		{
+			n = 0;
+		}
+		if ((size_t) n < total)
+		{
+			/* Partial write - write the remaining data of this batch segment by segment */
+			for (int j = 0; j < iovCount; j++)
+			{
+				if ((size_t) n >= iov[j].iov_len)
+				{
+					n -= iov[j].iov_len;
+					continue;
+				}
+				if (!UartWrite(uartInternal, (const uint8_t*) iov[j].iov_base + n, iov[j].iov_len - n))
+				{
+					return false;
+				}
+				n = 0;
+			}
+		}
+	}
+	return true;
+}
+
+#endif /* WE_PLATFORM_LINUX */
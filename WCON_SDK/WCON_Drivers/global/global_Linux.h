@@ -0,0 +1,275 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Linux platform driver (used for running the drivers on a host PC, e.g. against a simulated module).
+ */
+
+#ifndef GLOBAL_LINUX_H_INCLUDED
+#define GLOBAL_LINUX_H_INCLUDED
+
+#if defined(__linux__) && !defined(STM32L073xx) && !defined(STM32F401xE)
+
+/**
+ * @brief Is defined if the SDK is built for the Linux host platform.
+ */
+#define WE_PLATFORM_LINUX
+
+#include <stdbool.h>
+
+#include "global_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Simulated GPIO port.
+ *
+ * Pins are simulated in memory. The level of output pins can be read back using WE_GetPinLevel(),
+ * the level of input pins can be set using WE_SetSimulatedPinLevel().
+ */
+typedef struct WE_GPIO_Port_t
+{
+	uint32_t outputPins; /**< Pins configured as output */
+	uint32_t inputPins; /**< Pins configured as input */
+	uint32_t levels; /**< Current pin levels (bit set = high) */
+} WE_GPIO_Port_t;
+
+/**
+ * @brief Number of simulated GPIO ports.
+ */
+#define WE_GPIO_PORT_COUNT 8
+
+extern WE_GPIO_Port_t WE_GPIO_Ports[WE_GPIO_PORT_COUNT];
+
+/* Simulated GPIO ports and pins (allows using the same pin definitions as on the STM32 platforms) */
+#define GPIOA (&WE_GPIO_Ports[0])
+#define GPIOB (&WE_GPIO_Ports[1])
+#define GPIOC (&WE_GPIO_Ports[2])
+#define GPIOD (&WE_GPIO_Ports[3])
+#define GPIOE (&WE_GPIO_Ports[4])
+#define GPIOF (&WE_GPIO_Ports[5])
+#define GPIOG (&WE_GPIO_Ports[6])
+#define GPIOH (&WE_GPIO_Ports[7])
+
+#define GPIO_PIN_0 ((uint16_t) 0x0001)
+#define GPIO_PIN_1 ((uint16_t) 0x0002)
+#define GPIO_PIN_2 ((uint16_t) 0x0004)
+#define GPIO_PIN_3 ((uint16_t) 0x0008)
+#define GPIO_PIN_4 ((uint16_t) 0x0010)
+#define GPIO_PIN_5 ((uint16_t) 0x0020)
+#define GPIO_PIN_6 ((uint16_t) 0x0040)
+#define GPIO_PIN_7 ((uint16_t) 0x0080)
+#define GPIO_PIN_8 ((uint16_t) 0x0100)
+#define GPIO_PIN_9 ((uint16_t) 0x0200)
+#define GPIO_PIN_10 ((uint16_t) 0x0400)
+#define GPIO_PIN_11 ((uint16_t) 0x0800)
+#define GPIO_PIN_12 ((uint16_t) 0x1000)
+#define GPIO_PIN_13 ((uint16_t) 0x2000)
+#define GPIO_PIN_14 ((uint16_t) 0x4000)
+#define GPIO_PIN_15 ((uint16_t) 0x8000)
+
+/**
+ * @brief Is called when the level of a simulated output pin has been changed via WE_SetPin().
+ *
+ * @param[in] pin Pin that has been changed
+ * @param[in] level New pin level
+ */
+typedef void (*WE_PinChangedCallback_t)(WE_Pin_t pin, WE_Pin_Level_t level);
+
+/**
+ * @brief UART instances available on this platform.
+ */
+typedef enum WE_UART_Instance_t
+{
+	WE_UART_Instance_1 = 0, /**< First UART */
+	WE_UART_Instance_2, /**< Second UART */
+	WE_UART_Instance_Count /**< Number of UART instances */
+} WE_UART_Instance_t;
+
+/**
+ * @brief Set the level of a simulated input pin.
+ *
+ * @param[in] pin Input pin to be set
+ * @param[in] level Level to be set
+ * @return true if request succeeded, false otherwise
+ */
+extern bool WE_SetSimulatedPinLevel(WE_Pin_t pin, WE_Pin_Level_t level);
+
+/**
+ * @brief Set the function to be called when the level of a simulated output pin has been changed.
+ *
+ * Can be used by a simulated module to react to e.g. reset or wake-up pins.
+ *
+ * @param[in] callback Pin changed callback (may be NULL)
+ */
+extern void WE_SetPinChangedCallback(WE_PinChangedCallback_t callback);
+
+/**
+ * @brief Select the serial device to be used by a UART instance.
+ *
+ * Must be called before initializing the UART. If a device is set (e.g. /dev/ttyUSB0 for a
+ * real module connected via USB, or the slave side of a pseudo terminal created by a simulator),
+ * it is opened and configured using the UART settings. Otherwise a socket pair is created on
+ * initialization, whose other end can be retrieved using WE_UART_GetPeerFd().
+ *
+ * @param[in] instance UART instance
+ * @param[in] device Path of serial device (NULL to use a socket pair)
+ * @return true if request succeeded, false otherwise
+ */
+extern bool WE_UART_SetDevice(WE_UART_Instance_t instance, const char *device);
+
+/**
+ * @brief Get the file descriptor of the simulated module's end of a UART's socket pair.
+ *
+ * Data written to this file descriptor is passed to the rx byte handler of the UART, data
+ * transmitted via the UART can be read from it.
+ *
+ * @param[in] instance UART instance
+ * @return File descriptor or -1 if the UART is not initialized or uses a serial device
+ */
+extern int WE_UART_GetPeerFd(WE_UART_Instance_t instance);
+
+/**
+ * @brief Initialize and start the UART.
+ *
+ * Received data is passed to the rx byte handler by a receive thread.
+ *
+ * @param[in] baudrate Baud rate of the serial interface
+ * @param[in] flowControl Enable/disable flow control
+ * @param[in] parity Parity bit configuration
+ * @param[in] rxByteHandlerP Pointer to the handle rx byte function inside the driver. (this function is called by the receive thread on data reception)
+ */
+extern bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP);
+
+/**
+ * @brief Deinitialize and stop the UART.
+ */
+extern bool WE_UART1_DeInit();
+
+/**
+ * @brief Transmit data via UART.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+extern bool WE_UART1_Transmit(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Transmit data via UART (data is written immediately, the callback is called before returning).
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+extern bool WE_UART1_TransmitAsync(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Wait until all data passed to the UART has been transmitted.
+ *
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ * @return true if the UART is idle, false if the timeout has expired
+ */
+extern bool WE_UART1_WaitForTxIdle(uint32_t timeoutMs);
+
+/**
+ * @brief Set the function to be called when an asynchronous transmission has been completed.
+ *
+ * @param[in] callback Transmission complete callback (may be NULL)
+ */
+extern void WE_UART1_SetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback);
+
+/**
+ * @brief Transmit several data segments via UART as one contiguous stream.
+ *
+ * @param[in] segments Array of segments to be sent
+ * @param[in] count Number of segments in array
+ */
+extern bool WE_UART1_TransmitV(const WE_UART_Segment_t *segments, uint8_t count);
+
+/**
+ * @brief Initialize and start the UART.
+ *
+ * Received data is passed to the rx byte handler by a receive thread.
+ *
+ * @param[in] baudrate Baud rate of the serial interface
+ * @param[in] flowControl Enable/disable flow control
+ * @param[in] parity Parity bit configuration
+ * @param[in] rxByteHandlerP Pointer to the handle rx byte function inside the driver. (this function is called by the receive thread on data reception)
+ */
+extern bool WE_UART2_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxByteHandlerP);
+
+/**
+ * @brief Deinitialize and stop the UART.
+ */
+extern bool WE_UART2_DeInit();
+
+/**
+ * @brief Transmit data via UART.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+extern bool WE_UART2_Transmit(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Transmit data via UART (data is written immediately, the callback is called before returning).
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+extern bool WE_UART2_TransmitAsync(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Wait until all data passed to the UART has been transmitted.
+ *
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ * @return true if the UART is idle, false if the timeout has expired
+ */
+extern bool WE_UART2_WaitForTxIdle(uint32_t timeoutMs);
+
+/**
+ * @brief Set the function to be called when an asynchronous transmission has been completed.
+ *
+ * @param[in] callback Transmission complete callback (may be NULL)
+ */
+extern void WE_UART2_SetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback);
+
+/**
+ * @brief Transmit several data segments via UART as one contiguous stream.
+ *
+ * @param[in] segments Array of segments to be sent
+ * @param[in] count Number of segments in array
+ */
+extern bool WE_UART2_TransmitV(const WE_UART_Segment_t *segments, uint8_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* defined(__linux__) && !defined(STM32L073xx) && !defined(STM32F401xE) */
+
+#endif /* GLOBAL_LINUX_H_INCLUDED */
@@ -119,14 +119,127 @@ typedef bool (*WE_UART_DeInit_t)();
  */
 typedef bool (*WE_UART_Transmit_t)(const uint8_t*, uint16_t);
 
+/**
+ * @brief Is called when an asynchronous UART transmission has been completed
+ * (i.e. the last byte has been shifted out).
+ *
+ * Note that this function is called from interrupt context.
+ */
+typedef void (*WE_UART_TxCompleteCallback_t)(void);
+
+/**
+ * @brief Start transmitting data via UART without waiting for the transmission to complete.
+ *
+ * The data buffer must not be modified until the transmission has been completed
+ * (see WE_UART_WaitForTxIdle_t and WE_UART_TxCompleteCallback_t).
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+typedef bool (*WE_UART_TransmitAsync_t)(const uint8_t*, uint16_t);
+
+/**
+ * @brief Set the function to be called when an asynchronous UART transmission has been completed.
+ *
+ * @param[in] callback Function to be called from interrupt context (NULL to disable)
+ */
+typedef void (*WE_UART_SetTxCompleteCallback_t)(WE_UART_TxCompleteCallback_t);
+
+/**
+ * @brief Wait until all data passed to the UART has been transmitted.
+ *
+ * @param[in] timeoutMs Max. time to wait in milliseconds
+ */
+typedef bool (*WE_UART_WaitForTxIdle_t)(uint32_t);
+
+/**
+ * @brief One segment of data to be transmitted via WE_UART_TransmitV_t.
+ */
+typedef struct WE_UART_Segment_t
+{
+	const uint8_t *data; /**< Pointer to the segment's data */
+	uint16_t length; /**< Number of bytes in segment */
+} WE_UART_Segment_t;
+
+/**
+ * @brief Transmit several data segments via UART as one contiguous stream (gather transmit).
+ *
+ * Returns when all segments have been transmitted, so the segments (and the
+ * segment array) may be located on the stack.
+ *
+ * @param[in] segments Array of segments to be sent
+ * @param[in] count Number of segments in array
+ */
+typedef bool (*WE_UART_TransmitV_t)(const WE_UART_Segment_t*, uint8_t);
+
+/**
+ * @brief Defines how data received via UART (using DMA) is delivered.
+ */
+typedef enum WE_UART_RxMode_t
+{
+	WE_UART_RxMode_Push, /**< Received data is passed to the rx byte handler from interrupt context (default) */
+	WE_UART_RxMode_Pull /**< Received data stays in the DMA ring buffer until it is fetched by the application */
+} WE_UART_RxMode_t;
+
+/**
+ * @brief Defines how the buffer used for receiving data via UART (using DMA) is filled.
+ */
+typedef enum WE_UART_RxBufferMode_t
+{
+	WE_UART_RxBufferMode_Circular, /**< Buffer is used as ring buffer (default) */
+	WE_UART_RxBufferMode_DoubleBuffer /**< Buffer is split into two halves, which are filled alternately using the DMA's double buffer mode (STM32F4 only) */
+} WE_UART_RxBufferMode_t;
+
+/**
+ * @brief UART error and receive buffer statistics.
+ *
+ * @see WE_UART_GetStatistics()
+ */
+typedef struct WE_UART_Statistics_t
+{
+	uint32_t overrunErrors; /**< Number of overrun errors (received bytes lost, because the previous byte had not been read in time) */
+	uint32_t framingErrors; /**< Number of framing errors (stop bit not detected) */
+	uint32_t noiseErrors; /**< Number of bytes received with noise detected */
+	uint32_t parityErrors; /**< Number of parity errors */
+	uint32_t dmaRxOverflows; /**< Number of times unread data in the DMA receive ring buffer has been overwritten */
+	uint16_t dmaRxPeakFill; /**< Max. number of unread bytes in the DMA receive ring buffer */
+} WE_UART_Statistics_t;
+
+/**
+ * @brief Value of WE_RequestTiming_t entries that could not be determined (e.g. no response received).
+ */
+#define WE_REQUEST_TIMING_INVALID ((uint32_t) 0xFFFFFFFF)
+
+/**
+ * @brief Timing of a request sent to a radio module (all values in microseconds).
+ *
+ * Is used to find out whether a slow response is caused by the radio module, by the
+ * UART transmission or by the host evaluating the response.
+ *
+ * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
+ */
+typedef struct WE_RequestTiming_t
+{
+	uint32_t transmitTime; /**< Time needed for transmitting the request */
+	uint32_t firstByteLatency; /**< Time between end of transmission and reception of the first byte (see WE_UART_GetRxTimestamp()) */
+	uint32_t confirmLatency; /**< Time between end of transmission and reception of the confirmation */
+	uint32_t processingDelay; /**< Time between reception of the confirmation and its evaluation by the waiting function */
+} WE_RequestTiming_t;
+
 /**
  * @brief Used to store pointers to uart functions.
+ *
+ * The functions uartTransmitAsync, uartSetTxCompleteCallback, uartWaitForTxIdle and uartTransmitV are optional and may be NULL.
  */
 typedef struct WE_UART_t
 {
 	WE_UART_Init_t uartInit;
 	WE_UART_DeInit_t uartDeinit;
 	WE_UART_Transmit_t uartTransmit;
+	WE_UART_TransmitAsync_t uartTransmitAsync;
+	WE_UART_SetTxCompleteCallback_t uartSetTxCompleteCallback;
+	WE_UART_WaitForTxIdle_t uartWaitForTxIdle;
+	WE_UART_TransmitV_t uartTransmitV;
 	uint32_t baudrate;
 	WE_FlowControl_t flowControl;
 	WE_Parity_t parity;
@@ -320,6 +320,15 @@ bool Base64_Decode(uint8_t *inputData, uint32_t inputLength, uint8_t *outputData
 		return false;
 	}
 
+	for (i = 0; i < inputLength; i++)
+	{
+		if (inputData[i] >= sizeof(base64DecTable))
+		{
+			/* not a Base64 character (beyond decoding table) */
+			return false;
+		}
+	}
+
 	uint32_t decoded_buffer_length;
 
 	if (!Base64_GetDecBufSize(inputData, inputLength, &decoded_buffer_length))
@@ -0,0 +1,225 @@
+/**
+ * \file
+ * \brief Compares the cost of assembling AT commands using ATCommand_Builder_t with the
+ * string based ATCommand_AppendArgument*() functions.
+ *
+ * Three variants are measured for each command:
+ * - baseline: the appenders as they were before the builder was introduced (strlen() of the
+ *   command on every call, sprintf() for integers), copied below
+ * - legacy API: the current ATCommand_AppendArgument*() functions (strlen() of the command on every call)
+ * - builder: ATCommand_BuilderAppendArgument*() (length is tracked by the builder)
+ *
+ * All variants must produce the same command.
+ */
+
+#include "global/ATCommands.h"
+
+#include "test.h"
+
+#define BENCH_BUFFER_SIZE 2048
+#define BENCH_PAYLOAD_SIZE 1460
+#define BENCH_ARGUMENT_COUNT 24
+
+#define BENCH_INTFLAGS (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED)
+
+static char payload[BENCH_PAYLOAD_SIZE];
+
+/* Appenders before the introduction of ATCommand_Builder_t */
+
+static bool Baseline_AppendArgumentBytes(char *pOutString, const char *pInArgument, uint16_t numBytes, char delimiter)
+{
+	if (NULL == pOutString)
+	{
+		return false;
+	}
+
+	size_t strLength = strlen(pOutString);
+	if (NULL != pInArgument)
+	{
+		memcpy(&pOutString[strLength], pInArgument, numBytes);
+		strLength += numBytes;
+	}
+
+	pOutString[strLength] = delimiter;
+
+	return true;
+}
+
+static bool Baseline_AppendArgumentString(char *pOutString, const char *pInArgument, char delimiter)
+{
+	if (NULL == pOutString)
+	{
+		return false;
+	}
+
+	size_t outStrLength = strlen(pOutString);
+	if (NULL != pInArgument)
+	{
+		size_t inStrLength = strlen(pInArgument);
+		strcpy(&pOutString[outStrLength], pInArgument);
+		outStrLength += inStrLength;
+	}
+	pOutString[outStrLength] = delimiter;
+	if (delimiter != '\0')
+	{
+		pOutString[outStrLength + 1] = '\0';
+	}
+
+	return true;
+}
+
+static bool Baseline_AppendArgumentInt(char *pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+	if (NULL == pOutString)
+	{
+		return false;
+	}
+
+	char tempString[12];
+	sprintf(tempString, "%lu", (unsigned long) pInValue);
+	return Baseline_AppendArgumentString(pOutString, tempString, delimiter);
+}
+
+/* AT+sendTo with payload (Calypso, UDP) */
+
+static bool BuildSendToBaseline(char *buffer)
+{
+	strcpy(buffer, "AT+sendTo=");
+	bool ok = Baseline_AppendArgumentInt(buffer, 3, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && Baseline_AppendArgumentString(buffer, "INET", ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && Baseline_AppendArgumentInt(buffer, 8888, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && Baseline_AppendArgumentString(buffer, "192.168.100.1", ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && Baseline_AppendArgumentInt(buffer, 0, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && Baseline_AppendArgumentInt(buffer, BENCH_PAYLOAD_SIZE, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && Baseline_AppendArgumentBytes(buffer, payload, BENCH_PAYLOAD_SIZE, ATCOMMAND_STRING_TERMINATE);
+	ok = ok && Baseline_AppendArgumentString(buffer, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ok;
+}
+
+static bool BuildSendToLegacy(char *buffer)
+{
+	strcpy(buffer, "AT+sendTo=");
+	bool ok = ATCommand_AppendArgumentInt(buffer, 3, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_AppendArgumentString(buffer, "INET", ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_AppendArgumentInt(buffer, 8888, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_AppendArgumentString(buffer, "192.168.100.1", ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_AppendArgumentInt(buffer, 0, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_AppendArgumentInt(buffer, BENCH_PAYLOAD_SIZE, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_AppendArgumentBytes(buffer, payload, BENCH_PAYLOAD_SIZE, ATCOMMAND_STRING_TERMINATE);
+	ok = ok && ATCommand_AppendArgumentString(buffer, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ok;
+}
+
+static bool BuildSendToBuilder(char *buffer)
+{
+	ATCommand_Builder_t builder;
+	ATCommand_BuilderInit(&builder, buffer, BENCH_BUFFER_SIZE, "AT+sendTo=");
+	bool ok = ATCommand_BuilderAppendArgumentInt(&builder, 3, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_BuilderAppendArgumentString(&builder, "INET", ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_BuilderAppendArgumentInt(&builder, 8888, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_BuilderAppendArgumentString(&builder, "192.168.100.1", ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_BuilderAppendArgumentInt(&builder, 0, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_BuilderAppendArgumentInt(&builder, BENCH_PAYLOAD_SIZE, BENCH_INTFLAGS, ATCOMMAND_ARGUMENT_DELIM);
+	ok = ok && ATCommand_BuilderAppendArgumentBytes(&builder, payload, BENCH_PAYLOAD_SIZE, ATCOMMAND_STRING_TERMINATE);
+	ok = ok && ATCommand_BuilderAppendArgumentString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+	return ok;
+}
+
+/* Command with many short arguments (e.g. MQTT / HTTP configuration) */
+
+static const char *arguments[] = {
+		"mqtt",
+		"client01",
+		"broker.example.com",
+		"user",
+		"secret" };
+
+static bool BuildManyArgumentsBaseline(char *buffer)
+{
+	strcpy(buffer, "AT+config=");
+	bool ok = true;
+	for (int i = 0; ok && i < BENCH_ARGUMENT_COUNT; i++)
+	{
+		char delimiter = i < BENCH_ARGUMENT_COUNT - 1 ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE;
+		ok = (i % 2 == 0) ? Baseline_AppendArgumentString(buffer, arguments[i % 5], delimiter) : Baseline_AppendArgumentInt(buffer, 1000u * i, BENCH_INTFLAGS, delimiter);
+	}
+	return ok && Baseline_AppendArgumentString(buffer, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+}
+
+static bool BuildManyArgumentsLegacy(char *buffer)
+{
+	strcpy(buffer, "AT+config=");
+	bool ok = true;
+	for (int i = 0; ok && i < BENCH_ARGUMENT_COUNT; i++)
+	{
+		char delimiter = i < BENCH_ARGUMENT_COUNT - 1 ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE;
+		ok = (i % 2 == 0) ? ATCommand_AppendArgumentString(buffer, arguments[i % 5], delimiter) : ATCommand_AppendArgumentInt(buffer, 1000u * i, BENCH_INTFLAGS, delimiter);
+	}
+	return ok && ATCommand_AppendArgumentString(buffer, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+}
+
+static bool BuildManyArgumentsBuilder(char *buffer)
+{
+	ATCommand_Builder_t builder;
+	ATCommand_BuilderInit(&builder, buffer, BENCH_BUFFER_SIZE, "AT+config=");
+	bool ok = true;
+	for (int i = 0; ok && i < BENCH_ARGUMENT_COUNT; i++)
+	{
+		char delimiter = i < BENCH_ARGUMENT_COUNT - 1 ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE;
+		ok = (i % 2 == 0) ? ATCommand_BuilderAppendArgumentString(&builder, arguments[i % 5], delimiter) : ATCommand_BuilderAppendArgumentInt(&builder, 1000u * i, BENCH_INTFLAGS, delimiter);
+	}
+	return ok && ATCommand_BuilderAppendArgumentString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+}
+
+typedef bool (*BuildFunction_t)(char *buffer);
+
+/**
+ * @brief Measures the supplied build function and checks its output against the expected command.
+ */
+static void Measure(const char *name, BuildFunction_t build, const char *expected, size_t expectedLength, uint32_t iterations)
+{
+	static char buffer[BENCH_BUFFER_SIZE];
+
+	memset(buffer, 0, sizeof(buffer));
+	TEST_CHECK_MSG(build(buffer), "%s", name);
+	TEST_CHECK_MSG(memcmp(buffer, expected, expectedLength) == 0, "%s", name);
+
+	uint64_t start = TestGetTimeNs();
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		build(buffer);
+		TEST_KEEP(buffer);
+	}
+	TestPrintBenchmark(name, iterations, TestGetTimeNs() - start);
+}
+
+int main()
+{
+	static char expected[BENCH_BUFFER_SIZE];
+	const uint32_t iterations = TestBenchIterations(200000);
+
+	/* Payload without zero bytes, so that the baseline's strlen() finds the end of the command */
+	for (size_t i = 0; i < sizeof(payload); i++)
+	{
+		payload[i] = (char) ('A' + i % 26);
+	}
+
+	printf("AT+sendTo with %u byte payload:\n", BENCH_PAYLOAD_SIZE);
+	memset(expected, 0, sizeof(expected));
+	BuildSendToBuilder(expected);
+	size_t length = strlen(expected);
+	TEST_CHECK(length == strlen("AT+sendTo=3,INET,8888,192.168.100.1,0,1460,") + BENCH_PAYLOAD_SIZE + 2);
+	Measure("  baseline (strlen per argument, sprintf)", BuildSendToBaseline, expected, length + 1, iterations);
+	Measure("  legacy API (strlen per argument)", BuildSendToLegacy, expected, length + 1, iterations);
+	Measure("  builder", BuildSendToBuilder, expected, length + 1, iterations);
+
+	printf("Command with %u arguments:\n", BENCH_ARGUMENT_COUNT);
+	memset(expected, 0, sizeof(expected));
+	BuildManyArgumentsBuilder(expected);
+	length = strlen(expected);
+	Measure("  baseline (strlen per argument, sprintf)", BuildManyArgumentsBaseline, expected, length + 1, iterations);
+	Measure("  legacy API (strlen per argument)", BuildManyArgumentsLegacy, expected, length + 1, iterations);
+	Measure("  builder", BuildManyArgumentsBuilder, expected, length + 1, iterations);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,132 @@
+/**
+ * \file
+ * \brief Compares the integer and floating point conversion functions of the AT layer with
+ * the C library functions they replaced (snprintf(), strtoul(), strtod(), strtof()) and
+ * the throughput of byte array arguments in hex representation with binary arguments.
+ */
+
+#include "global/ATCommands.h"
+
+#include "test.h"
+
+#include <inttypes.h>
+
+#define BENCH_VALUE_COUNT 256
+
+/* Size of byte array arguments (e.g. a payload) */
+#define BENCH_PAYLOAD_SIZE 256
+
+static uint32_t values32[BENCH_VALUE_COUNT];
+static uint64_t values64[BENCH_VALUE_COUNT];
+static char intStrings[BENCH_VALUE_COUNT][24];
+static char doubleStrings[BENCH_VALUE_COUNT][32];
+
+static uint64_t randomState = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t Random()
+{
+	randomState ^= randomState >> 12;
+	randomState ^= randomState << 25;
+	randomState ^= randomState >> 27;
+	return randomState * 0x2545F4914F6CDD1DULL;
+}
+
+#define BENCH_LOOP(name, iterations, body) \
+	do \
+	{ \
+		uint64_t start = TestGetTimeNs(); \
+		for (uint32_t i = 0; i < (iterations); i++) \
+		{ \
+			const size_t n = i % BENCH_VALUE_COUNT; \
+			body; \
+		} \
+		TestPrintBenchmark(name, iterations, TestGetTimeNs() - start); \
+	} while (0)
+
+int main()
+{
+	/* Values of all magnitudes, as they appear in AT commands (ports, lengths, timestamps, coordinates) */
+	for (size_t i = 0; i < BENCH_VALUE_COUNT; i++)
+	{
+		values32[i] = (uint32_t) (Random() >> (32 + Random() % 32));
+		values64[i] = Random() >> (Random() % 64);
+		snprintf(intStrings[i], sizeof(intStrings[i]), "%" PRIu32, values32[i]);
+		snprintf(doubleStrings[i], sizeof(doubleStrings[i]), "%.*f", (int) (Random() % 8), (double) (int64_t) (Random() >> 40) / 1000.0 - 8000.0);
+	}
+
+	/* Both variants must agree */
+	for (size_t i = 0; i < BENCH_VALUE_COUNT; i++)
+	{
+		char string[24];
+		char expected[24];
+		ATCommand_IntToString(string, values32[i], ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED);
+		TEST_CHECK(strcmp(string, intStrings[i]) == 0);
+		ATCommand_Int64ToString(string, values64[i], ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED);
+		snprintf(expected, sizeof(expected), "%" PRIu64, values64[i]);
+		TEST_CHECK(strcmp(string, expected) == 0);
+		double value;
+		TEST_CHECK(ATCommand_StringToDouble(&value, doubleStrings[i]) && value == strtod(doubleStrings[i], NULL));
+	}
+
+	const uint32_t iterations = TestBenchIterations(2000000);
+	char string[24];
+
+	printf("uint32 to decimal string:\n");
+	BENCH_LOOP("  snprintf(\"%lu\")", iterations, snprintf(string, sizeof(string), "%lu", (unsigned long) values32[n]); TEST_KEEP(string));
+	BENCH_LOOP("  ATCommand_IntToString()", iterations, ATCommand_IntToString(string, values32[n], ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED); TEST_KEEP(string));
+
+	printf("uint32 to hex string:\n");
+	BENCH_LOOP("  snprintf(\"0x%lx\")", iterations, snprintf(string, sizeof(string), "0x%lx", (unsigned long) values32[n]); TEST_KEEP(string));
+	BENCH_LOOP("  ATCommand_IntToString()", iterations, ATCommand_IntToString(string, values32[n], ATCOMMAND_INTFLAGS_NOTATION_HEX | ATCOMMAND_INTFLAGS_UNSIGNED); TEST_KEEP(string));
+
+	printf("uint64 to decimal string:\n");
+	BENCH_LOOP("  snprintf(\"%llu\")", iterations, snprintf(string, sizeof(string), "%llu", (unsigned long long) values64[n]); TEST_KEEP(string));
+	BENCH_LOOP("  ATCommand_Int64ToString()", iterations, ATCommand_Int64ToString(string, values64[n], ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED); TEST_KEEP(string));
+
+	printf("Decimal string to uint32:\n");
+	BENCH_LOOP("  strtoul()", iterations, uint32_t v = (uint32_t) strtoul(intStrings[n], NULL, 10); TEST_KEEP(v));
+	BENCH_LOOP("  ATCommand_StringToInt()", iterations, uint32_t v; ATCommand_StringToInt(&v, intStrings[n], ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED); TEST_KEEP(v));
+
+	printf("Decimal string to double:\n");
+	BENCH_LOOP("  strtod()", iterations, double v = strtod(doubleStrings[n], NULL); TEST_KEEP(v));
+	BENCH_LOOP("  ATCommand_StringToDouble()", iterations, double v; ATCommand_StringToDouble(&v, doubleStrings[n]); TEST_KEEP(v));
+
+	printf("Decimal string to float:\n");
+	BENCH_LOOP("  strtof()", iterations, float v = strtof(doubleStrings[n], NULL); TEST_KEEP(v));
+	BENCH_LOOP("  ATCommand_StringToFloat()", iterations, float v; ATCommand_StringToFloat(&v, doubleStrings[n]); TEST_KEEP(v));
+
+	/* Byte array arguments: binary is copied as is, hex is two digits per byte (the binary
+	 * payload contains no zero bytes, so that it is terminated like a received response) */
+	uint8_t payload[BENCH_PAYLOAD_SIZE + 1];
+	char payloadHex[2 * BENCH_PAYLOAD_SIZE + 1];
+	for (size_t i = 0; i < BENCH_PAYLOAD_SIZE; i++)
+	{
+		payload[i] = (uint8_t) (1 + Random() % UINT8_MAX);
+	}
+	payload[BENCH_PAYLOAD_SIZE] = ATCOMMAND_STRING_TERMINATE;
+	ATCommand_BytesToHex(payloadHex, payload, BENCH_PAYLOAD_SIZE);
+	payloadHex[2 * BENCH_PAYLOAD_SIZE] = ATCOMMAND_STRING_TERMINATE;
+
+	char command[2 * BENCH_PAYLOAD_SIZE + 16];
+	uint8_t bytes[BENCH_PAYLOAD_SIZE];
+	uint16_t length = 0;
+	ATCommand_Builder_t builder;
+	char *pos = payloadHex;
+	TEST_CHECK(ATCommand_GetNextArgumentHex(&pos, bytes, &length, sizeof(bytes), ATCOMMAND_STRING_TERMINATE) && length == BENCH_PAYLOAD_SIZE && memcmp(bytes, payload, BENCH_PAYLOAD_SIZE) == 0);
+
+	const uint32_t payloadIterations = TestBenchIterations(200000);
+
+	printf("%u byte argument to command:\n", BENCH_PAYLOAD_SIZE);
+	BENCH_LOOP("  ATCommand_BuilderAppendArgumentBytes()", payloadIterations,
+			ATCommand_BuilderInit(&builder, command, sizeof(command), "AT+SEND=1,"); ATCommand_BuilderAppendArgumentBytes(&builder, (const char*) payload, BENCH_PAYLOAD_SIZE, ATCOMMAND_STRING_TERMINATE); TEST_KEEP(command); (void) n);
+	BENCH_LOOP("  ATCommand_BuilderAppendArgumentHex()", payloadIterations,
+			ATCommand_BuilderInit(&builder, command, sizeof(command), "AT+SEND=1,"); ATCommand_BuilderAppendArgumentHex(&builder, payload, BENCH_PAYLOAD_SIZE, ATCOMMAND_STRING_TERMINATE); TEST_KEEP(command); (void) n);
+
+	printf("%u byte argument from response:\n", BENCH_PAYLOAD_SIZE);
+	BENCH_LOOP("  ATCommand_GetNextArgumentSpan() + memcpy()", payloadIterations,
+			ATCommand_Span_t span; pos = (char*) payload; ATCommand_GetNextArgumentSpan(&pos, &span, ATCOMMAND_STRING_TERMINATE); memcpy(bytes, span.data, span.length); TEST_KEEP(bytes); (void) n);
+	BENCH_LOOP("  ATCommand_GetNextArgumentHex()", payloadIterations,
+			pos = payloadHex; ATCommand_GetNextArgumentHex(&pos, bytes, &length, sizeof(bytes), ATCOMMAND_STRING_TERMINATE); TEST_KEEP(bytes); (void) n);
+
+	return TEST_RESULT();
+}
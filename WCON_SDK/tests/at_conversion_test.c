@@ -0,0 +1,552 @@
+/**
+ * \file
+ * \brief Tests the integer and floating point conversion functions of the AT layer
+ * (ATCommand_IntToString(), ATCommand_Int64ToString(), ATCommand_StringToInt(),
+ * ATCommand_StringToDouble(), ATCommand_StringToFloat()) against the C library and
+ * the hex conversion of byte array arguments (ATCommand_HexToBytes(),
+ * ATCommand_GetNextArgumentHex(), ATCommand_BuilderAppendArgumentHex()).
+ */
+
+#include "global/ATCommands.h"
+
+#include "test.h"
+
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+
+#define TEST_RANDOM_COUNT 100000
+
+static uint64_t randomState = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * @brief Deterministic pseudo random numbers (xorshift64*).
+ */
+static uint64_t Random()
+{
+	randomState ^= randomState >> 12;
+	randomState ^= randomState << 25;
+	randomState ^= randomState >> 27;
+	return randomState * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief Random value with a random number of significant bits (so that all magnitudes are covered).
+ */
+static uint64_t RandomValue()
+{
+	return Random() >> (Random() % 64);
+}
+
+/**
+ * @brief Distance of two doubles in units in the last place.
+ */
+static uint64_t UlpDistance(double a, double b)
+{
+	int64_t ia, ib;
+	memcpy(&ia, &a, sizeof(ia));
+	memcpy(&ib, &b, sizeof(ib));
+	if ((ia < 0) != (ib < 0))
+	{
+		return a == b ? 0 : UINT64_MAX;
+	}
+	return ia > ib ? (uint64_t) (ia - ib) : (uint64_t) (ib - ia);
+}
+
+static uint32_t UlpDistanceFloat(float a, float b)
+{
+	int32_t ia, ib;
+	memcpy(&ia, &a, sizeof(ia));
+	memcpy(&ib, &b, sizeof(ib));
+	if ((ia < 0) != (ib < 0))
+	{
+		return a == b ? 0 : UINT32_MAX;
+	}
+	return ia > ib ? (uint32_t) (ia - ib) : (uint32_t) (ib - ia);
+}
+
+typedef struct IntType_t
+{
+	const char *name;
+	uint16_t sizeFlag;
+	uint8_t bits;
+	bool isSigned;
+} IntType_t;
+
+static const IntType_t intTypes[] = {
+		{
+				"uint8",
+				ATCOMMAND_INTFLAGS_SIZE8,
+				8,
+				false },
+		{
+				"int8",
+				ATCOMMAND_INTFLAGS_SIZE8,
+				8,
+				true },
+		{
+				"uint16",
+				ATCOMMAND_INTFLAGS_SIZE16,
+				16,
+				false },
+		{
+				"int16",
+				ATCOMMAND_INTFLAGS_SIZE16,
+				16,
+				true },
+		{
+				"uint32",
+				ATCOMMAND_INTFLAGS_SIZE32,
+				32,
+				false },
+		{
+				"int32",
+				ATCOMMAND_INTFLAGS_SIZE32,
+				32,
+				true },
+		{
+				"uint64",
+				ATCOMMAND_INTFLAGS_SIZE64,
+				64,
+				false },
+		{
+				"int64",
+				ATCOMMAND_INTFLAGS_SIZE64,
+				64,
+				true } };
+
+/**
+ * @brief Reduces a value to the range of the supplied type (sign extended for signed types).
+ */
+static uint64_t Truncate(const IntType_t *type, uint64_t value)
+{
+	if (type->bits == 64)
+	{
+		return value;
+	}
+	uint64_t mask = (1ULL << type->bits) - 1;
+	value &= mask;
+	if (type->isSigned && (value >> (type->bits - 1)) != 0)
+	{
+		value |= ~mask;
+	}
+	return value;
+}
+
+/**
+ * @brief Reads back a value parsed into a variable of the supplied type (sign extended for signed types).
+ */
+static uint64_t Load(const IntType_t *type, const void *p)
+{
+	switch (type->bits)
+	{
+	case 8:
+		return type->isSigned ? (uint64_t) (int64_t) *(const int8_t*) p : *(const uint8_t*) p;
+	case 16:
+		return type->isSigned ? (uint64_t) (int64_t) *(const int16_t*) p : *(const uint16_t*) p;
+	case 32:
+		return type->isSigned ? (uint64_t) (int64_t) *(const int32_t*) p : *(const uint32_t*) p;
+	default:
+		return *(const uint64_t*) p;
+	}
+}
+
+/**
+ * @brief Formats a value using the SDK and the C library, compares the results and parses the value back.
+ */
+static bool CheckIntRoundTrip(const IntType_t *type, uint64_t value)
+{
+	uint16_t sign = type->isSigned ? ATCOMMAND_INTFLAGS_SIGNED : ATCOMMAND_INTFLAGS_UNSIGNED;
+	char string[32];
+	char expected[32];
+	bool ok = true;
+
+	/* Decimal */
+	if (type->bits <= 32)
+	{
+		ok = ok && ATCommand_IntToString(string, (uint32_t) value, sign | ATCOMMAND_INTFLAGS_NOTATION_DEC);
+	}
+	else
+	{
+		ok = ok && ATCommand_Int64ToString(string, value, sign | ATCOMMAND_INTFLAGS_NOTATION_DEC);
+	}
+	if (type->isSigned)
+	{
+		snprintf(expected, sizeof(expected), "%" PRId64, (int64_t) value);
+	}
+	else
+	{
+		snprintf(expected, sizeof(expected), "%" PRIu64, value);
+	}
+	ok = ok && (strcmp(string, expected) == 0);
+
+	uint64_t parsed = 0;
+	ok = ok && ATCommand_StringToInt(&parsed, string, type->sizeFlag | sign) && (Load(type, &parsed) == value);
+
+	/* Hexadecimal (two's complement of the type's size, parsed back with and without prefix) */
+	uint64_t bits = type->bits == 64 ? value : value & ((1ULL << type->bits) - 1);
+	if (type->bits <= 32)
+	{
+		ok = ok && ATCommand_IntToString(string, (uint32_t) value, sign | ATCOMMAND_INTFLAGS_NOTATION_HEX);
+		snprintf(expected, sizeof(expected), "0x%" PRIx64, type->bits == 32 ? bits : (uint64_t) (uint32_t) value);
+	}
+	else
+	{
+		ok = ok && ATCommand_Int64ToString(string, value, sign | ATCOMMAND_INTFLAGS_NOTATION_HEX);
+		snprintf(expected, sizeof(expected), "0x%" PRIx64, bits);
+	}
+	ok = ok && (strcmp(string, expected) == 0);
+
+	snprintf(string, sizeof(string), "0x%" PRIx64, bits);
+	parsed = 0;
+	ok = ok && ATCommand_StringToInt(&parsed, string, type->sizeFlag | sign) && (Load(type, &parsed) == value);
+	parsed = 0;
+	ok = ok && ATCommand_StringToInt(&parsed, string + 2, type->sizeFlag | sign | ATCOMMAND_INTFLAGS_NOTATION_HEX) && (Load(type, &parsed) == value);
+
+	TEST_CHECK_MSG(ok, "%s %s (0x%" PRIx64 ")", type->name, expected, value);
+	return ok;
+}
+
+static void TestIntegers()
+{
+	for (size_t t = 0; t < sizeof(intTypes) / sizeof(intTypes[0]); t++)
+	{
+		const IntType_t *type = &intTypes[t];
+		uint64_t max = type->bits == 64 ? (type->isSigned ? INT64_MAX : UINT64_MAX) : (type->isSigned ? (1ULL << (type->bits - 1)) - 1 : (1ULL << type->bits) - 1);
+		uint64_t min = type->isSigned ? ~max : 0;
+
+		/* Limits, powers of ten and their neighbours */
+		CheckIntRoundTrip(type, 0);
+		CheckIntRoundTrip(type, max);
+		CheckIntRoundTrip(type, max - 1);
+		CheckIntRoundTrip(type, min);
+		CheckIntRoundTrip(type, min + 1);
+		uint64_t power = 1;
+		for (int i = 0; i < 20; i++)
+		{
+			for (int delta = -1; delta <= 1; delta++)
+			{
+				uint64_t value = power + (uint64_t) (int64_t) delta;
+				if (value <= max)
+				{
+					CheckIntRoundTrip(type, value);
+					if (type->isSigned)
+					{
+						CheckIntRoundTrip(type, 0 - value);
+					}
+				}
+			}
+			power *= 10;
+		}
+
+		for (int i = 0; i < TEST_RANDOM_COUNT; i++)
+		{
+			if (!CheckIntRoundTrip(type, Truncate(type, RandomValue())))
+			{
+				break;
+			}
+		}
+	}
+
+	/* Invalid input */
+	uint32_t value;
+	TEST_CHECK(!ATCommand_StringToInt(&value, "", ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED));
+	TEST_CHECK(!ATCommand_StringToInt(&value, "-", ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_SIGNED));
+	TEST_CHECK(!ATCommand_StringToInt(&value, "12a", ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED));
+	TEST_CHECK(!ATCommand_StringToInt(&value, "0x", ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED));
+	TEST_CHECK(!ATCommand_StringToInt(NULL, "1", ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED));
+	char string[32];
+	TEST_CHECK(!ATCommand_Int64ToString(string, 1, ATCOMMAND_INTFLAGS_NOTATION_DEC));
+	TEST_CHECK(!ATCommand_Int64ToString(string, 1, ATCOMMAND_INTFLAGS_UNSIGNED));
+}
+
+/**
+ * @brief Builds a random decimal string with the supplied number of significant digits, whose
+ * last digit has the supplied power of ten, in a random notation (integer, fraction or exponent).
+ */
+static void RandomDecimal(char *string, size_t size, int digits, int exponent)
+{
+	char mantissa[32];
+	mantissa[0] = (char) ('1' + Random() % 9);
+	for (int i = 1; i < digits; i++)
+	{
+		mantissa[i] = (char) ('0' + Random() % 10);
+	}
+	mantissa[digits] = '\0';
+
+	const char *sign = (Random() % 2) ? "-" : "";
+	switch (Random() % 3)
+	{
+	case 0:
+		snprintf(string, size, "%s%se%d", sign, mantissa, exponent);
+		break;
+
+	case 1:
+		/* Decimal point after the first digit */
+		snprintf(string, size, "%s%c.%sE%+d", sign, mantissa[0], mantissa + 1, exponent + digits - 1);
+		break;
+
+	default:
+		if (exponent < 0 && -exponent < digits)
+		{
+			/* Fixed point notation */
+			snprintf(string, size, "%s%.*s.%s", sign, digits + exponent, mantissa, mantissa + digits + exponent);
+		}
+		else
+		{
+			snprintf(string, size, "%s%se%d", sign, mantissa, exponent);
+		}
+		break;
+	}
+}
+
+/**
+ * @brief Parses random decimal strings and returns the max. deviation from strtod() in units in the last place.
+ */
+static uint64_t MaxDoubleError(int minDigits, int maxDigits, int minExponent, int maxExponent)
+{
+	uint64_t maxError = 0;
+	for (int i = 0; i < TEST_RANDOM_COUNT; i++)
+	{
+		char string[64];
+		int digits = minDigits + (int) (Random() % (uint64_t) (maxDigits - minDigits + 1));
+		int exponent = minExponent + (int) (Random() % (uint64_t) (maxExponent - minExponent + 1));
+		RandomDecimal(string, sizeof(string), digits, exponent);
+
+		double expected = strtod(string, NULL);
+		if (isinf(expected) || fabs(expected) < DBL_MIN)
+		{
+			/* Overflow and subnormal numbers are not covered */
+			continue;
+		}
+
+		double value = 0;
+		if (!ATCommand_StringToDouble(&value, string))
+		{
+			TEST_CHECK_MSG(false, "\"%s\" not accepted", string);
+			return UINT64_MAX;
+		}
+		uint64_t error = UlpDistance(value, expected);
+		if (error > maxError)
+		{
+			maxError = error;
+		}
+	}
+	return maxError;
+}
+
+static void TestDoubles()
+{
+	/* Fixed values (accepted or rejected like strtod() with the whole string consumed, the
+	 * accuracy is checked in detail below) */
+	static const char *strings[] = {
+			"0",
+			"-0",
+			"1.5",
+			"-2.25",
+			"+3.14159265358979",
+			"1e10",
+			"8.0E+02",
+			"  7",
+			"5.",
+			".5",
+			"0.1",
+			"50.1234567",
+			"1.7976931348623157e308",
+			"2.2250738585072014e-308",
+			"123456789012345678901234",
+			"0.000000000000000000001234",
+			"",
+			".",
+			"-",
+			"1e",
+			"1e+",
+			"abc",
+			"1.2.3",
+			"1,5",
+			"1 " };
+	for (size_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++)
+	{
+		char *end;
+		double expected = strtod(strings[i], &end);
+		bool expectedOk = (end != strings[i]) && (*end == '\0');
+		double value = 0;
+		bool ok = ATCommand_StringToDouble(&value, strings[i]);
+		TEST_CHECK_MSG(ok == expectedOk && (!ok || UlpDistance(value, expected) <= 6), "\"%s\": %d %.17g, strtod() %d %.17g", strings[i], ok, value, expectedOk, expected);
+	}
+
+	/* Correctly rounded for up to 15 significant digits and powers of ten within +-22 */
+	uint64_t error = MaxDoubleError(1, 15, -22, 22);
+	TEST_CHECK_MSG(error == 0, "%" PRIu64 " ulp", error);
+
+	/* Up to 19 significant digits are accumulated (one unit in the last place), further digits
+	 * are truncated (another unit in the last place) */
+	error = MaxDoubleError(16, 19, -22, 22);
+	TEST_CHECK_MSG(error <= 1, "%" PRIu64 " ulp", error);
+	error = MaxDoubleError(20, 25, -28, 16);
+	TEST_CHECK_MSG(error <= 2, "%" PRIu64 " ulp", error);
+
+	/* Larger powers of ten are applied in steps of 10^22 (up to about 6 units in the last place) */
+	error = MaxDoubleError(1, 25, -330, 300);
+	TEST_CHECK_MSG(error <= 6, "%" PRIu64 " ulp", error);
+
+}
+
+static void TestFloats()
+{
+	/* The value is parsed as double and then rounded to float, so it may be off by one unit in
+	 * the last place, if the double is exactly halfway between two floats (double rounding) */
+	uint32_t maxError = 0;
+	int mismatches = 0;
+	for (int i = 0; i < TEST_RANDOM_COUNT; i++)
+	{
+		char string[64];
+		RandomDecimal(string, sizeof(string), 1 + (int) (Random() % 9), (int) (Random() % 41) - 30);
+		float expected = strtof(string, NULL);
+		if (isinf(expected) || fabsf(expected) < FLT_MIN)
+		{
+			continue;
+		}
+		float value = 0;
+		TEST_CHECK(ATCommand_StringToFloat(&value, string));
+		uint32_t error = UlpDistanceFloat(value, expected);
+		if (error > 0)
+		{
+			mismatches++;
+		}
+		if (error > maxError)
+		{
+			maxError = error;
+		}
+	}
+	TEST_CHECK_MSG(maxError <= 1 && mismatches < TEST_RANDOM_COUNT / 10000, "%u ulp, %d mismatches", maxError, mismatches);
+
+	float value;
+	TEST_CHECK(ATCommand_StringToFloat(&value, "0.1") && value == 0.1f);
+	TEST_CHECK(ATCommand_StringToFloat(&value, "-273.15") && value == -273.15f);
+	TEST_CHECK(!ATCommand_StringToFloat(&value, "0.1x"));
+}
+
+static void TestHexToBytes()
+{
+	/* All byte values (upper case digits as written by ATCommand_BytesToHex(), parsed back in lower case as well) */
+	for (unsigned int value = 0; value <= UINT8_MAX; value++)
+	{
+		uint8_t byte = (uint8_t) value;
+		char hex[3] = { 0 };
+		char expected[3];
+		ATCommand_BytesToHex(hex, &byte, 1);
+		snprintf(expected, sizeof(expected), "%02X", value);
+		TEST_CHECK_MSG(memcmp(hex, expected, 2) == 0, "0x%02x: \"%.2s\"", value, hex);
+
+		uint8_t parsed = (uint8_t) ~value;
+		TEST_CHECK(ATCommand_HexToBytes(&parsed, hex, 1) && parsed == byte);
+		snprintf(hex, sizeof(hex), "%02x", value);
+		parsed = (uint8_t) ~value;
+		TEST_CHECK(ATCommand_HexToBytes(&parsed, hex, 1) && parsed == byte);
+	}
+
+	/* Mixed case within a byte and within the string */
+	const uint8_t expected[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xAB, 0xCD, 0xEF };
+	uint8_t bytes[sizeof(expected)];
+	TEST_CHECK(ATCommand_HexToBytes(bytes, "0123456789abcdefAbcDeF", sizeof(expected)) && memcmp(bytes, expected, sizeof(expected)) == 0);
+
+	/* Characters next to the digits in the ASCII table, non-ASCII characters and the end of the string */
+	static const char *invalid[] = { "/0", "0:", "@0", "0G", "`0", "0g", "0x", " 1", "-1", "\xB0", "0\xFF", "1" };
+	for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+	{
+		TEST_CHECK_MSG(!ATCommand_HexToBytes(bytes, invalid[i], 1), "\"%s\" accepted", invalid[i]);
+	}
+	TEST_CHECK(!ATCommand_HexToBytes(bytes, "0011x2", 3));
+	TEST_CHECK(!ATCommand_HexToBytes(NULL, "00", 1));
+	TEST_CHECK(ATCommand_HexToBytes(bytes, "", 0));
+
+	/* In place */
+	char string[] = "48656c6C6f";
+	TEST_CHECK(ATCommand_HexToBytes((uint8_t*) string, string, 5) && memcmp(string, "Hello", 5) == 0);
+}
+
+static void TestGetNextArgumentHex()
+{
+	uint8_t bytes[8];
+	uint16_t length = 0;
+
+	char arguments[] = "48656C6c6F,1";
+	char *pos = arguments;
+	TEST_CHECK(ATCommand_GetNextArgumentHex(&pos, bytes, &length, sizeof(bytes), ATCOMMAND_ARGUMENT_DELIM));
+	TEST_CHECK(length == 5 && memcmp(bytes, "Hello", 5) == 0);
+	TEST_CHECK(pos == &arguments[11]);
+
+	/* Last argument */
+	char last[] = "00fF";
+	pos = last;
+	TEST_CHECK(ATCommand_GetNextArgumentHex(&pos, bytes, &length, sizeof(bytes), ATCOMMAND_STRING_TERMINATE));
+	TEST_CHECK(length == 2 && bytes[0] == 0x00 && bytes[1] == 0xFF && *pos == ATCOMMAND_STRING_TERMINATE);
+
+	/* In place (output pointing to the argument in the input string) */
+	char inPlace[] = "576F726C64,2";
+	pos = inPlace;
+	TEST_CHECK(ATCommand_GetNextArgumentHex(&pos, (uint8_t*) inPlace, &length, sizeof(inPlace), ATCOMMAND_ARGUMENT_DELIM));
+	TEST_CHECK(length == 5 && memcmp(inPlace, "World", 5) == 0 && pos == &inPlace[11] && *pos == '2');
+
+	/* Rejected arguments leave the input position unchanged: odd number of digits, invalid digit
+	 * (also in the last byte), too long for the output, delimiter missing */
+	static const char *rejected[] = { "486,1", "4,1", "48x5,1", "486G,1", "48 6,1", "4865" };
+	for (size_t i = 0; i < sizeof(rejected) / sizeof(rejected[0]); i++)
+	{
+		char string[16];
+		strcpy(string, rejected[i]);
+		pos = string;
+		length = 99;
+		TEST_CHECK_MSG(!ATCommand_GetNextArgumentHex(&pos, bytes, &length, sizeof(bytes), ATCOMMAND_ARGUMENT_DELIM), "\"%s\" accepted", rejected[i]);
+		TEST_CHECK_MSG(pos == string && length == 99, "\"%s\": position %d", rejected[i], (int) (pos - string));
+	}
+	char tooLong[] = "48656C,1";
+	pos = tooLong;
+	TEST_CHECK(!ATCommand_GetNextArgumentHex(&pos, bytes, &length, 2, ATCOMMAND_ARGUMENT_DELIM) && pos == tooLong);
+	TEST_CHECK(ATCommand_GetNextArgumentHex(&pos, bytes, &length, 3, ATCOMMAND_ARGUMENT_DELIM) && length == 3);
+}
+
+static void TestBuilderAppendArgumentHex()
+{
+	const uint8_t bytes[] = { 0xDE, 0xAD, 0xbe, 0xef, 0x00, 0x7F };
+	char buffer[16];
+	ATCommand_Builder_t builder;
+
+	ATCommand_BuilderInit(&builder, buffer, sizeof(buffer), "AT+X=");
+	TEST_CHECK(ATCommand_BuilderAppendArgumentHex(&builder, bytes, 2, ATCOMMAND_ARGUMENT_DELIM));
+	TEST_CHECK(ATCommand_BuilderAppendArgumentHex(&builder, &bytes[4], 0, ATCOMMAND_ARGUMENT_DELIM));
+	TEST_CHECK_MSG(strcmp(buffer, "AT+X=DEAD,,") == 0 && builder.length == 11, "\"%s\"", buffer);
+
+	/* Exactly fits (two digits and termination character) */
+	TEST_CHECK(ATCommand_BuilderAppendArgumentHex(&builder, &bytes[4], 1, ATCOMMAND_STRING_TERMINATE));
+	TEST_CHECK(strcmp(buffer, "AT+X=DEAD,,00") == 0 && builder.length == 13 && !builder.overflow);
+
+	/* Overflow: nothing is written and further arguments are rejected */
+	ATCommand_BuilderInit(&builder, buffer, 14, "AT+X=");
+	TEST_CHECK(ATCommand_BuilderAppendArgumentHex(&builder, &bytes[2], 4, ATCOMMAND_STRING_TERMINATE));
+	TEST_CHECK(strcmp(buffer, "AT+X=BEEF007F") == 0);
+	TEST_CHECK(!ATCommand_BuilderAppendArgumentHex(&builder, bytes, 1, ATCOMMAND_STRING_TERMINATE));
+	TEST_CHECK(builder.overflow && builder.length == 13 && strcmp(buffer, "AT+X=BEEF007F") == 0);
+	TEST_CHECK(!ATCommand_BuilderAppendArgumentHex(&builder, bytes, 0, ATCOMMAND_STRING_TERMINATE));
+
+	/* Delimiter doesn't fit */
+	ATCommand_BuilderInit(&builder, buffer, 10, "AT+X=");
+	TEST_CHECK(!ATCommand_BuilderAppendArgumentHex(&builder, bytes, 2, ATCOMMAND_ARGUMENT_DELIM));
+	TEST_CHECK(builder.overflow && strcmp(buffer, "AT+X=") == 0);
+
+	ATCommand_BuilderInit(&builder, buffer, sizeof(buffer), "AT+X=");
+	TEST_CHECK(!ATCommand_BuilderAppendArgumentHex(&builder, NULL, 1, ATCOMMAND_STRING_TERMINATE));
+}
+
+int main()
+{
+	TestIntegers();
+	TestDoubles();
+	TestFloats();
+	TestHexToBytes();
+	TestGetNextArgumentHex();
+	TestBuilderAppendArgumentHex();
+
+	return TEST_RESULT();
+}
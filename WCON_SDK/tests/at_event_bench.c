@@ -0,0 +1,213 @@
+/**
+ * \file
+ * \brief Compares the event dispatch of ATCommand_ParseEventType() (binary search on sorted
+ * tables) with the linear strcmp() walk it replaced, using the Calypso event tables and a
+ * realistic mix of received events.
+ *
+ * ATEvent.c is included, so that its (static) event tables can be walked by the linear variant.
+ */
+
+#include "Calypso/ATCommands/ATEvent.c"
+
+#include "test.h"
+
+/**
+ * @brief Event dispatch before the tables were sorted (linear walk, names copied to a buffer).
+ */
+static bool Linear_ParseEventType(char **pAtCommand, const ATCommand_Event_t *pmoduleEvents, uint16_t numberOfEvents, char *delimiters, uint8_t number_of_delimiters, uint16_t *pEvent)
+{
+	const ATCommand_Event_t *eventP = &pmoduleEvents[0];
+	uint16_t remaining = numberOfEvents;
+
+	char cmdName[32];
+
+	if (!ATCommand_GetCmdName(pAtCommand, cmdName, sizeof(cmdName), delimiters, number_of_delimiters))
+	{
+		return false;
+	}
+
+	while (eventP != NULL)
+	{
+		if ((eventP->eventName == NULL) || (strcmp(eventP->eventName, cmdName) == 0))
+		{
+			if (eventP->subEventsP != NULL)
+			{
+				if (!ATCommand_GetNextArgumentString(pAtCommand, cmdName, eventP->subDelimiter, sizeof(cmdName)))
+				{
+					return false;
+				}
+				remaining = eventP->subEventsCount;
+				eventP = eventP->subEventsP;
+			}
+			else
+			{
+				*pEvent = eventP->eventID;
+				return true;
+			}
+		}
+		else
+		{
+			remaining--;
+			if (remaining == 0)
+			{
+				/* no next entry */
+				return false;
+			}
+			/* go to next entry */
+			eventP += 1;
+		}
+	}
+
+	return false;
+}
+
+typedef struct BenchEvent_t
+{
+	const char *line;
+	Calypso_ATEvent_t event;
+	uint8_t weight; /**< Relative frequency in the mix */
+} BenchEvent_t;
+
+/**
+ * @brief Event mix of an application receiving data via sockets and MQTT
+ * (socket data dominates, status events are rare).
+ */
+static const BenchEvent_t events[] = {
+		{
+				"+recv:1,0,64,SGVsbG8gV29ybGQh",
+				Calypso_ATEvent_SocketRcvd,
+				40 },
+		{
+				"+recvfrom:2,0,INET,8888,192.168.100.1,16,SGVsbG8gV29ybGQh",
+				Calypso_ATEvent_SocketRcvdFrom,
+				25 },
+		{
+				"+eventmqtt:recv,topic/a,0,0,0,5,hello",
+				Calypso_ATEvent_MQTTRecv,
+				15 },
+		{
+				"+eventsock:tx_failed,1,-11",
+				Calypso_ATEvent_SocketTxFailed,
+				5 },
+		{
+				"+eventmqtt:operation,puback,0",
+				Calypso_ATEvent_MQTTPuback,
+				5 },
+		{
+				"+netappping:64,3,3,12",
+				Calypso_ATEvent_Ping,
+				3 },
+		{
+				"+select:1,0",
+				Calypso_ATEvent_SocketSelect,
+				3 },
+		{
+				"+eventnetapp:ipv4_acquired,192.168.1.2,192.168.1.1,192.168.1.1",
+				Calypso_ATEvent_NetappIP4Acquired,
+				1 },
+		{
+				"+eventwlan:connect,wlan,00:11:22:33:44:55",
+				Calypso_ATEvent_WlanConnect,
+				1 },
+		{
+				"+eventstartup:Calypso,2.0.0,SDK,1.0",
+				Calypso_ATEvent_Startup,
+				1 },
+		{
+				"+eventgeneral:error,-1",
+				Calypso_ATEvent_GeneralError,
+				1 } };
+
+#define BENCH_EVENT_COUNT (sizeof(events) / sizeof(events[0]))
+#define BENCH_MIX_SIZE 100
+#define BENCH_LINE_SIZE 128
+
+static char mix[BENCH_MIX_SIZE][BENCH_LINE_SIZE];
+static Calypso_ATEvent_t mixEvents[BENCH_MIX_SIZE];
+
+typedef bool (*ParseFunction_t)(char **pAtCommand, const ATCommand_Event_t *pmoduleEvents, uint16_t numberOfEvents, char *delimiters, uint8_t number_of_delimiters, uint16_t *pEvent);
+
+static bool Parse(ParseFunction_t parse, const char *line, uint16_t *pEvent)
+{
+	char buffer[BENCH_LINE_SIZE];
+	char delimiters[] = {
+			ATCOMMAND_EVENT_DELIM,
+			ATCOMMAND_STRING_TERMINATE };
+	strcpy(buffer, line);
+	char *pos = buffer;
+	return parse(&pos, moduleMainEvents, ATCOMMAND_EVENT_COUNT(moduleMainEvents), delimiters, sizeof(delimiters), pEvent);
+}
+
+static void Measure(const char *name, ParseFunction_t parse, uint32_t iterations)
+{
+	/* All events of the mix must be recognized */
+	for (size_t i = 0; i < BENCH_MIX_SIZE; i++)
+	{
+		uint16_t event = Calypso_ATEvent_Invalid;
+		TEST_CHECK_MSG(Parse(parse, mix[i], &event) && event == mixEvents[i], "%s: %s", name, mix[i]);
+	}
+
+	uint64_t start = TestGetTimeNs();
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		uint16_t event;
+		Parse(parse, mix[i % BENCH_MIX_SIZE], &event);
+		TEST_KEEP(event);
+	}
+	TestPrintBenchmark(name, iterations, TestGetTimeNs() - start);
+}
+
+int main()
+{
+	/* Interleave the events according to their weights */
+	size_t count = 0;
+	for (uint8_t round = 0; count < BENCH_MIX_SIZE; round++)
+	{
+		for (size_t i = 0; i < BENCH_EVENT_COUNT && count < BENCH_MIX_SIZE; i++)
+		{
+			if (round < events[i].weight)
+			{
+				strcpy(mix[count], events[i].line);
+				mixEvents[count] = events[i].event;
+				count++;
+			}
+		}
+	}
+
+	/* Unknown events are rejected by both variants */
+	uint16_t event;
+	TEST_CHECK(!Parse(ATCommand_ParseEventType, "+unknown:1", &event));
+	TEST_CHECK(!Parse(Linear_ParseEventType, "+unknown:1", &event));
+	TEST_CHECK(!Parse(ATCommand_ParseEventType, "+eventwlan:unknown,1", &event));
+	TEST_CHECK(!Parse(Linear_ParseEventType, "+eventwlan:unknown,1", &event));
+
+	const uint32_t iterations = TestBenchIterations(2000000);
+	printf("Calypso event dispatch (%zu event types, %u events in mix):\n", BENCH_EVENT_COUNT, BENCH_MIX_SIZE);
+	Measure("  linear strcmp() walk", Linear_ParseEventType, iterations);
+	Measure("  ATCommand_ParseEventType() (binary search)", ATCommand_ParseEventType, iterations);
+
+	printf("Single events:\n");
+	const size_t singleEvents[] = {
+			0,
+			1,
+			2 };
+	for (size_t i = 0; i < sizeof(singleEvents) / sizeof(singleEvents[0]); i++)
+	{
+		const char *line = events[singleEvents[i]].line;
+		char name[64];
+		for (int variant = 0; variant < 2; variant++)
+		{
+			ParseFunction_t parse = variant == 0 ? Linear_ParseEventType : ATCommand_ParseEventType;
+			snprintf(name, sizeof(name), "  %.*s %s", (int) strcspn(line, ":"), line, variant == 0 ? "linear" : "binary search");
+			uint64_t start = TestGetTimeNs();
+			for (uint32_t j = 0; j < iterations; j++)
+			{
+				Parse(parse, line, &event);
+				TEST_KEEP(event);
+			}
+			TestPrintBenchmark(name, iterations, TestGetTimeNs() - start);
+		}
+	}
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,145 @@
+/**
+ * \file
+ * \brief Checks the event tables of the Calypso, AdrasteaI, StephanoI and DaphnisI drivers.
+ *
+ * ATCommand_ParseEventType() searches the tables using binary search, so the entries of the
+ * main and sub event tables must be sorted by name in strictly ascending strcmp() order and
+ * a wildcard entry (name NULL) may only be the last entry of a table. Additionally, every
+ * entry must be found by the driver's event parser, i.e. a line starting with the name(s)
+ * of the entry must resolve to the entry's event ID.
+ *
+ * The ATEvent.c files are included, so that their (static) event tables can be walked.
+ * The tables of the modules have the same names, so they are renamed per module.
+ */
+
+#define moduleMainEvents calypsoMainEvents
+#include "Calypso/ATCommands/ATEvent.c"
+#undef moduleMainEvents
+
+#define moduleMainEvents adrasteaMainEvents
+#define MQTTSubEvents adrasteaMQTTSubEvents
+#include "AdrasteaI/ATCommands/ATEvent.c"
+#undef moduleMainEvents
+#undef MQTTSubEvents
+
+#define moduleMainEvents stephanoMainEvents
+#define MQTTSubEvents stephanoMQTTSubEvents
+#include "StephanoI/ATCommands/ATEvent.c"
+#undef moduleMainEvents
+#undef MQTTSubEvents
+
+#define moduleMainEvents daphnisMainEvents
+#include "DaphnisI/Commands/ATEvent.c"
+#undef moduleMainEvents
+
+#include "test.h"
+
+/**
+ * @brief Name used to match a wildcard entry (not contained in any table).
+ */
+#define TEST_UNKNOWN_NAME "0"
+
+typedef bool (*ParseEventType_t)(char **pAtCommand, uint16_t *pEvent);
+
+static bool ParseCalypso(char **pAtCommand, uint16_t *pEvent)
+{
+	Calypso_ATEvent_t event;
+	bool ok = Calypso_ATEvent_ParseEventType(pAtCommand, &event);
+	*pEvent = (uint16_t) event;
+	return ok;
+}
+
+static bool ParseAdrastea(char **pAtCommand, uint16_t *pEvent)
+{
+	AdrasteaI_ATEvent_t event;
+	bool ok = AdrasteaI_ATEvent_ParseEventType(pAtCommand, &event);
+	*pEvent = (uint16_t) event;
+	return ok;
+}
+
+static bool ParseStephano(char **pAtCommand, uint16_t *pEvent)
+{
+	StephanoI_ATEvent_t event;
+	bool ok = StephanoI_ATEvent_ParseEventType(pAtCommand, &event);
+	*pEvent = (uint16_t) event;
+	return ok;
+}
+
+static bool ParseDaphnis(char **pAtCommand, uint16_t *pEvent)
+{
+	DaphnisI_ATEvent_t event;
+	bool ok = DaphnisI_ATEvent_ParseEventType(pAtCommand, &event);
+	*pEvent = (uint16_t) event;
+	return ok;
+}
+
+/**
+ * @brief Checks the order of a table and that each of its entries resolves to itself (recursively for sub event tables).
+ *
+ * @param[in] module Module name (for messages)
+ * @param[in] parse Event parser of the module
+ * @param[in] table Event table
+ * @param[in] count Number of entries in the table
+ * @param[in] prefix Line up to the name of the table's entries (names of the parent entries followed by their delimiters)
+ * @param[in] delimiter Delimiter following the name of the table's entries
+ */
+static void CheckTable(const char *module, ParseEventType_t parse, const ATCommand_Event_t *table, uint16_t count, const char *prefix, char delimiter)
+{
+	int failures = testFailures;
+
+	TEST_CHECK_MSG(count > 0, "%s: empty table after '%s'", module, prefix);
+	for (uint16_t i = 0; i < count; i++)
+	{
+		if (table[i].eventName == NULL)
+		{
+			TEST_CHECK_MSG(i == count - 1, "%s: wildcard at index %u of %u after '%s'", module, i, count, prefix);
+		}
+		else if (i > 0 && table[i - 1].eventName != NULL)
+		{
+			TEST_CHECK_MSG(strcmp(table[i - 1].eventName, table[i].eventName) < 0, "%s: '%s' not before '%s'", module, table[i - 1].eventName, table[i].eventName);
+		}
+	}
+	if (testFailures != failures)
+	{
+		/* Binary search would compare against the wildcard's name (NULL) */
+		return;
+	}
+
+	for (uint16_t i = 0; i < count; i++)
+	{
+		const ATCommand_Event_t *entry = &table[i];
+		char line[128];
+		int length = snprintf(line, sizeof(line), "%s%s", prefix, (entry->eventName != NULL) ? entry->eventName : TEST_UNKNOWN_NAME);
+		TEST_CHECK((length > 0) && (length + 3 < (int) sizeof(line)));
+
+		if (entry->subEventsP != NULL)
+		{
+			line[length++] = delimiter;
+			line[length] = '\0';
+			CheckTable(module, parse, entry->subEventsP, entry->subEventsCount, line, entry->subDelimiter);
+			continue;
+		}
+
+		if (delimiter != ATCOMMAND_STRING_TERMINATE)
+		{
+			line[length++] = delimiter;
+			line[length++] = '1';
+			line[length] = '\0';
+		}
+
+		char *pos = line;
+		uint16_t event = 0;
+		TEST_CHECK_MSG(parse(&pos, &event) && event == entry->eventID, "%s: '%s' resolves to %u, %u expected", module, line, event, entry->eventID);
+	}
+}
+
+int main()
+{
+	/* The main table is searched up to one of the delimiters passed by the parser (':' is used by all) */
+	CheckTable("Calypso", ParseCalypso, calypsoMainEvents, ATCOMMAND_EVENT_COUNT(calypsoMainEvents), "", ATCOMMAND_EVENT_DELIM);
+	CheckTable("AdrasteaI", ParseAdrastea, adrasteaMainEvents, ATCOMMAND_EVENT_COUNT(adrasteaMainEvents), "", ATCOMMAND_EVENT_DELIM);
+	CheckTable("StephanoI", ParseStephano, stephanoMainEvents, ATCOMMAND_EVENT_COUNT(stephanoMainEvents), "", ATCOMMAND_EVENT_DELIM);
+	CheckTable("DaphnisI", ParseDaphnis, daphnisMainEvents, ATCOMMAND_EVENT_COUNT(daphnisMainEvents), "", ATCOMMAND_EVENT_DELIM);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \brief Argument handling of the StephanoI WiFi commands, implemented twice: hand-written
+ * (at_fields_handwritten.c, as before the descriptor tables were introduced) and using
+ * descriptor tables (at_fields_descriptor.c, as in StephanoI/ATCommands/ATWifi.c).
+ *
+ * Both variants are compiled into separate objects, so that their flash footprint can be
+ * compared (make size) and their parse speed can be measured (at_fields_bench.c).
+ */
+
+#ifndef AT_FIELDS_H_INCLUDED
+#define AT_FIELDS_H_INCLUDED
+
+#include <global/ATCommands.h>
+#include <StephanoI/ATCommands/ATWifi.h>
+
+/**
+ * @brief Functions provided by each variant.
+ */
+typedef struct ATFields_Variant_t
+{
+	const char *name;
+	bool (*appendCountryCode)(ATCommand_Builder_t *pBuilder, const StephanoI_ATWifiCountryCode_t *t);
+	bool (*appendAPConfiguration)(ATCommand_Builder_t *pBuilder, const StephanoI_ATWiFi_APConfiguration_t *t);
+	bool (*appendIPRange)(ATCommand_Builder_t *pBuilder, const StephanoI_ATWiFi_IPRange_t *t);
+	bool (*parseScan)(char *EventArgumentsP, StephanoI_ATWiFi_Scan_t *t);
+	bool (*parseState)(char *EventArgumentsP, StephanoI_ATWiFi_State_t *t);
+	bool (*parseGetConnectedIPs)(char *EventArgumentsP, StephanoI_ATWiFi_GetConnectedIPs_t *t);
+	bool (*parseAPAssignIP)(char *EventArgumentsP, StephanoI_ATWiFi_APAssignIP_t *t);
+	bool (*parseCountryCode)(char *EventArgumentsP, StephanoI_ATWifiCountryCode_t *t);
+	bool (*parseAPConfiguration)(char *EventArgumentsP, StephanoI_ATWiFi_APConfiguration_t *t);
+	bool (*parseIPRange)(char *EventArgumentsP, StephanoI_ATWiFi_IPRange_t *t);
+} ATFields_Variant_t;
+
+extern const ATFields_Variant_t ATFields_Handwritten;
+extern const ATFields_Variant_t ATFields_Descriptor;
+
+#endif /* AT_FIELDS_H_INCLUDED */
@@ -0,0 +1,188 @@
+/**
+ * \file
+ * \brief Compares the hand-written argument handling of the StephanoI WiFi commands with the
+ * descriptor tables (ATCommand_ParseFields(), ATCommand_BuilderAppendFields()).
+ *
+ * Both variants must produce the same results. The flash footprint of the variants is
+ * compared by "make size".
+ */
+
+#include "at_fields.h"
+
+#include "test.h"
+
+#define BENCH_LINE_SIZE 128
+#define BENCH_BUFFER_SIZE 256
+
+/* Responses and events as sent by the module. The hand-written variant kept the quotation marks
+ * of some strings (country code, IP range), which the descriptor tables remove, so these are
+ * passed without quotation marks. */
+static const char scanLine[] = "(3,\"MyNetwork\",-45,\"aa:bb:cc:dd:ee:ff\",6,-12,0,4,4,7,1)";
+static const char stateLine[] = "2,\"MyNetwork\"";
+static const char connectedIPsLine[] = "192.168.4.2,aa:bb:cc:dd:ee:ff";
+static const char apAssignIPLine[] = "\"aa:bb:cc:dd:ee:ff\",\"192.168.4.2\"";
+static const char countryCodeLine[] = "0,CN,1,13";
+static const char apConfigurationLine[] = "\"MyAP\",\"password123\",5,3,4,0";
+static const char ipRangeLine[] = "2880,192.168.4.1,192.168.4.100";
+
+static const StephanoI_ATWifiCountryCode_t countryCode = {
+		.policy = 0,
+		.country_code = "CN",
+		.start_channel = 1,
+		.total_channel_count = 13 };
+static const StephanoI_ATWiFi_APConfiguration_t apConfiguration = {
+		.ssid = "MyAP",
+		.pwd = "password123",
+		.channel = 5,
+		.ecn = 3,
+		.max_connections = 4,
+		.ssid_hidden = false };
+static const StephanoI_ATWiFi_IPRange_t ipRange = {
+		.lease_time = 2880,
+		.start_ip = "192.168.4.1",
+		.end_ip = "192.168.4.100" };
+
+/**
+ * @brief Parses a copy of the line (the parsers modify their input) into a zeroed struct.
+ */
+#define PARSE(variant, function, line, result) \
+	({ \
+		char buffer[BENCH_LINE_SIZE]; \
+		strcpy(buffer, line); \
+		memset(&(result), 0, sizeof(result)); \
+		(variant)->function(buffer, &(result)); \
+	})
+
+#define CHECK_PARSE(function, line, type) \
+	do \
+	{ \
+		type a, b; \
+		TEST_CHECK_MSG(PARSE(&ATFields_Handwritten, function, line, a), "%s", #function); \
+		TEST_CHECK_MSG(PARSE(&ATFields_Descriptor, function, line, b), "%s", #function); \
+		TEST_CHECK_MSG(memcmp(&a, &b, sizeof(a)) == 0, "%s", #function); \
+	} while (0)
+
+#define CHECK_APPEND(function, value) \
+	do \
+	{ \
+		char a[BENCH_BUFFER_SIZE], b[BENCH_BUFFER_SIZE]; \
+		ATCommand_Builder_t builder; \
+		ATCommand_BuilderInit(&builder, a, sizeof(a), "AT="); \
+		TEST_CHECK_MSG(ATFields_Handwritten.function(&builder, &(value)), "%s", #function); \
+		ATCommand_BuilderInit(&builder, b, sizeof(b), "AT="); \
+		TEST_CHECK_MSG(ATFields_Descriptor.function(&builder, &(value)), "%s", #function); \
+		TEST_CHECK_MSG(strcmp(a, b) == 0, "%s: %s vs %s", #function, a, b); \
+	} while (0)
+
+/**
+ * @brief Parses all responses and events once.
+ */
+static void ParseAll(const ATFields_Variant_t *variant)
+{
+	StephanoI_ATWiFi_Scan_t scan;
+	StephanoI_ATWiFi_State_t state;
+	StephanoI_ATWiFi_GetConnectedIPs_t connectedIPs;
+	StephanoI_ATWiFi_APAssignIP_t apAssignIP;
+	StephanoI_ATWifiCountryCode_t country;
+	StephanoI_ATWiFi_APConfiguration_t apConfig;
+	StephanoI_ATWiFi_IPRange_t range;
+
+	PARSE(variant, parseScan, scanLine, scan);
+	PARSE(variant, parseState, stateLine, state);
+	PARSE(variant, parseGetConnectedIPs, connectedIPsLine, connectedIPs);
+	PARSE(variant, parseAPAssignIP, apAssignIPLine, apAssignIP);
+	PARSE(variant, parseCountryCode, countryCodeLine, country);
+	PARSE(variant, parseAPConfiguration, apConfigurationLine, apConfig);
+	PARSE(variant, parseIPRange, ipRangeLine, range);
+	TEST_KEEP(&scan);
+	TEST_KEEP(&state);
+	TEST_KEEP(&connectedIPs);
+	TEST_KEEP(&apAssignIP);
+	TEST_KEEP(&country);
+	TEST_KEEP(&apConfig);
+	TEST_KEEP(&range);
+}
+
+/**
+ * @brief Builds the arguments of all requests once.
+ */
+static void AppendAll(const ATFields_Variant_t *variant)
+{
+	char buffer[BENCH_BUFFER_SIZE];
+	ATCommand_Builder_t builder;
+
+	ATCommand_BuilderInit(&builder, buffer, sizeof(buffer), "AT+CWCOUNTRY=");
+	variant->appendCountryCode(&builder, &countryCode);
+	TEST_KEEP(buffer);
+	ATCommand_BuilderInit(&builder, buffer, sizeof(buffer), "AT+CWSAP=");
+	variant->appendAPConfiguration(&builder, &apConfiguration);
+	TEST_KEEP(buffer);
+	ATCommand_BuilderInit(&builder, buffer, sizeof(buffer), "AT+CWDHCPS=1,");
+	variant->appendIPRange(&builder, &ipRange);
+	TEST_KEEP(buffer);
+}
+
+int main()
+{
+	CHECK_PARSE(parseScan, scanLine, StephanoI_ATWiFi_Scan_t);
+	CHECK_PARSE(parseState, stateLine, StephanoI_ATWiFi_State_t);
+	CHECK_PARSE(parseGetConnectedIPs, connectedIPsLine, StephanoI_ATWiFi_GetConnectedIPs_t);
+	CHECK_PARSE(parseAPAssignIP, apAssignIPLine, StephanoI_ATWiFi_APAssignIP_t);
+	CHECK_PARSE(parseCountryCode, countryCodeLine, StephanoI_ATWifiCountryCode_t);
+	CHECK_PARSE(parseAPConfiguration, apConfigurationLine, StephanoI_ATWiFi_APConfiguration_t);
+	CHECK_PARSE(parseIPRange, ipRangeLine, StephanoI_ATWiFi_IPRange_t);
+
+	CHECK_APPEND(appendCountryCode, countryCode);
+	CHECK_APPEND(appendAPConfiguration, apConfiguration);
+	CHECK_APPEND(appendIPRange, ipRange);
+
+	/* Malformed input is rejected by both variants */
+	StephanoI_ATWiFi_Scan_t scan;
+	TEST_CHECK(!PARSE(&ATFields_Handwritten, parseScan, "(3,\"MyNetwork\",-45", scan));
+	TEST_CHECK(!PARSE(&ATFields_Descriptor, parseScan, "(3,\"MyNetwork\",-45", scan));
+
+	const uint32_t iterations = TestBenchIterations(200000);
+	const ATFields_Variant_t *variants[] = {
+			&ATFields_Handwritten,
+			&ATFields_Descriptor };
+	char name[64];
+
+	printf("+CWLAP scan result (11 arguments):\n");
+	for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++)
+	{
+		uint64_t start = TestGetTimeNs();
+		for (uint32_t i = 0; i < iterations; i++)
+		{
+			PARSE(variants[v], parseScan, scanLine, scan);
+			TEST_KEEP(&scan);
+		}
+		snprintf(name, sizeof(name), "  %s", variants[v]->name);
+		TestPrintBenchmark(name, iterations, TestGetTimeNs() - start);
+	}
+
+	printf("All 7 WiFi responses and events (29 arguments):\n");
+	for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++)
+	{
+		uint64_t start = TestGetTimeNs();
+		for (uint32_t i = 0; i < iterations; i++)
+		{
+			ParseAll(variants[v]);
+		}
+		snprintf(name, sizeof(name), "  %s", variants[v]->name);
+		TestPrintBenchmark(name, iterations, TestGetTimeNs() - start);
+	}
+
+	printf("All 3 WiFi set requests (13 arguments):\n");
+	for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++)
+	{
+		uint64_t start = TestGetTimeNs();
+		for (uint32_t i = 0; i < iterations; i++)
+		{
+			AppendAll(variants[v]);
+		}
+		snprintf(name, sizeof(name), "  %s", variants[v]->name);
+		TestPrintBenchmark(name, iterations, TestGetTimeNs() - start);
+	}
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,149 @@
+/**
+ * \file
+ * \brief Argument handling of the StephanoI WiFi commands using descriptor tables (tables
+ * copied from StephanoI/ATCommands/ATWifi.c, without sending the requests).
+ */
+
+#include "at_fields.h"
+
+/**
+ * @brief Arguments of AT+CWCOUNTRY (set request and response).
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_CountryCodeFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWifiCountryCode_t, policy, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWifiCountryCode_t, country_code, ATCommand_FieldType_QuotedString, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWifiCountryCode_t, start_channel, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWifiCountryCode_t, total_channel_count, ATCommand_FieldType_Unsigned, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of AT+CWSAP (set request and response).
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_APConfigurationFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, ssid, ATCommand_FieldType_QuotedString, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, pwd, ATCommand_FieldType_QuotedString, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, channel, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, ecn, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, max_connections, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APConfiguration_t, ssid_hidden, ATCommand_FieldType_Boolean, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of AT+CWDHCPS (set request following the enable flag and response).
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_IPRangeFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_IPRange_t, lease_time, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_IPRange_t, start_ip, ATCommand_FieldType_QuotedString, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_IPRange_t, end_ip, ATCommand_FieldType_QuotedString, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of +CWLAP event (following the opening bracket).
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_ScanFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, enc, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, ssid, ATCommand_FieldType_String, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, rssi, ATCommand_FieldType_Signed, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, MAC, ATCommand_FieldType_String, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, channel, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, freq_offset, ATCommand_FieldType_Signed, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, freqcal_val, ATCommand_FieldType_Signed, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, pairwise_cipher, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, group_cipher, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, bgn, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_Scan_t, wps_flags, ATCommand_FieldType_Unsigned, ')') };
+
+/**
+ * @brief Arguments of +CWSTATE event.
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_StateFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_State_t, state, ATCommand_FieldType_Unsigned, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_State_t, ssid, ATCommand_FieldType_String, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of +CWLIF event.
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_GetConnectedIPsFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_GetConnectedIPs_t, IP, ATCommand_FieldType_String, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_GetConnectedIPs_t, MAC, ATCommand_FieldType_String, ATCOMMAND_STRING_TERMINATE) };
+
+/**
+ * @brief Arguments of +DIST_STA_IP event.
+ */
+static const ATCommand_FieldDescriptor_t StephanoI_ATWifi_APAssignIPFields[] = {
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APAssignIP_t, MAC, ATCommand_FieldType_String, ATCOMMAND_ARGUMENT_DELIM),
+		ATCOMMAND_FIELD(StephanoI_ATWiFi_APAssignIP_t, ip, ATCommand_FieldType_String, ATCOMMAND_STRING_TERMINATE) };
+
+static bool Descriptor_AppendCountryCode(ATCommand_Builder_t *pBuilder, const StephanoI_ATWifiCountryCode_t *t)
+{
+	return ATCommand_BuilderAppendFields(pBuilder, t, StephanoI_ATWifi_CountryCodeFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_CountryCodeFields));
+}
+
+static bool Descriptor_AppendAPConfiguration(ATCommand_Builder_t *pBuilder, const StephanoI_ATWiFi_APConfiguration_t *t)
+{
+	return ATCommand_BuilderAppendFields(pBuilder, t, StephanoI_ATWifi_APConfigurationFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_APConfigurationFields));
+}
+
+static bool Descriptor_AppendIPRange(ATCommand_Builder_t *pBuilder, const StephanoI_ATWiFi_IPRange_t *t)
+{
+	return ATCommand_BuilderAppendFields(pBuilder, t, StephanoI_ATWifi_IPRangeFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_IPRangeFields));
+}
+
+static bool Descriptor_ParseScan(char *EventArgumentsP, StephanoI_ATWiFi_Scan_t *t)
+{
+	char *argumentsP = EventArgumentsP + 1;
+
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_ScanFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_ScanFields));
+}
+
+static bool Descriptor_ParseState(char *EventArgumentsP, StephanoI_ATWiFi_State_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_StateFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_StateFields));
+}
+
+static bool Descriptor_ParseGetConnectedIPs(char *EventArgumentsP, StephanoI_ATWiFi_GetConnectedIPs_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_GetConnectedIPsFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_GetConnectedIPsFields));
+}
+
+static bool Descriptor_ParseAPAssignIP(char *EventArgumentsP, StephanoI_ATWiFi_APAssignIP_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_APAssignIPFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_APAssignIPFields));
+}
+
+static bool Descriptor_ParseCountryCode(char *EventArgumentsP, StephanoI_ATWifiCountryCode_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_CountryCodeFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_CountryCodeFields));
+}
+
+static bool Descriptor_ParseAPConfiguration(char *EventArgumentsP, StephanoI_ATWiFi_APConfiguration_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_APConfigurationFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_APConfigurationFields));
+}
+
+static bool Descriptor_ParseIPRange(char *EventArgumentsP, StephanoI_ATWiFi_IPRange_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	return ATCommand_ParseFields(&argumentsP, t, StephanoI_ATWifi_IPRangeFields, ATCOMMAND_FIELD_COUNT(StephanoI_ATWifi_IPRangeFields));
+}
+
+const ATFields_Variant_t ATFields_Descriptor = {
+		.name = "descriptor tables",
+		.appendCountryCode = Descriptor_AppendCountryCode,
+		.appendAPConfiguration = Descriptor_AppendAPConfiguration,
+		.appendIPRange = Descriptor_AppendIPRange,
+		.parseScan = Descriptor_ParseScan,
+		.parseState = Descriptor_ParseState,
+		.parseGetConnectedIPs = Descriptor_ParseGetConnectedIPs,
+		.parseAPAssignIP = Descriptor_ParseAPAssignIP,
+		.parseCountryCode = Descriptor_ParseCountryCode,
+		.parseAPConfiguration = Descriptor_ParseAPConfiguration,
+		.parseIPRange = Descriptor_ParseIPRange };
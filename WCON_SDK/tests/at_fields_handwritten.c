@@ -0,0 +1,331 @@
+/**
+ * \file
+ * \brief Hand-written argument handling of the StephanoI WiFi commands (copy of
+ * StephanoI/ATCommands/ATWifi.c before the descriptor tables were introduced, with the
+ * sizes of total_channel_count and ip corrected, and without sending the requests).
+ */
+
+#include "at_fields.h"
+
+static bool Handwritten_AppendCountryCode(ATCommand_Builder_t *pBuilder, const StephanoI_ATWifiCountryCode_t *t)
+{
+	if (!ATCommand_BuilderAppendArgumentInt(pBuilder, (uint32_t) t->policy, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pBuilder, t->country_code, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentInt(pBuilder, (uint32_t) t->start_channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentInt(pBuilder, (uint32_t) t->total_channel_count, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	{
+		return false;
+	}
+	return true;
+}
+
+static bool Handwritten_AppendAPConfiguration(ATCommand_Builder_t *pBuilder, const StephanoI_ATWiFi_APConfiguration_t *config)
+{
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pBuilder, config->ssid, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pBuilder, config->pwd, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentInt(pBuilder, config->channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentInt(pBuilder, config->ecn, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentInt(pBuilder, config->max_connections, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentInt(pBuilder, config->ssid_hidden ? 1 : 0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_STRING_TERMINATE))
+	{
+		return false;
+	}
+	return true;
+}
+
+static bool Handwritten_AppendIPRange(ATCommand_Builder_t *pBuilder, const StephanoI_ATWiFi_IPRange_t *range)
+{
+	if (!ATCommand_BuilderAppendArgumentInt(pBuilder, range->lease_time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED ), ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pBuilder, range->start_ip, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_BuilderAppendArgumentStringQuotationMarks(pBuilder, range->end_ip, ATCOMMAND_STRING_TERMINATE))
+	{
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Parses the values of the Wifi Scan arguments.
+ *
+ * @param[in] EventArgumentsP String containing arguments of the AT command
+ * @param[out]    t               The parsed event data
+ *
+ * @return true if parsed successfully, false otherwise
+ */
+static bool Handwritten_ParseScan(char *EventArgumentsP, StephanoI_ATWiFi_Scan_t *t)
+{
+	/*ignore first '(' */
+	char *argumentsP = EventArgumentsP + 1;
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->enc), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->ssid, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->ssid)))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->rssi), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_SIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->MAC, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->MAC)))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->channel), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->freq_offset), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_SIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->freqcal_val), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_SIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->pairwise_cipher), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->group_cipher), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->bgn), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->wps_flags), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ')'))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Parses the values of the Wifi state arguments.
+ *
+ * @param[in] EventArgumentsP String containing arguments of the AT command
+ * @param[out]    t               The parsed event data
+ *
+ * @return true if parsed successfully, false otherwise
+ */
+static bool Handwritten_ParseState(char *EventArgumentsP, StephanoI_ATWiFi_State_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->state), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->ssid, ATCOMMAND_STRING_TERMINATE, sizeof(t->ssid)))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Parses the values of the Wifi GetconnectedIPs arguments.
+ *
+ * @param[in] EventArgumentsP String containing arguments of the AT command
+ * @param[out]    t               The parsed event data
+ *
+ * @return true if parsed successfully, false otherwise
+ */
+static bool Handwritten_ParseGetConnectedIPs(char *EventArgumentsP, StephanoI_ATWiFi_GetConnectedIPs_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->IP, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->IP)))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->MAC, ATCOMMAND_STRING_TERMINATE, sizeof(t->MAC)))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Parses the values of the Wifi AP assign IP arguments.
+ *
+ * @param[in] EventArgumentsP String containing arguments of the AT command
+ * @param[out]    t               The parsed event data
+ *
+ * @return true if parsed successfully, false otherwise
+ */
+static bool Handwritten_ParseAPAssignIP(char *EventArgumentsP, StephanoI_ATWiFi_APAssignIP_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->MAC, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->MAC)))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->ip, ATCOMMAND_STRING_TERMINATE, sizeof(t->ip)))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Parses the values of the Wifi country code.
+ *
+ * @param[in] EventArgumentsP String containing arguments of the AT command
+ * @param[out]    t               The parsed event data
+ *
+ * @return true if parsed successfully, false otherwise
+ */
+static bool Handwritten_ParseCountryCode(char *EventArgumentsP, StephanoI_ATWifiCountryCode_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->policy), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->country_code, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->country_code)))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->start_channel), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->total_channel_count), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+	{
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Parses the values of the AP configuration.
+ *
+ * @param[in] EventArgumentsP String containing arguments of the AT command
+ * @param[out]    t               The parsed event data
+ *
+ * @return true if parsed successfully, false otherwise
+ */
+static bool Handwritten_ParseAPConfiguration(char *EventArgumentsP, StephanoI_ATWiFi_APConfiguration_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, t->ssid, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->ssid)))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, t->pwd, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->pwd)))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->channel), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->ecn), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->max_connections), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	uint8_t dummy;
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &dummy, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+	{
+		return false;
+	}
+	t->ssid_hidden = (dummy == 0x01);
+	return true;
+}
+
+/**
+ * @brief Parses the values of the IP range
+ *
+ * @param[in] EventArgumentsP String containing arguments of the AT command
+ * @param[out]    t               The parsed event data
+ *
+ * @return true if parsed successfully, false otherwise
+ */
+static bool Handwritten_ParseGetIPrangeConfiguration(char *EventArgumentsP, StephanoI_ATWiFi_IPRange_t *t)
+{
+	char *argumentsP = EventArgumentsP;
+
+	if (!ATCommand_GetNextArgumentInt(&argumentsP, &(t->lease_time), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->start_ip, ATCOMMAND_ARGUMENT_DELIM, sizeof(t->start_ip)))
+	{
+		return false;
+	}
+	if (!ATCommand_GetNextArgumentString(&argumentsP, t->end_ip, ATCOMMAND_STRING_TERMINATE, sizeof(t->end_ip)))
+	{
+		return false;
+	}
+	return true;
+}
+
+const ATFields_Variant_t ATFields_Handwritten = {
+		.name = "hand-written",
+		.appendCountryCode = Handwritten_AppendCountryCode,
+		.appendAPConfiguration = Handwritten_AppendAPConfiguration,
+		.appendIPRange = Handwritten_AppendIPRange,
+		.parseScan = Handwritten_ParseScan,
+		.parseState = Handwritten_ParseState,
+		.parseGetConnectedIPs = Handwritten_ParseGetConnectedIPs,
+		.parseAPAssignIP = Handwritten_ParseAPAssignIP,
+		.parseCountryCode = Handwritten_ParseCountryCode,
+		.parseAPConfiguration = Handwritten_ParseAPConfiguration,
+		.parseIPRange = Handwritten_ParseGetIPrangeConfiguration };
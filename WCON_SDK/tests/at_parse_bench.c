@@ -0,0 +1,262 @@
+/**
+ * \file
+ * \brief Throughput of the AT argument parsers (ns per argument) and of the Calypso event
+ * parsing (event dispatch and arguments, lines per second).
+ *
+ * The parsers may modify the line, so each measured operation includes copying the line
+ * into a working buffer.
+ */
+
+#include "Calypso/ATCommands/ATEvent.h"
+
+#include "test.h"
+
+#define BENCH_LINE_SIZE 256
+#define BENCH_ARGUMENT_COUNT 8
+
+typedef enum BenchArgument_t
+{
+	BenchArgument_Int,
+	BenchArgument_IntHex,
+	BenchArgument_String,
+	BenchArgument_StringWithoutQuotationMarks,
+	BenchArgument_Enum,
+	BenchArgument_Boolean,
+	BenchArgument_Double,
+	BenchArgument_Hex
+} BenchArgument_t;
+
+typedef struct BenchArgumentLine_t
+{
+	const char *name;
+	BenchArgument_t type;
+	const char *line; /**< BENCH_ARGUMENT_COUNT arguments */
+} BenchArgumentLine_t;
+
+static const BenchArgumentLine_t argumentLines[] = {
+		{
+				"GetNextArgumentInt() decimal",
+				BenchArgument_Int,
+				"1,8080,-11,1460,65535,192,0,4294967295" },
+		{
+				"GetNextArgumentInt() hex",
+				BenchArgument_IntHex,
+				"0x1,0x1F90,0xFFF5,0x5B4,0xFFFF,0xC0,0x0,0xFFFFFFFF" },
+		{
+				"GetNextArgumentString()",
+				BenchArgument_String,
+				"192.168.100.1,aa:bb:cc:dd:ee:ff,MyNetwork,topic/a,INET,broker.example.com,2.0.0,SDK" },
+		{
+				"GetNextArgumentStringWithoutQuotationMarks()",
+				BenchArgument_StringWithoutQuotationMarks,
+				"\"192.168.100.1\",\"aa:bb:cc:dd:ee:ff\",\"MyNetwork\",\"topic/a\",\"INET\",\"broker.example.com\",\"2.0.0\",\"SDK\"" },
+		{
+				"GetNextArgumentEnum()",
+				BenchArgument_Enum,
+				"wpa2,none,wep,wpa3,wpa,wpa2,wpa_wpa2,none" },
+		{
+				"GetNextArgumentBoolean()",
+				BenchArgument_Boolean,
+				"true,false,false,true,true,true,false,false" },
+		{
+				"GetNextArgumentDouble()",
+				BenchArgument_Double,
+				"50.1234567,8.6543210,-12.5,1013.25,0.001,23.4,100,-0.75" },
+		{
+				"GetNextArgumentHex()",
+				BenchArgument_Hex,
+				"A0B1C2D3,E4F5,00112233,FF,DEADBEEF,0102,C0FFEE00,AA" } };
+
+static const char *enumStrings[] = {
+		"none",
+		"wep",
+		"wpa",
+		"wpa2",
+		"wpa_wpa2",
+		"wpa3" };
+
+/**
+ * @brief Parses all arguments of a line.
+ */
+static bool ParseArguments(BenchArgument_t type, char *line)
+{
+	char string[32];
+	uint8_t bytes[16];
+	uint32_t value;
+	uint8_t index;
+	bool boolean;
+	double number;
+	bool ok = true;
+
+	for (int i = 0; ok && i < BENCH_ARGUMENT_COUNT; i++)
+	{
+		char delimiter = i < BENCH_ARGUMENT_COUNT - 1 ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE;
+		switch (type)
+		{
+		case BenchArgument_Int:
+			ok = ATCommand_GetNextArgumentInt(&line, &value, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_SIGNED, delimiter);
+			TEST_KEEP(value);
+			break;
+
+		case BenchArgument_IntHex:
+			ok = ATCommand_GetNextArgumentInt(&line, &value, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX, delimiter);
+			TEST_KEEP(value);
+			break;
+
+		case BenchArgument_String:
+			ok = ATCommand_GetNextArgumentString(&line, string, delimiter, sizeof(string));
+			TEST_KEEP(string);
+			break;
+
+		case BenchArgument_StringWithoutQuotationMarks:
+			ok = ATCommand_GetNextArgumentStringWithoutQuotationMarks(&line, string, delimiter, sizeof(string));
+			TEST_KEEP(string);
+			break;
+
+		case BenchArgument_Enum:
+			ok = ATCommand_GetNextArgumentEnum(&line, &index, enumStrings, sizeof(enumStrings) / sizeof(enumStrings[0]), 10, delimiter);
+			TEST_KEEP(index);
+			break;
+
+		case BenchArgument_Boolean:
+			ok = ATCommand_GetNextArgumentBoolean(&line, &boolean, delimiter);
+			TEST_KEEP(boolean);
+			break;
+
+		case BenchArgument_Double:
+			ok = ATCommand_GetNextArgumentDouble(&line, &number, delimiter);
+			TEST_KEEP(number);
+			break;
+
+		case BenchArgument_Hex:
+		{
+			uint16_t length;
+			ok = ATCommand_GetNextArgumentHex(&line, bytes, &length, sizeof(bytes), delimiter);
+			TEST_KEEP(bytes);
+			break;
+		}
+		}
+	}
+	return ok;
+}
+
+/**
+ * @brief Event mix of an application receiving data via sockets and MQTT.
+ */
+static const char *eventLines[] = {
+		"+recv:1,0,16,SGVsbG8gV29ybGQh",
+		"+eventmqtt:recv,topic/a,QOS0,0,0,0,5,hello",
+		"+recv:1,0,16,SGVsbG8gV29ybGQh",
+		"+eventmqtt:recv,topic/a,QOS0,0,0,0,5,hello",
+		"+recv:1,0,16,SGVsbG8gV29ybGQh",
+		"+eventsock:tx_failed,1,-11",
+		"+recv:2,0,24,V1VSVEggRUxFS1RST05JSyBlaVNvcw==",
+		"+netappping:3,3,12",
+		"+recv:1,0,16,SGVsbG8gV29ybGQh",
+		"+eventnetapp:ipv4_acquired,192.168.1.2,192.168.1.1,192.168.1.1" };
+
+#define BENCH_EVENT_COUNT (sizeof(eventLines) / sizeof(eventLines[0]))
+
+/**
+ * @brief Parses an event line as an application would (event type, then arguments).
+ */
+static bool ParseEvent(char *line)
+{
+	static Calypso_ATEvent_SocketRcvd_t rcvd;
+	static Calypso_ATEvent_MQTTRcvd_t mqttRcvd;
+	Calypso_ATEvent_t event;
+
+	if (!Calypso_ATEvent_ParseEventType(&line, &event))
+	{
+		return false;
+	}
+
+	switch (event)
+	{
+	case Calypso_ATEvent_SocketRcvd:
+		return Calypso_ATEvent_ParseSocketRcvdEvent(&line, true, &rcvd);
+
+	case Calypso_ATEvent_MQTTRecv:
+		return Calypso_ATEvent_ParseSocketMQTTRcvdEvent(&line, &mqttRcvd);
+
+	case Calypso_ATEvent_SocketTxFailed:
+	{
+		Calypso_ATEvent_SocketTXFailed_t txFailed;
+		return Calypso_ATEvent_ParseSocketTXFailedEvent(&line, &txFailed);
+	}
+
+	case Calypso_ATEvent_Ping:
+	{
+		Calypso_ATEvent_Ping_t ping;
+		return Calypso_ATEvent_ParsePingEvent(&line, &ping);
+	}
+
+	case Calypso_ATEvent_NetappIP4Acquired:
+	{
+		Calypso_ATEvent_NetappIP4Acquired_t ip4Acquired;
+		return Calypso_ATEvent_ParseNetappIP4AcquiredEvent(&line, &ip4Acquired);
+	}
+
+	default:
+		return false;
+	}
+}
+
+int main()
+{
+	const uint32_t iterations = TestBenchIterations(500000);
+	char buffer[BENCH_LINE_SIZE];
+	char name[80];
+
+	printf("Arguments (%d per line, ns per argument):\n", BENCH_ARGUMENT_COUNT);
+	for (size_t i = 0; i < sizeof(argumentLines) / sizeof(argumentLines[0]); i++)
+	{
+		const BenchArgumentLine_t *argumentLine = &argumentLines[i];
+		strcpy(buffer, argumentLine->line);
+		TEST_CHECK_MSG(ParseArguments(argumentLine->type, buffer), "%s", argumentLine->name);
+
+		uint64_t start = TestGetTimeNs();
+		for (uint32_t j = 0; j < iterations; j++)
+		{
+			strcpy(buffer, argumentLine->line);
+			ParseArguments(argumentLine->type, buffer);
+		}
+		snprintf(name, sizeof(name), "  %s", argumentLine->name);
+		TestPrintBenchmark(name, iterations * BENCH_ARGUMENT_COUNT, TestGetTimeNs() - start);
+	}
+
+	printf("Calypso events (event type and arguments, ns per line and lines per second):\n");
+	for (size_t i = 0; i < BENCH_EVENT_COUNT; i++)
+	{
+		strcpy(buffer, eventLines[i]);
+		TEST_CHECK_MSG(ParseEvent(buffer), "%s", eventLines[i]);
+	}
+	/* Each distinct event of the mix */
+	const size_t singleEvents[] = {
+			0,
+			1,
+			5,
+			7,
+			9 };
+	for (size_t i = 0; i < sizeof(singleEvents) / sizeof(singleEvents[0]); i++)
+	{
+		const char *line = eventLines[singleEvents[i]];
+		uint64_t start = TestGetTimeNs();
+		for (uint32_t j = 0; j < iterations; j++)
+		{
+			strcpy(buffer, line);
+			ParseEvent(buffer);
+		}
+		snprintf(name, sizeof(name), "  %.*s", (int) strcspn(line, ","), line);
+		TestPrintBenchmark(name, iterations, TestGetTimeNs() - start);
+	}
+	uint64_t start = TestGetTimeNs();
+	for (uint32_t j = 0; j < iterations; j++)
+	{
+		strcpy(buffer, eventLines[j % BENCH_EVENT_COUNT]);
+		ParseEvent(buffer);
+	}
+	TestPrintBenchmark("  mix", iterations, TestGetTimeNs() - start);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,232 @@
+/**
+ * \file
+ * \brief Tests WE_UART_NegotiateBaudrate() using a fake module adapter.
+ *
+ * The fake module rejects baud rates in a configurable list and doesn't respond at
+ * the baud rates in another list (e.g. because of the signal quality). Optionally, it
+ * doesn't receive anything either at the failing rates, so falling back fails. The fake
+ * host UART has no limitations. The module responds to a ping if both sides use the
+ * same baud rate.
+ */
+
+#include "global/baudrate.h"
+#include "global/global.h"
+
+#include "test.h"
+
+#define TEST_MAX_CALLS 16
+
+static const uint32_t moduleBaudrates[] = {
+		921600,
+		460800,
+		230400,
+		115200 };
+
+static uint32_t moduleBaudrate;
+static uint32_t hostBaudrate;
+
+/* Baud rates rejected by the module / at which the module doesn't respond (0-terminated) */
+static const uint32_t *rejectedBaudrates;
+static const uint32_t *failingBaudrates;
+
+/* Module doesn't receive requests at the failing baud rates */
+static bool failingDeaf;
+
+/* Baud rates requested from the module (including rejected ones) */
+static uint32_t moduleRequests[TEST_MAX_CALLS];
+static uint8_t moduleRequestCount;
+static uint32_t pingCount;
+
+static bool Contains(const uint32_t *list, uint32_t baudrate)
+{
+	for (; (list != NULL) && (*list != 0); list++)
+	{
+		if (*list == baudrate)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool SetModuleBaudrate(uint32_t baudrate)
+{
+	if (moduleRequestCount < TEST_MAX_CALLS)
+	{
+		moduleRequests[moduleRequestCount++] = baudrate;
+	}
+	if (failingDeaf && Contains(failingBaudrates, moduleBaudrate))
+	{
+		/* Request is sent, but not received */
+		return true;
+	}
+	if (Contains(rejectedBaudrates, baudrate))
+	{
+		return false;
+	}
+	moduleBaudrate = baudrate;
+	return true;
+}
+
+static bool SetHostBaudrate(uint32_t baudrate)
+{
+	hostBaudrate = baudrate;
+	return true;
+}
+
+static bool Ping()
+{
+	pingCount++;
+	return (moduleBaudrate == hostBaudrate) && !Contains(failingBaudrates, moduleBaudrate);
+}
+
+static const WE_BaudrateAdapter_t adapter = {
+		.baudrates = moduleBaudrates,
+		.baudrateCount = sizeof(moduleBaudrates) / sizeof(moduleBaudrates[0]),
+		.setModuleBaudrate = SetModuleBaudrate,
+		.setHostBaudrate = SetHostBaudrate,
+		.ping = Ping };
+
+static void Reset(uint32_t baudrate, const uint32_t *rejected, const uint32_t *failing)
+{
+	moduleBaudrate = baudrate;
+	hostBaudrate = baudrate;
+	rejectedBaudrates = rejected;
+	failingBaudrates = failing;
+	failingDeaf = false;
+	moduleRequestCount = 0;
+	pingCount = 0;
+}
+
+/**
+ * @brief Checks the sequence of baud rates requested from the module (0-terminated).
+ */
+static void CheckModuleRequests(const uint32_t *expected)
+{
+	uint8_t count = 0;
+	while (expected[count] != 0)
+	{
+		count++;
+	}
+	TEST_CHECK_MSG(moduleRequestCount == count, "%u requests, %u expected", moduleRequestCount, count);
+	for (uint8_t i = 0; (i < count) && (i < moduleRequestCount); i++)
+	{
+		TEST_CHECK_MSG(moduleRequests[i] == expected[i], "request %u: %u, %u expected", i, moduleRequests[i], expected[i]);
+	}
+}
+
+static void TestHighestRate()
+{
+	uint32_t baudrate = 0;
+	Reset(115200, NULL, NULL);
+	TEST_CHECK(WE_UART_NegotiateBaudrate(&adapter, 115200, 0, &baudrate));
+	TEST_CHECK(baudrate == 921600 && moduleBaudrate == 921600 && hostBaudrate == 921600);
+	CheckModuleRequests((const uint32_t[] ) { 921600, 0 });
+}
+
+static void TestRejected()
+{
+	/* Module still uses the current baud rate, next lower rate is tried */
+	const uint32_t rejected[] = {
+			921600,
+			0 };
+	uint32_t baudrate = 0;
+	Reset(115200, rejected, NULL);
+	TEST_CHECK(WE_UART_NegotiateBaudrate(&adapter, 115200, 0, &baudrate));
+	TEST_CHECK(baudrate == 460800 && moduleBaudrate == 460800 && hostBaudrate == 460800);
+	CheckModuleRequests((const uint32_t[] ) { 921600, 460800, 0 });
+}
+
+static void TestPingFailure()
+{
+	/* Module doesn't respond at the new baud rate: both sides fall back to the previous rate */
+	const uint32_t failing[] = {
+			921600,
+			460800,
+			0 };
+	uint32_t baudrate = 0;
+	Reset(115200, NULL, failing);
+	TEST_CHECK(WE_UART_NegotiateBaudrate(&adapter, 115200, 0, &baudrate));
+	TEST_CHECK(baudrate == 230400 && moduleBaudrate == 230400 && hostBaudrate == 230400);
+	CheckModuleRequests((const uint32_t[] ) { 921600, 115200, 460800, 115200, 230400, 0 });
+
+	/* No faster rate working: stays at the current rate */
+	const uint32_t allFailing[] = {
+			921600,
+			460800,
+			230400,
+			0 };
+	Reset(115200, NULL, allFailing);
+	TEST_CHECK(WE_UART_NegotiateBaudrate(&adapter, 115200, 0, &baudrate));
+	TEST_CHECK(baudrate == 115200 && moduleBaudrate == 115200 && hostBaudrate == 115200);
+}
+
+static void TestMaxHostBaudrate()
+{
+	/* Rates above the host's limit are not requested */
+	uint32_t baudrate = 0;
+	Reset(115200, NULL, NULL);
+	TEST_CHECK(WE_UART_NegotiateBaudrate(&adapter, 115200, 460800, &baudrate));
+	TEST_CHECK(baudrate == 460800 && hostBaudrate == 460800);
+	CheckModuleRequests((const uint32_t[] ) { 460800, 0 });
+
+	/* Limit between two supported rates */
+	Reset(115200, NULL, NULL);
+	TEST_CHECK(WE_UART_NegotiateBaudrate(&adapter, 115200, 300000, &baudrate));
+	TEST_CHECK(baudrate == 230400);
+	CheckModuleRequests((const uint32_t[] ) { 230400, 0 });
+}
+
+static void TestAlreadyHighest()
+{
+	/* Nothing is written to the module */
+	uint32_t baudrate = 0;
+	Reset(921600, NULL, NULL);
+	TEST_CHECK(WE_UART_NegotiateBaudrate(&adapter, 921600, 0, &baudrate));
+	TEST_CHECK(baudrate == 921600);
+	CheckModuleRequests((const uint32_t[] ) { 0 });
+
+	/* Highest rate allowed by the host */
+	Reset(460800, NULL, NULL);
+	TEST_CHECK(WE_UART_NegotiateBaudrate(&adapter, 460800, 460800, &baudrate));
+	TEST_CHECK(baudrate == 460800);
+	CheckModuleRequests((const uint32_t[] ) { 0 });
+}
+
+static void TestNoCommunication()
+{
+	/* Module doesn't respond at the current baud rate */
+	uint32_t baudrate = 0;
+	Reset(115200, NULL, NULL);
+	hostBaudrate = 9600;
+	TEST_CHECK(!WE_UART_NegotiateBaudrate(&adapter, 9600, 0, &baudrate));
+	CheckModuleRequests((const uint32_t[] ) { 0 });
+	TEST_CHECK_MSG(pingCount == 3, "%u pings", pingCount);
+
+	/* Module doesn't respond after falling back */
+	const uint32_t failing[] = {
+			921600,
+			0 };
+	Reset(115200, NULL, failing);
+	failingDeaf = true;
+	TEST_CHECK(!WE_UART_NegotiateBaudrate(&adapter, 115200, 0, &baudrate));
+	CheckModuleRequests((const uint32_t[] ) { 921600, 115200, 0 });
+	TEST_CHECK(hostBaudrate == 115200);
+
+	/* Incomplete adapter */
+	WE_BaudrateAdapter_t incomplete = adapter;
+	incomplete.ping = NULL;
+	TEST_CHECK(!WE_UART_NegotiateBaudrate(&incomplete, 115200, 0, &baudrate));
+}
+
+int main()
+{
+	TestHighestRate();
+	TestRejected();
+	TestPingFailure();
+	TestMaxHostBaudrate();
+	TestAlreadyHighest();
+	TestNoCommunication();
+
+	return TEST_RESULT();
+}
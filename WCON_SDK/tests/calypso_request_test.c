@@ -0,0 +1,212 @@
+/**
+ * \file
+ * \brief Tests the request queue of the Calypso driver (Calypso_SendRequestAsync(),
+ * Calypso_ATSocket_SendAsync()) using a fake UART with asynchronous transmission.
+ *
+ * The fake UART records transmitted commands and completes a transmission only when
+ * the test calls the transmission complete callback, so the test can check that
+ * Calypso_ProcessRequests() starts transmissions without waiting for them and keeps
+ * the active request until its transmission has been completed.
+ */
+
+#include "Calypso/Calypso.h"
+#include "Calypso/ATCommands/ATSocket.h"
+#include "global/global.h"
+
+#include "test.h"
+
+static WE_UART_HandleRxByte_t *fakeRxHandler = NULL;
+static WE_UART_TxCompleteCallback_t fakeTxCompleteCallback = NULL;
+static const uint8_t *fakeTxData = NULL;
+static uint16_t fakeTxLength = 0;
+static uint32_t fakeTxCount = 0;
+static uint32_t fakeBlockingTxCount = 0;
+
+static bool FakeInit(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t *rxHandler)
+{
+	fakeRxHandler = rxHandler;
+	return true;
+}
+
+static bool FakeDeinit()
+{
+	return true;
+}
+
+static bool FakeTransmit(const uint8_t *data, uint16_t length)
+{
+	fakeBlockingTxCount++;
+	return true;
+}
+
+static bool FakeTransmitAsync(const uint8_t *data, uint16_t length)
+{
+	fakeTxData = data;
+	fakeTxLength = length;
+	fakeTxCount++;
+	return true;
+}
+
+static void FakeSetTxCompleteCallback(WE_UART_TxCompleteCallback_t callback)
+{
+	fakeTxCompleteCallback = callback;
+}
+
+/**
+ * @brief Passes a line to the driver as if it had been received from the module.
+ */
+static void FakeReceive(const char *line)
+{
+	(*fakeRxHandler)((uint8_t*) line, strlen(line));
+}
+
+static Calypso_CNFStatus_t completedStatus;
+static uint32_t completedCount = 0;
+
+static void OnComplete(Calypso_CNFStatus_t status, const char *response, uint16_t responseLength, void *context)
+{
+	completedStatus = status;
+	completedCount++;
+	(*(int*) context)++;
+}
+
+/**
+ * @brief Assigns distinct pins to the Calypso pin configuration.
+ */
+static void InitPins(Calypso_Pins_t *pins)
+{
+	WE_Pin_t *pin = (WE_Pin_t*) pins;
+	for (size_t i = 0; i < sizeof(Calypso_Pins_t) / sizeof(WE_Pin_t); i++)
+	{
+		pin[i].port = GPIOA;
+		pin[i].pin = (uint32_t) 1 << i;
+	}
+}
+
+static void TestQueue()
+{
+	char command[] = "AT+test\r\n";
+	int context = 0;
+
+	TEST_CHECK(Calypso_SendRequestAsync(command, 1000, OnComplete, &context));
+	TEST_CHECK(fakeTxCount == 1);
+	TEST_CHECK(fakeTxLength == strlen(command) && memcmp(fakeTxData, command, fakeTxLength) == 0);
+
+	/* Confirmation must not complete the request while it is still being transmitted */
+	FakeReceive("OK\r\n");
+	Calypso_ProcessRequests();
+	TEST_CHECK(completedCount == 0);
+	TEST_CHECK(Calypso_GetQueuedRequestCount() == 1);
+
+	fakeTxCompleteCallback();
+	Calypso_ProcessRequests();
+	TEST_CHECK(completedCount == 1 && context == 1);
+	TEST_CHECK(completedStatus == Calypso_CNFStatus_Success);
+	TEST_CHECK(Calypso_GetQueuedRequestCount() == 0);
+
+	/* Requests are sent one after the other */
+	char command2[] = "AT+test2\r\n";
+	TEST_CHECK(Calypso_SendRequestAsync(command, 1000, OnComplete, &context));
+	TEST_CHECK(Calypso_SendRequestAsync(command2, 1000, OnComplete, &context));
+	TEST_CHECK(fakeTxCount == 2);
+	fakeTxCompleteCallback();
+	Calypso_ProcessRequests();
+	TEST_CHECK(fakeTxCount == 2);
+	FakeReceive("error:test,-1\r\n");
+	Calypso_ProcessRequests();
+	TEST_CHECK(completedCount == 2 && completedStatus == Calypso_CNFStatus_Failed);
+	TEST_CHECK(fakeTxCount == 3);
+	TEST_CHECK(fakeTxLength == strlen(command2) && memcmp(fakeTxData, command2, fakeTxLength) == 0);
+	fakeTxCompleteCallback();
+	FakeReceive("OK\r\n");
+	Calypso_ProcessRequests();
+	TEST_CHECK(completedCount == 3 && completedStatus == Calypso_CNFStatus_Success);
+
+	/* Synchronous requests are rejected while asynchronous ones are queued */
+	TEST_CHECK(Calypso_SendRequestAsync(command, 1000, NULL, NULL));
+	TEST_CHECK(!Calypso_SendRequest(command));
+	fakeTxCompleteCallback();
+	FakeReceive("OK\r\n");
+	Calypso_ProcessRequests();
+	TEST_CHECK(Calypso_GetQueuedRequestCount() == 0);
+	TEST_CHECK(fakeBlockingTxCount == 0);
+}
+
+static void TestSocketSend()
+{
+	static Calypso_ATSocket_SendRequest_t requests[2];
+	char data[] = "Hello World!";
+	int context = 0;
+
+	/* Binary payload is copied, Base64 payload is encoded before queuing */
+	TEST_CHECK(Calypso_ATSocket_SendAsync(&requests[0], 1, NULL, Calypso_DataFormat_Binary, false, 12, data, OnComplete, &context));
+	TEST_CHECK(Calypso_ATSocket_SendAsync(&requests[1], 1, NULL, Calypso_DataFormat_Base64, true, 12, data, OnComplete, &context));
+	memset(data, 0, sizeof(data));
+
+	const char expected0[] = "AT+send=1,0,12,Hello World!\r\n";
+	TEST_CHECK_MSG(fakeTxLength == strlen(expected0) && memcmp(fakeTxData, expected0, fakeTxLength) == 0, "%.*s", fakeTxLength, fakeTxData);
+	fakeTxCompleteCallback();
+	FakeReceive("OK\r\n");
+	Calypso_ProcessRequests();
+
+	const char expected1[] = "AT+send=1,1,16,SGVsbG8gV29ybGQh\r\n";
+	TEST_CHECK_MSG(fakeTxLength == strlen(expected1) && memcmp(fakeTxData, expected1, fakeTxLength) == 0, "%.*s", fakeTxLength, fakeTxData);
+	fakeTxCompleteCallback();
+	FakeReceive("OK\r\n");
+	Calypso_ProcessRequests();
+	TEST_CHECK(context == 2);
+
+	/* Payload too large */
+	TEST_CHECK(!Calypso_ATSocket_SendAsync(&requests[0], 1, NULL, Calypso_DataFormat_Binary, false, Calypso_ATSocket_GetMaxSendLength(false) + 1, data, NULL, NULL));
+
+	/* Command buffer too small */
+	char buffer[20] = "AT+send=1,0,12,";
+	TEST_CHECK(!Calypso_SendRequestWithPayloadAsync(buffer, sizeof(buffer), (const uint8_t*) "Hello World!", 12, false, NULL, 1000, NULL, NULL));
+	TEST_CHECK(Calypso_GetQueuedRequestCount() == 0);
+}
+
+static void TestBlockingFallback()
+{
+	/* Without asynchronous transmission, requests are transmitted using uartTransmit */
+	static WE_UART_t uart = {
+			.uartInit = FakeInit,
+			.uartDeinit = FakeDeinit,
+			.uartTransmit = FakeTransmit };
+	static Calypso_Pins_t pins;
+	InitPins(&pins);
+	TEST_CHECK(Calypso_Init(&uart, &pins, NULL));
+	Calypso_SetTimingParameters(0, 0);
+
+	char command[] = "AT+test\r\n";
+	uint32_t txCount = fakeTxCount;
+	TEST_CHECK(Calypso_SendRequestAsync(command, 1000, NULL, NULL));
+	TEST_CHECK(fakeBlockingTxCount == 1 && fakeTxCount == txCount);
+	FakeReceive("OK\r\n");
+	Calypso_ProcessRequests();
+	TEST_CHECK(Calypso_GetQueuedRequestCount() == 0);
+}
+
+int main()
+{
+	static WE_UART_t uart = {
+			.uartInit = FakeInit,
+			.uartDeinit = FakeDeinit,
+			.uartTransmit = FakeTransmit,
+			.uartTransmitAsync = FakeTransmitAsync,
+			.uartSetTxCompleteCallback = FakeSetTxCompleteCallback };
+	static Calypso_Pins_t pins;
+
+	WE_Platform_Init();
+	InitPins(&pins);
+	TEST_CHECK(Calypso_Init(&uart, &pins, NULL));
+	TEST_CHECK(fakeTxCompleteCallback != NULL);
+	Calypso_SetTimingParameters(0, 0);
+
+	TestQueue();
+	TestSocketSend();
+
+	TEST_CHECK(Calypso_Deinit());
+	TestBlockingFallback();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,325 @@
+/**
+ * \file
+ * \brief Tests the receive path of the Calypso driver using the simulated module.
+ *
+ * Covers receiving +recv/+recvfrom payloads into buffers posted using
+ * Calypso_PostSocketReceiveBuffer() (binary and Base64, payloads split across
+ * receive chunks, payloads exceeding the buffer, timeout and cancellation) and lines
+ * exceeding CALYPSO_LINE_MAX_SIZE (discarded or passed to the line fragment callback).
+ */
+
+#include "Calypso/Calypso.h"
+#include "global/global.h"
+
+#include "sim/calypso_sim.h"
+
+#include "test.h"
+
+#include <unistd.h>
+
+#define TEST_WAIT_MS 1000
+
+/**
+ * @brief Time between sending the parts of data that is to be received in separate chunks.
+ */
+#define TEST_CHUNK_GAP_USEC 20000
+
+static char lastEvent[CALYPSO_LINE_MAX_SIZE];
+static volatile uint32_t eventCount = 0;
+
+static uint8_t rxBuffer[64];
+static volatile uint32_t rxCount = 0;
+static uint8_t rxSocketID;
+static uint16_t rxLength;
+static bool rxComplete;
+static void *rxContext;
+
+/**
+ * @brief Max. number of line fragments recorded by OnLineFragment().
+ */
+#define TEST_MAX_FRAGMENTS 8
+
+static char fragmentData[4 * CALYPSO_LINE_MAX_SIZE];
+static size_t fragmentDataLength = 0;
+static uint16_t fragmentLengths[TEST_MAX_FRAGMENTS];
+static bool fragmentFirst[TEST_MAX_FRAGMENTS];
+static bool fragmentLast[TEST_MAX_FRAGMENTS];
+static volatile uint32_t fragmentCount = 0;
+
+static void OnEvent(char *eventText)
+{
+	snprintf(lastEvent, sizeof(lastEvent), "%s", eventText);
+	eventCount++;
+}
+
+static void OnSocketReceive(uint8_t socketID, uint8_t *buffer, uint16_t length, bool complete, void *context)
+{
+	TEST_CHECK(buffer == rxBuffer);
+	rxSocketID = socketID;
+	rxLength = length;
+	rxComplete = complete;
+	rxContext = context;
+	rxCount++;
+}
+
+static void OnLineFragment(const char *fragment, uint16_t length, bool first, bool last)
+{
+	if (fragmentDataLength + length <= sizeof(fragmentData))
+	{
+		memcpy(&fragmentData[fragmentDataLength], fragment, length);
+	}
+	fragmentDataLength += length;
+	if (fragmentCount < TEST_MAX_FRAGMENTS)
+	{
+		fragmentLengths[fragmentCount] = length;
+		fragmentFirst[fragmentCount] = first;
+		fragmentLast[fragmentCount] = last;
+	}
+	fragmentCount++;
+}
+
+/**
+ * @brief Waits until the supplied counter has reached the expected value.
+ */
+static bool WaitForCount(volatile uint32_t *counter, uint32_t expected)
+{
+	uint32_t t0 = WE_GetTick();
+	while (*counter < expected)
+	{
+		if (WE_GetTick() - t0 > TEST_WAIT_MS)
+		{
+			return false;
+		}
+		WE_Delay(1);
+	}
+	return true;
+}
+
+static void Send(const char *data)
+{
+	TEST_CHECK(CalypsoSim_Send(data, strlen(data)));
+}
+
+/**
+ * @brief Sends an event line and checks that it is passed to the event callback unchanged
+ * (i.e. that the driver is back to processing lines).
+ */
+static void CheckNextLine()
+{
+	uint32_t events = eventCount;
+	Send("+eventsock:tx_failed,1,-11\r\n");
+	TEST_CHECK(WaitForCount(&eventCount, events + 1));
+	TEST_CHECK_MSG(strcmp(lastEvent, "+eventsock:tx_failed,1,-11") == 0, "%s", lastEvent);
+}
+
+/**
+ * @brief Posts rxBuffer, sends the supplied parts and checks the received payload.
+ */
+static void CheckReceive(uint8_t socketID, const char *parts[], int partCount, const char *expected, uint16_t expectedLength)
+{
+	uint32_t count = rxCount;
+	uint32_t events = eventCount;
+	int context = 0;
+
+	memset(rxBuffer, 0, sizeof(rxBuffer));
+	TEST_CHECK(Calypso_PostSocketReceiveBuffer(socketID, rxBuffer, sizeof(rxBuffer), OnSocketReceive, &context));
+	for (int i = 0; i < partCount; i++)
+	{
+		if (i > 0)
+		{
+			WE_DelayMicroseconds(TEST_CHUNK_GAP_USEC);
+		}
+		Send(parts[i]);
+	}
+
+	TEST_CHECK_MSG(WaitForCount(&rxCount, count + 1), "%s", parts[0]);
+	TEST_CHECK(rxSocketID == socketID);
+	TEST_CHECK(rxComplete);
+	TEST_CHECK(rxContext == &context);
+	TEST_CHECK_MSG(rxLength == expectedLength && memcmp(rxBuffer, expected, expectedLength) == 0, "%s: %u bytes", parts[0], rxLength);
+
+	/* Payload is not passed to the event callback, buffer has been released */
+	CheckNextLine();
+	TEST_CHECK(eventCount == events + 1);
+	TEST_CHECK(!Calypso_CancelSocketReceiveBuffer(socketID));
+}
+
+static void TestPostedBuffer()
+{
+	/* Binary payload containing a line end */
+	const char *binary[] = {
+			"+recv:1,0,12,Hello\r\nWorld\r\n" };
+	CheckReceive(1, binary, 1, "Hello\r\nWorld", 12);
+
+	const char *base64[] = {
+			"+recvfrom:2,1,16,SGVsbG8gV29ybGQh\r\n" };
+	CheckReceive(2, base64, 1, "Hello World!", 12);
+
+	/* Payload split across receive chunks (Base64 split inside a group of four characters) */
+	const char *binarySplit[] = {
+			"+recv:1,0,12,Hello\r",
+			"\nWorld\r\n" };
+	CheckReceive(1, binarySplit, 2, "Hello\r\nWorld", 12);
+
+	const char *base64Split[] = {
+			"+recv:3,1,16,SGVsbG8gV2",
+			"9ybGQh",
+			"\r\n" };
+	CheckReceive(3, base64Split, 3, "Hello World!", 12);
+
+	/* Header split across receive chunks */
+	const char *headerSplit[] = {
+			"+recvfrom:1,0",
+			",5,",
+			"Hello\r\n" };
+	CheckReceive(1, headerSplit, 3, "Hello", 5);
+}
+
+static void TestPayloadExceedingBuffer()
+{
+	uint8_t smallBuffer[4];
+	uint32_t count = rxCount;
+	uint32_t events = eventCount;
+
+	/* Line is processed as usual, buffer stays posted */
+	TEST_CHECK(Calypso_PostSocketReceiveBuffer(1, smallBuffer, sizeof(smallBuffer), OnSocketReceive, NULL));
+	Send("+recv:1,0,12,Hello World!\r\n");
+	TEST_CHECK(WaitForCount(&eventCount, events + 1));
+	TEST_CHECK_MSG(strcmp(lastEvent, "+recv:1,0,12,Hello World!") == 0, "%s", lastEvent);
+	TEST_CHECK(rxCount == count);
+	TEST_CHECK(Calypso_CancelSocketReceiveBuffer(1));
+	TEST_CHECK(rxCount == count);
+}
+
+static void TestCancel()
+{
+	uint32_t count = rxCount;
+	uint32_t events = eventCount;
+
+	TEST_CHECK(Calypso_PostSocketReceiveBuffer(1, rxBuffer, sizeof(rxBuffer), OnSocketReceive, NULL));
+	Send("+recv:1,0,20,0123456789");
+	WE_DelayMicroseconds(TEST_CHUNK_GAP_USEC);
+
+	/* Callback is executed by the caller with the data received so far */
+	TEST_CHECK(Calypso_CancelSocketReceiveBuffer(1));
+	TEST_CHECK(rxCount == count + 1);
+	TEST_CHECK(!rxComplete);
+	TEST_CHECK(rxLength == 10 && memcmp(rxBuffer, "0123456789", 10) == 0);
+
+	/* Rest of the line is discarded */
+	Send("abcdefghij\r\n");
+	CheckNextLine();
+	TEST_CHECK(eventCount == events + 1);
+	TEST_CHECK(rxCount == count + 1);
+}
+
+static void TestTimeout()
+{
+	uint32_t count = rxCount;
+	uint32_t timeout = Calypso_GetTimeout(Calypso_Timeout_SocketReceive);
+	Calypso_SetTimeout(Calypso_Timeout_SocketReceive, 10);
+
+	TEST_CHECK(Calypso_PostSocketReceiveBuffer(1, rxBuffer, sizeof(rxBuffer), OnSocketReceive, NULL));
+	Send("+recv:1,0,20,0123456789");
+	WE_DelayMicroseconds(TEST_CHUNK_GAP_USEC + 10000);
+
+	/* Data received after the timeout aborts reception and is processed as lines */
+	CheckNextLine();
+	TEST_CHECK(rxCount == count + 1);
+	TEST_CHECK(!rxComplete);
+	TEST_CHECK(rxLength == 10 && memcmp(rxBuffer, "0123456789", 10) == 0);
+
+	Calypso_SetTimeout(Calypso_Timeout_SocketReceive, timeout);
+}
+
+/**
+ * @brief Sends an event line of the given length (excluding the line end), returns the line.
+ */
+static const char* SendLongLine(size_t length)
+{
+	static char line[3 * CALYPSO_LINE_MAX_SIZE];
+	TEST_CHECK(length + 2 < sizeof(line));
+	strcpy(line, "+longline:");
+	for (size_t i = strlen(line); i < length; i++)
+	{
+		line[i] = 'a' + (i % 26);
+	}
+	line[length] = '\0';
+
+	fragmentDataLength = 0;
+	fragmentCount = 0;
+	Send(line);
+	Send("\r\n");
+	return line;
+}
+
+/**
+ * @brief Checks the fragments passed to the line fragment callback (after the next line has been received).
+ */
+static void CheckFragments(const char *line, const uint16_t *lengths, uint32_t count)
+{
+	TEST_CHECK_MSG(fragmentCount == count, "%u fragments, %u expected", fragmentCount, count);
+	for (uint32_t i = 0; (i < count) && (i < fragmentCount) && (i < TEST_MAX_FRAGMENTS); i++)
+	{
+		TEST_CHECK_MSG(fragmentLengths[i] == lengths[i], "fragment %u: %u bytes, %u expected", i, fragmentLengths[i], lengths[i]);
+		TEST_CHECK_MSG(fragmentFirst[i] == (i == 0) && fragmentLast[i] == (i == count - 1), "fragment %u: first %d, last %d", i, fragmentFirst[i], fragmentLast[i]);
+	}
+	TEST_CHECK(fragmentDataLength == strlen(line) && memcmp(fragmentData, line, fragmentDataLength) == 0);
+}
+
+static void TestLongLine()
+{
+	const uint16_t full = CALYPSO_LINE_MAX_SIZE - 1;
+	uint32_t events = eventCount;
+
+	/* Longest line fitting into the receive buffer (last byte is reserved for termination character) */
+	const char *line = SendLongLine(full);
+	TEST_CHECK(WaitForCount(&eventCount, events + 1));
+	TEST_CHECK(strlen(lastEvent) == full && strcmp(lastEvent, line) == 0);
+	events = eventCount;
+
+	/* Without fragment callback, the line is discarded */
+	SendLongLine(2 * CALYPSO_LINE_MAX_SIZE + 100);
+	CheckNextLine();
+	TEST_CHECK(eventCount == events + 1);
+	TEST_CHECK(fragmentCount == 0);
+	events = eventCount;
+
+	/* Passed to the fragment callback whenever the buffer is full, the rest with the line end */
+	Calypso_SetLineFragmentRxCallback(OnLineFragment);
+	line = SendLongLine(2 * CALYPSO_LINE_MAX_SIZE + 100);
+	CheckNextLine();
+	CheckFragments(line, (const uint16_t[] ) { full, full, 2 * CALYPSO_LINE_MAX_SIZE + 100 - 2 * full }, 3);
+	TEST_CHECK(eventCount == events + 1);
+	events = eventCount;
+
+	line = SendLongLine(CALYPSO_LINE_MAX_SIZE);
+	CheckNextLine();
+	CheckFragments(line, (const uint16_t[] ) { full, 1 }, 2);
+
+	/* Line that fills the buffer exactly twice: no empty last fragment */
+	line = SendLongLine(2 * full);
+	CheckNextLine();
+	CheckFragments(line, (const uint16_t[] ) { full, full }, 2);
+
+	/* Lines fitting into the buffer are not affected by the callback */
+	line = SendLongLine(full);
+	CheckNextLine();
+	TEST_CHECK(fragmentCount == 0);
+	TEST_CHECK(eventCount == events + 4);
+
+	Calypso_SetLineFragmentRxCallback(NULL);
+}
+
+int main()
+{
+	TEST_CHECK(CalypsoSim_Init(OnEvent));
+
+	TestPostedBuffer();
+	TestPayloadExceedingBuffer();
+	TestCancel();
+	TestTimeout();
+	TestLongLine();
+
+	return TEST_RESULT();
+}
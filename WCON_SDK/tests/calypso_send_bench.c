@@ -0,0 +1,192 @@
+/**
+ * \file
+ * \brief Messages per second sent via Calypso_ATSocket_Send() (synchronous) and
+ * Calypso_ATSocket_SendAsync() (request queue) to the simulated Calypso module, and
+ * throughput of the driver's receive path for event lines sent by the module.
+ *
+ * The application produces each message before sending it (simulated by busy waiting).
+ * Using the synchronous API, producing the next message starts after the previous one has
+ * been confirmed. Using the request queue, the next message is produced while the previous
+ * ones are in flight, so production overlaps with the module's response delay. The min.
+ * command interval is counted from the confirmation, so it overlaps with production using
+ * both APIs and bounds the message rate of both.
+ */
+
+#include "Calypso/Calypso.h"
+#include "Calypso/ATCommands/ATSocket.h"
+#include "global/global.h"
+
+#include "sim/calypso_sim.h"
+
+#include "test.h"
+
+#define BENCH_RESPONSE_DELAY_USEC 300
+#define BENCH_WAIT_TIME_STEP_USEC 1000
+#define BENCH_IDLE_USEC 50
+#define BENCH_MESSAGE_SIZE 64
+#define BENCH_SOCKET_ID 1
+#define BENCH_EVENT_LINE "+recv:1,0,16,SGVsbG8gV29ybGQh\r\n"
+
+static volatile uint32_t completedCount = 0;
+static volatile uint32_t failedCount = 0;
+static volatile uint32_t eventCount = 0;
+
+static void OnSendComplete(Calypso_CNFStatus_t status, const char *response, uint16_t responseLength, void *context)
+{
+	(void) response;
+	(void) responseLength;
+	(void) context;
+	if (status != Calypso_CNFStatus_Success)
+	{
+		failedCount++;
+	}
+	completedCount++;
+}
+
+static void OnEvent(char *eventText)
+{
+	if (strncmp(eventText, "+recv:", 6) == 0)
+	{
+		eventCount++;
+	}
+}
+
+/**
+ * @brief Produces a message (busy waits for the given time to simulate the application's work).
+ */
+static void ProduceMessage(char *message, uint32_t index, uint32_t workUsec)
+{
+	uint64_t end = TestGetTimeNs() + workUsec * 1000ULL;
+	memset(message, 'a' + (index % 26), BENCH_MESSAGE_SIZE);
+	while (TestGetTimeNs() < end)
+	{
+	}
+}
+
+/**
+ * @brief Sends messages using Calypso_ATSocket_Send(), returns the elapsed time.
+ */
+static uint64_t RunSync(uint32_t messageCount, uint32_t workUsec)
+{
+	char message[BENCH_MESSAGE_SIZE];
+	uint64_t start = TestGetTimeNs();
+	for (uint32_t i = 0; i < messageCount; i++)
+	{
+		ProduceMessage(message, i, workUsec);
+		uint16_t bytesSent;
+		TEST_CHECK(Calypso_ATSocket_Send(BENCH_SOCKET_ID, Calypso_DataFormat_Binary, false, sizeof(message), message, &bytesSent));
+		TEST_CHECK(bytesSent == sizeof(message));
+	}
+	return TestGetTimeNs() - start;
+}
+
+/**
+ * @brief Sends messages using Calypso_ATSocket_SendAsync(), returns the elapsed time.
+ *
+ * Requests are completed in FIFO order, so the request object and message buffer of
+ * message i can be reused for message i + CALYPSO_REQUEST_QUEUE_SIZE once the queue has space.
+ */
+static uint64_t RunAsync(uint32_t messageCount, uint32_t workUsec)
+{
+	static Calypso_ATSocket_SendRequest_t requests[CALYPSO_REQUEST_QUEUE_SIZE];
+	static char messages[CALYPSO_REQUEST_QUEUE_SIZE][BENCH_MESSAGE_SIZE];
+
+	completedCount = 0;
+	failedCount = 0;
+
+	uint64_t start = TestGetTimeNs();
+	for (uint32_t i = 0; i < messageCount; i++)
+	{
+		uint8_t slot = i % CALYPSO_REQUEST_QUEUE_SIZE;
+		ProduceMessage(messages[slot], i, workUsec);
+		Calypso_ProcessRequests();
+		while (Calypso_GetQueuedRequestCount() >= CALYPSO_REQUEST_QUEUE_SIZE)
+		{
+			WE_DelayMicroseconds(BENCH_IDLE_USEC);
+			Calypso_ProcessRequests();
+		}
+		TEST_CHECK(Calypso_ATSocket_SendAsync(&requests[slot], BENCH_SOCKET_ID, NULL, Calypso_DataFormat_Binary, false, BENCH_MESSAGE_SIZE, messages[slot], OnSendComplete, NULL));
+	}
+	while (Calypso_GetQueuedRequestCount() > 0)
+	{
+		WE_DelayMicroseconds(BENCH_IDLE_USEC);
+		Calypso_ProcessRequests();
+	}
+	uint64_t elapsedNs = TestGetTimeNs() - start;
+
+	TEST_CHECK_MSG(completedCount == messageCount, "%u of %u completed", completedCount, messageCount);
+	TEST_CHECK_MSG(failedCount == 0, "%u failed", failedCount);
+	return elapsedNs;
+}
+
+/**
+ * @brief Sends event lines from the simulated module, returns the time until all have been dispatched.
+ */
+static uint64_t RunEvents(uint32_t lineCount)
+{
+	const size_t lineLength = strlen(BENCH_EVENT_LINE);
+	char block[64 * sizeof(BENCH_EVENT_LINE)];
+	for (size_t i = 0; i < 64; i++)
+	{
+		memcpy(&block[i * lineLength], BENCH_EVENT_LINE, lineLength);
+	}
+
+	eventCount = 0;
+	uint64_t start = TestGetTimeNs();
+	for (uint32_t sent = 0; sent < lineCount; sent += 64)
+	{
+		uint32_t n = lineCount - sent < 64 ? lineCount - sent : 64;
+		TEST_CHECK(CalypsoSim_Send(block, n * lineLength));
+	}
+	uint64_t timeoutNs = start + 10000000000ULL;
+	while (eventCount < lineCount && TestGetTimeNs() < timeoutNs)
+	{
+		WE_DelayMicroseconds(BENCH_IDLE_USEC);
+	}
+	uint64_t elapsedNs = TestGetTimeNs() - start;
+
+	TEST_CHECK_MSG(eventCount == lineCount, "%u of %u events", eventCount, lineCount);
+	return elapsedNs;
+}
+
+int main()
+{
+	const uint32_t messageCount = TestBenchIterations(100);
+	const uint32_t minCommandIntervals[] = {
+			3000,
+			0 };
+	const uint32_t workTimes[] = {
+			0,
+			1000 };
+	char name[80];
+
+	TEST_CHECK(CalypsoSim_Init(OnEvent));
+	CalypsoSim_SetResponseDelay(BENCH_RESPONSE_DELAY_USEC);
+
+	printf("Socket send, %d byte messages (module response delay %u us, ns per message and messages per second):\n", BENCH_MESSAGE_SIZE, BENCH_RESPONSE_DELAY_USEC);
+	for (size_t i = 0; i < sizeof(minCommandIntervals) / sizeof(minCommandIntervals[0]); i++)
+	{
+		Calypso_SetTimingParameters(BENCH_WAIT_TIME_STEP_USEC, minCommandIntervals[i]);
+		for (size_t j = 0; j < sizeof(workTimes) / sizeof(workTimes[0]); j++)
+		{
+			uint32_t commandCount = CalypsoSim_GetCommandCount();
+			uint64_t syncNs = RunSync(messageCount, workTimes[j]);
+			TEST_CHECK(CalypsoSim_GetCommandCount() - commandCount == messageCount);
+
+			commandCount = CalypsoSim_GetCommandCount();
+			uint64_t asyncNs = RunAsync(messageCount, workTimes[j]);
+			TEST_CHECK(CalypsoSim_GetCommandCount() - commandCount == messageCount);
+
+			snprintf(name, sizeof(name), "  interval %4u us, work %4u us: sync", minCommandIntervals[i], workTimes[j]);
+			TestPrintBenchmark(name, messageCount, syncNs);
+			snprintf(name, sizeof(name), "  interval %4u us, work %4u us: async", minCommandIntervals[i], workTimes[j]);
+			TestPrintBenchmark(name, messageCount, asyncNs);
+		}
+	}
+
+	const uint32_t lineCount = TestBenchIterations(20000);
+	printf("Received event lines (UART receive path and event callback, ns per line and lines per second):\n");
+	TestPrintBenchmark("  +recv", lineCount, RunEvents(lineCount));
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,360 @@
+/**
+ * \file
+ * \brief Tests the binary debug log (WE_DEBUG_BINARY, see global/debug.c) on the STM32 platform files
+ * and compares its cost with formatting the message on the target.
+ *
+ * debug.c is run against the peripheral stand-in in stm32_host/ (USART2 with DMA). The frames
+ * transmitted by the simulated USART2 are decoded and checked. The test is linked with -no-pie,
+ * so that the debug buffer and the format strings are located below 4 GB (addresses are 32 bit).
+ */
+
+#include "global/global.h"
+
+#include "stm32_host/stm32_host.h"
+
+#include "test.h"
+
+#include <stdarg.h>
+#include <unistd.h>
+
+/* Defined in debug.c (redirects printf() output on the target) */
+extern int _write(int fd, char *ptr, int len);
+
+#define TEST_BAUDRATE 115200
+
+/**
+ * @brief Baud rate of the simulated USART2 while benchmarking (drains the ring buffer quickly,
+ * so that no records are dropped).
+ */
+#define TEST_BENCH_BAUDRATE 4000000
+
+#define TEST_MAX_RECORD_SIZE 128
+
+static const char testFormat[] = "value %d %u %s %c %llx %f %.*s|%*d\n";
+static const char sequenceFormat[] = "sequence %u\n";
+static const char benchFormat[] = "Calypso: socket %d sent %u bytes to %s:%u (%ld us)\n";
+
+typedef struct TestRecord_t
+{
+	uint8_t data[TEST_MAX_RECORD_SIZE];
+	size_t length;
+} TestRecord_t;
+
+/**
+ * @brief Decodes a COBS frame (without delimiter).
+ */
+static bool CobsDecode(const uint8_t *frame, size_t frameLength, TestRecord_t *record)
+{
+	record->length = 0;
+	size_t pos = 0;
+	while (pos < frameLength)
+	{
+		uint8_t code = frame[pos];
+		if (code == 0 || pos + code > frameLength)
+		{
+			return false;
+		}
+		for (size_t i = 1; i < code; i++)
+		{
+			if (record->length >= sizeof(record->data))
+			{
+				return false;
+			}
+			record->data[record->length++] = frame[pos + i];
+		}
+		pos += code;
+		if (code < 0xFF && pos < frameLength)
+		{
+			if (record->length >= sizeof(record->data))
+			{
+				return false;
+			}
+			record->data[record->length++] = 0;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Splits the data transmitted by USART2 into frames and decodes them.
+ *
+ * @return Number of records decoded, -1 if a frame is invalid
+ */
+static int DecodeTransmitted(TestRecord_t *records, int maxRecords)
+{
+	size_t length;
+	const uint8_t *data = STM32Host_GetTransmittedData(STM32Host_Uart_Debug, &length);
+	int count = 0;
+	size_t start = 0;
+	for (size_t i = 0; i < length; i++)
+	{
+		if (data[i] != 0)
+		{
+			continue;
+		}
+		if (count >= maxRecords || !CobsDecode(data + start, i - start, &records[count]))
+		{
+			return -1;
+		}
+		count++;
+		start = i + 1;
+	}
+	return start == length ? count : -1;
+}
+
+static uint32_t GetU32(const TestRecord_t *record, size_t *pos)
+{
+	uint32_t value = 0;
+	if (*pos + sizeof(value) <= record->length)
+	{
+		memcpy(&value, record->data + *pos, sizeof(value));
+	}
+	*pos += sizeof(value);
+	return value;
+}
+
+static uint64_t GetU64(const TestRecord_t *record, size_t *pos)
+{
+	uint64_t value = 0;
+	if (*pos + sizeof(value) <= record->length)
+	{
+		memcpy(&value, record->data + *pos, sizeof(value));
+	}
+	*pos += sizeof(value);
+	return value;
+}
+
+static bool GetString(const TestRecord_t *record, size_t *pos, const char *expected)
+{
+	size_t length = *pos < record->length ? record->data[*pos] : 0;
+	*pos += 1;
+	bool equal = length == strlen(expected) && *pos + length <= record->length && memcmp(record->data + *pos, expected, length) == 0;
+	*pos += length;
+	return equal;
+}
+
+/**
+ * @brief Waits until the debug output has been transmitted.
+ *
+ * WE_Debug_Flush() busy-waits, which would starve the simulation thread on a single CPU host,
+ * so it is only called once the simulated USART2 has become idle.
+ */
+static void WaitForDebugOutput()
+{
+	for (int i = 0; i < 5000 && !STM32Host_IsUartIdle(STM32Host_Uart_Debug); i++)
+	{
+		usleep(100);
+	}
+	WE_Debug_Flush();
+}
+
+static void TestRecordLayout()
+{
+	static TestRecord_t records[4];
+
+	STM32Host_ResetTransmittedData(STM32Host_Uart_Debug);
+	uint32_t before = WE_GetTickMicroseconds();
+	WE_LOG(testFormat, -5, 7u, "abc", 'x', 0x1122334455667788ULL, 1.5, 2, "hello", 6, 42);
+	TEST_CHECK(_write(STDOUT_FILENO, "plain text\n", 11) == 11);
+	TEST_CHECK(_write(42, "invalid", 7) < 0);
+	uint32_t after = WE_GetTickMicroseconds();
+	WaitForDebugOutput();
+
+	int count = DecodeTransmitted(records, 4);
+	TEST_CHECK_MSG(count == 2, "%d records", count);
+	if (count != 2)
+	{
+		return;
+	}
+
+	/* Log record: header followed by the raw arguments */
+	const TestRecord_t *record = &records[0];
+	size_t pos = 0;
+	uint32_t timestamp = GetU32(record, &pos);
+	TEST_CHECK(timestamp >= before && timestamp <= after);
+	TEST_CHECK(GetU32(record, &pos) == (uint32_t) (uintptr_t) testFormat);
+	TEST_CHECK(GetU32(record, &pos) == (uint32_t) -5);
+	TEST_CHECK(GetU32(record, &pos) == 7);
+	TEST_CHECK(GetString(record, &pos, "abc"));
+	TEST_CHECK(GetU32(record, &pos) == 'x');
+	TEST_CHECK(GetU64(record, &pos) == 0x1122334455667788ULL);
+	uint64_t doubleBits = GetU64(record, &pos);
+	double value;
+	memcpy(&value, &doubleBits, sizeof(value));
+	TEST_CHECK(value == 1.5);
+	TEST_CHECK(GetU32(record, &pos) == 2);
+	TEST_CHECK(GetString(record, &pos, "he"));
+	TEST_CHECK(GetU32(record, &pos) == 6);
+	TEST_CHECK(GetU32(record, &pos) == 42);
+	TEST_CHECK_MSG(pos == record->length, "%zu of %zu bytes decoded", pos, record->length);
+
+	/* Plain text record: format address 0 followed by the text */
+	record = &records[1];
+	pos = 0;
+	timestamp = GetU32(record, &pos);
+	TEST_CHECK(timestamp >= before && timestamp <= after);
+	TEST_CHECK(GetU32(record, &pos) == 0);
+	TEST_CHECK(record->length - pos == 11 && memcmp(record->data + pos, "plain text\n", 11) == 0);
+}
+
+static void TestLongRecords()
+{
+	static TestRecord_t records[8];
+	char text[300];
+	memset(text, 'a', sizeof(text));
+
+	/* Strings are truncated to the record size, plain text is split into several records */
+	STM32Host_ResetTransmittedData(STM32Host_Uart_Debug);
+	text[sizeof(text) - 1] = '\0';
+	WE_LOG("%s", text);
+	TEST_CHECK(_write(STDOUT_FILENO, text, 299) == 299);
+	WaitForDebugOutput();
+
+	int count = DecodeTransmitted(records, 8);
+	TEST_CHECK_MSG(count == 4, "%d records", count);
+	if (count != 4)
+	{
+		return;
+	}
+	TEST_CHECK(records[0].length == TEST_MAX_RECORD_SIZE && records[0].data[8] == TEST_MAX_RECORD_SIZE - 9);
+	size_t textLength = 0;
+	for (int i = 1; i < count; i++)
+	{
+		TEST_CHECK(records[i].length > 8 && records[i].length <= TEST_MAX_RECORD_SIZE);
+		textLength += records[i].length - 8;
+	}
+	TEST_CHECK(textLength == 299);
+}
+
+static void TestDroppedRecords()
+{
+	enum
+	{
+		recordCount = 400
+	};
+	static TestRecord_t records[recordCount];
+
+	/* Writing faster than USART2 can transmit fills the ring buffer - records are dropped
+	 * as a whole, so all records received are intact and in order */
+	STM32Host_ResetTransmittedData(STM32Host_Uart_Debug);
+	uint32_t droppedBefore = WE_Debug_GetDroppedRecords();
+	for (uint32_t i = 0; i < recordCount; i++)
+	{
+		WE_LOG(sequenceFormat, i);
+	}
+	uint32_t dropped = WE_Debug_GetDroppedRecords() - droppedBefore;
+	WaitForDebugOutput();
+
+	int count = DecodeTransmitted(records, recordCount);
+	TEST_CHECK(dropped > 0);
+	TEST_CHECK_MSG(count >= 0 && (uint32_t) count + dropped == recordCount, "%d records received, %u dropped", count, dropped);
+
+	uint32_t previous = 0;
+	for (int i = 0; i < count; i++)
+	{
+		size_t pos = 4;
+		TEST_CHECK(records[i].length == 12);
+		TEST_CHECK(GetU32(&records[i], &pos) == (uint32_t) (uintptr_t) sequenceFormat);
+		uint32_t sequence = GetU32(&records[i], &pos);
+		TEST_CHECK(i == 0 || sequence > previous);
+		previous = sequence;
+	}
+}
+
+/**
+ * @brief Formats a message into a buffer (text mode, as done by printf() on the target).
+ */
+static int FormatText(char *buffer, size_t size, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int length = vsnprintf(buffer, size, format, args);
+	va_end(args);
+	return length;
+}
+
+static void Benchmark()
+{
+	/* Records are written in batches fitting into the ring buffer, so that none are dropped.
+	 * Note that on the host, disabling interrupts (PRIMASK) is emulated using a mutex, which
+	 * adds to the time measured for WE_LOG() (measured separately below). */
+	const uint32_t batchSize = 32;
+	const uint32_t iterations = TestBenchIterations(20000);
+
+	STM32Host_StartUart(STM32Host_Uart_Debug, TEST_BENCH_BAUDRATE);
+	STM32Host_ResetTransmittedData(STM32Host_Uart_Debug);
+	uint32_t droppedBefore = WE_Debug_GetDroppedRecords();
+
+	uint64_t elapsedNs = 0;
+	for (uint32_t i = 0; i < iterations; i += batchSize)
+	{
+		uint64_t start = TestGetTimeNs();
+		for (uint32_t j = 0; j < batchSize; j++)
+		{
+			WE_LOG(benchFormat, 3, 1400u, "192.168.100.1", 8080u, (long) (i + j));
+		}
+		elapsedNs += TestGetTimeNs() - start;
+		WaitForDebugOutput();
+		STM32Host_ResetTransmittedData(STM32Host_Uart_Debug);
+	}
+	uint32_t logCount = (iterations + batchSize - 1) / batchSize * batchSize;
+	TEST_CHECK(WE_Debug_GetDroppedRecords() == droppedBefore);
+
+	char text[256];
+	int textLength = 0;
+	uint64_t start = TestGetTimeNs();
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		textLength = FormatText(text, sizeof(text), benchFormat, 3, 1400u, "192.168.100.1", 8080u, (long) i);
+		TEST_KEEP(text);
+	}
+	uint64_t textNs = TestGetTimeNs() - start;
+
+	/* Two critical sections per record (reserve and commit), which take a few cycles on the target */
+	start = TestGetTimeNs();
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		for (int section = 0; section < 2; section++)
+		{
+			uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			__set_PRIMASK(primask);
+		}
+	}
+	uint64_t criticalSectionNs = TestGetTimeNs() - start;
+
+	STM32Host_ResetTransmittedData(STM32Host_Uart_Debug);
+	WE_LOG(benchFormat, 3, 1400u, "192.168.100.1", 8080u, 123456L);
+	WaitForDebugOutput();
+	size_t frameLength;
+	STM32Host_GetTransmittedData(STM32Host_Uart_Debug, &frameLength);
+
+	printf("Message \"%.*s\" (host CPU time per message):\n", textLength - 1, text);
+	TestPrintBenchmark("  WE_LOG() binary record", logCount, elapsedNs);
+	TestPrintBenchmark("    of which emulated PRIMASK (mutex)", iterations, criticalSectionNs);
+	TestPrintBenchmark("  vsnprintf() text (formatting only)", iterations, textNs);
+	printf("  bytes on the wire: binary %zu, text %d (%.0f us vs %.0f us at %u baud)\n", frameLength, textLength, frameLength * 10e6 / TEST_BAUDRATE,
+			textLength * 10e6 / TEST_BAUDRATE, TEST_BAUDRATE);
+
+	TEST_CHECK(frameLength < (size_t) textLength);
+}
+
+int main()
+{
+	if (!STM32Host_Init())
+	{
+		return EXIT_FAILURE;
+	}
+
+	WE_Debug_Init();
+	STM32Host_StartUart(STM32Host_Uart_Debug, TEST_BAUDRATE);
+
+	TestRecordLayout();
+	TestLongRecords();
+	TestDroppedRecords();
+	Benchmark();
+
+	STM32Host_Stop();
+
+	return TEST_RESULT();
+}
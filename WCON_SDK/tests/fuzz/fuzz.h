@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief Interface of the fuzz targets (libFuzzer entry point).
+ *
+ * The targets are built either with clang and libFuzzer (make fuzz) or with any compiler
+ * and the standalone driver in fuzz_main.c, which runs the corpus and deterministic
+ * mutations of it (make check).
+ */
+
+#ifndef FUZZ_H_INCLUDED
+#define FUZZ_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Runs the target on one input (must not keep state between calls).
+ */
+extern int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/**
+ * @brief Copies the input into a null terminated buffer of exactly the required size, so
+ * that reads past the end of the line are detected by AddressSanitizer.
+ */
+static inline char* FuzzCopyLine(const uint8_t *data, size_t size)
+{
+	char *line = malloc(size + 1);
+	if (line != NULL)
+	{
+		memcpy(line, data, size);
+		line[size] = '\0';
+	}
+	return line;
+}
+
+/**
+ * @brief Aborts (reported as crash by the fuzzer), if the condition doesn't hold.
+ */
+#define FUZZ_ASSERT(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			abort(); \
+		} \
+	} while (0)
+
+#endif /* FUZZ_H_INCLUDED */
@@ -0,0 +1,238 @@
+/**
+ * \file
+ * \brief Fuzz target for the argument parsers of global/ATCommands.c.
+ *
+ * Input layout: byte 0 selects the parser, byte 1 the delimiter, byte 2 the integer flags,
+ * the remaining bytes are the arguments. The selected parser is applied repeatedly until
+ * it fails or the end of the arguments is reached. The argument pointer must never leave
+ * the input.
+ */
+
+#include "global/ATCommands.h"
+
+#include "fuzz.h"
+
+#define FUZZ_MAX_ARGUMENTS 64
+
+typedef enum FuzzParser_t
+{
+	FuzzParser_Span,
+	FuzzParser_String,
+	FuzzParser_StringWithoutQuotationMarks,
+	FuzzParser_ByteArray,
+	FuzzParser_Hex,
+	FuzzParser_Int,
+	FuzzParser_IntWithoutQuotationMarks,
+	FuzzParser_BitsWithoutQuotationMarks,
+	FuzzParser_Enum,
+	FuzzParser_EnumWithoutQuotationMarks,
+	FuzzParser_Bitmask,
+	FuzzParser_Boolean,
+	FuzzParser_Double,
+	FuzzParser_Float,
+	FuzzParser_DoubleWithoutQuotationMarks,
+	FuzzParser_FloatWithoutQuotationMarks,
+	FuzzParser_CmdName,
+	FuzzParser_CountArgs,
+	FuzzParser_NumberOfValues
+} FuzzParser_t;
+
+static const char delimiters[] = {
+		ATCOMMAND_ARGUMENT_DELIM,
+		ATCOMMAND_STRING_TERMINATE,
+		ATCOMMAND_EVENT_DELIM,
+		')',
+		' ',
+		'"' };
+
+static const char *strings[] = {
+		"none",
+		"wep",
+		"wpa",
+		"wpa2",
+		"wpa_wpa2",
+		"wpa3" };
+
+static const uint16_t sizeFlags[] = {
+		ATCOMMAND_INTFLAGS_SIZE8,
+		ATCOMMAND_INTFLAGS_SIZE16,
+		ATCOMMAND_INTFLAGS_SIZE32,
+		ATCOMMAND_INTFLAGS_SIZE64 };
+
+/**
+ * @brief Applies the parser once.
+ */
+static bool Parse(FuzzParser_t parser, const char *line, char **pos, const char *end, char delimiter, uint16_t intFlags, uint8_t option)
+{
+	/* Small output buffers, so that truncation is exercised (option selects the max. length) */
+	char string[16];
+	uint8_t bytes[16];
+	uint64_t value = 0;
+	double number;
+	float numberFloat;
+	uint8_t index;
+	uint32_t bitmask;
+	bool boolean;
+	uint16_t maxLength = (uint16_t) (1 + option % sizeof(string));
+
+	switch (parser)
+	{
+	case FuzzParser_Span:
+	{
+		ATCommand_Span_t span;
+		if (!ATCommand_GetNextArgumentSpan(pos, &span, delimiter))
+		{
+			return false;
+		}
+		FUZZ_ASSERT(span.data >= line && span.data + span.length <= end);
+		(void) ATCommand_SpanRemoveQuotationMarks(&span);
+		(void) ATCommand_SpanToString(string, span, maxLength);
+		(void) ATCommand_SpanToInt(&value, span, intFlags);
+		(void) ATCommand_SpanToDouble(&number, span);
+		(void) ATCommand_SpanToBoolean(&boolean, span);
+		return true;
+	}
+
+	case FuzzParser_String:
+		if (!ATCommand_GetNextArgumentString(pos, string, delimiter, maxLength))
+		{
+			return false;
+		}
+		FUZZ_ASSERT(strlen(string) < maxLength);
+		return true;
+
+	case FuzzParser_StringWithoutQuotationMarks:
+		if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(pos, string, delimiter, maxLength))
+		{
+			return false;
+		}
+		FUZZ_ASSERT(strlen(string) < maxLength);
+		return true;
+
+	case FuzzParser_ByteArray:
+	{
+		/* The caller has to make sure that the data is available (see documentation) */
+		uint16_t length = (uint16_t) (option % sizeof(bytes));
+		if ((size_t) (end - *pos) < length)
+		{
+			return false;
+		}
+		return ATCommand_GetNextArgumentByteArray(pos, length, bytes, sizeof(bytes));
+	}
+
+	case FuzzParser_Hex:
+	{
+		uint16_t length = 0;
+		if (!ATCommand_GetNextArgumentHex(pos, bytes, &length, maxLength, delimiter))
+		{
+			return false;
+		}
+		FUZZ_ASSERT(length <= maxLength);
+		return true;
+	}
+
+	case FuzzParser_Int:
+		return ATCommand_GetNextArgumentInt(pos, &value, intFlags, delimiter);
+
+	case FuzzParser_IntWithoutQuotationMarks:
+		return ATCommand_GetNextArgumentIntWithoutQuotationMarks(pos, &value, intFlags, delimiter);
+
+	case FuzzParser_BitsWithoutQuotationMarks:
+		return ATCommand_GetNextArgumentBitsWithoutQuotationMarks(pos, &value, intFlags, delimiter);
+
+	case FuzzParser_Enum:
+		if (!ATCommand_GetNextArgumentEnum(pos, &index, strings, sizeof(strings) / sizeof(strings[0]), maxLength, delimiter))
+		{
+			return false;
+		}
+		FUZZ_ASSERT(index < sizeof(strings) / sizeof(strings[0]));
+		return true;
+
+	case FuzzParser_EnumWithoutQuotationMarks:
+		if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(pos, &index, strings, sizeof(strings) / sizeof(strings[0]), maxLength, delimiter))
+		{
+			return false;
+		}
+		FUZZ_ASSERT(index < sizeof(strings) / sizeof(strings[0]));
+		return true;
+
+	case FuzzParser_Bitmask:
+		bitmask = 0;
+		if (!ATCommand_GetNextArgumentBitmask(pos, strings, sizeof(strings) / sizeof(strings[0]), maxLength, &bitmask, delimiter))
+		{
+			return false;
+		}
+		FUZZ_ASSERT((bitmask >> (sizeof(strings) / sizeof(strings[0]))) == 0);
+		return true;
+
+	case FuzzParser_Boolean:
+		return ATCommand_GetNextArgumentBoolean(pos, &boolean, delimiter);
+
+	case FuzzParser_Double:
+		return ATCommand_GetNextArgumentDouble(pos, &number, delimiter);
+
+	case FuzzParser_Float:
+		return ATCommand_GetNextArgumentFloat(pos, &numberFloat, delimiter);
+
+	case FuzzParser_DoubleWithoutQuotationMarks:
+		return ATCommand_GetNextArgumentDoubleWithoutQuotationMarks(pos, &number, delimiter);
+
+	case FuzzParser_FloatWithoutQuotationMarks:
+		return ATCommand_GetNextArgumentFloatWithoutQuotationMarks(pos, &numberFloat, delimiter);
+
+	case FuzzParser_CmdName:
+	{
+		char cmdDelimiters[] = {
+				delimiter,
+				ATCOMMAND_STRING_TERMINATE };
+		if (!ATCommand_GetCmdName(pos, string, maxLength, cmdDelimiters, sizeof(cmdDelimiters)))
+		{
+			return false;
+		}
+		FUZZ_ASSERT(strlen(string) < maxLength);
+		return true;
+	}
+
+	case FuzzParser_CountArgs:
+		FUZZ_ASSERT(ATCommand_CountArgs(*pos) >= 0);
+		return false;
+
+	default:
+		return false;
+	}
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	if (size < 3)
+	{
+		return 0;
+	}
+
+	FuzzParser_t parser = (FuzzParser_t) (data[0] % FuzzParser_NumberOfValues);
+	char delimiter = delimiters[data[1] % sizeof(delimiters)];
+	uint16_t intFlags = sizeFlags[data[2] % 4] | ((data[2] & 0x04) ? ATCOMMAND_INTFLAGS_SIGNED : ATCOMMAND_INTFLAGS_UNSIGNED) | ((data[2] & 0x08) ? ATCOMMAND_INTFLAGS_NOTATION_HEX : ATCOMMAND_INTFLAGS_NOTATION_DEC);
+	uint8_t option = data[2] >> 4;
+
+	char *line = FuzzCopyLine(data + 3, size - 3);
+	if (line == NULL)
+	{
+		return 0;
+	}
+	char *end = line + size - 3;
+	char *pos = line;
+
+	for (int i = 0; i < FUZZ_MAX_ARGUMENTS; i++)
+	{
+		char *before = pos;
+		bool ok = Parse(parser, line, &pos, end, delimiter, intFlags, (uint8_t) (option + i));
+		FUZZ_ASSERT(pos >= line && pos <= end);
+		if (!ok || pos == before || pos == end)
+		{
+			break;
+		}
+	}
+
+	free(line);
+	return 0;
+}
@@ -0,0 +1,175 @@
+/**
+ * \file
+ * \brief Fuzz target for the event parsers of the radio module drivers.
+ *
+ * The input is a received line. It is dispatched using the event tables of Calypso,
+ * AdrasteaI, StephanoI and DaphnisI. For Calypso, the arguments of recognized events are
+ * parsed using the corresponding Calypso_ATEvent_Parse*() function. For DaphnisI, the
+ * arguments of +RXDATA events are parsed using DaphnisI_ATEvent_ParseRxData() into a
+ * buffer of DAPHNISI_MAX_PAYLOAD_SIZE bytes.
+ */
+
+#include "Calypso/ATCommands/ATEvent.h"
+#include "AdrasteaI/ATCommands/ATEvent.h"
+#include "StephanoI/ATCommands/ATEvent.h"
+#include "DaphnisI/Commands/ATEvent.h"
+
+#include "fuzz.h"
+
+/**
+ * @brief Parses the arguments of a Calypso event.
+ */
+static void ParseCalypsoArguments(Calypso_ATEvent_t event, char **pArguments, bool decodeBase64)
+{
+	/* Large event structs (receive buffers) are kept static */
+	static Calypso_ATEvent_SocketRcvd_t rcvd;
+	static Calypso_ATEvent_MQTTRcvd_t mqttRcvd;
+	char id[16];
+	char value[16];
+
+	switch (event)
+	{
+	case Calypso_ATEvent_Startup:
+	{
+		Calypso_ATEvent_Startup_t startup;
+		Calypso_ATEvent_ParseStartUpEvent(pArguments, &startup);
+		break;
+	}
+
+	case Calypso_ATEvent_Ping:
+	{
+		Calypso_ATEvent_Ping_t ping;
+		Calypso_ATEvent_ParsePingEvent(pArguments, &ping);
+		break;
+	}
+
+	case Calypso_ATEvent_SocketTCPConnect:
+	{
+		Calypso_ATEvent_SocketTCPConnect_t connect;
+		Calypso_ATEvent_ParseSocketTCPConnectEvent(pArguments, &connect);
+		break;
+	}
+
+	case Calypso_ATEvent_SocketTCPAccept:
+	{
+		Calypso_ATEvent_SocketTCPAccept_t accept;
+		Calypso_ATEvent_ParseSocketTCPAcceptEvent(pArguments, &accept);
+		break;
+	}
+
+	case Calypso_ATEvent_SocketTxFailed:
+	{
+		Calypso_ATEvent_SocketTXFailed_t txFailed;
+		Calypso_ATEvent_ParseSocketTXFailedEvent(pArguments, &txFailed);
+		break;
+	}
+
+	case Calypso_ATEvent_SocketRcvd:
+		Calypso_ATEvent_ParseSocketRcvdEvent(pArguments, decodeBase64, &rcvd);
+		break;
+
+	case Calypso_ATEvent_NetappIP4Acquired:
+	{
+		Calypso_ATEvent_NetappIP4Acquired_t ip4Acquired;
+		Calypso_ATEvent_ParseNetappIP4AcquiredEvent(pArguments, &ip4Acquired);
+		break;
+	}
+
+	case Calypso_ATEvent_MQTTRecv:
+		Calypso_ATEvent_ParseSocketMQTTRcvdEvent(pArguments, &mqttRcvd);
+		break;
+
+	case Calypso_ATEvent_MQTTConnack:
+	{
+		Calypso_ATEvent_MQTTConnack_t connack;
+		Calypso_ATEvent_ParseMQTTConnackEvent(pArguments, &connack);
+		break;
+	}
+
+	case Calypso_ATEvent_FileListEntry:
+	{
+		Calypso_ATFile_FileListEntry_t entry;
+		Calypso_ATEvent_ParseFileListEntryEvent(pArguments, &entry);
+		break;
+	}
+
+	case Calypso_ATEvent_HTTPGet:
+		Calypso_ATEvent_ParseHttpGetEvent(pArguments, id, sizeof(id));
+		break;
+
+	case Calypso_ATEvent_CustomGPIO:
+	{
+		uint8_t gpioId;
+		Calypso_ATEvent_ParseCustomGPIOEvent(pArguments, &gpioId);
+		break;
+	}
+
+	case Calypso_ATEvent_CustomHTTPPost:
+		Calypso_ATEvent_ParseCustomHTTPPostEvent(pArguments, id, value, sizeof(id), sizeof(value));
+		break;
+
+	default:
+		break;
+	}
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	char *line = FuzzCopyLine(data, size);
+	if (line == NULL)
+	{
+		return 0;
+	}
+	char *pos = line;
+
+	Calypso_ATEvent_t calypsoEvent;
+	if (Calypso_ATEvent_ParseEventType(&pos, &calypsoEvent))
+	{
+		FUZZ_ASSERT(calypsoEvent > Calypso_ATEvent_Invalid && calypsoEvent < Calypso_ATEvent_NumberOfValues);
+		FUZZ_ASSERT(pos >= line && pos <= line + size);
+		ParseCalypsoArguments(calypsoEvent, &pos, (size % 2) != 0);
+		FUZZ_ASSERT(pos >= line && pos <= line + size);
+	}
+
+	/* The parsers modify the line, so each module gets a fresh copy */
+	memcpy(line, data, size);
+	pos = line;
+	AdrasteaI_ATEvent_t adrasteaEvent;
+	if (AdrasteaI_ATEvent_ParseEventType(&pos, &adrasteaEvent))
+	{
+		FUZZ_ASSERT(adrasteaEvent < AdrasteaI_ATEvent_NumberOfValues);
+		FUZZ_ASSERT(pos >= line && pos <= line + size);
+	}
+
+	memcpy(line, data, size);
+	pos = line;
+	StephanoI_ATEvent_t stephanoEvent;
+	if (StephanoI_ATEvent_ParseEventType(&pos, &stephanoEvent))
+	{
+		FUZZ_ASSERT(stephanoEvent < StephanoI_ATEvent_NumberOfValues);
+		FUZZ_ASSERT(pos >= line && pos <= line + size);
+	}
+
+	memcpy(line, data, size);
+	pos = line;
+	DaphnisI_ATEvent_t daphnisEvent;
+	if (DaphnisI_ATEvent_ParseEventType(&pos, &daphnisEvent))
+	{
+		FUZZ_ASSERT(daphnisEvent > DaphnisI_ATEvent_Invalid && daphnisEvent < DaphnisI_ATEvent_NumberOfValues);
+		FUZZ_ASSERT(pos >= line && pos <= line + size);
+		if (daphnisEvent == DaphnisI_ATEvent_RxData)
+		{
+			static uint8_t payload[DAPHNISI_MAX_PAYLOAD_SIZE];
+			DaphnisI_RxData_t rxData = {
+					.data = payload };
+			if (DaphnisI_ATEvent_ParseRxData(&pos, &rxData))
+			{
+				FUZZ_ASSERT(rxData.dataLength <= DAPHNISI_MAX_PAYLOAD_SIZE);
+			}
+			FUZZ_ASSERT(pos >= line && pos <= line + size);
+		}
+	}
+
+	free(line);
+	return 0;
+}
@@ -0,0 +1,227 @@
+/**
+ * \file
+ * \brief Standalone driver for the fuzz targets (used, if libFuzzer is not available).
+ *
+ * Usage: fuzz_target [-n mutations] corpus_file_or_directory...
+ *
+ * Runs the target on every corpus file and afterwards on the given number of mutations of
+ * the corpus files (bit flips, inserted/removed bytes, delimiters, splices). The mutations
+ * are deterministic, so that failures can be reproduced. Crashes are detected by building
+ * the target with AddressSanitizer and UndefinedBehaviorSanitizer.
+ */
+
+#include "fuzz.h"
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#define FUZZ_MAX_INPUTS 1024
+#define FUZZ_MAX_INPUT_SIZE 4096
+
+typedef struct FuzzInput_t
+{
+	uint8_t *data;
+	size_t size;
+} FuzzInput_t;
+
+static FuzzInput_t inputs[FUZZ_MAX_INPUTS];
+static size_t inputCount = 0;
+
+static uint64_t randomState = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t Random()
+{
+	randomState ^= randomState >> 12;
+	randomState ^= randomState << 25;
+	randomState ^= randomState >> 27;
+	return randomState * 0x2545F4914F6CDD1DULL;
+}
+
+static bool LoadFile(const char *path)
+{
+	FILE *file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "cannot open %s\n", path);
+		return false;
+	}
+	uint8_t buffer[FUZZ_MAX_INPUT_SIZE];
+	size_t size = fread(buffer, 1, sizeof(buffer), file);
+	fclose(file);
+
+	if (inputCount < FUZZ_MAX_INPUTS)
+	{
+		inputs[inputCount].data = malloc(size + 1);
+		memcpy(inputs[inputCount].data, buffer, size);
+		inputs[inputCount].size = size;
+		inputCount++;
+	}
+	return true;
+}
+
+static bool Load(const char *path)
+{
+	struct stat info;
+	if (stat(path, &info) != 0)
+	{
+		fprintf(stderr, "cannot open %s\n", path);
+		return false;
+	}
+	if (!S_ISDIR(info.st_mode))
+	{
+		return LoadFile(path);
+	}
+
+	struct dirent **entries;
+	int count = scandir(path, &entries, NULL, alphasort);
+	if (count < 0)
+	{
+		return false;
+	}
+	bool ok = true;
+	for (int i = 0; i < count; i++)
+	{
+		if (entries[i]->d_name[0] != '.')
+		{
+			char file[1024];
+			snprintf(file, sizeof(file), "%s/%s", path, entries[i]->d_name);
+			ok = LoadFile(file) && ok;
+		}
+		free(entries[i]);
+	}
+	free(entries);
+	return ok;
+}
+
+/**
+ * @brief Creates a mutation of a random corpus input.
+ */
+static size_t Mutate(uint8_t *out)
+{
+	static const uint8_t interesting[] = {
+			',',
+			':',
+			'"',
+			'(',
+			')',
+			'\0',
+			'\r',
+			'\n',
+			'-',
+			'.',
+			'e',
+			'0',
+			'9',
+			'x',
+			' ',
+			0xFF };
+
+	const FuzzInput_t *input = &inputs[Random() % inputCount];
+	size_t size = input->size;
+	memcpy(out, input->data, size);
+
+	int count = 1 + (int) (Random() % 4);
+	for (int i = 0; i < count; i++)
+	{
+		size_t pos = size > 0 ? Random() % size : 0;
+		switch (Random() % 6)
+		{
+		case 0:
+			/* Flip a bit */
+			if (size > 0)
+			{
+				out[pos] ^= (uint8_t) (1 << (Random() % 8));
+			}
+			break;
+
+		case 1:
+			/* Replace by a delimiter or another interesting character */
+			if (size > 0)
+			{
+				out[pos] = interesting[Random() % sizeof(interesting)];
+			}
+			break;
+
+		case 2:
+			/* Insert a character */
+			if (size < FUZZ_MAX_INPUT_SIZE)
+			{
+				memmove(&out[pos + 1], &out[pos], size - pos);
+				out[pos] = (Random() % 2) ? interesting[Random() % sizeof(interesting)] : (uint8_t) Random();
+				size++;
+			}
+			break;
+
+		case 3:
+			/* Remove a range */
+			if (size > 0)
+			{
+				size_t length = 1 + Random() % (size - pos);
+				memmove(&out[pos], &out[pos + length], size - pos - length);
+				size -= length;
+			}
+			break;
+
+		case 4:
+			/* Truncate */
+			size = pos;
+			break;
+
+		default:
+		{
+			/* Splice with the tail of another input */
+			const FuzzInput_t *other = &inputs[Random() % inputCount];
+			size_t otherPos = other->size > 0 ? Random() % other->size : 0;
+			size_t length = other->size - otherPos;
+			if (pos + length > FUZZ_MAX_INPUT_SIZE)
+			{
+				length = FUZZ_MAX_INPUT_SIZE - pos;
+			}
+			memcpy(&out[pos], &other->data[otherPos], length);
+			size = pos + length;
+			break;
+		}
+		}
+	}
+	return size;
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned long mutations = 0;
+	bool ok = true;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+		{
+			mutations = strtoul(argv[++i], NULL, 10);
+		}
+		else
+		{
+			ok = Load(argv[i]) && ok;
+		}
+	}
+	if (!ok || inputCount == 0)
+	{
+		fprintf(stderr, "usage: %s [-n mutations] corpus_file_or_directory...\n", argv[0]);
+		return 1;
+	}
+
+	for (size_t i = 0; i < inputCount; i++)
+	{
+		LLVMFuzzerTestOneInput(inputs[i].data, inputs[i].size);
+	}
+
+	static uint8_t buffer[FUZZ_MAX_INPUT_SIZE + 1];
+	for (unsigned long i = 0; i < mutations; i++)
+	{
+		size_t size = Mutate(buffer);
+		LLVMFuzzerTestOneInput(buffer, size);
+	}
+
+	printf("%s: %zu corpus inputs, %lu mutations passed\n", argv[0], inputCount, mutations);
+	return 0;
+}
@@ -0,0 +1,219 @@
+/**
+ * \file
+ * \brief Tests the Linux host implementation of the platform layer (global_Linux.c).
+ */
+
+#include "global/global.h"
+
+#include "test.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+static uint8_t rxData[256];
+static volatile size_t rxLength = 0;
+static volatile uint32_t rxTimestamp = 0;
+static volatile uint32_t txCompleteCount = 0;
+
+static WE_Pin_t changedPin;
+static WE_Pin_Level_t changedLevel;
+static int pinChangedCount = 0;
+
+static void RxHandler(uint8_t *data, size_t length)
+{
+	for (size_t i = 0; i < length && rxLength < sizeof(rxData); i++)
+	{
+		rxData[rxLength] = data[i];
+		rxLength++;
+	}
+	rxTimestamp = WE_UART_GetRxTimestamp();
+}
+
+static WE_UART_HandleRxByte_t rxHandler = RxHandler;
+
+static void OnTxComplete()
+{
+	txCompleteCount++;
+}
+
+static void OnPinChanged(WE_Pin_t pin, WE_Pin_Level_t level)
+{
+	changedPin = pin;
+	changedLevel = level;
+	pinChangedCount++;
+}
+
+/**
+ * @brief Reads the supplied number of bytes from the other end of the UART's socket pair.
+ */
+static bool ReadPeer(int fd, uint8_t *buffer, size_t length)
+{
+	size_t received = 0;
+	while (received < length)
+	{
+		ssize_t n = read(fd, buffer + received, length - received);
+		if (n <= 0)
+		{
+			return false;
+		}
+		received += (size_t) n;
+	}
+	return true;
+}
+
+/**
+ * @brief Waits until the supplied number of bytes has been passed to the rx byte handler.
+ */
+static bool WaitForRx(size_t length)
+{
+	for (int i = 0; i < 1000 && rxLength < length; i++)
+	{
+		WE_Delay(1);
+	}
+	return rxLength == length;
+}
+
+static void TestUart()
+{
+	TEST_CHECK(WE_UART1_Init(115200, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+	WE_UART1_SetTxCompleteCallback(OnTxComplete);
+	int fd = WE_UART_GetPeerFd(WE_UART_Instance_1);
+	TEST_CHECK(fd >= 0);
+
+	uint8_t buffer[64];
+
+	/* Transmit */
+	TEST_CHECK(WE_UART1_Transmit((const uint8_t*) "AT+test\r\n", 9));
+	TEST_CHECK(ReadPeer(fd, buffer, 9) && memcmp(buffer, "AT+test\r\n", 9) == 0);
+
+	/* Asynchronous transmit */
+	TEST_CHECK(WE_UART1_TransmitAsync((const uint8_t*) "async", 5));
+	TEST_CHECK(WE_UART1_WaitForTxIdle(1000));
+	TEST_CHECK(txCompleteCount >= 1);
+	TEST_CHECK(ReadPeer(fd, buffer, 5) && memcmp(buffer, "async", 5) == 0);
+
+	/* Scatter-gather transmit (empty segments are skipped) */
+	WE_UART_Segment_t segments[] = {
+			{
+					.data = (const uint8_t*) "AT+send=",
+					.length = 8 },
+			{
+					.data = NULL,
+					.length = 0 },
+			{
+					.data = (const uint8_t*) "1,2\r\n",
+					.length = 5 } };
+	TEST_CHECK(WE_UART1_TransmitV(segments, 3));
+	TEST_CHECK(ReadPeer(fd, buffer, 13) && memcmp(buffer, "AT+send=1,2\r\n", 13) == 0);
+
+	/* Invalid arguments */
+	TEST_CHECK(!WE_UART1_Transmit(NULL, 1));
+	WE_UART_Segment_t invalid = {
+			.data = NULL,
+			.length = 1 };
+	TEST_CHECK(!WE_UART1_TransmitV(&invalid, 1));
+
+	/* Receive (data is passed to the handler by the receive thread, including its timestamp) */
+	uint32_t before = WE_GetTickMicroseconds();
+	TEST_CHECK(write(fd, "+eventstartup\r\n", 15) == 15);
+	TEST_CHECK(WaitForRx(15));
+	TEST_CHECK(memcmp(rxData, "+eventstartup\r\n", 15) == 0);
+	TEST_CHECK(rxTimestamp >= before && rxTimestamp <= WE_GetTickMicroseconds());
+
+	WE_UART_Statistics_t statistics;
+	TEST_CHECK(WE_UART_GetStatistics(WE_UART_Instance_1, &statistics));
+	TEST_CHECK(!WE_UART_GetStatistics(WE_UART_Instance_Count, &statistics));
+
+	TEST_CHECK(WE_UART1_DeInit());
+	TEST_CHECK(WE_UART_GetPeerFd(WE_UART_Instance_1) < 0);
+}
+
+static void TestSerialDevice()
+{
+	/* Pseudo terminal as serial device */
+	int master = posix_openpt(O_RDWR | O_NOCTTY);
+	TEST_CHECK(master >= 0 && grantpt(master) == 0 && unlockpt(master) == 0);
+	if (master < 0)
+	{
+		return;
+	}
+	TEST_CHECK(WE_UART_SetDevice(WE_UART_Instance_2, ptsname(master)));
+	TEST_CHECK(WE_UART2_Init(115200, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+
+	/* Waiting for the transmitter to become idle returns within the timeout */
+	uint8_t buffer[16];
+	TEST_CHECK(WE_UART2_Transmit((const uint8_t*) "AT\r\n", 4));
+	uint32_t start = WE_GetTick();
+	TEST_CHECK(WE_UART2_WaitForTxIdle(100));
+	TEST_CHECK(WE_UART2_WaitForTxIdle(0));
+	TEST_CHECK(WE_GetTick() - start < 100);
+	TEST_CHECK(ReadPeer(master, buffer, 4) && memcmp(buffer, "AT\r\n", 4) == 0);
+
+	TEST_CHECK(WE_UART2_DeInit());
+	TEST_CHECK(WE_UART_SetDevice(WE_UART_Instance_2, NULL));
+	close(master);
+}
+
+static void TestPins()
+{
+	WE_Pin_t pins[] = {
+			{
+					.port = GPIOA,
+					.pin = GPIO_PIN_0,
+					.type = WE_Pin_Type_Output },
+			{
+					.port = GPIOB,
+					.pin = GPIO_PIN_5,
+					.type = WE_Pin_Type_Input },
+			{
+					.port = NULL,
+					.pin = 0,
+					.type = WE_Pin_Type_Output } };
+	TEST_CHECK(WE_InitPins(pins, 3));
+	WE_SetPinChangedCallback(OnPinChanged);
+
+	/* Output pins are initialized low and report changes to the simulated module */
+	TEST_CHECK(WE_GetPinLevel(pins[0]) == WE_Pin_Level_Low);
+	TEST_CHECK(WE_SetPin(pins[0], WE_Pin_Level_High));
+	TEST_CHECK(WE_GetPinLevel(pins[0]) == WE_Pin_Level_High);
+	TEST_CHECK(pinChangedCount == 1 && changedPin.pin == GPIO_PIN_0 && changedLevel == WE_Pin_Level_High);
+
+	/* Input pins are set by the simulated module and can't be set by the driver */
+	TEST_CHECK(!WE_SetPin(pins[1], WE_Pin_Level_High));
+	TEST_CHECK(WE_SetSimulatedPinLevel(pins[1], WE_Pin_Level_High));
+	TEST_CHECK(WE_GetPinLevel(pins[1]) == WE_Pin_Level_High);
+	TEST_CHECK(pinChangedCount == 1);
+
+	TEST_CHECK(!WE_SetPin(pins[2], WE_Pin_Level_High));
+	TEST_CHECK(WE_DeinitPin(pins[0]));
+	TEST_CHECK(WE_GetPinLevel(pins[0]) == WE_Pin_Level_Low);
+	WE_SetPinChangedCallback(NULL);
+}
+
+static void TestTiming()
+{
+	uint32_t tick = WE_GetTick();
+	uint32_t tickUs = WE_GetTickMicroseconds();
+	WE_Delay(20);
+	uint32_t elapsedMs = WE_GetTick() - tick;
+	uint32_t elapsedUs = WE_GetTickMicroseconds() - tickUs;
+	TEST_CHECK_MSG(elapsedMs >= 20 && elapsedMs < 200, "%u ms", elapsedMs);
+	TEST_CHECK_MSG(elapsedUs >= 20000 && elapsedUs < 200000, "%u us", elapsedUs);
+
+	uint32_t state = WE_EnterCriticalSection();
+	uint32_t nested = WE_EnterCriticalSection();
+	WE_ExitCriticalSection(nested);
+	WE_ExitCriticalSection(state);
+}
+
+int main()
+{
+	WE_Platform_Init();
+
+	TestUart();
+	TestSerialDevice();
+	TestPins();
+	TestTiming();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,144 @@
+/**
+ * \file
+ * \brief Simulated Calypso module (see calypso_sim.h).
+ */
+
+#include "calypso_sim.h"
+
+#include "global/global.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * @brief Max. length of a command line stored by the simulated module (longer lines are truncated).
+ */
+#define CALYPSO_SIM_MAX_LINE_LENGTH 2048
+
+static Calypso_Pins_t CalypsoSim_pins;
+static WE_UART_t CalypsoSim_uart;
+static int CalypsoSim_fd = -1;
+static pthread_t CalypsoSim_thread;
+static pthread_mutex_t CalypsoSim_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static volatile uint32_t CalypsoSim_responseDelayUsec = 0;
+static volatile uint32_t CalypsoSim_commandCount = 0;
+static char CalypsoSim_lastCommand[CALYPSO_SIM_MAX_LINE_LENGTH];
+
+static void* CalypsoSim_Thread(void *arg)
+{
+	(void) arg;
+	static char line[CALYPSO_SIM_MAX_LINE_LENGTH];
+	size_t lineLength = 0;
+	bool lastWasCr = false;
+	uint8_t buffer[4096];
+
+	while (true)
+	{
+		ssize_t n = read(CalypsoSim_fd, buffer, sizeof(buffer));
+		if (n <= 0)
+		{
+			return NULL;
+		}
+
+		for (ssize_t i = 0; i < n; i++)
+		{
+			char c = (char) buffer[i];
+			if (lastWasCr && c == '\n')
+			{
+				pthread_mutex_lock(&CalypsoSim_mutex);
+				memcpy(CalypsoSim_lastCommand, line, lineLength);
+				CalypsoSim_lastCommand[lineLength] = '\0';
+				CalypsoSim_commandCount++;
+				pthread_mutex_unlock(&CalypsoSim_mutex);
+				lineLength = 0;
+				lastWasCr = false;
+
+				if (CalypsoSim_responseDelayUsec > 0)
+				{
+					WE_DelayMicroseconds(CalypsoSim_responseDelayUsec);
+				}
+				CalypsoSim_Send("OK\r\n", 4);
+				continue;
+			}
+			if (lastWasCr && lineLength < sizeof(line) - 1)
+			{
+				line[lineLength++] = '\r';
+			}
+			lastWasCr = (c == '\r');
+			if (!lastWasCr && lineLength < sizeof(line) - 1)
+			{
+				line[lineLength++] = c;
+			}
+		}
+	}
+}
+
+bool CalypsoSim_Init(Calypso_EventCallback_t eventCallback)
+{
+	WE_Platform_Init();
+
+	WE_Pin_t *pins = (WE_Pin_t*) &CalypsoSim_pins;
+	for (size_t i = 0; i < sizeof(CalypsoSim_pins) / sizeof(WE_Pin_t); i++)
+	{
+		pins[i].port = GPIOA;
+		pins[i].pin = (uint32_t) 1 << i;
+	}
+
+	CalypsoSim_uart.baudrate = 921600;
+	CalypsoSim_uart.flowControl = WE_FlowControl_NoFlowControl;
+	CalypsoSim_uart.parity = WE_Parity_None;
+	CalypsoSim_uart.uartInit = WE_UART1_Init;
+	CalypsoSim_uart.uartDeinit = WE_UART1_DeInit;
+	CalypsoSim_uart.uartTransmit = WE_UART1_Transmit;
+	CalypsoSim_uart.uartTransmitAsync = WE_UART1_TransmitAsync;
+	CalypsoSim_uart.uartSetTxCompleteCallback = WE_UART1_SetTxCompleteCallback;
+	CalypsoSim_uart.uartWaitForTxIdle = WE_UART1_WaitForTxIdle;
+	CalypsoSim_uart.uartTransmitV = WE_UART1_TransmitV;
+
+	if (!Calypso_Init(&CalypsoSim_uart, &CalypsoSim_pins, eventCallback))
+	{
+		return false;
+	}
+
+	CalypsoSim_fd = WE_UART_GetPeerFd(WE_UART_Instance_1);
+	if (CalypsoSim_fd < 0)
+	{
+		return false;
+	}
+	return pthread_create(&CalypsoSim_thread, NULL, CalypsoSim_Thread, NULL) == 0;
+}
+
+void CalypsoSim_SetResponseDelay(uint32_t delayUsec)
+{
+	CalypsoSim_responseDelayUsec = delayUsec;
+}
+
+uint32_t CalypsoSim_GetCommandCount(void)
+{
+	return CalypsoSim_commandCount;
+}
+
+void CalypsoSim_GetLastCommand(char *buffer, size_t size)
+{
+	pthread_mutex_lock(&CalypsoSim_mutex);
+	snprintf(buffer, size, "%s", CalypsoSim_lastCommand);
+	pthread_mutex_unlock(&CalypsoSim_mutex);
+}
+
+bool CalypsoSim_Send(const char *data, size_t length)
+{
+	while (length > 0)
+	{
+		ssize_t n = write(CalypsoSim_fd, data, length);
+		if (n <= 0)
+		{
+			return false;
+		}
+		data += n;
+		length -= (size_t) n;
+	}
+	return true;
+}
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief Simulated Calypso module connected to the Calypso driver via the socket pair UART of global_Linux.c.
+ *
+ * Every command line received from the driver is answered with "OK\r\n" (optionally after a delay).
+ */
+
+#ifndef CALYPSO_SIM_H_INCLUDED
+#define CALYPSO_SIM_H_INCLUDED
+
+#include "Calypso/Calypso.h"
+
+/**
+ * @brief Initializes the Calypso driver (using WE_UART_Instance_1) and starts the simulated module.
+ *
+ * @param[in] eventCallback Event callback passed to Calypso_Init() (optional)
+ *
+ * @return true if successful, false otherwise
+ */
+extern bool CalypsoSim_Init(Calypso_EventCallback_t eventCallback);
+
+/**
+ * @brief Sets the time the simulated module takes before responding to a command.
+ *
+ * @param[in] delayUsec Response delay in microseconds
+ */
+extern void CalypsoSim_SetResponseDelay(uint32_t delayUsec);
+
+/**
+ * @brief Returns the number of command lines received by the simulated module.
+ */
+extern uint32_t CalypsoSim_GetCommandCount(void);
+
+/**
+ * @brief Copies the last command line received by the simulated module (without line ending).
+ *
+ * @param[out] buffer Buffer receiving the command
+ * @param[in] size Size of buffer
+ */
+extern void CalypsoSim_GetLastCommand(char *buffer, size_t size);
+
+/**
+ * @brief Sends data (e.g. an event line) from the simulated module to the driver.
+ *
+ * @param[in] data Data to be sent
+ * @param[in] length Number of bytes to be sent
+ *
+ * @return true if successful, false otherwise
+ */
+extern bool CalypsoSim_Send(const char *data, size_t length);
+
+#endif /* CALYPSO_SIM_H_INCLUDED */
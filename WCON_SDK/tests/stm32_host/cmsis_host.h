@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief Replaces the CMSIS core intrinsics (cmsis_gcc.h) when building the STM32 platform files on a host PC.
+ *
+ * Is force-included (-include) before any other header. Defining the include guard of
+ * cmsis_gcc.h makes the CMSIS headers use the definitions below instead of the Cortex-M
+ * inline assembly. Interrupt masking (PRIMASK) is emulated using a lock that is also held
+ * by the simulated peripherals while executing an interrupt handler (see stm32_host.c).
+ */
+
+#ifndef CMSIS_HOST_H_INCLUDED
+#define CMSIS_HOST_H_INCLUDED
+
+#define __CMSIS_GCC_H
+
+#include <stdint.h>
+
+#define __ASM                                  __asm
+#define __INLINE                               inline
+#define __STATIC_INLINE                        static inline
+#define __STATIC_FORCEINLINE                   static inline
+#define __NO_RETURN                            __attribute__((__noreturn__))
+#define __USED                                 __attribute__((used))
+#define __WEAK                                 __attribute__((weak))
+#define __PACKED                               __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT                        struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION                         union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)                           __attribute__((aligned(x)))
+#define __RESTRICT                             __restrict
+#define __COMPILER_BARRIER()                   __asm volatile("" ::: "memory")
+
+#define __NOP()                                __asm volatile("" ::: "memory")
+#define __WFI()                                __asm volatile("" ::: "memory")
+#define __WFE()                                __asm volatile("" ::: "memory")
+#define __SEV()                                __asm volatile("" ::: "memory")
+#define __BKPT(value)                          __builtin_trap()
+#define __CLZ(value)                           ((uint8_t) ((value) == 0U ? 32U : __builtin_clz(value)))
+
+#define __ISB()                                __sync_synchronize()
+#define __DSB()                                __sync_synchronize()
+#define __DMB()                                __sync_synchronize()
+
+static inline uint32_t __RBIT(uint32_t value)
+{
+	uint32_t result = 0;
+	for (int i = 0; i < 32; i++)
+	{
+		result = (result << 1) | (value & 1U);
+		value >>= 1;
+	}
+	return result;
+}
+
+#define __REV(value)                           __builtin_bswap32(value)
+
+extern uint32_t __get_PRIMASK(void);
+extern void __set_PRIMASK(uint32_t priMask);
+extern void __enable_irq(void);
+extern void __disable_irq(void);
+extern uint32_t __LDREXW(volatile uint32_t *addr);
+extern uint32_t __STREXW(uint32_t value, volatile uint32_t *addr);
+
+#endif /* CMSIS_HOST_H_INCLUDED */
@@ -0,0 +1,599 @@
+/**
+ * \file
+ * \brief Stand-in for the STM32 peripherals (memory mapping, interrupt masking, HAL functions).
+ */
+
+#include "stm32_host.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+/**
+ * @brief Simulated SRAM (see STM32Host_SramAlloc()).
+ */
+#define STM32HOST_SRAM_ADDRESS 0x20000000UL
+#define STM32HOST_SRAM_SIZE 0x20000UL
+
+/**
+ * @brief Max. number of transmitted bytes recorded per UART (see STM32Host_GetTransmittedData()).
+ */
+#define STM32HOST_TX_CAPTURE_SIZE 0x10000
+
+/**
+ * @brief Max. number of distinct DMA interrupt status registers.
+ */
+#define STM32HOST_MAX_DMA_ISR (STM32Host_Uart_Count + STM32Host_RxUart_Count)
+
+/**
+ * @brief Cortex-M interrupt control and state register (PendSV is set pending by writing PENDSVSET).
+ */
+#define STM32HOST_SCB_ICSR ((volatile uint32_t*) 0xE000ED04UL)
+#define STM32HOST_SCB_ICSR_PENDSVSET (1UL << 28)
+
+/* PendSV handler is optional, as it is not linked into every test */
+extern void PendSV_Handler() __attribute__((weak));
+
+/**
+ * @brief Lock emulating PRIMASK. Is held by a thread while it has disabled interrupts and
+ * by the simulation thread while executing an interrupt handler.
+ */
+static pthread_mutex_t STM32Host_irqLock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static __thread uint32_t STM32Host_primask = 0;
+
+static size_t STM32Host_sramUsed = 0;
+
+/**
+ * @brief State of a simulated UART transmitter.
+ */
+typedef struct STM32Host_UartState_t
+{
+	volatile bool enabled;
+	uint64_t byteTimeNs;
+
+	/* Status register value as seen by the simulated hardware (used for emulating the
+	 * clear-by-writing semantics of the status registers) */
+	uint32_t status;
+
+	volatile bool dmaActive;
+	uint32_t dmaAddress;
+	uint32_t dmaRemaining;
+	uint64_t nextFetchNs;
+	uint64_t shiftOutDoneNs;
+	volatile bool shiftOutPending;
+
+	uint8_t txCapture[STM32HOST_TX_CAPTURE_SIZE];
+	volatile size_t txCaptureLength;
+} STM32Host_UartState_t;
+
+static STM32Host_UartState_t STM32Host_uarts[STM32Host_Uart_Count];
+
+/**
+ * @brief State of a simulated UART receiver's DMA channel/stream.
+ */
+typedef struct STM32Host_RxState_t
+{
+	bool dmaActive;
+	uint32_t dmaLength; /* Number of data to be reloaded in circular / double buffer mode */
+	uint32_t dmaNdtr; /* Last value of the number of data register written by the simulated DMA */
+	uint32_t dmaM0ar;
+} STM32Host_RxState_t;
+
+static STM32Host_RxState_t STM32Host_rxStates[STM32Host_RxUart_Count];
+
+/**
+ * @brief Total time spent executing interrupt handlers (see STM32Host_GetIrqTimeNs()).
+ */
+static volatile uint64_t STM32Host_irqTimeNs = 0;
+
+/**
+ * @brief DMA interrupt status register values as seen by the simulated hardware
+ * (the flags of several channels/streams may be located in the same register).
+ */
+static struct
+{
+	volatile uint32_t *isr;
+	uint32_t value;
+} STM32Host_dmaIsrs[STM32HOST_MAX_DMA_ISR];
+
+static pthread_t STM32Host_thread;
+static volatile bool STM32Host_running = false;
+static uint64_t STM32Host_startTimeNs = 0;
+
+static uint64_t STM32Host_GetMonotonicNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static uint64_t STM32Host_GetTimeNs(void)
+{
+	return STM32Host_GetMonotonicNs() - STM32Host_startTimeNs;
+}
+
+static uint32_t* STM32Host_GetDmaIsr(volatile uint32_t *isr)
+{
+	for (size_t i = 0; i < STM32HOST_MAX_DMA_ISR; i++)
+	{
+		if (STM32Host_dmaIsrs[i].isr == isr || STM32Host_dmaIsrs[i].isr == NULL)
+		{
+			STM32Host_dmaIsrs[i].isr = isr;
+			return &STM32Host_dmaIsrs[i].value;
+		}
+	}
+	return NULL;
+}
+
+static void STM32Host_ResetPeripherals(void)
+{
+	memset(STM32Host_dmaIsrs, 0, sizeof(STM32Host_dmaIsrs));
+	for (size_t i = 0; i < STM32Host_Uart_Count; i++)
+	{
+		const STM32Host_UartConfig_t *config = &STM32Host_UartConfigs[i];
+		STM32Host_uarts[i].status = config->uartStatusResetValue;
+		*config->uartStatus = config->uartStatusResetValue;
+		*STM32Host_GetDmaIsr(config->dmaIsr) = 0;
+	}
+}
+
+bool STM32Host_Init(void)
+{
+	for (size_t i = 0; i < STM32Host_MemoryRegionCount; i++)
+	{
+		void *p = mmap((void*) STM32Host_MemoryRegions[i].address, STM32Host_MemoryRegions[i].size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+		if (p != (void*) STM32Host_MemoryRegions[i].address)
+		{
+			fprintf(stderr, "Failed to map peripheral region at 0x%08lx\n", (unsigned long) STM32Host_MemoryRegions[i].address);
+			return false;
+		}
+	}
+
+	void *sram = mmap((void*) STM32HOST_SRAM_ADDRESS, STM32HOST_SRAM_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+	if (sram != (void*) STM32HOST_SRAM_ADDRESS)
+	{
+		fprintf(stderr, "Failed to map SRAM at 0x%08lx\n", STM32HOST_SRAM_ADDRESS);
+		return false;
+	}
+
+	STM32Host_startTimeNs = STM32Host_GetMonotonicNs();
+	STM32Host_ResetPeripherals();
+	return true;
+}
+
+void* STM32Host_SramAlloc(size_t size)
+{
+	size = (size + 7) & ~(size_t) 7;
+	if (STM32Host_sramUsed + size > STM32HOST_SRAM_SIZE)
+	{
+		return NULL;
+	}
+	void *p = (void*) (STM32HOST_SRAM_ADDRESS + STM32Host_sramUsed);
+	STM32Host_sramUsed += size;
+	return p;
+}
+
+/**
+ * @brief Executes an interrupt handler, followed by the PendSV handler if it has been set pending.
+ */
+static void STM32Host_RaiseIrq(void (*handler)(void))
+{
+	if (handler == NULL)
+	{
+		return;
+	}
+	pthread_mutex_lock(&STM32Host_irqLock);
+	uint64_t startNs = STM32Host_GetMonotonicNs();
+	handler();
+	if ((*STM32HOST_SCB_ICSR & STM32HOST_SCB_ICSR_PENDSVSET) && (PendSV_Handler != NULL))
+	{
+		*STM32HOST_SCB_ICSR &= ~STM32HOST_SCB_ICSR_PENDSVSET;
+		PendSV_Handler();
+	}
+	STM32Host_irqTimeNs += STM32Host_GetMonotonicNs() - startNs;
+	pthread_mutex_unlock(&STM32Host_irqLock);
+}
+
+/**
+ * @brief Applies the DMA interrupt flag clear register writes done by the software since the last call.
+ */
+static void STM32Host_SyncDmaFlags(volatile uint32_t *isr, volatile uint32_t *ifcr)
+{
+	uint32_t *dmaIsr = STM32Host_GetDmaIsr(isr);
+	uint32_t clear = *ifcr;
+	if (clear != 0)
+	{
+		*ifcr = 0;
+		*dmaIsr &= ~clear;
+	}
+	*isr = *dmaIsr;
+}
+
+/**
+ * @brief Sets DMA interrupt flags.
+ */
+static void STM32Host_SetDmaFlags(volatile uint32_t *isr, uint32_t flags)
+{
+	uint32_t *dmaIsr = STM32Host_GetDmaIsr(isr);
+	*dmaIsr |= flags;
+	*isr = *dmaIsr;
+}
+
+/**
+ * @brief Applies the status register writes done by the software since the last call.
+ */
+static void STM32Host_SyncRegisters(const STM32Host_UartConfig_t *config, STM32Host_UartState_t *uart)
+{
+	if (config->uartClear == NULL)
+	{
+		/* Flags are cleared by writing 0, all other bits are read-only */
+		uint32_t status = *config->uartStatus;
+		uart->status &= status | ~config->uartClearableFlags;
+	}
+	else
+	{
+		uint32_t clear = *config->uartClear;
+		if (clear != 0)
+		{
+			*config->uartClear = 0;
+			if (clear & config->uartTcClear)
+			{
+				uart->status &= ~config->uartTc;
+			}
+		}
+	}
+	*config->uartStatus = uart->status;
+
+	STM32Host_SyncDmaFlags(config->dmaIsr, config->dmaIfcr);
+}
+
+/**
+ * @brief Starts fetching data, if the channel/stream has been enabled by the software.
+ */
+static void STM32Host_CheckDmaStart(const STM32Host_UartConfig_t *config, STM32Host_UartState_t *uart, uint64_t nowNs)
+{
+	if (uart->dmaActive || !(*config->dmaCr & config->dmaEn) || !(*config->uartCr3 & config->uartDmat))
+	{
+		return;
+	}
+
+	uart->dmaActive = true;
+	uart->dmaAddress = *config->dmaMar;
+	uart->dmaRemaining = *config->dmaNdtr & 0xFFFFU;
+	if (!uart->shiftOutPending && uart->nextFetchNs < nowNs)
+	{
+		/* Transmitter is idle - first byte is fetched immediately */
+		uart->nextFetchNs = nowNs;
+	}
+	uart->shiftOutPending = false;
+}
+
+/**
+ * @brief Advances the simulated transmitter to the supplied point in time.
+ */
+static void STM32Host_UartStep(const STM32Host_UartConfig_t *config, STM32Host_UartState_t *uart, uint64_t nowNs)
+{
+	STM32Host_SyncRegisters(config, uart);
+	STM32Host_CheckDmaStart(config, uart, nowNs);
+
+	while (uart->dmaActive && (nowNs >= uart->nextFetchNs))
+	{
+		/* Transmit data register is empty - DMA moves the next byte */
+		if (uart->txCaptureLength < sizeof(uart->txCapture))
+		{
+			uart->txCapture[uart->txCaptureLength] = *(volatile uint8_t*) (uintptr_t) uart->dmaAddress;
+			uart->txCaptureLength++;
+		}
+		if (*config->dmaCr & config->dmaMinc)
+		{
+			uart->dmaAddress++;
+		}
+		uart->dmaRemaining--;
+		*config->dmaNdtr = uart->dmaRemaining;
+		uart->shiftOutDoneNs = uart->nextFetchNs + uart->byteTimeNs;
+		uart->nextFetchNs += uart->byteTimeNs;
+
+		if (uart->dmaRemaining == 0)
+		{
+			/* Transfer complete */
+			uart->dmaActive = false;
+			uart->shiftOutPending = true;
+			*config->dmaCr &= ~config->dmaEn;
+			STM32Host_SetDmaFlags(config->dmaIsr, config->dmaTc);
+			if (*config->dmaCr & config->dmaTcie)
+			{
+				STM32Host_RaiseIrq(config->dmaIrq);
+				STM32Host_SyncRegisters(config, uart);
+			}
+
+			/* The interrupt handler might have started the next transfer */
+			STM32Host_CheckDmaStart(config, uart, nowNs);
+		}
+	}
+
+	if (uart->shiftOutPending && (nowNs >= uart->shiftOutDoneNs))
+	{
+		/* Last byte has been shifted out */
+		uart->shiftOutPending = false;
+		uart->status |= config->uartTc;
+		*config->uartStatus = uart->status;
+		if (*config->uartCr1 & config->uartTcie)
+		{
+			STM32Host_RaiseIrq(config->uartIrq);
+			STM32Host_SyncRegisters(config, uart);
+
+			/* The interrupt handler might have started the next transfer */
+			STM32Host_CheckDmaStart(config, uart, nowNs);
+		}
+	}
+}
+
+static void* STM32Host_Thread(void *arg)
+{
+	(void) arg;
+	struct timespec delay = {
+			.tv_sec = 0,
+			.tv_nsec = 10000 };
+	while (STM32Host_running)
+	{
+		for (size_t i = 0; i < STM32Host_Uart_Count; i++)
+		{
+			if (STM32Host_uarts[i].enabled)
+			{
+				STM32Host_UartStep(&STM32Host_UartConfigs[i], &STM32Host_uarts[i], STM32Host_GetTimeNs());
+			}
+		}
+		nanosleep(&delay, NULL);
+	}
+	return NULL;
+}
+
+void STM32Host_StartUart(STM32Host_Uart_t uart, uint32_t baudrate)
+{
+	/* 8N1: start bit, 8 data bits, stop bit */
+	STM32Host_uarts[uart].byteTimeNs = 10ULL * 1000000000ULL / baudrate;
+	STM32Host_uarts[uart].enabled = true;
+	if (!STM32Host_running)
+	{
+		STM32Host_running = true;
+		pthread_create(&STM32Host_thread, NULL, STM32Host_Thread, NULL);
+	}
+}
+
+void STM32Host_Stop(void)
+{
+	if (STM32Host_running)
+	{
+		STM32Host_running = false;
+		pthread_join(STM32Host_thread, NULL);
+	}
+}
+
+const uint8_t* STM32Host_GetTransmittedData(STM32Host_Uart_t uart, size_t *length)
+{
+	*length = STM32Host_uarts[uart].txCaptureLength;
+	return STM32Host_uarts[uart].txCapture;
+}
+
+void STM32Host_ResetTransmittedData(STM32Host_Uart_t uart)
+{
+	STM32Host_uarts[uart].txCaptureLength = 0;
+}
+
+bool STM32Host_IsUartIdle(STM32Host_Uart_t uart)
+{
+	const STM32Host_UartConfig_t *config = &STM32Host_UartConfigs[uart];
+	return !(*config->dmaCr & config->dmaEn) && !STM32Host_uarts[uart].dmaActive && !STM32Host_uarts[uart].shiftOutPending;
+}
+
+/**
+ * @brief Checks if the software has (re)started the receiver's DMA channel/stream.
+ *
+ * @return true if the DMA channel/stream is enabled
+ */
+static bool STM32Host_CheckRxDmaStart(const STM32Host_RxConfig_t *config, STM32Host_RxState_t *rx)
+{
+	if (!(*config->dmaCr & config->dmaEn) || !(*config->uartCr3 & config->uartDmar))
+	{
+		rx->dmaActive = false;
+		return false;
+	}
+
+	if (!rx->dmaActive || (*config->dmaNdtr != rx->dmaNdtr) || (*config->dmaM0ar != rx->dmaM0ar))
+	{
+		/* Registers have been written by the software (only possible while the DMA was disabled) */
+		rx->dmaActive = true;
+		rx->dmaLength = *config->dmaNdtr & 0xFFFFU;
+		rx->dmaNdtr = rx->dmaLength;
+		rx->dmaM0ar = *config->dmaM0ar;
+	}
+	return rx->dmaLength > 0;
+}
+
+size_t STM32Host_Receive(STM32Host_RxUart_t uart, const uint8_t *data, size_t length, bool idle)
+{
+	const STM32Host_RxConfig_t *config = &STM32Host_RxConfigs[uart];
+	STM32Host_RxState_t *rx = &STM32Host_rxStates[uart];
+	size_t written = 0;
+
+	pthread_mutex_lock(&STM32Host_irqLock);
+	for (size_t i = 0; i < length; i++)
+	{
+		STM32Host_SyncDmaFlags(config->dmaIsr, config->dmaIfcr);
+		if (!STM32Host_CheckRxDmaStart(config, rx))
+		{
+			continue;
+		}
+
+		bool memory1 = (config->dmaM1ar != NULL) && (*config->dmaCr & config->dmaDbm) && (*config->dmaCr & config->dmaCt);
+		uint32_t address = memory1 ? *config->dmaM1ar : *config->dmaM0ar;
+		*(volatile uint8_t*) (uintptr_t) (address + rx->dmaLength - rx->dmaNdtr) = data[i];
+		written++;
+		rx->dmaNdtr--;
+
+		uint32_t irqFlags = 0;
+		if (rx->dmaLength - rx->dmaNdtr == rx->dmaLength / 2)
+		{
+			irqFlags = config->dmaHtie;
+			STM32Host_SetDmaFlags(config->dmaIsr, config->dmaHt);
+		}
+		if (rx->dmaNdtr == 0)
+		{
+			/* Circular mode: reload, double buffer mode: switch to the other memory target */
+			rx->dmaNdtr = rx->dmaLength;
+			if (*config->dmaCr & config->dmaDbm)
+			{
+				*config->dmaCr ^= config->dmaCt;
+			}
+			irqFlags = config->dmaTcie;
+			STM32Host_SetDmaFlags(config->dmaIsr, config->dmaTc);
+		}
+		*config->dmaNdtr = rx->dmaNdtr;
+
+		if (*config->dmaCr & irqFlags)
+		{
+			STM32Host_RaiseIrq(config->dmaIrq);
+			STM32Host_SyncDmaFlags(config->dmaIsr, config->dmaIfcr);
+		}
+	}
+
+	if (idle && (*config->uartCr1 & config->uartIdleie))
+	{
+		/* The flag's clearing sequence is not checked - it is cleared after the interrupt handler */
+		*config->uartStatus |= config->uartIdle;
+		STM32Host_RaiseIrq(config->uartIrq);
+		*config->uartStatus &= ~config->uartIdle;
+	}
+	pthread_mutex_unlock(&STM32Host_irqLock);
+
+	return written;
+}
+
+uint64_t STM32Host_GetIrqTimeNs(void)
+{
+	return STM32Host_irqTimeNs;
+}
+
+/* CMSIS core functions (see cmsis_host.h) */
+
+uint32_t __get_PRIMASK(void)
+{
+	return STM32Host_primask;
+}
+
+void __disable_irq(void)
+{
+	if (STM32Host_primask == 0)
+	{
+		pthread_mutex_lock(&STM32Host_irqLock);
+		STM32Host_primask = 1;
+	}
+}
+
+void __enable_irq(void)
+{
+	if (STM32Host_primask != 0)
+	{
+		STM32Host_primask = 0;
+		pthread_mutex_unlock(&STM32Host_irqLock);
+	}
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+	if (priMask & 1U)
+	{
+		__disable_irq();
+	}
+	else
+	{
+		__enable_irq();
+	}
+}
+
+uint32_t __LDREXW(volatile uint32_t *addr)
+{
+	return *addr;
+}
+
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+	*addr = value;
+	return 0;
+}
+
+/* HAL functions used by global.c and the platform files */
+
+typedef enum
+{
+	STM32Host_HAL_OK = 0
+} STM32Host_HAL_StatusTypeDef;
+
+STM32Host_HAL_StatusTypeDef HAL_Init(void)
+{
+	return STM32Host_HAL_OK;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return (uint32_t) (STM32Host_GetMonotonicNs() / 1000000ULL);
+}
+
+void HAL_Delay(uint32_t delay)
+{
+	struct timespec ts = {
+			.tv_sec = delay / 1000,
+			.tv_nsec = (long) (delay % 1000) * 1000000L };
+	nanosleep(&ts, NULL);
+}
+
+STM32Host_HAL_StatusTypeDef HAL_RCC_OscConfig(void *init)
+{
+	(void) init;
+	return STM32Host_HAL_OK;
+}
+
+STM32Host_HAL_StatusTypeDef HAL_RCC_ClockConfig(void *init, uint32_t latency)
+{
+	(void) init;
+	(void) latency;
+	return STM32Host_HAL_OK;
+}
+
+STM32Host_HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(void *init)
+{
+	(void) init;
+	return STM32Host_HAL_OK;
+}
+
+void HAL_GPIO_Init(void *port, void *init)
+{
+	(void) port;
+	(void) init;
+}
+
+void HAL_GPIO_DeInit(void *port, uint32_t pin)
+{
+	(void) port;
+	(void) pin;
+}
+
+void HAL_GPIO_WritePin(void *port, uint16_t pin, int state)
+{
+	(void) port;
+	(void) pin;
+	(void) state;
+}
+
+int HAL_GPIO_ReadPin(void *port, uint16_t pin)
+{
+	(void) port;
+	(void) pin;
+	return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * \file
+ * \brief Stand-in for the STM32 peripherals used to run the STM32 platform files (global_F4xx.c, global_L0xx.c) on a host PC.
+ *
+ * The peripheral register blocks are mapped to their physical addresses in the test process,
+ * so that the platform files can be built unmodified using the ST headers. A simulation thread
+ * models the transmitters of USART1 (radio module) and USART2 (debug output) and their DMA
+ * channels/streams: data is fetched from memory at the configured baud rate and the DMA transfer
+ * complete and USART transmission complete interrupts are raised by calling the respective
+ * interrupt handlers.
+ *
+ * The receivers of the UART instances are modeled by STM32Host_Receive(), which is executed by
+ * the calling thread: the received data is written to memory by the DMA channel/stream (circular
+ * or double buffer mode) and the DMA half-transfer / transfer complete and USART idle line
+ * interrupts are raised, followed by the PendSV handler if it has been set pending.
+ *
+ * DMA addresses are 32 bit, so data to be transferred by the simulated DMA must be located
+ * in the simulated SRAM (see STM32Host_SramAlloc()) or the test must be linked with -no-pie.
+ */
+
+#ifndef STM32_HOST_H_INCLUDED
+#define STM32_HOST_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Simulated UART transmitters.
+ */
+typedef enum STM32Host_Uart_t
+{
+	STM32Host_Uart_1, /**< USART1 (WE_UART_Instance_1) */
+	STM32Host_Uart_Debug, /**< USART2 (debug output, see debug.c) */
+	STM32Host_Uart_Count
+} STM32Host_Uart_t;
+
+/**
+ * @brief Register and interrupt configuration of a simulated UART transmitter and its DMA channel/stream.
+ */
+typedef struct STM32Host_UartConfig_t
+{
+	volatile uint32_t *uartCr1; /**< USART control register 1 */
+	volatile uint32_t *uartCr3; /**< USART control register 3 */
+	volatile uint32_t *uartStatus; /**< USART status register (SR / ISR) */
+	volatile uint32_t *uartClear; /**< USART interrupt flag clear register (ICR), NULL if the flags are cleared by writing 0 to the status register */
+	uint32_t uartStatusResetValue; /**< Reset value of the status register */
+	uint32_t uartClearableFlags; /**< Status flags that are cleared by writing 0 (used if uartClear is NULL) */
+	uint32_t uartTc; /**< Transmission complete flag */
+	uint32_t uartTcClear; /**< Transmission complete clear flag in uartClear */
+	uint32_t uartTcie; /**< Transmission complete interrupt enable bit in CR1 */
+	uint32_t uartDmat; /**< DMA transmitter enable bit in CR3 */
+	void (*uartIrq)(void); /**< USART interrupt handler (may be NULL) */
+
+	volatile uint32_t *dmaCr; /**< DMA stream/channel configuration register */
+	volatile uint32_t *dmaNdtr; /**< DMA number of data register */
+	volatile uint32_t *dmaMar; /**< DMA memory address register */
+	volatile uint32_t *dmaIsr; /**< DMA interrupt status register containing the stream's/channel's flags */
+	volatile uint32_t *dmaIfcr; /**< DMA interrupt flag clear register */
+	uint32_t dmaEn; /**< Enable bit in dmaCr */
+	uint32_t dmaMinc; /**< Memory increment bit in dmaCr */
+	uint32_t dmaTcie; /**< Transfer complete interrupt enable bit in dmaCr */
+	uint32_t dmaTc; /**< Transfer complete flag(s) in dmaIsr */
+	void (*dmaIrq)(void); /**< DMA interrupt handler (may be NULL) */
+} STM32Host_UartConfig_t;
+
+/**
+ * @brief Simulated UART receivers.
+ */
+typedef enum STM32Host_RxUart_t
+{
+	STM32Host_RxUart_1, /**< USART1 (WE_UART_Instance_1) */
+	STM32Host_RxUart_2, /**< Second UART instance (USART6 on STM32F4, USART4 on STM32L0) */
+	STM32Host_RxUart_Count
+} STM32Host_RxUart_t;
+
+/**
+ * @brief Register and interrupt configuration of a simulated UART receiver and its DMA channel/stream.
+ */
+typedef struct STM32Host_RxConfig_t
+{
+	volatile uint32_t *uartCr1; /**< USART control register 1 */
+	volatile uint32_t *uartCr3; /**< USART control register 3 */
+	volatile uint32_t *uartStatus; /**< USART status register (SR / ISR) */
+	uint32_t uartIdle; /**< Idle line detected flag */
+	uint32_t uartIdleie; /**< Idle line interrupt enable bit in CR1 */
+	uint32_t uartDmar; /**< DMA receiver enable bit in CR3 */
+	void (*uartIrq)(void); /**< USART interrupt handler (may be NULL) */
+
+	volatile uint32_t *dmaCr; /**< DMA stream/channel configuration register */
+	volatile uint32_t *dmaNdtr; /**< DMA number of data register */
+	volatile uint32_t *dmaM0ar; /**< DMA memory (0) address register */
+	volatile uint32_t *dmaM1ar; /**< DMA memory 1 address register, NULL if double buffer mode is not available */
+	volatile uint32_t *dmaIsr; /**< DMA interrupt status register containing the stream's/channel's flags */
+	volatile uint32_t *dmaIfcr; /**< DMA interrupt flag clear register */
+	uint32_t dmaEn; /**< Enable bit in dmaCr */
+	uint32_t dmaHtie; /**< Half-transfer interrupt enable bit in dmaCr */
+	uint32_t dmaTcie; /**< Transfer complete interrupt enable bit in dmaCr */
+	uint32_t dmaDbm; /**< Double buffer mode bit in dmaCr (0 if not available) */
+	uint32_t dmaCt; /**< Current target bit in dmaCr (0 if not available) */
+	uint32_t dmaHt; /**< Half-transfer flag(s) in dmaIsr */
+	uint32_t dmaTc; /**< Transfer complete flag(s) in dmaIsr */
+	void (*dmaIrq)(void); /**< DMA interrupt handler (may be NULL) */
+} STM32Host_RxConfig_t;
+
+/**
+ * @brief Address range of simulated peripherals.
+ */
+typedef struct STM32Host_MemoryRegion_t
+{
+	uintptr_t address;
+	size_t size;
+} STM32Host_MemoryRegion_t;
+
+/**
+ * @brief Family specific configuration (see stm32_host_f4.c, stm32_host_l0.c).
+ */
+extern const STM32Host_MemoryRegion_t STM32Host_MemoryRegions[];
+extern const size_t STM32Host_MemoryRegionCount;
+extern const STM32Host_UartConfig_t STM32Host_UartConfigs[STM32Host_Uart_Count];
+extern const STM32Host_RxConfig_t STM32Host_RxConfigs[STM32Host_RxUart_Count];
+
+/**
+ * @brief Maps the peripheral registers and SRAM to their physical addresses.
+ *
+ * @return true if successful, false otherwise (e.g. if the address ranges are not available)
+ */
+extern bool STM32Host_Init(void);
+
+/**
+ * @brief Allocates memory in the simulated SRAM.
+ *
+ * @param[in] size Number of bytes
+ *
+ * @return Pointer to the allocated memory (is not freed), NULL if out of memory
+ */
+extern void* STM32Host_SramAlloc(size_t size);
+
+/**
+ * @brief Starts simulating a UART transmitter (after the UART has been initialized by the software).
+ *
+ * @param[in] uart UART to be simulated
+ * @param[in] baudrate Baud rate used for calculating the duration of transmissions (8N1)
+ */
+extern void STM32Host_StartUart(STM32Host_Uart_t uart, uint32_t baudrate);
+
+/**
+ * @brief Stops the simulation thread.
+ */
+extern void STM32Host_Stop(void);
+
+/**
+ * @brief Returns the data transmitted since the last call of STM32Host_ResetTransmittedData().
+ *
+ * @param[in] uart UART
+ * @param[out] length Number of bytes transmitted
+ *
+ * @return Transmitted data
+ */
+extern const uint8_t* STM32Host_GetTransmittedData(STM32Host_Uart_t uart, size_t *length);
+
+/**
+ * @brief Discards the data transmitted so far.
+ *
+ * @param[in] uart UART
+ */
+extern void STM32Host_ResetTransmittedData(STM32Host_Uart_t uart);
+
+/**
+ * @brief Returns true if the transmitter is idle (no DMA transfer running, last byte shifted out).
+ *
+ * @param[in] uart UART
+ */
+extern bool STM32Host_IsUartIdle(STM32Host_Uart_t uart);
+
+/**
+ * @brief Receives data via a simulated UART receiver.
+ *
+ * The data is written to memory by the UART's DMA channel/stream, raising the DMA half-transfer
+ * and transfer complete interrupts (if enabled). If requested, the idle line interrupt is raised
+ * after the last byte. Is executed by the calling thread with interrupts disabled, so the interrupt
+ * handlers have returned when this function returns.
+ *
+ * Must not be used for USART1 while its transmitter is simulated (see STM32Host_StartUart()),
+ * as the status registers are not shared between the simulated transmitter and receiver.
+ *
+ * @param[in] uart UART receiver
+ * @param[in] data Received data
+ * @param[in] length Number of bytes received
+ * @param[in] idle Raise the idle line interrupt after the last byte
+ *
+ * @return Number of bytes written to memory (data is lost if reception via DMA is not enabled)
+ */
+extern size_t STM32Host_Receive(STM32Host_RxUart_t uart, const uint8_t *data, size_t length, bool idle);
+
+/**
+ * @brief Returns the total time spent executing interrupt handlers (including the PendSV handler).
+ */
+extern uint64_t STM32Host_GetIrqTimeNs(void);
+
+#endif /* STM32_HOST_H_INCLUDED */
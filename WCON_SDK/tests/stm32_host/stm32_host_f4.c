@@ -0,0 +1,125 @@
+/**
+ * \file
+ * \brief STM32F4 part of the peripheral stand-in (transmitters: USART1 with DMA2 stream 7, USART2 with
+ * DMA1 stream 6, receivers: USART1 with DMA2 stream 2, USART6 with DMA2 stream 1).
+ */
+
+#include "stm32_host.h"
+
+#include "stm32f4xx.h"
+
+/* Interrupt handlers are optional, as not all of them are linked into every test */
+extern void USART1_IRQHandler() __attribute__((weak));
+extern void USART2_IRQHandler() __attribute__((weak));
+extern void USART6_IRQHandler() __attribute__((weak));
+extern void DMA2_Stream1_IRQHandler() __attribute__((weak));
+extern void DMA2_Stream2_IRQHandler() __attribute__((weak));
+extern void DMA2_Stream7_IRQHandler() __attribute__((weak));
+extern void DMA1_Stream6_IRQHandler() __attribute__((weak));
+
+/**
+ * @brief Peripheral address ranges (APB1, APB2, AHB1) and Cortex-M system control space.
+ */
+const STM32Host_MemoryRegion_t STM32Host_MemoryRegions[] = {
+		{
+				.address = PERIPH_BASE,
+				.size = 0x30000 },
+		{
+				.address = 0xE0000000UL,
+				.size = 0x100000 }, };
+const size_t STM32Host_MemoryRegionCount = sizeof(STM32Host_MemoryRegions) / sizeof(STM32Host_MemoryRegions[0]);
+
+/**
+ * @brief Bits of USART_SR that are cleared by writing 0 (writing 1 has no effect).
+ */
+#define STM32HOST_USART_SR_RC_W0 (USART_SR_CTS | USART_SR_LBD | USART_SR_TC | USART_SR_RXNE)
+
+const STM32Host_UartConfig_t STM32Host_UartConfigs[STM32Host_Uart_Count] = {
+		[STM32Host_Uart_1] = {
+				.uartCr1 = &USART1->CR1,
+				.uartCr3 = &USART1->CR3,
+				.uartStatus = &USART1->SR,
+				.uartClear = NULL,
+				.uartStatusResetValue = USART_SR_TXE | USART_SR_TC,
+				.uartClearableFlags = STM32HOST_USART_SR_RC_W0,
+				.uartTc = USART_SR_TC,
+				.uartTcie = USART_CR1_TCIE,
+				.uartDmat = USART_CR3_DMAT,
+				.uartIrq = USART1_IRQHandler,
+				.dmaCr = &DMA2_Stream7->CR,
+				.dmaNdtr = &DMA2_Stream7->NDTR,
+				.dmaMar = &DMA2_Stream7->M0AR,
+				.dmaIsr = &DMA2->HISR,
+				.dmaIfcr = &DMA2->HIFCR,
+				.dmaEn = DMA_SxCR_EN,
+				.dmaMinc = DMA_SxCR_MINC,
+				.dmaTcie = DMA_SxCR_TCIE,
+				.dmaTc = DMA_HISR_TCIF7,
+				.dmaIrq = DMA2_Stream7_IRQHandler },
+		[STM32Host_Uart_Debug] = {
+				.uartCr1 = &USART2->CR1,
+				.uartCr3 = &USART2->CR3,
+				.uartStatus = &USART2->SR,
+				.uartClear = NULL,
+				.uartStatusResetValue = USART_SR_TXE | USART_SR_TC,
+				.uartClearableFlags = STM32HOST_USART_SR_RC_W0,
+				.uartTc = USART_SR_TC,
+				.uartTcie = USART_CR1_TCIE,
+				.uartDmat = USART_CR3_DMAT,
+				.uartIrq = USART2_IRQHandler,
+				.dmaCr = &DMA1_Stream6->CR,
+				.dmaNdtr = &DMA1_Stream6->NDTR,
+				.dmaMar = &DMA1_Stream6->M0AR,
+				.dmaIsr = &DMA1->HISR,
+				.dmaIfcr = &DMA1->HIFCR,
+				.dmaEn = DMA_SxCR_EN,
+				.dmaMinc = DMA_SxCR_MINC,
+				.dmaTcie = DMA_SxCR_TCIE,
+				.dmaTc = DMA_HISR_TCIF6,
+				.dmaIrq = DMA1_Stream6_IRQHandler } };
+
+const STM32Host_RxConfig_t STM32Host_RxConfigs[STM32Host_RxUart_Count] = {
+		[STM32Host_RxUart_1] = {
+				.uartCr1 = &USART1->CR1,
+				.uartCr3 = &USART1->CR3,
+				.uartStatus = &USART1->SR,
+				.uartIdle = USART_SR_IDLE,
+				.uartIdleie = USART_CR1_IDLEIE,
+				.uartDmar = USART_CR3_DMAR,
+				.uartIrq = USART1_IRQHandler,
+				.dmaCr = &DMA2_Stream2->CR,
+				.dmaNdtr = &DMA2_Stream2->NDTR,
+				.dmaM0ar = &DMA2_Stream2->M0AR,
+				.dmaM1ar = &DMA2_Stream2->M1AR,
+				.dmaIsr = &DMA2->LISR,
+				.dmaIfcr = &DMA2->LIFCR,
+				.dmaEn = DMA_SxCR_EN,
+				.dmaHtie = DMA_SxCR_HTIE,
+				.dmaTcie = DMA_SxCR_TCIE,
+				.dmaDbm = DMA_SxCR_DBM,
+				.dmaCt = DMA_SxCR_CT,
+				.dmaHt = DMA_LISR_HTIF2,
+				.dmaTc = DMA_LISR_TCIF2,
+				.dmaIrq = DMA2_Stream2_IRQHandler },
+		[STM32Host_RxUart_2] = {
+				.uartCr1 = &USART6->CR1,
+				.uartCr3 = &USART6->CR3,
+				.uartStatus = &USART6->SR,
+				.uartIdle = USART_SR_IDLE,
+				.uartIdleie = USART_CR1_IDLEIE,
+				.uartDmar = USART_CR3_DMAR,
+				.uartIrq = USART6_IRQHandler,
+				.dmaCr = &DMA2_Stream1->CR,
+				.dmaNdtr = &DMA2_Stream1->NDTR,
+				.dmaM0ar = &DMA2_Stream1->M0AR,
+				.dmaM1ar = &DMA2_Stream1->M1AR,
+				.dmaIsr = &DMA2->LISR,
+				.dmaIfcr = &DMA2->LIFCR,
+				.dmaEn = DMA_SxCR_EN,
+				.dmaHtie = DMA_SxCR_HTIE,
+				.dmaTcie = DMA_SxCR_TCIE,
+				.dmaDbm = DMA_SxCR_DBM,
+				.dmaCt = DMA_SxCR_CT,
+				.dmaHt = DMA_LISR_HTIF1,
+				.dmaTc = DMA_LISR_TCIF1,
+				.dmaIrq = DMA2_Stream1_IRQHandler } };
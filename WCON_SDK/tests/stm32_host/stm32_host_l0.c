@@ -0,0 +1,117 @@
+/**
+ * \file
+ * \brief STM32L0 part of the peripheral stand-in (transmitters: USART1 with DMA1 channel 2, USART2 with
+ * DMA1 channel 4, receivers: USART1 with DMA1 channel 3, USART4 with DMA1 channel 6).
+ */
+
+#include "stm32_host.h"
+
+#include "stm32l0xx.h"
+
+/* Interrupt handlers are optional, as not all of them are linked into every test */
+extern void USART1_IRQHandler() __attribute__((weak));
+extern void USART2_IRQHandler() __attribute__((weak));
+extern void USART4_5_IRQHandler() __attribute__((weak));
+extern void DMA1_Channel2_3_IRQHandler() __attribute__((weak));
+extern void DMA1_Channel4_5_6_7_IRQHandler() __attribute__((weak));
+
+/**
+ * @brief Peripheral address ranges (APB1, APB2, AHB, IOPORT) and Cortex-M system control space.
+ */
+const STM32Host_MemoryRegion_t STM32Host_MemoryRegions[] = {
+		{
+				.address = PERIPH_BASE,
+				.size = 0x30000 },
+		{
+				.address = IOPPERIPH_BASE,
+				.size = 0x2000 },
+		{
+				.address = 0xE0000000UL,
+				.size = 0x100000 }, };
+const size_t STM32Host_MemoryRegionCount = sizeof(STM32Host_MemoryRegions) / sizeof(STM32Host_MemoryRegions[0]);
+
+const STM32Host_UartConfig_t STM32Host_UartConfigs[STM32Host_Uart_Count] = {
+		[STM32Host_Uart_1] = {
+				.uartCr1 = &USART1->CR1,
+				.uartCr3 = &USART1->CR3,
+				.uartStatus = &USART1->ISR,
+				.uartClear = &USART1->ICR,
+				.uartStatusResetValue = USART_ISR_TXE | USART_ISR_TC,
+				.uartTc = USART_ISR_TC,
+				.uartTcClear = USART_ICR_TCCF,
+				.uartTcie = USART_CR1_TCIE,
+				.uartDmat = USART_CR3_DMAT,
+				.uartIrq = USART1_IRQHandler,
+				.dmaCr = &DMA1_Channel2->CCR,
+				.dmaNdtr = &DMA1_Channel2->CNDTR,
+				.dmaMar = &DMA1_Channel2->CMAR,
+				.dmaIsr = &DMA1->ISR,
+				.dmaIfcr = &DMA1->IFCR,
+				.dmaEn = DMA_CCR_EN,
+				.dmaMinc = DMA_CCR_MINC,
+				.dmaTcie = DMA_CCR_TCIE,
+				.dmaTc = DMA_ISR_TCIF2 | DMA_ISR_GIF2,
+				.dmaIrq = DMA1_Channel2_3_IRQHandler },
+		[STM32Host_Uart_Debug] = {
+				.uartCr1 = &USART2->CR1,
+				.uartCr3 = &USART2->CR3,
+				.uartStatus = &USART2->ISR,
+				.uartClear = &USART2->ICR,
+				.uartStatusResetValue = USART_ISR_TXE | USART_ISR_TC,
+				.uartTc = USART_ISR_TC,
+				.uartTcClear = USART_ICR_TCCF,
+				.uartTcie = USART_CR1_TCIE,
+				.uartDmat = USART_CR3_DMAT,
+				.uartIrq = USART2_IRQHandler,
+				.dmaCr = &DMA1_Channel4->CCR,
+				.dmaNdtr = &DMA1_Channel4->CNDTR,
+				.dmaMar = &DMA1_Channel4->CMAR,
+				.dmaIsr = &DMA1->ISR,
+				.dmaIfcr = &DMA1->IFCR,
+				.dmaEn = DMA_CCR_EN,
+				.dmaMinc = DMA_CCR_MINC,
+				.dmaTcie = DMA_CCR_TCIE,
+				.dmaTc = DMA_ISR_TCIF4 | DMA_ISR_GIF4,
+				.dmaIrq = DMA1_Channel4_5_6_7_IRQHandler } };
+
+const STM32Host_RxConfig_t STM32Host_RxConfigs[STM32Host_RxUart_Count] = {
+		[STM32Host_RxUart_1] = {
+				.uartCr1 = &USART1->CR1,
+				.uartCr3 = &USART1->CR3,
+				.uartStatus = &USART1->ISR,
+				.uartIdle = USART_ISR_IDLE,
+				.uartIdleie = USART_CR1_IDLEIE,
+				.uartDmar = USART_CR3_DMAR,
+				.uartIrq = USART1_IRQHandler,
+				.dmaCr = &DMA1_Channel3->CCR,
+				.dmaNdtr = &DMA1_Channel3->CNDTR,
+				.dmaM0ar = &DMA1_Channel3->CMAR,
+				.dmaM1ar = NULL,
+				.dmaIsr = &DMA1->ISR,
+				.dmaIfcr = &DMA1->IFCR,
+				.dmaEn = DMA_CCR_EN,
+				.dmaHtie = DMA_CCR_HTIE,
+				.dmaTcie = DMA_CCR_TCIE,
+				.dmaHt = DMA_ISR_HTIF3 | DMA_ISR_GIF3,
+				.dmaTc = DMA_ISR_TCIF3 | DMA_ISR_GIF3,
+				.dmaIrq = DMA1_Channel2_3_IRQHandler },
+		[STM32Host_RxUart_2] = {
+				.uartCr1 = &USART4->CR1,
+				.uartCr3 = &USART4->CR3,
+				.uartStatus = &USART4->ISR,
+				.uartIdle = USART_ISR_IDLE,
+				.uartIdleie = USART_CR1_IDLEIE,
+				.uartDmar = USART_CR3_DMAR,
+				.uartIrq = USART4_5_IRQHandler,
+				.dmaCr = &DMA1_Channel6->CCR,
+				.dmaNdtr = &DMA1_Channel6->CNDTR,
+				.dmaM0ar = &DMA1_Channel6->CMAR,
+				.dmaM1ar = NULL,
+				.dmaIsr = &DMA1->ISR,
+				.dmaIfcr = &DMA1->IFCR,
+				.dmaEn = DMA_CCR_EN,
+				.dmaHtie = DMA_CCR_HTIE,
+				.dmaTcie = DMA_CCR_TCIE,
+				.dmaHt = DMA_ISR_HTIF6 | DMA_ISR_GIF6,
+				.dmaTc = DMA_ISR_TCIF6 | DMA_ISR_GIF6,
+				.dmaIrq = DMA1_Channel4_5_6_7_IRQHandler } };
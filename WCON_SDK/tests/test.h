@@ -0,0 +1,127 @@
+/**
+ * \file
+ * \brief Helpers shared by the host tests and benchmarks (checks, timing, result output).
+ *
+ * Must be included after the SDK headers, as global.h disables printf() on the target.
+ */
+
+#ifndef TEST_H_INCLUDED
+#define TEST_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#undef printf
+#undef fprintf
+
+/**
+ * @brief Number of failed checks (see TEST_CHECK()).
+ */
+static int testFailures __attribute__((unused)) = 0;
+
+/**
+ * @brief Checks a condition and reports it, if it doesn't hold (the test is continued).
+ */
+#define TEST_CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			testFailures++; \
+		} \
+	} while (0)
+
+/**
+ * @brief Checks a condition and reports it including a formatted message, if it doesn't hold.
+ */
+#define TEST_CHECK_MSG(condition, ...) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			fprintf(stderr, "%s:%d: check failed: %s: ", __FILE__, __LINE__, #condition); \
+			fprintf(stderr, __VA_ARGS__); \
+			fprintf(stderr, "\n"); \
+			testFailures++; \
+		} \
+	} while (0)
+
+/**
+ * @brief Prints the test result and returns the exit code of the test (use as "return TEST_RESULT();").
+ */
+#define TEST_RESULT() TestResult(__FILE__)
+
+static inline int TestResult(const char *file)
+{
+	if (testFailures > 0)
+	{
+		fprintf(stderr, "%s: %d check(s) failed\n", file, testFailures);
+		return EXIT_FAILURE;
+	}
+	printf("%s: passed\n", file);
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ */
+static inline uint64_t TestGetTimeNs()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief Returns the CPU time consumed by the calling thread in nanoseconds.
+ */
+static inline uint64_t TestGetThreadCpuTimeNs()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief Prevents the compiler from optimizing away a value computed in a benchmark loop.
+ */
+#define TEST_KEEP(value) __asm volatile("" : : "g"(value) : "memory")
+
+/**
+ * @brief Number of iterations of benchmark loops (can be overridden using the BENCH_SCALE environment variable).
+ *
+ * @param[in] iterations Default number of iterations
+ */
+static inline uint32_t TestBenchIterations(uint32_t iterations)
+{
+	const char *scale = getenv("BENCH_SCALE");
+	if (scale != NULL)
+	{
+		double factor = atof(scale);
+		if (factor > 0)
+		{
+			iterations = (uint32_t) (iterations * factor);
+		}
+	}
+	return iterations > 0 ? iterations : 1;
+}
+
+/**
+ * @brief Prints a benchmark result line.
+ *
+ * @param[in] name Name of the benchmark
+ * @param[in] iterations Number of operations performed
+ * @param[in] elapsedNs Time taken for all operations
+ */
+static inline void TestPrintBenchmark(const char *name, uint64_t iterations, uint64_t elapsedNs)
+{
+	double nsPerOp = (double) elapsedNs / (double) iterations;
+	printf("%-48s %12.1f ns/op %14.0f op/s\n", name, nsPerOp, nsPerOp > 0 ? 1e9 / nsPerOp : 0);
+}
+
+#endif /* TEST_H_INCLUDED */
@@ -0,0 +1,477 @@
+/**
+ * \file
+ * \brief Tests reception via DMA on the STM32 platform files (push and pull mode).
+ *
+ * global_F4xx.c / global_L0xx.c are run against the peripheral stand-in in stm32_host/,
+ * which writes the received data to the DMA receive buffer and raises the DMA and idle
+ * line interrupts followed by PendSV (see STM32Host_Receive()). Covers caller-supplied
+ * receive buffers, the second UART instance (USART6 on STM32F4, USART4 on STM32L0) and,
+ * on STM32F4, the DMA's double buffer mode. Also measures the time spent in interrupt
+ * context per received chunk in push and pull mode and counts the DMA receive buffer
+ * overflows if the application fetches the data too rarely.
+ */
+
+#include "global/global.h"
+
+#include "stm32_host/stm32_host.h"
+
+#include "test.h"
+
+#define TEST_BAUDRATE 115200
+#define TEST_RX_BUFFER_SIZE 16
+#define TEST_CALLER_BUFFER_SIZE 24
+
+/**
+ * @brief Second UART instance (same reception semantics as USART1).
+ */
+#if defined(STM32F401xE)
+#define TEST_UART2(function) WE_UART6_##function
+#else
+#define TEST_UART2(function) WE_UART4_##function
+#endif
+#define TEST_BENCH_BUFFER_SIZE 256
+#define TEST_BENCH_CHUNK_SIZE 32
+
+/**
+ * @brief Time (microseconds) the rx byte handler is busy per call in the interrupt time measurement.
+ */
+#define TEST_HANDLER_WORK_USEC 20
+
+static uint8_t received[1024];
+static size_t receivedLength = 0;
+static uint32_t handlerCalls = 0;
+static uint32_t handlerWorkUsec = 0;
+
+/**
+ * @brief Data passed to STM32Host_Receive() by the rx byte handler on its first call (see TestReentrancy()).
+ */
+static const char *reentrantData = NULL;
+
+static void RxHandler(uint8_t *data, size_t length)
+{
+	if (receivedLength + length <= sizeof(received))
+	{
+		memcpy(&received[receivedLength], data, length);
+	}
+	receivedLength += length;
+	handlerCalls++;
+
+	if (handlerWorkUsec > 0)
+	{
+		uint64_t end = TestGetTimeNs() + handlerWorkUsec * 1000ULL;
+		while (TestGetTimeNs() < end)
+		{
+		}
+	}
+
+	if (reentrantData != NULL)
+	{
+		/* More data arrives while the handler waits for something (pull mode processes pending data while waiting) */
+		const char *data = reentrantData;
+		reentrantData = NULL;
+		STM32Host_Receive(STM32Host_RxUart_1, (const uint8_t*) data, strlen(data), true);
+		WE_Delay(2);
+	}
+}
+
+static WE_UART_HandleRxByte_t rxHandler = RxHandler;
+
+static void ResetReceived()
+{
+	receivedLength = 0;
+	handlerCalls = 0;
+}
+
+static void ReceiveOn(STM32Host_RxUart_t uart, const char *data)
+{
+	size_t length = strlen(data);
+	TEST_CHECK(STM32Host_Receive(uart, (const uint8_t*) data, length, true) == length);
+}
+
+static void Receive(const char *data)
+{
+	ReceiveOn(STM32Host_RxUart_1, data);
+}
+
+static void CheckReceived(const char *expected, uint32_t expectedCalls)
+{
+	size_t length = strlen(expected);
+	TEST_CHECK_MSG(receivedLength == length && memcmp(received, expected, length) == 0, "%.*s", (int) receivedLength, received);
+	TEST_CHECK_MSG(handlerCalls == expectedCalls, "%u calls", handlerCalls);
+	ResetReceived();
+}
+
+/**
+ * @brief Checks the data returned by WE_UARTx_RxPeek().
+ */
+static void CheckSpans(uint16_t length, const WE_UART_Segment_t spans[2], const char *span0, const char *span1)
+{
+	TEST_CHECK(length == strlen(span0) + strlen(span1));
+	TEST_CHECK_MSG(spans[0].length == strlen(span0) && memcmp(spans[0].data, span0, spans[0].length) == 0, "%.*s", spans[0].length, spans[0].data);
+	TEST_CHECK_MSG(spans[1].length == strlen(span1) && (spans[1].length == 0 || memcmp(spans[1].data, span1, spans[1].length) == 0), "%.*s", spans[1].length, spans[1].data);
+}
+
+/**
+ * @brief Checks the data returned by WE_UART1_RxPeek().
+ */
+static void CheckPeek(const char *span0, const char *span1)
+{
+	WE_UART_Segment_t spans[2];
+	uint16_t length = WE_UART1_RxPeek(spans);
+	CheckSpans(length, spans, span0, span1);
+}
+
+static void TestPush()
+{
+	/* Data is passed to the rx byte handler from interrupt context (idle line interrupt -> PendSV) */
+	WE_UART1_SetRxMode(WE_UART_RxMode_Push);
+	Receive("Hello");
+	CheckReceived("Hello", 1);
+
+	/* Delivered on the half-transfer, transfer complete (wrap-around) and idle line interrupts */
+	Receive("0123456789ab");
+	CheckReceived("0123456789ab", 3);
+
+	/* Nothing to be fetched by the application */
+	WE_UART_Segment_t spans[2];
+	TEST_CHECK(WE_UART1_RxPeek(spans) == 0);
+	WE_UART1_ProcessRx();
+	TEST_CHECK(handlerCalls == 0);
+}
+
+static void TestPull()
+{
+	/* Read position is 1 (see TestPush()) */
+	WE_UART1_SetRxMode(WE_UART_RxMode_Pull);
+	Receive("abcdefghijkl");
+	TEST_CHECK(handlerCalls == 0);
+	CheckPeek("abcdefghijkl", "");
+
+	/* Partial consumption */
+	WE_UART1_RxConsume(5);
+	CheckPeek("fghijkl", "");
+	WE_UART1_RxConsume(7);
+	CheckPeek("", "");
+
+	/* Write position wraps around (read position 13): data is returned as two spans */
+	Receive("01234567");
+	CheckPeek("012", "34567");
+	WE_UART1_RxConsume(3);
+	CheckPeek("34567", "");
+	WE_UART1_RxConsume(5);
+
+	/* Processing passes the data to the rx byte handler (both spans) and consumes it */
+	Receive("ABCDEFGHIJKLMN");
+	WE_UART1_ProcessRx();
+	CheckReceived("ABCDEFGHIJKLMN", 2);
+	CheckPeek("", "");
+	WE_UART1_ProcessRx();
+	TEST_CHECK(handlerCalls == 0);
+
+	/* Pending data is processed while waiting */
+	Receive("wait");
+	WE_Delay(1);
+	CheckReceived("wait", 1);
+}
+
+static void TestReentrancy()
+{
+	/* The handler receives more data and waits using WE_Delay(), which processes pending
+	 * data - the data being delivered must not be passed to the handler a second time */
+	WE_UART1_SetRxMode(WE_UART_RxMode_Pull);
+	reentrantData = "more";
+	Receive("first");
+	WE_UART1_ProcessRx();
+	CheckReceived("first", 1);
+
+	/* Data received in the meantime is delivered by the next call */
+	WE_UART1_ProcessRx();
+	CheckReceived("more", 1);
+}
+
+static void TestSetRxBuffer()
+{
+	uint8_t *buffer = STM32Host_SramAlloc(TEST_CALLER_BUFFER_SIZE);
+
+	/* Buffer can't be changed while the UART is initialized */
+	TEST_CHECK(!WE_UART1_SetRxBuffer(buffer, TEST_CALLER_BUFFER_SIZE, WE_UART_RxBufferMode_Circular));
+
+	TEST_CHECK(WE_UART1_DeInit());
+	TEST_CHECK(!WE_UART1_SetRxBuffer(buffer, 1, WE_UART_RxBufferMode_Circular));
+	TEST_CHECK(!WE_UART1_SetRxBuffer(buffer, TEST_CALLER_BUFFER_SIZE - 1, WE_UART_RxBufferMode_DoubleBuffer));
+
+	/* Data is written to the caller-supplied buffer, starting at its beginning */
+	TEST_CHECK(WE_UART1_SetRxBuffer(buffer, TEST_CALLER_BUFFER_SIZE, WE_UART_RxBufferMode_Circular));
+	TEST_CHECK(WE_UART1_Init(TEST_BAUDRATE, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+	WE_UART1_SetRxMode(WE_UART_RxMode_Pull);
+	Receive("caller");
+	WE_UART_Segment_t spans[2];
+	TEST_CHECK(WE_UART1_RxPeek(spans) == 6 && spans[0].data == buffer);
+	CheckPeek("caller", "");
+	WE_UART1_RxConsume(6);
+
+	/* Whole buffer is used before wrapping around */
+	Receive("0123456789abcdefghij");
+	CheckPeek("0123456789abcdefgh", "ij");
+	TEST_CHECK(WE_UART1_RxPeek(spans) == 20 && spans[1].data == buffer);
+	WE_UART1_RxConsume(20);
+	CheckPeek("", "");
+}
+
+static void TestDoubleBuffer()
+{
+	uint8_t *buffer = STM32Host_SramAlloc(TEST_RX_BUFFER_SIZE);
+	const STM32Host_RxConfig_t *dma = &STM32Host_RxConfigs[STM32Host_RxUart_1];
+	WE_UART_Segment_t spans[2];
+
+	TEST_CHECK(WE_UART1_DeInit());
+#if defined(STM32F401xE)
+	/* Memory 0 is the first half, memory 1 the second half of the buffer */
+	TEST_CHECK(WE_UART1_SetRxBuffer(buffer, TEST_RX_BUFFER_SIZE, WE_UART_RxBufferMode_DoubleBuffer));
+	TEST_CHECK(WE_UART1_Init(TEST_BAUDRATE, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+	TEST_CHECK((*dma->dmaCr & dma->dmaDbm) && !(*dma->dmaCr & dma->dmaCt));
+	WE_UART1_SetRxMode(WE_UART_RxMode_Pull);
+
+	Receive("abcde");
+	CheckPeek("abcde", "");
+	TEST_CHECK(WE_UART1_RxPeek(spans) == 5 && spans[0].data == buffer);
+
+	/* DMA switches to memory 1 mid-stream, the data is contiguous */
+	Receive("fghijk");
+	TEST_CHECK(*dma->dmaCr & dma->dmaCt);
+	CheckPeek("abcdefghijk", "");
+	WE_UART1_RxConsume(4);
+	CheckPeek("efghijk", "");
+	WE_UART1_RxConsume(7);
+
+	/* DMA switches back to memory 0: data is returned as two spans */
+	Receive("0123456789");
+	TEST_CHECK(!(*dma->dmaCr & dma->dmaCt));
+	CheckPeek("01234", "56789");
+	TEST_CHECK(WE_UART1_RxPeek(spans) == 10 && spans[0].data == &buffer[11] && spans[1].data == buffer);
+	WE_UART1_RxConsume(5);
+	CheckPeek("56789", "");
+	WE_UART1_RxConsume(5);
+
+	/* Push mode: delivered on the half-transfer and transfer complete interrupts of both memory targets */
+	WE_UART1_SetRxMode(WE_UART_RxMode_Push);
+	Receive("ABCDEFGHIJKLMNOPQRST");
+	CheckReceived("ABCDEFGHIJKLMNOPQRST", 6);
+	TEST_CHECK(WE_UART1_RxPeek(spans) == 0);
+
+	TEST_CHECK(WE_UART1_DeInit());
+#else
+	/* Double buffer mode is not available */
+	TEST_CHECK(!WE_UART1_SetRxBuffer(buffer, TEST_RX_BUFFER_SIZE, WE_UART_RxBufferMode_DoubleBuffer));
+	TEST_CHECK(!(*dma->dmaCr & dma->dmaEn));
+#endif
+	TEST_CHECK(WE_UART1_SetRxBuffer(buffer, TEST_RX_BUFFER_SIZE, WE_UART_RxBufferMode_Circular));
+	TEST_CHECK(WE_UART1_Init(TEST_BAUDRATE, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+}
+
+static void TestSecondUart()
+{
+	WE_UART_Segment_t spans[2];
+	TEST_CHECK(TEST_UART2(SetRxBuffer)(STM32Host_SramAlloc(TEST_RX_BUFFER_SIZE), TEST_RX_BUFFER_SIZE, WE_UART_RxBufferMode_Circular));
+	TEST_CHECK(TEST_UART2(Init)(TEST_BAUDRATE, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+
+	/* Push mode: delivered on the idle line, half-transfer and transfer complete interrupts */
+	TEST_UART2(SetRxMode)(WE_UART_RxMode_Push);
+	ReceiveOn(STM32Host_RxUart_2, "Hello");
+	CheckReceived("Hello", 1);
+	ReceiveOn(STM32Host_RxUart_2, "0123456789ab");
+	CheckReceived("0123456789ab", 3);
+
+	/* Pull mode: partial consumption, wrap-around (write position 1), processing */
+	TEST_UART2(SetRxMode)(WE_UART_RxMode_Pull);
+	ReceiveOn(STM32Host_RxUart_2, "abcdefgh");
+	TEST_CHECK(handlerCalls == 0);
+	CheckSpans(TEST_UART2(RxPeek)(spans), spans, "abcdefgh", "");
+	TEST_UART2(RxConsume)(6);
+	ReceiveOn(STM32Host_RxUart_2, "ijklmnop");
+	CheckSpans(TEST_UART2(RxPeek)(spans), spans, "ghijklmno", "p");
+	TEST_UART2(ProcessRx)();
+	CheckReceived("ghijklmnop", 2);
+
+	/* Data of the second UART is not returned by USART1 and vice versa, both are processed while waiting */
+	WE_UART1_SetRxMode(WE_UART_RxMode_Pull);
+	ReceiveOn(STM32Host_RxUart_2, "two");
+	Receive("one");
+	CheckPeek("one", "");
+	CheckSpans(TEST_UART2(RxPeek)(spans), spans, "two", "");
+	WE_Delay(1);
+	TEST_CHECK_MSG(receivedLength == 6 && handlerCalls == 2, "%.*s", (int) receivedLength, received);
+	ResetReceived();
+
+	TEST_CHECK(TEST_UART2(DeInit)());
+	TEST_CHECK(STM32Host_Receive(STM32Host_RxUart_2, (const uint8_t*) "lost", 4, true) == 0);
+	TEST_CHECK(handlerCalls == 0);
+}
+
+/**
+ * @brief Checks the DMA receive buffer statistics of USART1.
+ */
+static void CheckStatistics(uint32_t dmaRxOverflows, uint16_t dmaRxPeakFill)
+{
+	WE_UART_Statistics_t statistics;
+	TEST_CHECK(WE_UART_GetStatistics(WE_UART_Instance_1, &statistics));
+	TEST_CHECK_MSG(statistics.dmaRxOverflows == dmaRxOverflows && statistics.dmaRxPeakFill == dmaRxPeakFill, "%u overflows, peak fill %u", statistics.dmaRxOverflows,
+			statistics.dmaRxPeakFill);
+}
+
+/**
+ * @brief Checks that the unconsumed data of USART1 (possibly split into two spans) is the expected data, consumes it.
+ */
+static void CheckUnconsumed(const char *expected)
+{
+	WE_UART_Segment_t spans[2];
+	char data[TEST_RX_BUFFER_SIZE + 1];
+	uint16_t length = WE_UART1_RxPeek(spans);
+	TEST_CHECK(length == strlen(expected) && length <= TEST_RX_BUFFER_SIZE);
+	if (length <= TEST_RX_BUFFER_SIZE)
+	{
+		memcpy(data, spans[0].data, spans[0].length);
+		memcpy(&data[spans[0].length], spans[1].data, spans[1].length);
+		data[length] = '\0';
+		TEST_CHECK_MSG(strcmp(data, expected) == 0, "%s", data);
+	}
+	WE_UART1_RxConsume(length);
+}
+
+static void TestStatistics()
+{
+	/* Buffer of TEST_RX_BUFFER_SIZE bytes, nothing unconsumed (see TestSecondUart()) */
+	WE_UART1_SetRxMode(WE_UART_RxMode_Pull);
+	TEST_CHECK(WE_UART_ResetStatistics(WE_UART_Instance_1));
+	CheckStatistics(0, 0);
+
+	/* Peak fill is the max. number of unconsumed bytes */
+	Receive("0123456789");
+	CheckStatistics(0, 10);
+	WE_UART1_RxConsume(4);
+	Receive("abc");
+	CheckStatistics(0, 10);
+	WE_UART1_ProcessRx();
+	Receive("ABCDEFGHIJKL");
+	CheckStatistics(0, 12);
+	CheckUnconsumed("ABCDEFGHIJKL");
+	ResetReceived();
+
+	/* Ring is overrun: counted once, only the bytes written after the write position
+	 * has passed the read position are still available */
+	Receive("abcdefghijklmnopqrst");
+	CheckStatistics(1, TEST_RX_BUFFER_SIZE);
+	CheckUnconsumed("qrst");
+	Receive("uvwxy");
+	CheckStatistics(1, TEST_RX_BUFFER_SIZE);
+	CheckUnconsumed("uvwxy");
+
+	/* Overrun by more than three times the buffer size: counted on each DMA receive event
+	 * (write position 5, half-transfer / transfer complete after 3, 11, ..., 43 bytes,
+	 * idle line after 50 bytes) at which the buffer has been overrun since the last one */
+	Receive("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMN");
+	CheckStatistics(4, TEST_RX_BUFFER_SIZE);
+	CheckUnconsumed("MN");
+
+	/* Counting restarts, the write position is kept */
+	TEST_CHECK(WE_UART_ResetStatistics(WE_UART_Instance_1));
+	CheckStatistics(0, 0);
+	Receive("xyz");
+	CheckStatistics(0, 3);
+	CheckUnconsumed("xyz");
+	TEST_CHECK(handlerCalls == 0);
+}
+
+/**
+ * @brief Receives chunks of data, returns the time spent in interrupt context.
+ *
+ * @param[in] chunkCount Number of chunks to be received
+ * @param[in] processInterval Number of chunks after which WE_UART1_ProcessRx() is called (pull mode only)
+ */
+static uint64_t RunChunks(uint32_t chunkCount, uint32_t processInterval)
+{
+	uint8_t chunk[TEST_BENCH_CHUNK_SIZE];
+	memset(chunk, 'x', sizeof(chunk));
+
+	uint64_t irqTimeNs = STM32Host_GetIrqTimeNs();
+	for (uint32_t i = 0; i < chunkCount; i++)
+	{
+		STM32Host_Receive(STM32Host_RxUart_1, chunk, sizeof(chunk), true);
+		if ((processInterval > 0) && ((i + 1) % processInterval == 0))
+		{
+			WE_UART1_ProcessRx();
+		}
+	}
+	WE_UART1_ProcessRx();
+	return STM32Host_GetIrqTimeNs() - irqTimeNs;
+}
+
+static void TestInterruptTime()
+{
+	const uint32_t chunkCount = TestBenchIterations(200);
+	const uint32_t overflowInterval = 2 * TEST_BENCH_BUFFER_SIZE / TEST_BENCH_CHUNK_SIZE;
+	WE_UART_Statistics_t pushStatistics, pullStatistics, lateStatistics;
+
+	TEST_CHECK(WE_UART1_DeInit());
+	TEST_CHECK(WE_UART1_SetRxBuffer(STM32Host_SramAlloc(TEST_BENCH_BUFFER_SIZE), TEST_BENCH_BUFFER_SIZE, WE_UART_RxBufferMode_Circular));
+	TEST_CHECK(WE_UART1_Init(TEST_BAUDRATE, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+	handlerWorkUsec = TEST_HANDLER_WORK_USEC;
+
+	WE_UART1_SetRxMode(WE_UART_RxMode_Push);
+	WE_UART_ResetStatistics(WE_UART_Instance_1);
+	ResetReceived();
+	uint64_t pushNs = RunChunks(chunkCount, 0);
+	WE_UART_GetStatistics(WE_UART_Instance_1, &pushStatistics);
+	TEST_CHECK(receivedLength == chunkCount * TEST_BENCH_CHUNK_SIZE);
+
+	/* Application fetches the data after each chunk */
+	WE_UART1_SetRxMode(WE_UART_RxMode_Pull);
+	WE_UART_ResetStatistics(WE_UART_Instance_1);
+	ResetReceived();
+	uint64_t pullNs = RunChunks(chunkCount, 1);
+	WE_UART_GetStatistics(WE_UART_Instance_1, &pullStatistics);
+	TEST_CHECK(receivedLength == chunkCount * TEST_BENCH_CHUNK_SIZE);
+
+	/* Application fetches the data after twice the buffer size has been received */
+	WE_UART_ResetStatistics(WE_UART_Instance_1);
+	ResetReceived();
+	RunChunks(chunkCount, overflowInterval);
+	WE_UART_GetStatistics(WE_UART_Instance_1, &lateStatistics);
+	handlerWorkUsec = 0;
+
+	printf("Received %u chunks of %u bytes (DMA buffer %u bytes, rx byte handler busy %u us per call):\n", chunkCount, TEST_BENCH_CHUNK_SIZE, TEST_BENCH_BUFFER_SIZE, TEST_HANDLER_WORK_USEC);
+	printf("  push mode:                      %8.1f us in interrupt context per chunk, %u overruns, %u DMA buffer overflows\n", pushNs / 1e3 / chunkCount,
+			pushStatistics.overrunErrors, pushStatistics.dmaRxOverflows);
+	printf("  pull mode, fetched every chunk: %8.1f us in interrupt context per chunk, %u overruns, %u DMA buffer overflows\n", pullNs / 1e3 / chunkCount,
+			pullStatistics.overrunErrors, pullStatistics.dmaRxOverflows);
+	printf("  pull mode, fetched every %2u chunks:                                       %u overruns, %u DMA buffer overflows\n", overflowInterval,
+			lateStatistics.overrunErrors, lateStatistics.dmaRxOverflows);
+
+	/* Handler is no longer executed in interrupt context */
+	TEST_CHECK_MSG(pullNs < pushNs / 4, "push %.1f us, pull %.1f us", pushNs / 1e3, pullNs / 1e3);
+	TEST_CHECK(pushStatistics.dmaRxOverflows == 0 && pullStatistics.dmaRxOverflows == 0);
+	TEST_CHECK(lateStatistics.dmaRxOverflows > 0);
+}
+
+int main()
+{
+	if (!STM32Host_Init())
+	{
+		return EXIT_FAILURE;
+	}
+
+	uint8_t *rxBuffer = STM32Host_SramAlloc(TEST_RX_BUFFER_SIZE);
+	TEST_CHECK(WE_UART1_SetRxBuffer(rxBuffer, TEST_RX_BUFFER_SIZE, WE_UART_RxBufferMode_Circular));
+	TEST_CHECK(WE_UART1_Init(TEST_BAUDRATE, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+
+	TestPush();
+	TestPull();
+	TestReentrancy();
+	TestSetRxBuffer();
+	TestDoubleBuffer();
+	TestSecondUart();
+	TestStatistics();
+	TestInterruptTime();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,117 @@
+/**
+ * \file
+ * \brief Measures the CPU blocking time of WE_UART1_TransmitAsync() on the STM32 platform files.
+ *
+ * global_F4xx.c / global_L0xx.c are run against the peripheral stand-in in stm32_host/
+ * (DMA enabled). The asynchronous transmission is expected to return after setting up the
+ * DMA transfer, while WE_UART1_Transmit() blocks for the duration of the transfer.
+ */
+
+#include "global/global.h"
+
+#include "stm32_host/stm32_host.h"
+
+#include "test.h"
+
+#define TEST_BAUDRATE 115200
+#define TEST_PAYLOAD_SIZE 1024
+
+static volatile uint32_t txCompleteCount = 0;
+
+static void OnTxComplete()
+{
+	txCompleteCount++;
+}
+
+static void RxHandler(uint8_t *data, size_t length)
+{
+	(void) data;
+	(void) length;
+}
+
+static WE_UART_HandleRxByte_t rxHandler = RxHandler;
+
+/**
+ * @brief Checks that the data captured by the simulated USART equals the expected data.
+ */
+static void CheckTransmitted(const uint8_t *expected, size_t length)
+{
+	size_t transmittedLength;
+	const uint8_t *transmitted = STM32Host_GetTransmittedData(STM32Host_Uart_1, &transmittedLength);
+	TEST_CHECK_MSG(transmittedLength == length, "%zu bytes transmitted, %zu expected", transmittedLength, length);
+	TEST_CHECK(transmittedLength != length || memcmp(transmitted, expected, length) == 0);
+	STM32Host_ResetTransmittedData(STM32Host_Uart_1);
+}
+
+int main()
+{
+	if (!STM32Host_Init())
+	{
+		return EXIT_FAILURE;
+	}
+
+	TEST_CHECK(WE_UART1_Init(TEST_BAUDRATE, WE_FlowControl_NoFlowControl, WE_Parity_None, &rxHandler));
+	WE_UART1_SetTxCompleteCallback(OnTxComplete);
+	STM32Host_StartUart(STM32Host_Uart_1, TEST_BAUDRATE);
+
+	uint8_t *payload = STM32Host_SramAlloc(TEST_PAYLOAD_SIZE);
+	for (size_t i = 0; i < TEST_PAYLOAD_SIZE; i++)
+	{
+		payload[i] = (uint8_t) (i * 7 + 3);
+	}
+	const uint64_t transferNs = (uint64_t) TEST_PAYLOAD_SIZE * 10ULL * 1000000000ULL / TEST_BAUDRATE;
+
+	/* Asynchronous transmission: returns as soon as the DMA transfer has been started */
+	uint64_t start = TestGetTimeNs();
+	TEST_CHECK(WE_UART1_TransmitAsync(payload, TEST_PAYLOAD_SIZE));
+	uint64_t asyncBlockedNs = TestGetTimeNs() - start;
+	TEST_CHECK(WE_UART1_WaitForTxIdle(1000));
+	uint64_t asyncTotalNs = TestGetTimeNs() - start;
+	TEST_CHECK(txCompleteCount == 1);
+	CheckTransmitted(payload, TEST_PAYLOAD_SIZE);
+
+	/* Blocking transmission: returns when the last byte has been shifted out */
+	start = TestGetTimeNs();
+	TEST_CHECK(WE_UART1_Transmit(payload, TEST_PAYLOAD_SIZE));
+	uint64_t syncBlockedNs = TestGetTimeNs() - start;
+	TEST_CHECK(txCompleteCount == 2);
+	CheckTransmitted(payload, TEST_PAYLOAD_SIZE);
+
+	/* A second asynchronous transmission waits for the previous one to complete */
+	start = TestGetTimeNs();
+	TEST_CHECK(WE_UART1_TransmitAsync(payload, TEST_PAYLOAD_SIZE / 2));
+	TEST_CHECK(WE_UART1_TransmitAsync(payload + TEST_PAYLOAD_SIZE / 2, TEST_PAYLOAD_SIZE / 2));
+	uint64_t backToBackBlockedNs = TestGetTimeNs() - start;
+	TEST_CHECK(WE_UART1_WaitForTxIdle(1000));
+	TEST_CHECK(txCompleteCount == 4);
+	CheckTransmitted(payload, TEST_PAYLOAD_SIZE);
+
+	/* Scatter-gather transmission (segments are sent as one stream, returns when complete) */
+	WE_UART_Segment_t segments[] = {
+			{
+					.data = payload,
+					.length = 10 },
+			{
+					.data = payload + 10,
+					.length = 0 },
+			{
+					.data = payload + 10,
+					.length = 90 } };
+	TEST_CHECK(WE_UART1_TransmitV(segments, sizeof(segments) / sizeof(segments[0])));
+	CheckTransmitted(payload, 100);
+
+	STM32Host_Stop();
+
+	printf("%u bytes at %u baud (transfer time %.1f ms):\n", TEST_PAYLOAD_SIZE, TEST_BAUDRATE, transferNs / 1e6);
+	printf("  WE_UART1_TransmitAsync() blocked %10.1f us (until complete: %.1f ms)\n", asyncBlockedNs / 1e3, asyncTotalNs / 1e6);
+	printf("  WE_UART1_Transmit() blocked      %10.1f us\n", syncBlockedNs / 1e3);
+	printf("  2nd WE_UART1_TransmitAsync() blocked %6.1f us (waits for 1st transfer of %.1f ms)\n", backToBackBlockedNs / 1e3, transferNs / 2e6);
+
+	/* The CPU must not be blocked for a noticeable part of the transfer time */
+	TEST_CHECK_MSG(asyncBlockedNs < transferNs / 20, "%.1f us", asyncBlockedNs / 1e3);
+	TEST_CHECK_MSG(asyncTotalNs >= transferNs * 9 / 10, "%.1f ms", asyncTotalNs / 1e6);
+	TEST_CHECK_MSG(syncBlockedNs >= transferNs * 9 / 10, "%.1f ms", syncBlockedNs / 1e6);
+	TEST_CHECK_MSG(backToBackBlockedNs >= transferNs / 2 * 9 / 10, "%.1f ms", backToBackBlockedNs / 1e6);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,85 @@
+/**
+ * \file
+ * \brief Tests WE_WaitForEvent() and measures the confirmation latency and CPU time of synchronous Calypso requests.
+ *
+ * Waiting for a confirmation using WE_WaitForEvent() (waitTimeStepUsec > 0) is compared with
+ * busy polling (waitTimeStepUsec = 0). Both are expected to see the confirmation without
+ * a delay, but only busy polling keeps the CPU busy while waiting.
+ */
+
+#include "Calypso/Calypso.h"
+#include "global/global.h"
+
+#include "sim/calypso_sim.h"
+
+#include "test.h"
+
+#define TEST_REQUESTS 200
+#define TEST_RESPONSE_DELAY_USEC 500
+
+typedef struct
+{
+	uint64_t latencyNs;
+	uint64_t cpuNs;
+} RequestStatistics_t;
+
+static void TestWaitForEvent()
+{
+	volatile bool flag = true;
+	uint64_t start = TestGetTimeNs();
+	TEST_CHECK(WE_WaitForEvent(&flag, 1000));
+	TEST_CHECK(TestGetTimeNs() - start < 10000000ULL);
+
+	flag = false;
+	start = TestGetTimeNs();
+	TEST_CHECK(!WE_WaitForEvent(&flag, 20));
+	uint64_t elapsedNs = TestGetTimeNs() - start;
+	TEST_CHECK_MSG(elapsedNs >= 20000000ULL && elapsedNs < 200000000ULL, "%.1f ms", elapsedNs / 1e6);
+}
+
+/**
+ * @brief Sends requests to the simulated module and measures the time until the confirmation has been seen.
+ */
+static RequestStatistics_t RunRequests(uint32_t waitTimeStepUsec)
+{
+	Calypso_SetTimingParameters(waitTimeStepUsec, 0);
+
+	RequestStatistics_t statistics = {
+			0 };
+	char request[] = "AT+test\r\n";
+	for (int i = 0; i < TEST_REQUESTS; i++)
+	{
+		uint64_t start = TestGetTimeNs();
+		uint64_t cpuStart = TestGetThreadCpuTimeNs();
+		bool ok = Calypso_SendRequest(request) && Calypso_WaitForConfirm(1000, Calypso_CNFStatus_Success, NULL);
+		statistics.cpuNs += TestGetThreadCpuTimeNs() - cpuStart;
+		statistics.latencyNs += TestGetTimeNs() - start;
+		TEST_CHECK(ok);
+	}
+	statistics.latencyNs /= TEST_REQUESTS;
+	statistics.cpuNs /= TEST_REQUESTS;
+	return statistics;
+}
+
+int main()
+{
+	TestWaitForEvent();
+
+	TEST_CHECK(CalypsoSim_Init(NULL));
+	CalypsoSim_SetResponseDelay(TEST_RESPONSE_DELAY_USEC);
+
+	RequestStatistics_t waiting = RunRequests(5 * 1000);
+	RequestStatistics_t polling = RunRequests(0);
+	TEST_CHECK(CalypsoSim_GetCommandCount() == 2 * TEST_REQUESTS);
+
+	printf("Request/confirmation round trip (module response delay %u us):\n", TEST_RESPONSE_DELAY_USEC);
+	printf("  WE_WaitForEvent() (5 ms step): %8.1f us latency, %8.1f us CPU per request\n", waiting.latencyNs / 1e3, waiting.cpuNs / 1e3);
+	printf("  busy polling:                  %8.1f us latency, %8.1f us CPU per request\n", polling.latencyNs / 1e3, polling.cpuNs / 1e3);
+
+	/* The confirmation must be seen without waiting for the next time step */
+	TEST_CHECK_MSG(waiting.latencyNs < TEST_RESPONSE_DELAY_USEC * 1000ULL + 2000000ULL, "%.1f us", waiting.latencyNs / 1e3);
+	/* Sleeping while waiting must save most of the CPU time */
+	TEST_CHECK_MSG(waiting.cpuNs * 2 < polling.cpuNs, "%.1f us vs. %.1f us", waiting.cpuNs / 1e3, polling.cpuNs / 1e3);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+#
+# This file is part of WIRELESS CONNECTIVITY SDK for STM32.
+#
+# COPYRIGHT (c) 2023 Wurth Elektronik eiSos GmbH & Co. KG
+#
+# Decodes the binary debug log output of the SDK (WE_DEBUG_BINARY, see global/debug.c).
+#
+# Each log record contains a timestamp, the address of the format string and the raw
+# arguments. The format strings are read from the application's ELF file.
+#
+# Usage:
+#   we_log_decode.py firmware.elf /dev/ttyACM0 [--baud 115200]
+#   we_log_decode.py firmware.elf captured.bin
+#
+# Requires pyelftools (and pyserial for reading from a serial port).
+
+import argparse
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diuoxXcfFeEgGaAspn%])')
+
+
+class FormatStrings:
+    """Reads null-terminated strings from the allocated sections of an ELF file."""
+
+    def __init__(self, path):
+        self.sections = []
+        self.cache = {}
+        with open(path, 'rb') as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                if section['sh_flags'] & 0x2 and section['sh_type'] != 'SHT_NOBITS':
+                    self.sections.append((section['sh_addr'], section.data()))
+
+    def get(self, address):
+        if address not in self.cache:
+            self.cache[address] = None
+            for start, data in self.sections:
+                if start <= address < start + len(data):
+                    end = data.find(b'\0', address - start)
+                    self.cache[address] = data[address - start:end].decode('latin-1')
+                    break
+        return self.cache[address]
+
+
+def cobs_decode(frame):
+    out = bytearray()
+    pos = 0
+    while pos < len(frame):
+        code = frame[pos]
+        if code == 0 or pos + code > len(frame):
+            raise ValueError('invalid COBS frame')
+        out += frame[pos + 1:pos + code]
+        pos += code
+        if code < 0xFF and pos < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+class Arguments:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def take(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.pos + size > len(self.data):
+            raise EOFError()
+        value, = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += size
+        return value
+
+    def take_string(self):
+        length = self.take('<B')
+        if self.pos + length > len(self.data):
+            raise EOFError()
+        value = self.data[self.pos:self.pos + length].decode('latin-1')
+        self.pos += length
+        return value
+
+
+def format_record(fmt, data):
+    """Formats the arguments of a record according to the printf() format string."""
+    args = Arguments(data)
+    out = []
+    last = 0
+    try:
+        for match in CONVERSION.finditer(fmt):
+            out.append(fmt[last:match.start()])
+            last = match.end()
+            flags, width, precision, length, conversion = match.groups()
+            if conversion == '%':
+                out.append('%')
+                continue
+            if width == '*':
+                width = str(args.take('<i'))
+            if precision == '*':
+                precision = str(args.take('<i'))
+            spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+            if conversion in 'diuoxXc':
+                if length in ('ll', 'j'):
+                    value = args.take('<q' if conversion in 'di' else '<Q')
+                else:
+                    value = args.take('<i' if conversion in 'di' else '<I')
+                    bits = {'h': 16, 'hh': 8}.get(length)
+                    if bits is not None:
+                        value &= (1 << bits) - 1
+                        if conversion in 'di' and value >= 1 << (bits - 1):
+                            value -= 1 << bits
+                out.append((spec + {'u': 'd', 'i': 'd'}.get(conversion, conversion)) % value)
+            elif conversion in 'fFeEgGaA':
+                value = args.take('<d')
+                out.append((spec + {'a': 'e', 'A': 'E'}.get(conversion, conversion)) % value)
+            elif conversion == 's':
+                out.append((spec + 's') % args.take_string())
+            elif conversion == 'p':
+                out.append('0x%08x' % args.take('<I'))
+        out.append(fmt[last:])
+    except EOFError:
+        out.append('[truncated]')
+    return ''.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode binary debug log output of the WE Wireless Connectivity SDK.')
+    parser.add_argument('elf', help='ELF file of the application')
+    parser.add_argument('input', help='serial port or file containing the captured output ("-" for stdin)')
+    parser.add_argument('--baud', type=int, default=115200, help='baud rate of serial port')
+    options = parser.parse_args()
+
+    strings = FormatStrings(options.elf)
+
+    if options.input == '-':
+        source = sys.stdin.buffer
+    elif options.input.startswith('/dev/') or options.input.upper().startswith('COM'):
+        import serial
+        source = serial.Serial(options.input, options.baud)
+    else:
+        source = open(options.input, 'rb')
+
+    frame = bytearray()
+    line_start = True
+    synchronized = False
+    while True:
+        chunk = source.read(1)
+        if not chunk:
+            break
+        if chunk[0] != 0:
+            frame += chunk
+            continue
+
+        # Discard data received before the first delimiter (might start in the middle of a record)
+        if not synchronized:
+            synchronized = True
+            frame.clear()
+            continue
+
+        try:
+            record = cobs_decode(bytes(frame))
+        except ValueError:
+            record = b''
+        frame.clear()
+        if len(record) < 8:
+            sys.stdout.write('[invalid record]\n')
+            line_start = True
+            continue
+
+        timestamp, address = struct.unpack_from('<II', record)
+        if address == 0:
+            text = record[8:].decode('latin-1')
+        else:
+            fmt = strings.get(address)
+            text = format_record(fmt, record[8:]) if fmt is not None else '[unknown format string 0x%08x]\n' % address
+
+        # Prefix each line with the timestamp (in seconds) of the record that started it
+        for part in text.splitlines(True):
+            if line_start:
+                sys.stdout.write('[%10.6f] ' % (timestamp / 1e6))
+            sys.stdout.write(part)
+            line_start = part.endswith('\n')
+        sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()